@@ -29,16 +29,15 @@
 #endif
 
 std::string
-Base64Encode(const std::vector<uint8>& src)
+Base64Encode(const uint8 *src, size_t srclen)
 {
 #if defined(USE_MBEDTLS)
 	// mbedTLS にあるのでそれを使う。
 
-	size_t dlen = ((src.size() + 2) / 3) * 4 + 1;
+	size_t dlen = ((srclen + 2) / 3) * 4 + 1;
 	std::vector<uint8> dst(dlen);
 	size_t olen;
-	mbedtls_base64_encode(dst.data(), dst.size(), &olen,
-		src.data(), src.size());
+	mbedtls_base64_encode(dst.data(), dst.size(), &olen, src, srclen);
 	return std::string((const char *)dst.data());
 #else
 	static const char enc[] =
@@ -47,9 +46,9 @@ Base64Encode(const std::vector<uint8>& src)
 		"0123456789+/";
 	std::vector<uint8> tmp;
 	std::string base64;
-	int i;
+	size_t i;
 
-	for (i = 0; src.size() - i >= 3; ) {
+	for (i = 0; srclen - i >= 3; ) {
 		// 0000'0011  1111'2222  2233'3333
 		uint8 a0 = src[i++];
 		uint8 a1 = src[i++];
@@ -62,12 +61,12 @@ Base64Encode(const std::vector<uint8>& src)
 	}
 
 	// 残りは 0,1,2バイト
-	if (src.size() - i == 1) {
+	if (srclen - i == 1) {
 		uint8 a0 = src[i++];
 
 		tmp.push_back(a0 >> 2);
 		tmp.push_back((a0 & 0x03) << 4);
-	} else if (src.size() - i == 2) {
+	} else if (srclen - i == 2) {
 		uint8 a0 = src[i++];
 		uint8 a1 = src[i++];
 
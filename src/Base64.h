@@ -29,4 +29,10 @@
 #include <string>
 #include <vector>
 
-std::string Base64Encode(const std::vector<uint8>& src);
+std::string Base64Encode(const uint8 *src, size_t srclen);
+
+static inline std::string
+Base64Encode(const std::vector<uint8>& src)
+{
+	return Base64Encode(src.data(), src.size());
+}
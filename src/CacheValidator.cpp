@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// キャッシュした画像の検証子
+//
+
+#include "CacheValidator.h"
+#include "HttpClient.h"
+#include "ImageCache.h"
+#include "StringUtil.h"
+
+// 応答ヘッダから検証子を取り出す。
+void
+CacheValidator::FromHeaders(const std::vector<std::string>& headers,
+	time_t now)
+{
+	etag = HttpClient::GetHeader(headers, "ETag");
+	last_modified = HttpClient::GetHeader(headers, "Last-Modified");
+	fetched = now;
+	max_age = DefaultMaxAge;
+
+	// Cache-Control: public, max-age=3600 のような形式。
+	// no-cache (と no-store) なら毎回確認する。
+	auto cc = HttpClient::GetHeader(headers, "Cache-Control");
+	for (const auto& item : Split(StringToLower(cc), ",")) {
+		auto directive = Chomp(item);
+		if (directive == "no-cache" || directive == "no-store") {
+			max_age = 0;
+			break;
+		}
+		if (StartWith(directive, "max-age=")) {
+			max_age = stou32def(directive.c_str() + 8, DefaultMaxAge);
+		}
+	}
+}
+
+// 鮮度期間内なら true を返す。
+bool
+CacheValidator::IsFresh(time_t now) const
+{
+	return now < (time_t)fetched + max_age;
+}
+
+// http に条件付きリクエストのヘッダを追加する。
+void
+CacheValidator::AddConditionalHeaders(HttpClient& http) const
+{
+	if (!etag.empty()) {
+		http.AddHeader("If-None-Match: " + etag);
+	}
+	if (!last_modified.empty()) {
+		http.AddHeader("If-Modified-Since: " + last_modified);
+	}
+}
+
+// 条件付きリクエストの応答を反映する。
+bool
+CacheValidator::Update(const HttpClient& http, time_t now)
+{
+	if (http.ResultCode == 304) {
+		// 304 にも新しい検証子や max-age が付いていることがある。
+		CacheValidator v;
+		v.FromHeaders(http.RecvHeaders, now);
+		if (!v.etag.empty()) {
+			etag = v.etag;
+		}
+		if (!v.last_modified.empty()) {
+			last_modified = v.last_modified;
+		}
+		max_age = v.max_age;
+		fetched = now;
+		return true;
+	}
+
+	FromHeaders(http.RecvHeaders, now);
+	return false;
+}
+
+// 保存用の形式に変換する。
+// "<fetched> <max_age>\n<etag>\n<last_modified>\n" の形式。
+// ヘッダの値は改行を含まないのでこれで区切れる。
+std::string
+CacheValidator::Serialize() const
+{
+	return string_format("%u %u\n%s\n%s\n", fetched, max_age,
+		etag.c_str(), last_modified.c_str());
+}
+
+// 保存用の形式から復元する。
+bool
+CacheValidator::Deserialize(const uint8 *data, size_t len)
+{
+	std::string s((const char *)data, len);
+	auto lines = Split(s, "\n");
+	if (lines.size() < 1) {
+		return false;
+	}
+
+	char *ep;
+	auto [ f, ferr ] = stou32(lines[0].c_str(), &ep);
+	if (ferr || *ep != ' ') {
+		return false;
+	}
+	auto [ m, merr ] = stou32(ep + 1);
+	if (merr) {
+		return false;
+	}
+	fetched = f;
+	max_age = m;
+	etag = (lines.size() > 1) ? lines[1] : "";
+	last_modified = (lines.size() > 2) ? lines[2] : "";
+	return true;
+}
+
+// key の検証子を cache から読み込む。
+// なければ false を返す。
+bool
+CacheValidator::Load(ImageCache& cache, const std::string& key)
+{
+	const uint8 *data;
+	size_t len;
+
+	if (cache.Lookup("val-" + key, &data, &len) == false) {
+		return false;
+	}
+	return Deserialize(data, len);
+}
+
+// key の検証子を cache に保存する。
+void
+CacheValidator::Store(ImageCache& cache, const std::string& key) const
+{
+	if (CanRevalidate()) {
+		auto str = Serialize();
+		cache.Store("val-" + key, str.data(), str.size());
+	} else {
+		// 検証子がなければ問い合わせようがないので持っていても仕方ない。
+		cache.Remove("val-" + key);
+	}
+}
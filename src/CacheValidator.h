@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include <string>
+#include <vector>
+#include <ctime>
+
+class HttpClient;
+class ImageCache;
+
+//
+// キャッシュした画像の検証子
+//
+// 画像を取得した時の応答ヘッダの ETag、Last-Modified、
+// Cache-Control: max-age を覚えておき、鮮度期間を過ぎたら
+// If-None-Match / If-Modified-Since 付きで問い合わせる。
+// 304 が返ってくれば手元のキャッシュをそのまま使い続けられる。
+class CacheValidator
+{
+ public:
+	// max-age の指定がない時の鮮度期間 [秒]
+	static const uint32 DefaultMaxAge = 24 * 60 * 60;
+
+	// 応答ヘッダから検証子を取り出す。now は取得時刻。
+	void FromHeaders(const std::vector<std::string>& headers, time_t now);
+
+	// 鮮度期間内なら true を返す。
+	bool IsFresh(time_t now) const;
+
+	// 条件付きリクエストが出来るなら true を返す。
+	bool CanRevalidate() const {
+		return !etag.empty() || !last_modified.empty();
+	}
+
+	// 同じ内容に対する検証子なら true を返す。
+	bool SameAs(const CacheValidator& other) const {
+		return CanRevalidate() &&
+			etag == other.etag && last_modified == other.last_modified;
+	}
+
+	// http に条件付きリクエストのヘッダを追加する。
+	void AddConditionalHeaders(HttpClient& http) const;
+
+	// 条件付きリクエストの応答を反映する。
+	// 304 なら取得時刻を now に更新して true を返す。
+	// それ以外なら (新しい内容が返ってきたので) 応答ヘッダから
+	// 検証子を取り直して false を返す。
+	bool Update(const HttpClient& http, time_t now);
+
+	// 保存用の形式に変換する、またその逆。
+	std::string Serialize() const;
+	bool Deserialize(const uint8 *data, size_t len);
+
+	// key の検証子を cache から読み込む。なければ false を返す。
+	bool Load(ImageCache& cache, const std::string& key);
+
+	// key の検証子を cache に保存する。
+	// 問い合わせに使えない検証子なら、保存してあるものを消す。
+	void Store(ImageCache& cache, const std::string& key) const;
+
+	std::string etag {};
+	std::string last_modified {};
+	uint32 fetched {};		// 取得 (または確認) した時刻
+	uint32 max_age {};		// 鮮度期間 [秒]
+};
@@ -25,26 +25,39 @@
 
 #include "sayaka.h"
 #include "Display.h"
-#include "FileStream.h"
+#include "Base64.h"
+#include "CacheValidator.h"
 #include "HttpClient.h"
+#include "Image.h"
+#include "ImageCache.h"
+#include "ImageSource.h"
 #include "JsonInc.h"
+#include "KittyImageCache.h"
+#include "LineWrapper.h"
 #include "MathAlphaSymbols.h"
 #include "MemoryStream.h"
+#include "NegativeCache.h"
+#include "NoteHistory.h"
+#include "RenderBuffer.h"
+#include "SixelHotCache.h"
 #include "SixelConverter.h"
+#include "StageStat.h"
 #include "StringUtil.h"
 #include "UString.h"
 #include "autofd.h"
-#include "eaw_code.h"
 #include "subr.h"
 #include "term.h"
+#include <condition_variable>
 #include <ctime>
-
-#if !defined(PATH_SEPARATOR)
-#define PATH_SEPARATOR "/"
-#endif
+#include <cstdarg>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sys/uio.h>
 
 // 色定数
 static const std::string BOLD		= "1";
+static const std::string ITALIC		= "3";
 static const std::string UNDERSCORE	= "4";
 static const std::string STRIKE		= "9";
 static const std::string BLACK		= "30";
@@ -63,10 +76,54 @@ static const std::string YELLOW		= "93";
 
 static std::string str_join(const std::string& sep,
 	const std::string& s1, const std::string& s2);
-static bool fetch_image(FileStream& outstream,
-	const std::string& img_url, int resize_width);
+
+static void output_nohistory(const std::string& str);
+static void show_icon(const std::function<bool()>& callback);
+static FetchResult get_source(MemoryStream& src, CacheValidator *valp,
+	const std::string& img_url, time_t now,
+	std::unique_lock<std::mutex> *lockp = NULL);
+static FetchResult get_source_data(const uint8 **datap, size_t *lenp,
+	std::vector<uint8>& body, CacheValidator *valp,
+	const std::string& img_url, time_t now,
+	std::unique_lock<std::mutex> *lockp = NULL);
+static FetchResult fetch_source(std::vector<uint8>& body,
+	NegativeCache::Reason *reasonp, CacheValidator *valp,
+	const std::string& img_url);
+static bool show_kitty(const std::string& img_file,
+	const std::string& img_url, int resize_width, int index);
+static bool show_iterm2(const std::string& img_url, int resize_width,
+	int index);
+static void image_position(int width, int height, int index,
+	std::string *prep, std::string *postp);
+static void put_image(const uint8 *data, size_t len, int width, int height,
+	int index);
+static bool load_image(SixelConverter& sx, NegativeCache::Reason *reasonp,
+	MemoryStream& src, const std::string& img_url, int resize_width);
+static bool convert_image(Stream& outstream, NegativeCache::Reason *reasonp,
+	MemoryStream& src, const std::string& img_url, int resize_width);
+static bool convert_rgb(std::vector<uint8>& dst, int *widthp, int *heightp,
+	NegativeCache::Reason *reasonp,
+	MemoryStream& src, const std::string& img_url, int resize_width);
 
 static std::array<UString, Color::Max> color2esc;	// 色エスケープ文字列
+static std::array<UString, Color::Max> colorbegin;	// 属性付け開始文字列
+static UString colorend;							// 属性付け終了文字列
+
+// 他のプロセスが同じ画像を取得し終わるのを待つ最大時間 [msec]
+static const int SINGLE_FLIGHT_TIMEOUT = 15 * 1000;
+
+// 画像キャッシュ (imagecache, srccache, negcache, hotcache, kittycache) は
+// 並列再生のワーカーからも使うので、触る間はこれを持っておくこと。
+// Lookup() で得た領域は他の操作で動くことがあるので、使い終わるまで持つ。
+// ImageCache::KeyLock はプロセス間のロックでスレッド同士は排他しないため、
+// 取得、変換中のキーは cache_inflight で覚えておく。通信中はこれを離すので
+// 表示側もワーカーと同じく印を付けてから get_source() を呼ぶこと。
+static std::mutex cache_mtx;
+static std::condition_variable cache_cv;
+static std::set<std::string> cache_inflight;
+
+// 1ノート分の出力を溜めておくバッファ
+static RenderBuffer render;
 
 void
 init_color()
@@ -140,6 +197,23 @@ init_color()
 	color2esc[Color::Verified]	= UString(verified);
 	color2esc[Color::Protected]	= UString(gray);
 	color2esc[Color::NG]		= UString(str_join(";", STRIKE, gray));
+
+	// MFM の装飾。
+	color2esc[Color::Bold]		= UString(BOLD);
+	color2esc[Color::Italic]	= UString(ITALIC);
+	color2esc[Color::Strike]	= UString(STRIKE);
+	color2esc[Color::Small]		= UString(gray);
+
+	// 属性付けの開始と終了の文字列は何度も使うので作っておく。
+	// --no-color なら一切属性を付けない。
+	if (opt_nocolor == false) {
+		for (int col = 0; col < Color::Max; col++) {
+			colorbegin[col] = UString(CSI);
+			colorbegin[col].Append(color2esc[col]);
+			colorbegin[col].Append('m');
+		}
+		colorend = UString(CSI "0m");
+	}
 }
 
 // 文字列 s1 と s2 を sep で結合した文字列を返す。
@@ -161,20 +235,112 @@ str_join(const std::string& sep, const std::string& s1, const std::string& s2)
 	}
 }
 
-// UString をインデントを付けて文字列を表示する
+// 1ノート分の出力を溜め始める。
+// EndRender() までの output()、print_()、ShowIcon()、ShowImage() の
+// 出力はバッファに溜まり、EndRender() で一度に書き出す。
+void
+BeginRender()
+{
+	// それまでに stdio に溜まっている分を先に出しておく。
+	fflush(stdout);
+	render.Begin(use_syncout);
+	history.Begin();
+}
+
+// 溜めた1ノート分の出力を書き出す。
+void
+EndRender()
+{
+	if (render.IsActive() == false) {
+		return;
+	}
+	history.End();
+	bool ok;
+	{
+		StageTimer timer(Stage::Output);
+		ok = render.End(STDOUT_FILENO, &in_sixel);
+	}
+	if (ok == false) {
+		Debug(diag, "%s: write: %s", __func__, strerrno());
+	}
+	StageStat::Count(Counter::BytesOut, render.GetBytes());
+	Debug(diag, "%s: %zu bytes in %d write(s)", __func__,
+		render.GetBytes(), render.GetWrites());
+}
+
+// 文字列を出力する。
+// BeginRender() 以降ならバッファに溜め、そうでなければ stdout に出力する。
+void
+output(const std::string& str)
+{
+	history.AddRaw(str);
+	output_nohistory(str);
+}
+
+// 文字列を出力する。出力先は output() と同じだが、履歴には記録しない。
+static void
+output_nohistory(const std::string& str)
+{
+	if (render.IsActive()) {
+		render.Append(str);
+	} else {
+		fputs(str.c_str(), stdout);
+	}
+}
+
+// 書式付きで文字列を出力する。出力先は output() と同じ。
+void
+outputf(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	if (__predict_false(history.IsRecording())) {
+		char *buf;
+		int r = vasprintf(&buf, fmt, ap);
+		if (r >= 0) {
+			history.AddRaw(buf, r);
+			render.Append(buf, r);
+			free(buf);
+		}
+	} else if (render.IsActive()) {
+		render.VPrintf(fmt, ap);
+	} else {
+		vprintf(fmt, ap);
+	}
+	va_end(ap);
+}
+
+// print_() の作業領域。呼ばれるたびに確保し直さないよう使い回す。
+static std::string print_buf;
+static UString print_ubuf;
+
+// UString をインデントを付けて文字列を表示する。
+// 文字単位のフィルタ (Stage1)、インデントと折り返し (Stage2)、
+// 出力文字コードへの変換を1回の走査で行う。
 void
 print_(const UString& src)
 {
+	StageTimer timer(Stage::Print);
+
+	history.AddText(indent_depth, src);
+
+	print_buf.clear();
+	bool to_jis = !output_codeset.empty();
+	LineWrapper out(print_buf, print_ubuf,
+		indent_cols * (indent_depth + 1), screen_cols, to_jis);
+	bool to_iso2022jp = (output_codeset == "iso-2022-jp");
+
 	// Stage1: Unicode 文字単位でいろいろフィルターかける。
-	UString utext;
 	for (const auto uni : src) {
 		// Private Use Area (外字) をコードポイント形式(?)にする
 		if (__predict_false((  0xe000 <= uni && uni <=   0xf8ff))	// BMP
 		 || __predict_false(( 0xf0000 <= uni && uni <=  0xffffd))	// 第15面
 		 || __predict_false((0x100000 <= uni && uni <= 0x10fffd))) 	// 第16面
 		{
-			auto tmp = string_format("<U+%X>", uni);
-			utext.AppendASCII(tmp);
+			char tmp[16];
+			snprintf(tmp, sizeof(tmp), "<U+%X>", uni);
+			out.PutASCII(tmp);
 			continue;
 		}
 
@@ -182,7 +348,7 @@ print_(const UString& src)
 		    opt_mathalpha == true)
 		{
 			// Mathematical Alphanumeric Symbols を全角英数字に変換
-			utext.Append(ConvMathAlpha(uni));
+			out.Put(ConvMathAlpha(uni));
 			continue;
 		}
 
@@ -193,241 +359,202 @@ print_(const UString& src)
 		// U+20E1 は「上に左右矢印を前の文字につける」で囲みではないが
 		// 面倒なので混ぜておく。なぜ間に入れたのか…。
 		if (__predict_false(0x20dd <= uni && uni <= 0x20e4) && opt_nocombine) {
-			utext.Append(0x20);
+			out.Put(0x20);
 		}
 
-		if (__predict_false(!output_codeset.empty())) {
+		if (__predict_false(to_jis)) {
 			// JIS/EUC-JP(/Shift-JIS) に変換する場合のマッピング
 			// 本当は変換先がこれらの時だけのほうがいいだろうけど。
 
 			// 全角チルダ(U+FF5E) -> 波ダッシュ(U+301C)
 			if (uni == 0xff5e) {
-				utext.Append(0x301c);
+				out.Put(0x301c);
 				continue;
 			}
 
 			// 全角ハイフンマイナス(U+FF0D) -> マイナス記号(U+2212)
 			if (uni == 0xff0d) {
-				utext.Append(0x2212);
+				out.Put(0x2212);
 				continue;
 			}
 
 			// BULLET (U+2022) -> 中黒(U+30FB)
 			if (uni == 0x2022) {
-				utext.Append(0x30fb);
+				out.Put(0x30fb);
 				continue;
 			}
 
 			// NetBSD/x68k なら半角カナは表示できる。
 			// XXX 正確には JIS という訳ではないのだがとりあえず
-			if (output_codeset == "iso-2022-jp") {
+			if (to_iso2022jp) {
 				if (__predict_false(0xff61 <= uni && uni < 0xffa0)) {
-					utext.AppendASCII(ESC "(I");
-					utext.Append(uni - 0xff60 + 0x20);
-					utext.AppendASCII(ESC "(B");
+					out.PutASCII(ESC "(I");
+					out.Put(uni - 0xff60 + 0x20);
+					out.PutASCII(ESC "(B");
 					continue;
 				}
 			}
 
 			// 変換先に対応する文字がなければゲタ'〓'(U+3013)にする
 			if (__predict_false(UString::IsUCharConvertible(uni) == false)) {
-				utext.Append(0x3013);
+				out.Put(0x3013);
 				continue;
 			}
 		}
 
-		utext.Append(uni);
-	}
-
-	if (0) {
-		for (int i = 0; i < utext.size(); i++) {
-			printf("print_[%d] %02x\n", i, utext[i]);
-		}
-	}
-
-	// Stage2: インデントつけていく。
-	UString utext2;
-	// インデント階層
-	auto left = indent_cols * (indent_depth + 1);
-	auto indent = UString(string_format(CSI "%dC", left));
-	utext2.Append(indent);
-
-	if (__predict_false(screen_cols == 0)) {
-		// 桁数が分からない場合は何もしない
-		utext2.Append(utext);
-	} else {
-		// 1文字ずつ文字幅を数えながら出力用に整形していく
-		int in_escape = 0;
-		auto x = left;
-		for (int i = 0, end = utext.size(); i < end; i++) {
-			const auto uni = utext[i];
-			if (__predict_false(in_escape > 0)) {
-				// 1: ESC直後
-				// 2: ESC [
-				// 3: ESC (
-				utext2.Append(uni);
-				switch (in_escape) {
-				 case 1:
-					// ESC 直後の文字で二手に分かれる
-					if (uni == '[') {
-						in_escape = 2;
-					} else {
-						in_escape = 3;	// 手抜き
-					}
-					break;
-				 case 2:
-					// ESC [ 以降 'm' まで
-					if (uni == 'm') {
-						in_escape = 0;
-					}
-					break;
-				 case 3:
-					// ESC ( の次の1文字だけ
-					in_escape = 0;
-					break;
-				}
-			} else {
-				if (uni == ESCchar) {
-					utext2.Append(uni);
-					in_escape = 1;
-				} else if (uni == '\n') {
-					utext2.Append(uni);
-					utext2.Append(indent);
-					x = left;
-				} else {
-					// 文字幅を取得
-					auto width = get_eaw_width(uni);
-					if (width == 1) {
-						utext2.Append(uni);
-						x++;
-					} else {
-						assert(width == 2);
-						if (x > screen_cols - 2) {
-							utext2.Append('\n');
-							utext2.Append(indent);
-							x = left;
-						}
-						utext2.Append(uni);
-						x += 2;
-					}
-				}
-				if (x > screen_cols - 1) {
-					utext2.Append('\n');
-					utext2.Append(indent);
-					x = left;
-				}
-			}
-
-			// デバッグ用
-			if (0) {
-				printf("[%d] U+%04x, x = %d", i, uni, x);
-				if (uni == ESCchar) {
-					printf(" ESC");
-				} else if (uni == '\n') {
-					printf(" '\\n'");
-				} else if (0x20 <= uni && uni < 0x7f) {
-					printf(" '%c'", uni);
-				}
-				printf("\n");
-			}
-		}
+		out.Put(uni);
 	}
+	out.Finish();
 
-	// 出力文字コードに変換
-	std::string outstr = utext2.ToString();
-	fputs(outstr.c_str(), stdout);
+	// 履歴には折り返す前の src を記録してある。
+	output_nohistory(print_buf);
 }
 
 // 属性付け開始文字列を UString で返す
-UString
+const UString&
 ColorBegin(Color col)
 {
-	UString esc;
-
-	if (__predict_false(opt_nocolor)) {
-		// --no-color なら一切属性を付けない
-	} else {
-		esc.AppendASCII(CSI);
-		esc.Append(color2esc[col]);
-		esc.Append('m');
-	}
-	return esc;
+	return colorbegin[col];
 }
 
 // 属性付け終了文字列を UString で返す
-UString
+const UString&
 ColorEnd(Color col)
 {
-	UString esc;
-
-	if (__predict_false(opt_nocolor)) {
-		// --no-color なら一切属性を付けない
-	} else {
-		esc.AppendASCII(CSI "0m");
-	}
-	return esc;
+	return colorend;
 }
 
 // 文字列 text を UString に変換して、色属性を付けた UString を返す
 UString
 coloring(const std::string& text, Color col)
 {
+	const UString& begin = ColorBegin(col);
+	const UString& end = ColorEnd(col);
 	UString utext;
 
-	utext += ColorBegin(col);
-	utext += UString::FromUTF8(text);
-	utext += ColorEnd(col);
+	utext.reserve(begin.size() + text.size() + end.size());
+	utext.Append(begin);
+	utext.AppendUTF8(text);
+	utext.Append(end);
 
 	return utext;
 }
 
 
+// 画面の大きさ (桁数やアイコンサイズ) に依存する出力を行う。
+// fn はその場で実行し、端末の大きさが変わった時に描き直せるよう
+// ノートの履歴にも記録しておく。
+// fn が参照するものは (キャッシュのキーにする URL など) 値で持っておくこと。
+void
+Draw(const std::function<void()>& fn)
+{
+	if (history.IsRecording()) {
+		history.AddDraw(indent_depth, fn);
+		// fn の中の出力は fn を再実行すれば再現できるので記録しない。
+		history.SetPaused(true);
+		fn();
+		history.SetPaused(false);
+	} else {
+		fn();
+	}
+}
+
+// 覚えているノートを今の画面の大きさで描き直す。
+// 画面を消去してから古い順に表示し直す。
+// アイコンサイズが変わっても元画像キャッシュから作り直すので
+// ダウンロードし直すことはない。
+void
+RedrawHistory()
+{
+	if (history.GetCount() == 0) {
+		return;
+	}
+	Debug(diag, "%s: %zu notes", __func__, history.GetCount());
+
+	// ノートの描画中には呼ばれないはずだが念のため。
+	if (__predict_false(render.IsActive())) {
+		return;
+	}
+
+	// 全体を1回で書き出す。描き直し中の出力は記録しない。
+	fflush(stdout);
+	render.Begin(use_syncout);
+	render.Append(CSI "H" CSI "2J");
+	int saved_depth = indent_depth;
+	for (const auto& note : history.GetNotes()) {
+		for (const auto& item : note) {
+			switch (item.type) {
+			 case NoteHistory::Item::Text:
+				indent_depth = item.depth;
+				print_(item.text);
+				break;
+			 case NoteHistory::Item::Raw:
+				render.Append(item.raw);
+				break;
+			 case NoteHistory::Item::Draw:
+				indent_depth = item.depth;
+				item.draw();
+				break;
+			}
+		}
+	}
+	indent_depth = saved_depth;
+	if (render.End(STDOUT_FILENO, &in_sixel) == false) {
+		Debug(diag, "%s: write: %s", __func__, strerrno());
+	}
+}
+
 // 現在行にアイコンを表示。
 // 呼び出し時点でカーソルは行頭にあるため、必要なインデントを行う。
 // アイコン表示後にカーソル位置を表示前の位置に戻す。
-// 実際のアイコン表示そのものはサービスごとに callback(user, userid) で行う。
-// userid はキャッシュファイルに使うユーザ名(アカウント名)文字列。
-// 呼び出し元ではすでに持ってるはずなので。
+// 実際のアイコン表示そのものはサービスごとに callback() で行う。
 // callback() はアイコンを表示できれば true を返すこと。
+// 描き直しの時にも呼ばれるので、必要なもの (URL やキャッシュファイルに
+// 使うユーザ名など) は値で持っておくこと。
 void
-ShowIcon(bool (*callback)(const Json&, const std::string&),
-	const Json& user, const std::string& userid)
+ShowIcon(const std::function<bool()>& callback)
+{
+	Draw([callback]() { show_icon(callback); });
+}
+
+// ShowIcon() の本体。
+static void
+show_icon(const std::function<bool()>& callback)
 {
 	if ((int)diagImage == 0) {
 		// 改行x3 + カーソル上移動x3 を行ってあらかじめスクロールを
 		// 発生させ、アイコン表示時にスクロールしないようにしてから
 		// カーソル位置を保存する
 		// (スクロールするとカーソル位置復元時に位置が合わない)
-		printf("\n\n\n" CSI "3A" ESC "7");
+		outputf("\n\n\n" CSI "3A" ESC "7");
 
 		// インデント。
 		// CSI."0C" は0文字でなく1文字になってしまうので、必要な時だけ。
 		if (indent_depth > 0) {
 			int left = indent_cols * indent_depth;
-			printf(CSI "%dC", left);
+			outputf(CSI "%dC", left);
 		}
 	}
 
 	bool shown = false;
 	if (__predict_true(use_sixel != UseSixel::No)) {
 		// ここがサービスごとに違う部分。
-		// user から実際に画像を表示する。
-		shown = callback(user, userid);
+		shown = callback();
 	}
 
 	if (__predict_true(shown)) {
 		if ((int)diagImage == 0) {
 			// アイコン表示後、カーソル位置を復帰
-			printf("\r");
+			outputf("\r");
 			// カーソル位置保存/復元に対応していない端末でも動作するように
 			// カーソル位置復元前にカーソル上移動x3を行う
-			printf(CSI "3A" ESC "8");
+			outputf(CSI "3A" ESC "8");
 		}
 	} else {
 		// アイコンを表示してない場合はここで代替アイコンを表示。
-		printf(" *");
+		outputf(" *");
 		// これだけで復帰できるはず
-		printf("\r");
+		outputf("\r");
 	}
 }
 
@@ -447,8 +574,153 @@ GetCacheFilename(const std::string& img_url)
 	return img_file;
 }
 
+// SIXEL の先頭付近から幅と高さを取得する。
+// 取得できれば true を返す。
+static bool
+parse_sixel_size(const uint8 *buf, size_t n, int *widthp, int *heightp)
+{
+	const char *s = (const char *)buf;
+	char *ep;
+	size_t i;
+
+	// 先頭付近しか見ないので、4KB もあれば十分。
+	n = std::min(n, (size_t)4096);
+	if (n < 32) {
+		return false;
+	}
+	// " <Pan>; <Pad>; <Ph>; <Pv>
+	// Search "
+	for (i = 0; i < n && s[i] != '\x22'; i++)
+		;
+	// Skip Pan;
+	for (i++; i < n && s[i] != ';'; i++)
+		;
+	// Skip Pad
+	for (i++; i < n && s[i] != ';'; i++)
+		;
+	// Ph
+	i++;
+	if (i >= n) {
+		return false;
+	}
+	int width = stou32def(s + i, -1, &ep);
+	if (width < 0) {
+		return false;
+	}
+	// Pv
+	i = ep - s;
+	i++;
+	if (i >= n) {
+		return false;
+	}
+	int height = stou32def(s + i, -1);
+	if (height < 0) {
+		return false;
+	}
+
+	*widthp = width;
+	*heightp = height;
+	return true;
+}
+
+// SIXEL を前後のカーソル移動と一緒に writev(2) で端末に書き出す。
+// sixel はキャッシュの mmap 領域を直接指しているので、stdio のバッファに
+// コピーすることなく (端末が受け付ければ) 1回のシステムコールで書ける。
+// 途中で SIGINT によって中断されたら (in_sixel が下ろされたら)
+// SIXEL の残りは捨てて、後ろのカーソル移動だけ書き出し、false を返す。
+static bool
+write_sixel(const std::string& pre, const uint8 *sixel, size_t sixel_len,
+	const std::string& post)
+{
+	struct iovec iov[3];
+	int nwrite = 0;
+	bool aborted = false;
+
+	// それまでに stdio に溜まっている分を先に出しておく。
+	fflush(stdout);
+
+	iov[0].iov_base = const_cast<char *>(pre.data());
+	iov[0].iov_len  = pre.size();
+	iov[1].iov_base = const_cast<uint8 *>(sixel);
+	iov[1].iov_len  = sixel_len;
+	iov[2].iov_base = const_cast<char *>(post.data());
+	iov[2].iov_len  = post.size();
+	const int iovcnt = sizeof(iov) / sizeof(iov[0]);
+
+	in_sixel = true;
+	for (int i = 0; i < iovcnt; ) {
+		if (iov[i].iov_len == 0) {
+			i++;
+			continue;
+		}
+		if (__predict_false(in_sixel == false) && i <= 1) {
+			// 中断されたので SIXEL の残りは捨てる。
+			i = 2;
+			aborted = true;
+			continue;
+		}
+
+		ssize_t n = writev(STDOUT_FILENO, &iov[i], iovcnt - i);
+		nwrite++;
+		if (__predict_false(n < 0)) {
+			if (errno == EINTR) {
+				continue;
+			}
+			Debug(diagImage, "%s: writev: %s", __func__, strerrno());
+			break;
+		}
+		// 書けた分だけ進める。
+		for (; i < iovcnt && n >= (ssize_t)iov[i].iov_len; i++) {
+			n -= iov[i].iov_len;
+		}
+		if (i < iovcnt) {
+			iov[i].iov_base = (char *)iov[i].iov_base + n;
+			iov[i].iov_len -= n;
+		}
+	}
+	in_sixel = false;
+
+	size_t total = pre.size() + sixel_len + post.size();
+	StageStat::Count(Counter::BytesOut, total);
+	Debug(diagImage, "%s: %zu bytes in %d write(s)", __func__, total, nwrite);
+	return !aborted;
+}
+
+// SIXEL の出力に影響するオプションを表す文字列を返す。
+// 同じ画像でもこれらが違えば別の SIXEL になるので、キャッシュのキーに含める。
+static std::string
+sixel_variant()
+{
+	return string_format("-c%d%s%s", color_mode,
+		(opt_ormode ? "o" : ""), (opt_output_palette ? "" : "n"));
+}
+
+// 元画像 (ダウンロードしたままのバイト列) を src に用意する。
+// 詳細は ImageSource::Get() を参照。
+// cache_mtx を持って呼ぶこと。lockp を渡せばダウンロード中はそれを離す。
+static FetchResult
+get_source(MemoryStream& src, CacheValidator *valp,
+	const std::string& img_url, time_t now, std::unique_lock<std::mutex> *lockp)
+{
+	ImageSource source(srccache, negcache, fetch_source);
+	source.SetDiag(diagImage);
+	return source.Get(src, valp, img_url, now, lockp);
+}
+
+// 元画像をコピーせずに *datap, *lenp で返す。
+// 詳細は ImageSource::GetData() を参照。
+static FetchResult
+get_source_data(const uint8 **datap, size_t *lenp, std::vector<uint8>& body,
+	CacheValidator *valp, const std::string& img_url, time_t now,
+	std::unique_lock<std::mutex> *lockp)
+{
+	ImageSource source(srccache, negcache, fetch_source);
+	source.SetDiag(diagImage);
+	return source.GetData(datap, lenp, body, valp, img_url, now, lockp);
+}
+
 // 画像をキャッシュして表示する。
-//  img_file はキャッシュディレクトリ内でのファイル名 (拡張子 .sixel なし)。
+//  img_file はキャッシュ内でのキー。
 //  img_url は画像の URL。
 //  resize_width はリサイズ後の画像の幅。ピクセルで指定。0 を指定すると
 //  リサイズせずオリジナルのサイズ。
@@ -462,64 +734,169 @@ ShowImage(const std::string& img_file, const std::string& img_url,
 	if (use_sixel == UseSixel::No)
 		return false;
 
-	auto cache_filename = cachedir + PATH_SEPARATOR + img_file + ".sixel";
+	StageTimer timer(Stage::Image);
 	Debug(diagImage, "%s: img_url=%s", __func__, img_url.c_str());
-	Debug(diagImage, "%s: cache_filename=%s", __func__, cache_filename.c_str());
-
-	FileStream cache_file;
-	if (cache_file.Open(cache_filename, "r") == false) {
-		// キャッシュファイルがないので、画像を取得してキャッシュに保存。
-		Debug(diagImage, "%s: sixel cache is not found; fetch the image.",
-			__func__);
-		if (cache_file.Open(cache_filename, "w+") == false) {
-			Debug(diagImage, "%s: cache file '%s': %s", __method__,
-				cache_filename.c_str(), strerrno());
+	Debug(diagImage, "%s: img_file=%s", __func__, img_file.c_str());
+
+	if (use_kitty) {
+		return show_kitty(img_file, img_url, resize_width, index);
+	}
+	if (use_iterm2) {
+		return show_iterm2(img_url, resize_width, index);
+	}
+
+	// キャッシュは3段になっている。
+	// まずメモリ上のキャッシュを探す。あれば幅と高さも解析済み。
+	// 次にディスクキャッシュにあればそれを (mmap された領域のまま) 使う。
+	// なければ元画像から SIXEL に変換してキャッシュに保存。
+	// 元画像は元画像キャッシュにあればそれを使い、なければダウンロードする。
+	// そのためフォントサイズや色数が変わっても再ダウンロードは不要。
+	// キャッシュへの保存に失敗しても表示は出来る。
+	// どのキャッシュにあっても、検証子の鮮度期間を過ぎていれば
+	// 条件付きで問い合わせて、変わっていなければそのまま使う。
+	const std::string sixel_key = img_file + sixel_variant();
+	const uint8 *sixel;
+	size_t sixel_len;
+	int sx_width;
+	int sx_height;
+	std::vector<uint8> fetched;
+
+	// 書き出すまでキャッシュを持っておく。
+	// ワーカーがこの画像を用意している途中なら、終わるのを待ってそれを使う。
+	std::unique_lock<std::mutex> lock(cache_mtx);
+	if (__predict_false(cache_inflight.empty() == false)) {
+		TraceScope trace("cache_wait");
+		cache_cv.wait(lock, [&]() {
+			return cache_inflight.count(sixel_key) == 0;
+		});
+	}
+
+	// Blurhash は通信しないので検証子も失敗の記録も対象外。
+	bool is_remote = !StartWith(img_url, "blurhash://");
+	time_t now = GetUnixTime();
+	CacheValidator val;
+	bool stale = false;
+	if (is_remote && val.Load(imagecache, sixel_key)) {
+		stale = !val.IsFresh(now) && val.CanRevalidate();
+	}
+
+	const auto *hot = hotcache.Lookup(sixel_key);
+	Debug(diagImage, "%s: hot cache %s (hit %ju/%ju, %zu entries, %zu bytes)",
+		__func__, (hot ? "hit" : "miss"),
+		(uintmax_t)hotcache.GetHit(),
+		(uintmax_t)(hotcache.GetHit() + hotcache.GetMiss()),
+		hotcache.GetCount(), hotcache.GetBytes());
+	StageStat::Count((hot && !stale) ? Counter::HotHit : Counter::HotMiss);
+	if (hot && !stale) {
+		sixel = hot->data.data();
+		sixel_len = hot->data.size();
+		sx_width = hot->width;
+		sx_height = hot->height;
+	} else {
+		// ディスクキャッシュになければ (または古ければ) 用意する。
+		// 他のプロセスが同じ画像を取得中なら、終わるのを待ってそれを使う。
+		bool cached = false;
+		bool filled = false;
+		auto check = [&]() {
+			stale = false;
+			if (is_remote && val.Load(imagecache, sixel_key)) {
+				stale = !val.IsFresh(now) && val.CanRevalidate();
+			}
+			cached = imagecache.Lookup(sixel_key, &sixel, &sixel_len);
+			return cached && !stale;
+		};
+		auto fill = [&]() {
+			filled = true;
+			if (cached == false) {
+				Debug(diagImage, "%s: sixel cache is not found.", __func__);
+				val = CacheValidator();
+			} else {
+				Debug(diagImage, "%s: sixel cache is stale; revalidate.",
+					__func__);
+			}
+
+			// 変換結果はメモリ上に作り、成功した時だけキャッシュに入れるので
+			// 失敗しても中途半端なキャッシュは残らない。
+			// 通信中は cache_mtx を離すので、その間ワーカーが同じ画像に
+			// 手を出さないよう取得中の印を付けておく。
+			MemoryStream src;
+			auto r = FetchResult::Fetched;
+			if (is_remote) {
+				cache_inflight.insert(sixel_key);
+				r = get_source(src, &val, img_url, now, &lock);
+				cache_inflight.erase(sixel_key);
+				cache_cv.notify_all();
+			}
+			if (r == FetchResult::Failed) {
+				if (cached == false) {
+					return false;
+				}
+				// 確認できなくても手元にあるものを表示する。
+				// 鮮度期間をもう一巡するまでは問い合わせない。
+				Debug(diagImage, "%s: use stale cache", __func__);
+				val.fetched = now;
+			} else if (r == FetchResult::Fetched) {
+				MemoryStream mem;
+				auto reason = NegativeCache::Reason::None;
+				if (convert_image(mem, &reason, src, img_url, resize_width)
+				    == false) {
+					Debug(diagImage, "%s: convert_image failed", __func__);
+					if (is_remote && reason != NegativeCache::Reason::None) {
+						// 読めない元画像を持っていても仕方ない。
+						srccache.Remove(img_url);
+						negcache.Fail(img_url, reason, now);
+					}
+					return false;
+				}
+				fetched.resize(mem.GetSize());
+				mem.Read(fetched.data(), fetched.size());
+				imagecache.Store(sixel_key, fetched.data(), fetched.size());
+			}
+			if (is_remote) {
+				val.Store(imagecache, sixel_key);
+			}
+
+			// Store() で mmap された領域は移動することがあるので引き直す。
+			if (fetched.empty() == false) {
+				sixel = fetched.data();
+				sixel_len = fetched.size();
+			} else if (imagecache.Lookup(sixel_key, &sixel, &sixel_len)
+			    == false) {
+				return false;
+			}
+			return true;
+		};
+		bool ok = imagecache.SingleFlight(sixel_key, SINGLE_FLIGHT_TIMEOUT,
+			check, fill);
+		StageStat::Count(filled ? Counter::CacheMiss : Counter::CacheHit);
+		if (ok == false) {
 			return false;
 		}
-		if (fetch_image(cache_file, img_url, resize_width) == false) {
-			Debug(diagImage, "%s: fetch_image failed\n", __func__);
+
+		// SIXEL の先頭付近から幅と高さを取得
+		if (parse_sixel_size(sixel, sixel_len, &sx_width, &sx_height) == false)
+		{
 			return false;
 		}
+		hotcache.Store(sixel_key, sixel, sixel_len, sx_width, sx_height);
 	}
 
-	// SIXEL の先頭付近から幅と高さを取得
-	auto sx_width = 0;
-	auto sx_height = 0;
-	char buf[4096];
-	char *ep;
-	auto n = cache_file.Read(buf, sizeof(buf));
-	if (n < 32) {
-		return false;
-	}
-	// " <Pan>; <Pad>; <Ph>; <Pv>
-	int i;
-	// Search "
-	for (i = 0; i < n && buf[i] != '\x22'; i++)
-		;
-	// Skip Pan;
-	for (i++; i < n && buf[i] != ';'; i++)
-		;
-	// Skip Pad
-	for (i++; i < n && buf[i] != ';'; i++)
-		;
-	// Ph
-	i++;
-	sx_width = stou32def(buf + i, -1, &ep);
-	if (sx_width < 0) {
-		return false;
-	}
-	// Pv
-	i = ep - buf;
-	i++;
-	sx_height = stou32def(buf + i, -1);
-	if (sx_height < 0) {
-		return false;
-	}
+	put_image(sixel, sixel_len, sx_width, sx_height, index);
+	return true;
+}
 
+// 大きさ width x height の画像を表示する前後のカーソル移動を計算して
+// *prep, *postp に書き戻す。index は ShowImage() と同じ。
+static void
+image_position(int width, int height, int index,
+	std::string *prep, std::string *postp)
+{
 	// この画像が占める文字数
-	auto image_rows = (sx_height + fontheight - 1) / fontheight;
-	auto image_cols = (sx_width + fontwidth - 1) / fontwidth;
+	auto image_rows = (height + fontheight - 1) / fontheight;
+	auto image_cols = (width + fontwidth - 1) / fontwidth;
 
+	std::string& pre = *prep;
+	std::string& post = *postp;
 	if (index < 0) {
 		// アイコンの場合は呼び出し側で実施。
 	} else {
@@ -529,8 +906,7 @@ ShowImage(const std::string& img_file, const std::string& img_url,
 		    (indent + image_next_cols + image_cols >= screen_cols))
 		{
 			// 指定された枚数を超えるか、画像が入らない場合は折り返す
-			printf("\r");
-			printf(CSI "%dC", indent);
+			pre = string_format("\r" CSI "%dC", indent);
 			image_count = 0;
 			image_max_rows = 0;
 			image_next_cols = 0;
@@ -538,49 +914,413 @@ ShowImage(const std::string& img_file, const std::string& img_url,
 			// 前の画像の横に並べる
 			if (image_count > 0) {
 				if (image_max_rows > 0) {
-					printf(CSI "%dA", image_max_rows);
+					pre += string_format(CSI "%dA", image_max_rows);
 				}
 				if (image_next_cols > 0) {
-					printf(CSI "%dC", image_next_cols);
+					pre += string_format(CSI "%dC", image_next_cols);
 				}
 			}
 		}
-	}
 
-	// 最初の1回はすでに buf に入っているのでまず出力して、
-	// 次からは順次読みながら最後まで出力。
-	do {
-		in_sixel = true;
-		fwrite(buf, 1, n, stdout);
-		fflush(stdout);
-		in_sixel = false;
-
-		n = cache_file.Read(buf, sizeof(buf));
-	} while (n > 0);
-
-	if (index < 0) {
-		// アイコンの場合は呼び出し側で実施。
-	} else {
-		// 添付画像の場合
 		image_count++;
 		image_next_cols += image_cols;
 
 		// カーソル位置は同じ列に表示した画像の中で最長のものの下端に揃える
 		if (image_max_rows > image_rows) {
-			printf(CSI "%dB", image_max_rows - image_rows);
+			post = string_format(CSI "%dB", image_max_rows - image_rows);
 		} else {
 			image_max_rows = image_rows;
 		}
 	}
+}
+
+// 画像 data (大きさ width x height) を位置決めして書き出す。
+// data は SIXEL か kitty graphics protocol のシーケンス。
+// index は ShowImage() と同じ。
+static void
+put_image(const uint8 *data, size_t len, int width, int height, int index)
+{
+	// 画像の前後のカーソル移動は画像と一緒に書き出す。
+	std::string pre;
+	std::string post;
+	image_position(width, height, index, &pre, &post);
+
+	// ファイルから読みながら小分けに出力するのではなく一度で書き出す。
+	// ノートの描画中ならノートごと書き出すのでバッファに溜めておく。
+	// data はこの後キャッシュを操作すると無効になるのでコピーする。
+	if (render.IsActive()) {
+		render.Append(pre);
+		render.AppendSixel(data, len);
+		render.Append(post);
+	} else {
+		write_sixel(pre, data, len, post);
+	}
+}
+
+
+// kitty graphics protocol で画像を表示する。引数は ShowImage() と同じ。
+// 一度端末に送った画像は kittycache に記録しておき、2回目以降は
+// ID を指定して表示するだけで済ませる。送る時は元画像を減色せずに
+// RGB のまま送るので、SIXEL のキャッシュは使わない。
+// 元画像は SIXEL の場合と同じく元画像キャッシュから取得する。
+// 表示できれば true を返す。
+static bool
+show_kitty(const std::string& img_file, const std::string& img_url,
+	int resize_width, int index)
+{
+	const std::string key = img_file + string_format("-k%d", resize_width);
+	bool is_remote = !StartWith(img_url, "blurhash://");
+	time_t now = GetUnixTime();
+	std::string seq;
+	uint32 id;
+	int width;
+	int height;
+
+	// ワーカーがこの画像の元画像を取得している途中なら、終わるのを待つ。
+	std::unique_lock<std::mutex> lock(cache_mtx);
+	if (__predict_false(cache_inflight.empty() == false)) {
+		TraceScope trace("cache_wait");
+		cache_cv.wait(lock, [&]() {
+			return cache_inflight.count(img_url) == 0;
+		});
+	}
+
+	const auto *e = kittycache.Lookup(key);
+	Debug(diagImage, "%s: kitty cache %s (%zu entries, %zu bytes)",
+		__func__, (e ? "hit" : "miss"),
+		kittycache.GetCount(), kittycache.GetBytes());
+	StageStat::Count(e ? Counter::KittyHit : Counter::KittyMiss);
+	if (e) {
+		id = e->id;
+		width = e->width;
+		height = e->height;
+	} else {
+		// 検証子なしで取得するので NotModified にはならない。
+		// 通信中は cache_mtx を離すので、取得中の印を付けておく。
+		MemoryStream src;
+		CacheValidator val;
+		auto r = FetchResult::Fetched;
+		if (is_remote) {
+			cache_inflight.insert(img_url);
+			r = get_source(src, &val, img_url, now, &lock);
+			cache_inflight.erase(img_url);
+			cache_cv.notify_all();
+		}
+		if (r != FetchResult::Fetched) {
+			return false;
+		}
+
+		std::vector<uint8> rgb;
+		auto reason = NegativeCache::Reason::None;
+		if (convert_rgb(rgb, &width, &height, &reason, src, img_url,
+		    resize_width) == false) {
+			Debug(diagImage, "%s: convert_rgb failed", __func__);
+			if (is_remote && reason != NegativeCache::Reason::None) {
+				srccache.Remove(img_url);
+				negcache.Fail(img_url, reason, now);
+			}
+			return false;
+		}
+
+		// 追い出したものは端末からも削除する。
+		StageTimer timer(Stage::Encode);
+		std::vector<uint32> evicted;
+		id = kittycache.Store(key, rgb.size(), width, height, &evicted);
+		for (auto old : evicted) {
+			seq += KittyImageCache::DeleteSequence(old);
+		}
+		seq += KittyImageCache::UploadSequence(id, rgb.data(), width, height);
+	}
 
+	auto image_rows = (height + fontheight - 1) / fontheight;
+	seq += KittyImageCache::PlaceSequence(id, image_rows);
+	put_image((const uint8 *)seq.data(), seq.size(), width, height, index);
 	return true;
 }
 
-// 画像をダウンロードして SIXEL に変換して out に書き出す。
-// 成功すれば true を、失敗すれば false を返す。
-// 成功した場合 out はファイル先頭を指している。
-// img_url は画像 URL。
-// ただし Blurhash なら独自の blurhash://<JSON> 形式の文字列を渡すこと。
+// iTerm2 の画像表示 (OSC 1337 File=) で画像を表示する。
+// 引数は ShowImage() と同じ。
+// 端末が元画像 (JPEG や PNG など) のまま受け取れるので、デコードも
+// 減色も SIXEL 変換もせず、元画像キャッシュのものを Base64 にして送る。
+// 元画像はキャッシュの mmap 領域 (かダウンロードしたもの) をそのまま使い、
+// Base64 は小分けに変換しながら直接端末に書き出すので、画像全体の
+// コピーも Base64 全体も持つことはない。
+// 大きさはヘッダから取得し、SIXEL と同じ大きさになるよう文字数で指定する。
+// Blurhash は元画像がないので表示できない。
+// 表示できれば true を返す。途中で中断された場合も false を返す。
+static bool
+show_iterm2(const std::string& img_url, int resize_width, int index)
+{
+	// 1回に Base64 に変換する元画像のバイト数 (3 の倍数)
+	static const size_t CHUNK_SIZE = 3 * 16384;
+
+	if (StartWith(img_url, "blurhash://")) {
+		return false;
+	}
+	time_t now = GetUnixTime();
+
+	// ワーカーがこの画像の元画像を取得している途中なら、終わるのを待つ。
+	std::unique_lock<std::mutex> lock(cache_mtx);
+	if (__predict_false(cache_inflight.empty() == false)) {
+		TraceScope trace("cache_wait");
+		cache_cv.wait(lock, [&]() {
+			return cache_inflight.count(img_url) == 0;
+		});
+	}
+
+	// 検証子なしで取得するので NotModified にはならない。
+	// 通信中は cache_mtx を離すので、取得中の印を付けておく。
+	// data は元画像キャッシュの mmap 領域を指していることがあるので、
+	// 書き出し終わるまでロックを持っておく。
+	const uint8 *data;
+	size_t len;
+	std::vector<uint8> body;
+	CacheValidator val;
+	cache_inflight.insert(img_url);
+	auto r = get_source_data(&data, &len, body, &val, img_url, now, &lock);
+	cache_inflight.erase(img_url);
+	cache_cv.notify_all();
+	if (r != FetchResult::Fetched) {
+		return false;
+	}
+
+	Size size;
+	if (ProbeImageSize(data, len, &size) == false) {
+		Debug(diagImage, "%s: unknown image size", __func__);
+		return false;
+	}
+
+	// convert_image() と同じく長辺を resize_width 以下に縮小した大きさ。
+	int width = size.w;
+	int height = size.h;
+	if (resize_width > 0) {
+		if (width >= height && width > resize_width) {
+			height = height * resize_width / width;
+			width = resize_width;
+		} else if (width < height && height > resize_width) {
+			width = width * resize_width / height;
+			height = resize_width;
+		}
+	}
+	width = std::max(width, 1);
+	height = std::max(height, 1);
+	auto image_rows = (height + fontheight - 1) / fontheight;
+	auto image_cols = (width + fontwidth - 1) / fontwidth;
+
+	std::string pre;
+	std::string post;
+	image_position(width, height, index, &pre, &post);
+
+	// kitty の場合と同じく、先に場所を空けてから戻って表示し、
+	// doNotMoveCursor で表示によるカーソル移動は抑制して、最後に自分で
+	// 下に移動する。(アイコンの表示でカーソル位置を保存しているので
+	// ここでは保存・復帰は使えない)
+	std::string ind;
+	for (int i = 0; i < image_rows; i++) {
+		ind += ESC "D";
+	}
+	pre += ind;
+	pre += string_format(CSI "%dA", image_rows);
+	post = ind + post;
+	std::string head = string_format(
+		ESC "]1337;File=inline=1;size=%zu;width=%d;height=%d;"
+		"doNotMoveCursor=1:",
+		len, image_cols, image_rows);
+
+	// 画像はバッファに溜めず、小分けにして直接端末に書き出す。
+	// ノートの描画中なら、それまでに溜めた分を先に書き出しておく。
+	// 途中で中断されたら残りは捨てる。BEL も含めて中断の対象。
+	// 後ろのカーソル移動は、描画中ならノートの続きとして溜める。
+	StageTimer timer(Stage::Encode);
+	bool active = render.IsActive();
+	if (active && render.Flush(STDOUT_FILENO, &in_sixel) == false) {
+		Debug(diagImage, "%s: write: %s", __func__, strerrno());
+	}
+	bool ok = write_sixel(pre, (const uint8 *)head.data(), head.size(), "");
+	for (size_t pos = 0; pos < len && ok; pos += CHUNK_SIZE) {
+		size_t n = std::min(len - pos, CHUNK_SIZE);
+		auto b64 = Base64Encode(data + pos, n);
+		ok = write_sixel("", (const uint8 *)b64.data(), b64.size(), "");
+	}
+	if (ok) {
+		ok = write_sixel("", (const uint8 *)"\a", 1, "");
+	}
+	if (active) {
+		render.Append(post);
+	} else {
+		write_sixel("", NULL, 0, post);
+	}
+	return ok;
+}
+
+// 画像を表示せずに、SIXEL に変換してキャッシュに入れておく。
+// 引数は ShowImage() と同じ。並列再生のワーカーから呼ばれる。
+// ダウンロードと変換の間はキャッシュを離すので、他のワーカーや表示と
+// 並行して動ける。すでにキャッシュにあれば何もしない (期限切れかどうかは
+// 表示する時に ShowImage() が確かめる)。
+// キャッシュに用意できれば true を返す。
+bool
+PrefetchImage(const std::string& img_file, const std::string& img_url,
+	int resize_width)
+{
+	if (use_sixel == UseSixel::No)
+		return false;
+
+	const std::string sixel_key = img_file + sixel_variant();
+	const uint8 *sixel;
+	size_t sixel_len;
+	bool is_remote = !StartWith(img_url, "blurhash://");
+	time_t now = GetUnixTime();
+
+	std::unique_lock<std::mutex> lock(cache_mtx);
+	if (use_kitty || use_iterm2) {
+		// kitty と iTerm2 では SIXEL は使わないので、ここでは元画像を
+		// 元画像キャッシュに用意するところまで。
+		if (is_remote == false || cache_inflight.count(img_url) != 0) {
+			return true;
+		}
+		cache_inflight.insert(img_url);
+		TraceScope trace("prefetch");
+		MemoryStream src;
+		CacheValidator val;
+		auto r = get_source(src, &val, img_url, now, &lock);
+		cache_inflight.erase(img_url);
+		cache_cv.notify_all();
+		return (r == FetchResult::Fetched);
+	}
+	if (cache_inflight.count(sixel_key) != 0 ||
+	    imagecache.Lookup(sixel_key, &sixel, &sixel_len)) {
+		return true;
+	}
+	// 他のプロセスが格納したかも知れないので探し直す。
+	imagecache.Refresh();
+	if (imagecache.Lookup(sixel_key, &sixel, &sixel_len)) {
+		return true;
+	}
+	cache_inflight.insert(sixel_key);
+	Debug(diagImage, "%s: %s", __func__, sixel_key.c_str());
+	TraceScope trace("prefetch");
+
+	bool rv = false;
+	MemoryStream src;
+	CacheValidator val;
+	auto r = FetchResult::Fetched;
+	if (is_remote) {
+		r = get_source(src, &val, img_url, now, &lock);
+	}
+	if (r == FetchResult::Fetched) {
+		lock.unlock();
+		MemoryStream mem;
+		auto reason = NegativeCache::Reason::None;
+		bool converted = convert_image(mem, &reason, src, img_url,
+			resize_width);
+		std::vector<uint8> buf;
+		if (converted) {
+			buf.resize(mem.GetSize());
+			mem.Read(buf.data(), buf.size());
+		}
+		lock.lock();
+
+		if (converted) {
+			imagecache.Store(sixel_key, buf.data(), buf.size());
+			if (is_remote) {
+				val.Store(imagecache, sixel_key);
+			}
+			rv = true;
+		} else {
+			Debug(diagImage, "%s: convert_image failed", __func__);
+			if (is_remote && reason != NegativeCache::Reason::None) {
+				srccache.Remove(img_url);
+				negcache.Fail(img_url, reason, now);
+			}
+		}
+	}
+
+	cache_inflight.erase(sixel_key);
+	cache_cv.notify_all();
+	return rv;
+}
+
+// 画像を img_url からダウンロードして body に格納する。
+// 成功すれば FetchResult::Fetched を返す。
+// 失敗すれば *reasonp に失敗の種類をセットして FetchResult::Failed を返す。
+// 失敗しても次回また試してよさそうな場合は Reason::None のまま。
+// 応答ヘッダから取り出した検証子を *valp にセットする。
+// この時 *valp が検証子を持っていれば条件付きリクエストにし、
+// 304 が返ってきたら FetchResult::NotModified を返す。
+static FetchResult
+fetch_source(std::vector<uint8>& body, NegativeCache::Reason *reasonp,
+	CacheValidator *valp, const std::string& img_url)
+{
+	// ベンチマークでは通信せず、元画像キャッシュにあるものだけを使う。
+	if (opt_offline) {
+		Debug(diagImage, "%s: offline", __func__);
+		return FetchResult::Failed;
+	}
+
+	StageTimer timer(Stage::Fetch);
+	HttpClient http;
+
+	http.SetDiag(diagHttp);
+	if (http.Open(img_url) == false) {
+		return FetchResult::Failed;
+	}
+	http.family = address_family;
+	http.SetTimeout(opt_timeout_image);
+	if (!opt_ciphers.empty()) {
+		http.SetCiphers(opt_ciphers);
+	}
+	valp->AddConditionalHeaders(http);
+	Stream *stream = http.GET();
+	if (stream == NULL) {
+		Debug(diagImage, "%s: GET failed", __method__);
+		*reasonp = NegativeCache::FromResultCode(http.ResultCode);
+		return FetchResult::Failed;
+	}
+	if (valp->Update(http, GetUnixTime())) {
+		Debug(diagImage, "%s: not modified", __method__);
+		return FetchResult::NotModified;
+	}
+
+	// URL の末尾が .jpg とか .png なのに Content-Type が image/* でない
+	// (= HTML とか) を返すやつは画像ではないので無視。
+	const auto& content_type = http.GetHeader(http.RecvHeaders,
+		"Content-Type");
+	if (StartWith(content_type, "image/") == false) {
+		Debug(diagImage, "%s: Content-type is not an image: %s",
+			__method__, content_type.c_str());
+		*reasonp = NegativeCache::Reason::NotImage;
+		return FetchResult::Failed;
+	}
+
+	// 全部読み込む。
+	// 途中で切れたものは画像として読めるかどうか分からないので、
+	// 変換する時に判断する。
+	{
+		StageTimer dltimer(Stage::Download);
+		for (;;) {
+			uint8 buf[4096];
+			auto n = stream->Read(buf, sizeof(buf));
+			if (n <= 0) {
+				break;
+			}
+			body.insert(body.end(), buf, buf + n);
+		}
+	}
+	StageStat::Count(Counter::BytesIn, body.size());
+	if (body.empty()) {
+		Debug(diagImage, "%s: empty body", __method__);
+		*reasonp = NegativeCache::Reason::Decode;
+		return FetchResult::Failed;
+	}
+	return FetchResult::Fetched;
+}
+
+// 元画像 src を読み込んで sx に用意する。
+// 成功すれば true を返す。
+// 失敗すれば *reasonp に失敗の種類をセットして false を返す。
+// img_url は画像 URL で、Blurhash の場合は src ではなくこちらから変換する。
+// Blurhash なら独自の blurhash://<JSON> 形式の文字列を渡すこと。
 // <JSON> 部分は URL エンコードではなくただの文字列。内容は
 // {
 //   "hash":"...", (必須)
@@ -588,16 +1328,13 @@ ShowImage(const std::string& img_file, const std::string& img_url,
 //   "h":int, (必須)
 // } で、入力画像のあるべきサイズを指定する。
 // resize_width はリサイズすべき幅を指定、0 ならリサイズしない。
-bool
-fetch_image(FileStream& outstream, const std::string& img_url, int resize_width)
+static bool
+load_image(SixelConverter& sx, NegativeCache::Reason *reasonp,
+	MemoryStream& src, const std::string& img_url, int resize_width)
 {
-	SixelConverter sx(opt_debug_sixel);
-
 	// 共通の設定
 	// 一番高速になる設定
 	sx.ResizeMode = SixelResizeMode::ByLoad;
-	// 縮小するので X68k でも画質 High でいける
-	sx.ReduceMode = ReductorReduceMode::HighQuality;
 	// 縮小のみの長辺指定変形。
 	// height にも resize_width を渡すことで長辺を resize_width に
 	// 制限できる。この関数の呼び出し意図がそれを想定している。
@@ -607,6 +1344,45 @@ fetch_image(FileStream& outstream, const std::string& img_url, int resize_width)
 	sx.ResizeHeight = resize_width;
 	sx.ResizeAxis = ResizeAxisMode::ScaleDownLong;
 
+	if (StartWith(img_url, "blurhash://")) {
+		// Blurhash は自分で自分のサイズを(アスペクト比すら)持っておらず、
+		// 代わりに呼び出し側が独自形式で提供してくれているのでそれを
+		// 取り出して、サイズ固定モードで SIXEL にする。うーんこの…。
+		Json obj = Json::parse(&img_url[11]);
+		if (obj.is_object() == false) {
+			return false;
+		}
+		auto hash = JsonAsString(obj["hash"]);
+		src.Append(hash.c_str(), hash.length());
+		// サイズはここで sx にセットする。
+		sx.ResizeAxis = ResizeAxisMode::Both;
+		sx.ResizeWidth  = JsonAsInt(obj["w"]);
+		sx.ResizeHeight = JsonAsInt(obj["h"]);
+	}
+	bool loaded;
+	{
+		StageTimer timer(Stage::Decode);
+		loaded = sx.LoadFromStream(&src);
+	}
+	if (loaded == false) {
+		Debug(diagImage, "%s LoadFromStream failed", __func__);
+		*reasonp = NegativeCache::Reason::Decode;
+		return false;
+	}
+	return true;
+}
+
+// 元画像 src を SIXEL に変換して outstream に書き出す。
+// 引数と戻り値は load_image() と同じ。
+static bool
+convert_image(Stream& outstream, NegativeCache::Reason *reasonp,
+	MemoryStream& src, const std::string& img_url, int resize_width)
+{
+	SixelConverter sx(opt_debug_sixel);
+
+	// 縮小するので X68k でも画質 High でいける
+	sx.ReduceMode = ReductorReduceMode::HighQuality;
+
 	if (color_mode == ColorFixedX68k) {
 		// とりあえず固定 16 色
 		// システム取得する?
@@ -633,65 +1409,41 @@ fetch_image(FileStream& outstream, const std::string& img_url, int resize_width)
 	}
 	sx.OutputPalette = opt_output_palette;
 
-	// mem と http が stream を提供するので生存期間に注意。stream は解放不要。
-	MemoryStream mem;
-	HttpClient http;
-	Stream *stream = NULL;
-	if (StartWith(img_url, "blurhash://")) {
-		// Blurhash は自分で自分のサイズを(アスペクト比すら)持っておらず、
-		// 代わりに呼び出し側が独自形式で提供してくれているのでそれを
-		// 取り出して、サイズ固定モードで SIXEL にする。うーんこの…。
-		Json obj = Json::parse(&img_url[11]);
-		if (obj.is_object() == false) {
-			return false;
-		}
-		auto hash = JsonAsString(obj["hash"]);
-		mem.Append(hash.c_str(), hash.length());
-		mem.Rewind();
-		stream = &mem;
-		// サイズはここで sx にセットする。
-		sx.ResizeAxis = ResizeAxisMode::Both;
-		sx.ResizeWidth  = JsonAsInt(obj["w"]);
-		sx.ResizeHeight = JsonAsInt(obj["h"]);
-	} else {
-		http.SetDiag(diagHttp);
-		if (http.Open(img_url) == false) {
-			return false;
-		}
-		http.family = address_family;
-		http.SetTimeout(opt_timeout_image);
-		if (!opt_ciphers.empty()) {
-			http.SetCiphers(opt_ciphers);
-		}
-		stream = http.GET();
-		if (stream == NULL) {
-			Debug(diagImage, "%s: GET failed", __method__);
-			return false;
-		}
-
-		// URL の末尾が .jpg とか .png なのに Content-Type が image/* でない
-		// (= HTML とか) を返すやつは画像ではないので無視。
-		const auto& content_type = http.GetHeader(http.RecvHeaders,
-			"Content-Type");
-		if (StartWith(content_type, "image/") == false) {
-			Debug(diagImage, "%s: Content-type is not an image: %s",
-				__method__, content_type.c_str());
-			return false;
-		}
-	}
-	if (sx.LoadFromStream(stream) == false) {
-		Debug(diagImage, "%s LoadFromStream failed", __func__);
+	if (load_image(sx, reasonp, src, img_url, resize_width) == false) {
 		return false;
 	}
 
 	// インデックスカラー変換
-	sx.ConvertToIndexed();
+	{
+		StageTimer timer(Stage::Reduce);
+		sx.ConvertToIndexed();
+	}
 
+	StageTimer timer(Stage::Encode);
 	if (sx.SixelToStream(&outstream) == false) {
 		Debug(diagImage, "%s: SixelToStream failed", __func__);
 		return false;
 	}
-	outstream.Flush();
-	outstream.Rewind();
+	return true;
+}
+
+// 元画像 src を減色せずに RGB (1ピクセル3バイト) に変換して dst に書き出す。
+// 変換後の大きさを *widthp, *heightp に書き戻す。
+// 他の引数と戻り値は load_image() と同じ。
+static bool
+convert_rgb(std::vector<uint8>& dst, int *widthp, int *heightp,
+	NegativeCache::Reason *reasonp,
+	MemoryStream& src, const std::string& img_url, int resize_width)
+{
+	SixelConverter sx(opt_debug_sixel);
+
+	if (load_image(sx, reasonp, src, img_url, resize_width) == false) {
+		return false;
+	}
+
+	StageTimer timer(Stage::Reduce);
+	sx.ConvertToRGB(dst);
+	*widthp = sx.GetWidth();
+	*heightp = sx.GetHeight();
 	return true;
 }
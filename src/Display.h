@@ -26,14 +26,22 @@
 #pragma once
 
 #include "JsonFwd.h"
+#include <functional>
 
 extern void init_color();
+extern void BeginRender();
+extern void EndRender();
+extern void output(const std::string& str);
+extern void outputf(const char *fmt, ...) __printflike(1, 2);
 extern void print_(const UString& utext);
-extern UString ColorBegin(Color col);
-extern UString ColorEnd(Color col);
+extern const UString& ColorBegin(Color col);
+extern const UString& ColorEnd(Color col);
 extern UString coloring(const std::string& text, Color col);
-extern void ShowIcon(bool (*callback)(const Json&, const std::string&),
-	const Json& user, const std::string& userid);
+extern void Draw(const std::function<void()>& fn);
+extern void RedrawHistory();
+extern void ShowIcon(const std::function<bool()>& callback);
 extern std::string GetCacheFilename(const std::string& img_url);
 extern bool ShowImage(const std::string& img_file, const std::string& img_url,
 	int resize_width, int index);
+extern bool PrefetchImage(const std::string& img_file,
+	const std::string& img_url, int resize_width);
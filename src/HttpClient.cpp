@@ -31,6 +31,7 @@
 #else
 #include "TLSHandle_openssl.h"
 #endif
+#include "StageStat.h"
 #include "StringUtil.h"
 #include <cstring>
 #include <errno.h>
@@ -153,14 +154,20 @@ HttpClient::Act(const std::string& method)
 			sb += "\r\n";
 		}
 
-		SendRequest(sb);
-		ReceiveHeader();
+		{
+			StageTimer timer(Stage::TTFB);
+			SendRequest(sb);
+			ReceiveHeader();
+		}
 
 		if (300 <= ResultCode && ResultCode < 400) {
-			Close();
+			// Location があればリダイレクト。
+			// 304 Not Modified などは Location を持たないので
+			// 接続はそのままで呼び出し側に返す。
 			auto location = GetHeader(RecvHeaders, "Location");
-			Debug(diag, "Redirect to %s", location.c_str());
 			if (!location.empty()) {
+				Close();
+				Debug(diag, "Redirect to %s", location.c_str());
 				auto newUri = ParsedUri::Parse(location);
 				if (!newUri.Scheme.empty()) {
 					// Scheme があればフルURIとみなす
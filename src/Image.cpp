@@ -25,6 +25,7 @@
 
 #include "Image.h"
 #include "PeekableStream.h"
+#include <cstring>
 
 //
 // 画像
@@ -55,6 +56,120 @@ Image::Create(int width_, int height_)
 	buf.resize(GetStride() * GetHeight());
 }
 
+//
+// 画像のヘッダ
+//
+
+static inline uint32
+be16(const uint8 *p)
+{
+	return (p[0] << 8) | p[1];
+}
+
+static inline uint32
+le16(const uint8 *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static inline uint32
+le24(const uint8 *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16);
+}
+
+// buf (長さ len) の画像をデコードせずに、ヘッダから大きさを取得して
+// *sizep に書き戻す。対応しているのは PNG、GIF、JPEG、WebP。
+// 取得できれば true を返す。
+bool
+ProbeImageSize(const uint8 *buf, size_t len, Size *sizep)
+{
+	Size size;
+
+	if (len >= 24 && memcmp(buf, "\x89PNG\r\n\x1a\n", 8) == 0) {
+		// PNG は先頭が IHDR チャンクと決まっている。
+		if (memcmp(buf + 12, "IHDR", 4) != 0) {
+			return false;
+		}
+		size.w = (be16(buf + 16) << 16) | be16(buf + 18);
+		size.h = (be16(buf + 20) << 16) | be16(buf + 22);
+	} else if (len >= 10 && memcmp(buf, "GIF8", 4) == 0) {
+		// GIF は論理画面の大きさ。
+		size.w = le16(buf + 6);
+		size.h = le16(buf + 8);
+	} else if (len >= 4 && buf[0] == 0xff && buf[1] == 0xd8) {
+		// JPEG は SOFn セグメントを探す。
+		// 手前に EXIF などがあるので長さを見ながら読み飛ばす。
+		size_t i = 2;
+		for (;;) {
+			if (i + 4 > len || buf[i] != 0xff) {
+				return false;
+			}
+			uint8 marker = buf[i + 1];
+			if (marker == 0xff) {
+				// フィルバイト
+				i++;
+				continue;
+			}
+			if (marker == 0x01 || (0xd0 <= marker && marker <= 0xd8)) {
+				// 長さを持たないマーカー
+				i += 2;
+				continue;
+			}
+			if (marker == 0xd9 || marker == 0xda) {
+				// EOI か SOS まで来てしまった。
+				return false;
+			}
+			if (0xc0 <= marker && marker <= 0xcf &&
+			    marker != 0xc4 && marker != 0xc8 && marker != 0xcc)
+			{
+				if (i + 9 > len) {
+					return false;
+				}
+				size.h = be16(buf + i + 5);
+				size.w = be16(buf + i + 7);
+				break;
+			}
+			i += 2 + be16(buf + i + 2);
+		}
+	} else if (len >= 30 && memcmp(buf, "RIFF", 4) == 0 &&
+	    memcmp(buf + 8, "WEBP", 4) == 0)
+	{
+		// WebP は最初のチャンクの種類によって書式が違う。
+		const uint8 *p = buf + 20;
+		if (memcmp(buf + 12, "VP8 ", 4) == 0) {
+			// 非可逆。3バイトのフレームタグと開始コードの後。
+			if (memcmp(p + 3, "\x9d\x01\x2a", 3) != 0) {
+				return false;
+			}
+			size.w = le16(p + 6) & 0x3fff;
+			size.h = le16(p + 8) & 0x3fff;
+		} else if (memcmp(buf + 12, "VP8L", 4) == 0) {
+			// 可逆。シグネチャの後に 14 ビットずつ (値は -1 したもの)。
+			if (p[0] != 0x2f) {
+				return false;
+			}
+			uint32 bits = le24(p + 1) | (p[4] << 24);
+			size.w = (bits & 0x3fff) + 1;
+			size.h = ((bits >> 14) & 0x3fff) + 1;
+		} else if (memcmp(buf + 12, "VP8X", 4) == 0) {
+			// 拡張形式。キャンバスの大きさ (値は -1 したもの)。
+			size.w = le24(p + 4) + 1;
+			size.h = le24(p + 7) + 1;
+		} else {
+			return false;
+		}
+	} else {
+		return false;
+	}
+
+	if (size.w <= 0 || size.h <= 0) {
+		return false;
+	}
+	*sizep = size;
+	return true;
+}
+
 //
 // 画像ローダの基本クラス
 //
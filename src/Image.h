@@ -101,6 +101,9 @@ struct Size
 	int h {};
 };
 
+// 画像をデコードせずに、ヘッダから大きさを取得する。
+extern bool ProbeImageSize(const uint8 *buf, size_t len, Size *sizep);
+
 // 画像
 // 今の所扱うのは RGB24 形式、パディングなしの画像フォーマットのみ。
 // つまり channels = 3, bit_depth = 8, stride = width * 3 固定。
@@ -0,0 +1,969 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "ImageCache.h"
+#include "StringUtil.h"
+#include "Tracer.h"
+#include "subr.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+//
+// 画像キャッシュ (単一データファイル版)
+//
+
+// ファイルヘッダ (16 バイト)
+//  +0.b[8]	マジック "SYKCDAT1"
+//  +8.l	世代番号
+// +12.l	予約
+//
+// レコード (16 バイト + キー + データ)
+//  +0.l	マジック
+//  +4.l	キーの長さ
+//  +8.l	データの長さ (0 なら墓標)
+// +12.l	キーとデータのチェックサム
+// +16		キー、データ
+//
+// インデックス
+//  +0.b[8]	マジック "SYKCIDX1"
+//  +8.l	対応するデータファイルの世代番号
+// +12.l	エントリ数
+// +16.q	このインデックスがカバーしているデータファイルの終端位置
+// +24		エントリ × エントリ数
+//			+0.q オフセット、+8.l レコード長、+12.l データ長、
+//			+16.l 参照時刻、+20.l キー長、+24 キー
+// 末尾.l	ここまでのチェックサム
+//
+// 数値はすべてリトルエンディアン。
+
+static const char data_magic[] = "SYKCDAT1";
+static const char index_magic[] = "SYKCIDX1";
+static const uint32 rec_magic = 0x524b5953;	// "SYKR"
+
+// 1レコードの上限。これを超えるものは壊れているとみなす。
+static const uint32 MAX_KEYLEN = 1024;
+static const uint32 MAX_DATALEN = 64 * 1024 * 1024;
+
+static inline void
+put32(uint8 *p, uint32 val)
+{
+	val = htole32(val);
+	memcpy(p, &val, sizeof(val));
+}
+
+static inline void
+put64(uint8 *p, uint64 val)
+{
+	val = htole64(val);
+	memcpy(p, &val, sizeof(val));
+}
+
+static inline uint32
+get32(const uint8 *p)
+{
+	uint32 val;
+	memcpy(&val, p, sizeof(val));
+	return le32toh(val);
+}
+
+static inline uint64
+get64(const uint8 *p)
+{
+	uint64 val;
+	memcpy(&val, p, sizeof(val));
+	return le64toh(val);
+}
+
+// FNV-1a (32ビット)。h に続けて計算できる。
+static uint32
+checksum(uint32 h, const void *src, size_t len)
+{
+	const uint8 *s = (const uint8 *)src;
+
+	for (size_t i = 0; i < len; i++) {
+		h ^= s[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+static const uint32 CHECKSUM_INIT = 2166136261u;
+
+// コンストラクタ
+ImageCache::ImageCache(const std::string& name_)
+	: name(name_)
+{
+}
+
+// デストラクタ
+ImageCache::~ImageCache()
+{
+	Close();
+}
+
+// ディレクトリ dir にあるキャッシュを開く (なければ作る)。
+bool
+ImageCache::Open(const std::string& dir, uint64 budget_)
+{
+	Close();
+
+	datapath = dir + "/" + name + ".dat";
+	idxpath  = dir + "/" + name + ".idx";
+	budget = budget_;
+
+	// ロックファイルが作れなくても単独でなら使える。
+	std::string lockpath = dir + "/" + name + ".lock";
+	lockfd = open(lockpath.c_str(), O_RDWR | O_CREAT, 0644);
+	if (lockfd < 0) {
+		Debug(diag, "%s: %s: %s", __method__, lockpath.c_str(), strerrno());
+	}
+
+	Lock();
+	bool rv = OpenData() && Load();
+	if (rv) {
+		Debug(diag, "%s: %s: %d entries, live %ju bytes, dead %ju bytes",
+			__method__, name.c_str(),
+			GetCount(), (uintmax_t)GetLiveBytes(), (uintmax_t)GetDeadBytes());
+
+		Evict();
+		MaybeCompact();
+		if (dirty > 0) {
+			Sync();
+		}
+	} else {
+		CloseData();
+	}
+	Unlock();
+	return rv;
+}
+
+// インデックスを書き出して閉じる。
+void
+ImageCache::Close()
+{
+	if (fd >= 0) {
+		Sync();
+	}
+	CloseData();
+	entries.clear();
+	live_bytes = 0;
+	if (lockfd >= 0) {
+		close(lockfd);
+		lockfd = -1;
+	}
+}
+
+// 開いたデータファイルのエントリを読み込む。
+// インデックスがあればそこから、なければ先頭から走査する。
+// ロックを持った状態で呼ぶこと。
+bool
+ImageCache::Load()
+{
+	uint64 scan_from;
+
+	entries.clear();
+	live_bytes = 0;
+	if (LoadIndex(&scan_from) == false) {
+		entries.clear();
+		live_bytes = 0;
+		scan_from = HeaderSize;
+	}
+	return Scan(scan_from);
+}
+
+// fcntl(2) で lockfd の start から 1 バイトをロックする。
+// type は F_WRLCK か F_UNLCK。
+static bool
+lock_range(int lockfd, short type, off_t start, bool wait)
+{
+	struct flock fl;
+
+	memset(&fl, 0, sizeof(fl));
+	fl.l_type = type;
+	fl.l_whence = SEEK_SET;
+	fl.l_start = start;
+	fl.l_len = 1;
+	for (;;) {
+		if (fcntl(lockfd, (wait ? F_SETLKW : F_SETLK), &fl) == 0) {
+			return true;
+		}
+		if (errno != EINTR) {
+			return false;
+		}
+	}
+}
+
+// データファイルとインデックスをプロセス間で排他する。
+// 入れ子にできる。
+void
+ImageCache::Lock()
+{
+	if (lockdepth++ == 0 && lockfd >= 0) {
+		if (lock_range(lockfd, F_WRLCK, 0, true) == false) {
+			Debug(diag, "%s: %s", __method__, strerrno());
+		}
+	}
+}
+
+void
+ImageCache::Unlock()
+{
+	if (--lockdepth == 0 && lockfd >= 0) {
+		lock_range(lockfd, F_UNLCK, 0, false);
+	}
+}
+
+// 他のプロセスによる更新を取り込む。
+// ロックを持った状態で呼ぶこと。
+bool
+ImageCache::CatchUp()
+{
+	struct stat st;
+
+	if (fd < 0) {
+		return false;
+	}
+
+	// 他のプロセスが詰め直していたら、データファイルごと開き直す。
+	if (stat(datapath.c_str(), &st) < 0 ||
+	    st.st_dev != dev || st.st_ino != ino ||
+	    fstat(fd, &st) < 0 || st.st_size < file_size)
+	{
+		Debug(diag, "%s: %s: reopen", __method__, name.c_str());
+		CloseData();
+		if (OpenData() == false || Load() == false) {
+			CloseData();
+			return false;
+		}
+		return true;
+	}
+
+	// 他のプロセスが追記していたら、その分を取り込む。
+	if (st.st_size > file_size) {
+		uint64 from = file_size;
+		file_size = st.st_size;
+		if (Remap() == false || Scan(from) == false) {
+			return false;
+		}
+		Debug(diag, "%s: %s: %ju bytes appended by others", __method__,
+			name.c_str(), (uintmax_t)(file_size - from));
+	}
+	return true;
+}
+
+// キーごとのロックの数。ロックファイルの 1 バイト目から使う。
+static const uint32 KEYLOCK_SLOTS = 65536;
+
+// キー単位のプロセス間ロックを取る。
+ImageCache::KeyLock::KeyLock(ImageCache& cache_, const std::string& key,
+	int timeout_msec)
+	: cache(cache_)
+{
+	if (cache.lockfd < 0) {
+		return;
+	}
+
+	slot = 1 + checksum(CHECKSUM_INIT, key.data(), key.size()) % KEYLOCK_SLOTS;
+	for (int elapsed = 0; ; elapsed += 20) {
+		if (lock_range(cache.lockfd, F_WRLCK, slot, false)) {
+			locked = true;
+			break;
+		}
+		if ((errno != EAGAIN && errno != EACCES) || elapsed >= timeout_msec) {
+			Debug(cache.diag, "%s: %s: %s", __method__, key.c_str(),
+				(elapsed >= timeout_msec ? "timeout" : strerrno()));
+			break;
+		}
+		if (waited == false) {
+			Debug(cache.diag, "%s: %s: wait for another process", __method__,
+				key.c_str());
+			waited = true;
+		}
+		usleep(20 * 1000);
+	}
+}
+
+// キー単位のプロセス間ロックを解放する。
+ImageCache::KeyLock::~KeyLock()
+{
+	if (locked && cache.lockfd >= 0) {
+		lock_range(cache.lockfd, F_UNLCK, slot, false);
+	}
+}
+
+// 他のプロセスによる更新を取り込む。
+bool
+ImageCache::Refresh()
+{
+	if (fd < 0) {
+		return false;
+	}
+
+	Lock();
+	bool rv = CatchUp();
+	Unlock();
+	return rv;
+}
+
+// データファイルを開く。なければ作る。
+bool
+ImageCache::OpenData()
+{
+	struct stat st;
+	uint8 hdr[HeaderSize];
+
+	fd = open(datapath.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+	if (fd < 0) {
+		Debug(diag, "%s: %s: %s", __method__, datapath.c_str(), strerrno());
+		return false;
+	}
+	if (fstat(fd, &st) < 0) {
+		Debug(diag, "%s: fstat: %s", __method__, strerrno());
+		CloseData();
+		return false;
+	}
+
+	dev = st.st_dev;
+	ino = st.st_ino;
+	file_size = st.st_size;
+	if (file_size >= HeaderSize &&
+	    pread(fd, hdr, sizeof(hdr), 0) == sizeof(hdr) &&
+	    memcmp(hdr, data_magic, 8) == 0)
+	{
+		generation = get32(&hdr[8]);
+	} else {
+		// 新規作成か、ヘッダが壊れているので作り直す。
+		if (file_size != 0) {
+			Debug(diag, "%s: %s: bad header, recreate", __method__,
+				datapath.c_str());
+		}
+		generation = (uint32)GetUnixTime();
+		memset(hdr, 0, sizeof(hdr));
+		memcpy(hdr, data_magic, 8);
+		put32(&hdr[8], generation);
+		if (ftruncate(fd, 0) < 0 ||
+		    write(fd, hdr, sizeof(hdr)) != sizeof(hdr))
+		{
+			Debug(diag, "%s: write header: %s", __method__, strerrno());
+			CloseData();
+			return false;
+		}
+		file_size = HeaderSize;
+	}
+
+	return Remap();
+}
+
+// データファイルを閉じる。
+void
+ImageCache::CloseData()
+{
+	if (map) {
+		munmap(map, map_size);
+		map = NULL;
+		map_size = 0;
+	}
+	if (fd >= 0) {
+		close(fd);
+		fd = -1;
+	}
+	file_size = 0;
+}
+
+// データファイルの現在の大きさで mmap し直す。
+bool
+ImageCache::Remap()
+{
+	if (map) {
+		munmap(map, map_size);
+		map = NULL;
+		map_size = 0;
+	}
+
+	void *m = mmap(NULL, file_size, PROT_READ, MAP_FILE | MAP_SHARED, fd, 0);
+	if (m == MAP_FAILED) {
+		Debug(diag, "%s: mmap: %s", __method__, strerrno());
+		return false;
+	}
+	map = (uint8 *)m;
+	map_size = file_size;
+	return true;
+}
+
+// インデックスのスナップショットを読み込む。
+// 成功すれば、インデックスがカバーしているデータファイルの終端位置を
+// *scan_from に書き戻して true を返す。
+// インデックスがないか、壊れているか、データファイルと世代が
+// 一致しなければ false を返す。
+bool
+ImageCache::LoadIndex(uint64 *scan_from)
+{
+	std::vector<uint8> buf;
+	struct stat st;
+
+	int ifd = open(idxpath.c_str(), O_RDONLY);
+	if (ifd < 0) {
+		return false;
+	}
+	if (fstat(ifd, &st) < 0 || st.st_size < 28) {
+		close(ifd);
+		return false;
+	}
+	buf.resize(st.st_size);
+	auto n = read(ifd, buf.data(), buf.size());
+	close(ifd);
+	if (n != buf.size()) {
+		return false;
+	}
+
+	size_t end = buf.size() - 4;
+	if (memcmp(&buf[0], index_magic, 8) != 0 ||
+	    get32(&buf[8]) != generation ||
+	    checksum(CHECKSUM_INIT, &buf[0], end) != get32(&buf[end]))
+	{
+		Debug(diag, "%s: %s is stale or broken", __method__, idxpath.c_str());
+		return false;
+	}
+	uint32 count = get32(&buf[12]);
+	uint64 valid_end = get64(&buf[16]);
+	if (valid_end < HeaderSize || valid_end > file_size) {
+		return false;
+	}
+
+	size_t pos = 24;
+	for (uint32 i = 0; i < count; i++) {
+		if (pos + 24 > end) {
+			return false;
+		}
+		Entry e;
+		e.offset  = get64(&buf[pos]);
+		e.reclen  = get32(&buf[pos + 8]);
+		e.datalen = get32(&buf[pos + 12]);
+		e.atime   = get32(&buf[pos + 16]);
+		uint32 keylen = get32(&buf[pos + 20]);
+		pos += 24;
+		if (pos + keylen > end ||
+		    e.offset < HeaderSize || e.offset + e.reclen > valid_end ||
+		    e.reclen != RecHeaderSize + keylen + e.datalen ||
+		    get32(&map[e.offset]) != rec_magic)
+		{
+			return false;
+		}
+		std::string key((const char *)&buf[pos], keylen);
+		pos += keylen;
+
+		e.seq = ++seqno;
+		live_bytes += e.reclen;
+		entries.emplace(std::move(key), e);
+	}
+
+	*scan_from = valid_end;
+	return true;
+}
+
+// データファイルの from 以降のレコードを走査してエントリに反映する。
+// 末尾に壊れたレコードがあればそこで切り捨てる。
+bool
+ImageCache::Scan(uint64 from)
+{
+	uint64 pos = from;
+	uint32 now = GetUnixTime();
+
+	while (pos + RecHeaderSize <= file_size) {
+		const uint8 *rec = &map[pos];
+		uint32 keylen  = get32(&rec[4]);
+		uint32 datalen = get32(&rec[8]);
+		if (get32(&rec[0]) != rec_magic ||
+		    keylen == 0 || keylen > MAX_KEYLEN || datalen > MAX_DATALEN ||
+		    pos + RecHeaderSize + keylen + datalen > file_size)
+		{
+			break;
+		}
+		uint32 sum = checksum(CHECKSUM_INIT, &rec[RecHeaderSize],
+			keylen + datalen);
+		if (sum != get32(&rec[12])) {
+			break;
+		}
+
+		std::string key((const char *)&rec[RecHeaderSize], keylen);
+		uint32 reclen = RecHeaderSize + keylen + datalen;
+		auto it = entries.find(key);
+		if (it != entries.end()) {
+			live_bytes -= it->second.reclen;
+			entries.erase(it);
+		}
+		if (datalen != 0) {
+			Entry e;
+			e.offset = pos;
+			e.reclen = reclen;
+			e.datalen = datalen;
+			e.atime = now;
+			e.seq = ++seqno;
+			live_bytes += reclen;
+			entries.emplace(std::move(key), e);
+		}
+		dirty++;
+		pos += reclen;
+	}
+
+	if (pos != file_size) {
+		// 書き込み途中でクラッシュしたレコードを切り捨てる。
+		Debug(diag, "%s: truncate broken tail at %ju (file size %ju)",
+			__method__, (uintmax_t)pos, (uintmax_t)file_size);
+		if (ftruncate(fd, pos) < 0) {
+			Debug(diag, "%s: ftruncate: %s", __method__, strerrno());
+			return false;
+		}
+		file_size = pos;
+		return Remap();
+	}
+	return true;
+}
+
+// key のデータを探す。
+bool
+ImageCache::Lookup(const std::string& key, const uint8 **datap, size_t *lenp)
+{
+	if (__predict_false(fd < 0)) {
+		return false;
+	}
+
+	auto it = entries.find(key);
+	if (it == entries.end()) {
+		// 他のプロセスが格納しているかも知れない。
+		// 毎回確認するとシステムコールが増えるので、たまにだけ。
+		uint32 now = GetUnixTime();
+		if (now == last_refresh) {
+			return false;
+		}
+		last_refresh = now;
+		if (Refresh() == false) {
+			return false;
+		}
+		it = entries.find(key);
+		if (it == entries.end()) {
+			return false;
+		}
+	}
+	Entry& e = it->second;
+
+	// 前回 mmap した後に追記されたものなら mmap し直す。
+	if (__predict_false(e.offset + e.reclen > map_size)) {
+		if (Remap() == false) {
+			return false;
+		}
+	}
+
+	Touch(e);
+	*datap = map + e.offset + e.reclen - e.datalen;
+	*lenp = e.datalen;
+	return true;
+}
+
+// key に data を格納する。
+bool
+ImageCache::Store(const std::string& key, const void *data, size_t len)
+{
+	if (__predict_false(fd < 0)) {
+		return false;
+	}
+	if (key.empty() || key.size() > MAX_KEYLEN ||
+	    len == 0 || len > MAX_DATALEN)
+	{
+		return false;
+	}
+
+	if (Append(key, data, len) == false) {
+		return false;
+	}
+
+	Evict();
+	MaybeCompact();
+	if (dirty >= 32) {
+		Sync();
+	}
+	return true;
+}
+
+// key を削除する。
+void
+ImageCache::Remove(const std::string& key)
+{
+	if (fd < 0 || entries.count(key) == 0) {
+		return;
+	}
+	// 墓標レコードを追記すると、Append() の中でエントリも消える。
+	Append(key, NULL, 0);
+}
+
+// key のデータを複数のプロセスで重複して用意しないための手順。
+bool
+ImageCache::SingleFlight(const std::string& key, int timeout_msec,
+	const std::function<bool()>& check, const std::function<bool()>& fill)
+{
+	if (check()) {
+		return true;
+	}
+
+	// 他のプロセスが同じキーを取得中なら、終わるのを待ってそれを使う。
+	// 自分が取得する場合は、終わるまでロックを持っておく。
+	// ロックを取るまでの間に格納されたかも知れないので探し直す。
+	std::unique_ptr<KeyLock> keylock;
+	{
+		TraceScope trace("keylock");
+		keylock.reset(new KeyLock(*this, key, timeout_msec));
+		Refresh();
+		if (check()) {
+			return true;
+		}
+	}
+	return fill();
+}
+
+// データファイルにレコードを追記して、エントリを更新する。
+bool
+ImageCache::Append(const std::string& key, const void *data, size_t len)
+{
+	uint8 hdr[RecHeaderSize];
+	struct iovec iov[3];
+
+	uint32 sum = checksum(CHECKSUM_INIT, key.data(), key.size());
+	sum = checksum(sum, data, len);
+	put32(&hdr[0], rec_magic);
+	put32(&hdr[4], key.size());
+	put32(&hdr[8], len);
+	put32(&hdr[12], sum);
+
+	iov[0].iov_base = hdr;
+	iov[0].iov_len  = sizeof(hdr);
+	iov[1].iov_base = const_cast<char *>(key.data());
+	iov[1].iov_len  = key.size();
+	iov[2].iov_base = const_cast<void *>(data);
+	iov[2].iov_len  = len;
+	uint32 reclen = sizeof(hdr) + key.size() + len;
+
+	// 他のプロセスが追記した分を取り込んで、本当の末尾に書く。
+	Lock();
+	if (CatchUp() == false) {
+		Unlock();
+		return false;
+	}
+	auto n = writev(fd, iov, 3);
+	if (n != reclen) {
+		Debug(diag, "%s: writev: %s", __method__,
+			(n < 0 ? strerrno() : "short write"));
+		// 中途半端に書けていたら元に戻す。
+		if (ftruncate(fd, file_size) < 0) {
+			Debug(diag, "%s: ftruncate: %s", __method__, strerrno());
+		}
+		Unlock();
+		return false;
+	}
+	Unlock();
+
+	auto it = entries.find(key);
+	if (it != entries.end()) {
+		live_bytes -= it->second.reclen;
+		entries.erase(it);
+	}
+	if (len != 0) {
+		Entry e;
+		e.offset = file_size;
+		e.reclen = reclen;
+		e.datalen = len;
+		Touch(e);
+		live_bytes += reclen;
+		entries.emplace(key, e);
+	}
+	file_size += reclen;
+	dirty++;
+	return true;
+}
+
+// key が prefix で始まり、最終参照が age 秒より前のものを削除する。
+// Remove() と同じく墓標を追記するので、インデックスを書き出す前に
+// 落ちても、他のプロセスと共有していても、消したものは生き返らない。
+int
+ImageCache::Expire(const std::string& prefix, uint32 age)
+{
+	uint32 now = GetUnixTime();
+
+	std::vector<std::string> keys;
+	for (const auto& p : entries) {
+		if (StartWith(p.first, prefix) && p.second.atime + age < now) {
+			keys.emplace_back(p.first);
+		}
+	}
+	if (keys.empty()) {
+		return 0;
+	}
+
+	Lock();
+	for (const auto& key : keys) {
+		Remove(key);
+	}
+	Unlock();
+	Debug(diag, "%s: %s* %zu expired", __method__, prefix.c_str(),
+		keys.size());
+	MaybeCompact();
+	return keys.size();
+}
+
+// 参照時刻を更新する。
+void
+ImageCache::Touch(Entry& e)
+{
+	e.atime = GetUnixTime();
+	e.seq = ++seqno;
+}
+
+// データ総量が上限を超えていれば、参照の古いものから追い出す。
+// 上限ぎりぎりまでだと毎回追い出しが起きるので、少し余裕を持たせる。
+// 追い出しも Remove() と同じく墓標を追記する (Expire() 参照)。
+void
+ImageCache::Evict()
+{
+	if (budget == 0 || live_bytes <= budget) {
+		return;
+	}
+
+	std::vector<std::unordered_map<std::string, Entry>::const_iterator> list;
+	list.reserve(entries.size());
+	for (auto it = entries.cbegin(); it != entries.cend(); ++it) {
+		list.emplace_back(it);
+	}
+	std::sort(list.begin(), list.end(),
+		[](const auto& a, const auto& b) {
+			if (a->second.atime != b->second.atime) {
+				return a->second.atime < b->second.atime;
+			}
+			return a->second.seq < b->second.seq;
+		}
+	);
+
+	// 墓標の追記でエントリが動くので、先にキーを決めておく。
+	uint64 low = budget - budget / 8;
+	uint64 live = live_bytes;
+	std::vector<std::string> keys;
+	for (const auto& it : list) {
+		if (live <= low) {
+			break;
+		}
+		live -= it->second.reclen;
+		keys.emplace_back(it->first);
+	}
+	list.clear();
+
+	Lock();
+	for (const auto& key : keys) {
+		Remove(key);
+	}
+	Unlock();
+	Debug(diag, "%s: %s: %zu entries evicted, live %ju bytes", __method__,
+		name.c_str(), keys.size(), (uintmax_t)live_bytes);
+}
+
+// 死んだ領域が増えてきたら詰め直す。
+void
+ImageCache::MaybeCompact()
+{
+	uint64 dead = GetDeadBytes();
+
+	if (dead >= 64 * 1024 && dead > live_bytes / 2) {
+		Compact();
+	}
+}
+
+// 生きているレコードだけを新しいデータファイルに詰め直す。
+// 新しいデータファイルは世代番号を1つ進めるので、ここでクラッシュしても
+// 古いインデックスは世代不一致で使われず、データファイルから再構築される。
+bool
+ImageCache::Compact()
+{
+	if (fd < 0) {
+		return false;
+	}
+
+	// 他のプロセスが追記した分も含めて詰め直す。
+	Lock();
+	bool rv = CatchUp() && CompactLocked();
+	Unlock();
+	return rv;
+}
+
+// Compact() の本体。ロックを持った状態で呼ぶこと。
+bool
+ImageCache::CompactLocked()
+{
+	if (map_size < file_size && Remap() == false) {
+		return false;
+	}
+
+	std::string tmppath = datapath + ".tmp";
+	int nfd = open(tmppath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_APPEND,
+		0644);
+	if (nfd < 0) {
+		Debug(diag, "%s: %s: %s", __method__, tmppath.c_str(), strerrno());
+		return false;
+	}
+
+	uint32 newgen = generation + 1;
+	uint8 hdr[HeaderSize];
+	memset(hdr, 0, sizeof(hdr));
+	memcpy(hdr, data_magic, 8);
+	put32(&hdr[8], newgen);
+	if (write(nfd, hdr, sizeof(hdr)) != sizeof(hdr)) {
+		goto abort;
+	}
+
+	{
+		// 元のファイル内での順序を保ってコピーする。
+		// 隣接しているレコードはまとめて書き出す。
+		std::vector<Entry *> list;
+		list.reserve(entries.size());
+		for (auto& p : entries) {
+			list.emplace_back(&p.second);
+		}
+		std::sort(list.begin(), list.end(),
+			[](const Entry *a, const Entry *b) {
+				return a->offset < b->offset;
+			}
+		);
+
+		std::vector<uint64> newoffset(list.size());
+		uint64 newsize = HeaderSize;
+		for (size_t i = 0; i < list.size(); ) {
+			uint64 start = list[i]->offset;
+			uint64 end = start;
+			size_t j = i;
+			for (; j < list.size() && list[j]->offset == end; j++) {
+				newoffset[j] = newsize + (end - start);
+				end += list[j]->reclen;
+			}
+			size_t len = end - start;
+			if (write(nfd, map + start, len) != len) {
+				goto abort;
+			}
+			newsize += len;
+			i = j;
+		}
+		struct stat st;
+		if (fsync(nfd) < 0 || fstat(nfd, &st) < 0) {
+			goto abort;
+		}
+		if (rename(tmppath.c_str(), datapath.c_str()) < 0) {
+			goto abort;
+		}
+
+		Debug(diag, "%s: %ju -> %ju bytes", __method__,
+			(uintmax_t)file_size, (uintmax_t)newsize);
+		for (size_t i = 0; i < list.size(); i++) {
+			list[i]->offset = newoffset[i];
+		}
+		CloseData();
+		fd = nfd;
+		dev = st.st_dev;
+		ino = st.st_ino;
+		generation = newgen;
+		file_size = newsize;
+		dirty++;
+		if (Remap() == false) {
+			return false;
+		}
+	}
+	return SyncLocked();
+
+ abort:
+	Debug(diag, "%s: %s", __method__, strerrno());
+	close(nfd);
+	unlink(tmppath.c_str());
+	return false;
+}
+
+// インデックスのスナップショットを書き出す。
+// 一時ファイルに書いてから rename(2) するので、途中でクラッシュしても
+// 古いスナップショットか新しいスナップショットのどちらかが残る。
+bool
+ImageCache::Sync()
+{
+	if (fd < 0) {
+		return false;
+	}
+
+	// 他のプロセスの分も含めて書き出す。
+	Lock();
+	bool rv = CatchUp() && SyncLocked();
+	Unlock();
+	return rv;
+}
+
+// Sync() の本体。ロックを持った状態で呼ぶこと。
+bool
+ImageCache::SyncLocked()
+{
+	std::vector<uint8> buf(24);
+	memcpy(&buf[0], index_magic, 8);
+	put32(&buf[8], generation);
+	put32(&buf[12], entries.size());
+	put64(&buf[16], file_size);
+	for (const auto& p : entries) {
+		const std::string& key = p.first;
+		const Entry& e = p.second;
+		size_t pos = buf.size();
+		buf.resize(pos + 24 + key.size());
+		put64(&buf[pos], e.offset);
+		put32(&buf[pos + 8], e.reclen);
+		put32(&buf[pos + 12], e.datalen);
+		put32(&buf[pos + 16], e.atime);
+		put32(&buf[pos + 20], key.size());
+		memcpy(&buf[pos + 24], key.data(), key.size());
+	}
+	size_t end = buf.size();
+	buf.resize(end + 4);
+	put32(&buf[end], checksum(CHECKSUM_INIT, &buf[0], end));
+
+	std::string tmppath = idxpath + ".tmp";
+	int ifd = open(tmppath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (ifd < 0) {
+		Debug(diag, "%s: %s: %s", __method__, tmppath.c_str(), strerrno());
+		return false;
+	}
+	auto n = write(ifd, buf.data(), buf.size());
+	close(ifd);
+	if (n != buf.size() || rename(tmppath.c_str(), idxpath.c_str()) < 0) {
+		Debug(diag, "%s: %s: %s", __method__, idxpath.c_str(), strerrno());
+		unlink(tmppath.c_str());
+		return false;
+	}
+	dirty = 0;
+	return true;
+}
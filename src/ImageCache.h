@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include "Diag.h"
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+//
+// 画像キャッシュ (単一データファイル版)
+//
+// 以前はキャッシュディレクトリに画像1枚につき1ファイルを作っていたが、
+// 遅いディスクや巨大なディレクトリで起動時の find(1) が重く、
+// inode も食うので、1つのデータファイルに追記していく方式にした。
+//
+// <dir>/sixel.dat … データファイル。
+//	先頭にファイルヘッダ、その後ろにレコードが追記されていく。
+//	レコードは自己記述的なので、インデックスがなくても先頭から
+//	走査すれば全体を再構築できる。
+// <dir>/sixel.idx … インデックスのスナップショット。
+//	起動時に全体を走査しなくていいようにするためのもので、
+//	スナップショット以降に追記されたレコードは起動時に走査して拾う。
+//
+// 書き込みは追記のみで、途中でクラッシュして末尾のレコードが
+// 壊れていてもチェックサムで検出して切り捨てる。
+// 削除は墓標レコード (データ長 0) の追記で表す。
+// 追い出しは参照時刻の古いものから行い、死んだ領域が増えたら
+// 生きているレコードだけを新しいデータファイルにコピーして詰める。
+//
+// ファイル名の "sixel" の部分はコンストラクタで変えられるので、
+// 同じディレクトリに用途の違うキャッシュを複数置くことが出来る。
+//
+// 複数のプロセスで同じキャッシュを共有できる。
+// <dir>/sixel.lock … ロックファイル。
+//	先頭 1 バイトを fcntl(2) でロックしてデータファイルとインデックスの
+//	更新を排他する。他のプロセスが追記したレコードは、ロックを取った
+//	ついでに (と、見付からなかった時にたまに) 走査して取り込む。
+//	他のプロセスが詰め直した場合はデータファイルごと開き直す。
+//	2 バイト目以降はキーごとのロックで、同じ画像を複数のプロセスが
+//	同時に取得しないようにするために使う (KeyLock)。
+class ImageCache
+{
+ public:
+	struct Entry {
+		uint64 offset {};	// データファイル内のレコード先頭位置
+		uint32 reclen {};	// レコード全体の長さ
+		uint32 datalen {};	// データ部の長さ
+		uint32 atime {};	// 最終参照時刻 (Unix time)
+		uint64 seq {};		// 同一時刻内での参照順 (プロセス内のみ)
+	};
+
+	// name はファイル名 (<dir>/<name>.dat と <dir>/<name>.idx) に使う。
+	explicit ImageCache(const std::string& name_ = "sixel");
+	~ImageCache();
+
+	// リソースを持っているのでコピーコンストラクタを禁止する。
+	ImageCache(const ImageCache&) = delete;
+	ImageCache& operator=(const ImageCache&) = delete;
+
+	void SetDiag(const Diag& diag_) { diag = diag_; }
+
+	// ディレクトリ dir にあるキャッシュを開く (なければ作る)。
+	// budget はデータの総量の上限 [byte]。
+	// 成功すれば true を、失敗すれば false を返す。
+	bool Open(const std::string& dir, uint64 budget);
+
+	// インデックスを書き出して閉じる。
+	void Close();
+
+	bool IsOpen() const { return fd >= 0; }
+
+	// キー単位のプロセス間ロック。
+	// 他のプロセスが同じキーを取得中なら、終わるか timeout_msec 経つまで待つ。
+	// ロックを取ったら、それまでに他のプロセスが格納したかも知れないので
+	// Refresh() してから探し直すこと。タイムアウトした場合はロックせずに戻る。
+	// ハッシュでロックを共有するので、別のキーを待つことも稀にある。
+	class KeyLock
+	{
+	 public:
+		KeyLock(ImageCache& cache_, const std::string& key, int timeout_msec);
+		~KeyLock();
+
+		KeyLock(const KeyLock&) = delete;
+		KeyLock& operator=(const KeyLock&) = delete;
+
+		bool IsLocked() const { return locked; }
+		bool IsWaited() const { return waited; }
+
+	 private:
+		ImageCache& cache;
+		off_t slot {};
+		bool locked {};
+		bool waited {};
+	};
+
+	// key のデータを探す。
+	// 見付かれば *datap, *lenp にデータの位置と長さをセットして true を返す。
+	// *datap は mmap された領域を指しているので、次に Store()、Remove()、
+	// Compact()、Refresh() や、見付からなかった Lookup() などを呼ぶまでの
+	// 間だけ有効。
+	bool Lookup(const std::string& key, const uint8 **datap, size_t *lenp);
+
+	// 他のプロセスによる更新を取り込む。
+	bool Refresh();
+
+	// key に data を格納する。同じキーがあれば置き換える。
+	bool Store(const std::string& key, const void *data, size_t len);
+
+	// key を削除する。
+	void Remove(const std::string& key);
+
+	// key のデータを複数のプロセスで重複して用意しないための手順。
+	// check() が false なら KeyLock を取ってから Refresh() して check() を
+	// やり直し、それでも false なら fill() で用意する。fill() を呼んでいる
+	// 間はロックを持っている。ロックがタイムアウトしたら、そのまま用意する。
+	// check() か fill() が true を返せば true を返す。
+	bool SingleFlight(const std::string& key, int timeout_msec,
+		const std::function<bool()>& check, const std::function<bool()>& fill);
+
+	// key が prefix で始まり、最終参照が age 秒より前のものを削除する。
+	// 削除した数を返す。
+	int Expire(const std::string& prefix, uint32 age);
+
+	// 生きているレコードだけを新しいデータファイルに詰め直す。
+	bool Compact();
+
+	// インデックスのスナップショットを書き出す。
+	bool Sync();
+
+	// 統計情報
+	int GetCount() const { return entries.size(); }
+	uint64 GetLiveBytes() const { return live_bytes; }
+	uint64 GetDeadBytes() const { return file_size - HeaderSize - live_bytes; }
+	uint64 GetBudget() const { return budget; }
+
+	static const uint32 HeaderSize = 16;
+	static const uint32 RecHeaderSize = 16;
+
+ private:
+	bool OpenData();
+	void CloseData();
+	bool Load();
+	bool Remap();
+	bool LoadIndex(uint64 *scan_from);
+	bool Scan(uint64 from);
+	void Lock();
+	void Unlock();
+	bool CatchUp();
+	bool CompactLocked();
+	bool SyncLocked();
+	bool Append(const std::string& key, const void *data, size_t len);
+	void Evict();
+	void Touch(Entry& e);
+	void MaybeCompact();
+
+	std::string name {};
+	std::string datapath {};
+	std::string idxpath {};
+
+	int fd {-1};				// データファイル
+	dev_t dev {};				// データファイルの dev と inode。
+	ino_t ino {};				// 他のプロセスが詰め直したら変わる。
+	int lockfd {-1};			// ロックファイル
+	int lockdepth {};			// ロックの入れ子の深さ
+	uint32 last_refresh {};		// 見付からなかった時に最後に確認した時刻
+	uint32 generation {};		// データファイルの世代
+	uint64 file_size {};		// データファイルの大きさ
+	uint8 *map {};				// データファイルの mmap
+	size_t map_size {};
+
+	uint64 budget {};			// データ総量の上限
+	uint64 live_bytes {};		// 生きているレコードの総量
+	uint64 seqno {};			// 参照順カウンタ
+	int dirty {};				// スナップショット以降の更新数
+
+	std::unordered_map<std::string, Entry> entries {};
+
+	Diag diag {};
+};
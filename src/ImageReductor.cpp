@@ -498,10 +498,11 @@ ImageReductor::RoundDownPow2(int x)
 }
 
 // -level .. +level までの乱数を返します。
+// 並列再生では複数のスレッドで変換するので、状態はスレッドごとに持ちます。
 /*static*/ int
 ImageReductor::rnd(int level)
 {
-	static uint32 y = (uint32)24539283060L;
+	static thread_local uint32 y = (uint32)24539283060L;
 	y = y ^ (y << 13);
 	y = y ^ (y >> 17);
 	y = y ^ (y << 5);
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// 元画像 (ダウンロードしたままのバイト列) を用意する
+//
+
+#include "ImageSource.h"
+#include "ImageCache.h"
+#include "MemoryStream.h"
+#include "StageStat.h"
+
+// コンストラクタ
+ImageSource::ImageSource(ImageCache& cache_, NegativeCache& negcache_,
+	const Fetcher& fetcher_)
+	: cache(cache_), negcache(negcache_), fetcher(fetcher_)
+{
+}
+
+// url の元画像を src に用意する。
+FetchResult
+ImageSource::Get(MemoryStream& src, CacheValidator *valp,
+	const std::string& url, time_t now, std::unique_lock<std::mutex> *lockp)
+{
+	const uint8 *data;
+	size_t len;
+	std::vector<uint8> body;
+
+	auto r = GetData(&data, &len, body, valp, url, now, lockp);
+	if (r == FetchResult::Fetched) {
+		src.Append((const char *)data, len);
+	}
+	return r;
+}
+
+// url の元画像をコピーせずに *datap, *lenp で返す。
+FetchResult
+ImageSource::GetData(const uint8 **datap, size_t *lenp,
+	std::vector<uint8>& body, CacheValidator *valp,
+	const std::string& url, time_t now, std::unique_lock<std::mutex> *lockp)
+{
+	const uint8 *data;
+	size_t len;
+
+	body.clear();
+	CacheValidator srcval;
+	bool has_src = cache.Lookup(url, &data, &len);
+	bool has_srcval = has_src && srcval.Load(cache, url);
+	StageStat::Count(has_src ? Counter::SourceHit : Counter::SourceMiss);
+
+	if (has_src == false ||
+	    (srcval.CanRevalidate() && srcval.IsFresh(now) == false))
+	{
+		// 問い合わせに使う検証子
+		CacheValidator cond = has_src ? srcval : *valp;
+
+		// 最近失敗した URL なら接続すらせずに諦める。
+		// 条件付きの問い合わせは手元に表示できるものがあるので対象外。
+		bool conditional = cond.CanRevalidate();
+		if (conditional == false && negcache.Check(url, now)) {
+			return FetchResult::Failed;
+		}
+
+		auto reason = NegativeCache::Reason::None;
+		if (lockp) {
+			lockp->unlock();
+		}
+		auto r = fetcher(body, &reason, &cond, url);
+		if (lockp) {
+			lockp->lock();
+		}
+		if (r == FetchResult::Failed) {
+			if (conditional == false && reason != NegativeCache::Reason::None) {
+				negcache.Fail(url, reason, now);
+			}
+			if (has_src == false) {
+				return r;
+			}
+			// 確認できなくても手元の元画像を使う。
+			// (ShowImage() が期限切れの SIXEL を使うのと同じ)
+			// 元画像キャッシュだけを用意しておけば通信なしで再生できる。
+			Debug(diag, "%s: use stale source", __method__);
+		} else {
+			negcache.Success(url);
+
+			if (r == FetchResult::NotModified && has_src == false) {
+				*valp = cond;
+				return r;
+			}
+			srcval = cond;
+			has_srcval = true;
+			if (r == FetchResult::Fetched) {
+				// 1つで上限の 1/8 を超えるようなものは他を追い出しすぎるので
+				// 元画像キャッシュには置かない。
+				uint64 budget = cache.GetBudget();
+				if (budget == 0 || body.size() <= budget / 8) {
+					cache.Store(url, body.data(), body.size());
+				} else {
+					cache.Remove(url);
+				}
+				srcval.Store(cache, url);
+				*datap = body.data();
+				*lenp = body.size();
+				*valp = srcval;
+				return r;
+			}
+			// 元画像キャッシュのものが最新だった。
+			srcval.Store(cache, url);
+		}
+
+		// Store() で mmap された領域は移動することがあるので引き直す。
+		// ダウンロード中にロックを離していた場合も同様。
+		if (cache.Lookup(url, &data, &len) == false) {
+			return FetchResult::Failed;
+		}
+	} else {
+		Debug(diag, "%s: source cache hit", __method__);
+	}
+
+	// 元画像キャッシュのものを使う。
+	if (has_srcval && srcval.SameAs(*valp)) {
+		*valp = srcval;
+		return FetchResult::NotModified;
+	}
+	*datap = data;
+	*lenp = len;
+	*valp = srcval;
+	return FetchResult::Fetched;
+}
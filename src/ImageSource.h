@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include "CacheValidator.h"
+#include "Diag.h"
+#include "NegativeCache.h"
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class ImageCache;
+class MemoryStream;
+
+// 元画像の取得結果
+enum class FetchResult {
+	Failed,
+	Fetched,		// 取得した
+	NotModified,	// 条件付きリクエストで 304 が返ってきた
+};
+
+//
+// 元画像 (ダウンロードしたままのバイト列) を用意する
+//
+// 元画像キャッシュにあって鮮度期間内ならそれを使い、期限切れなら
+// 条件付きで問い合わせる。なければダウンロードして元画像キャッシュに
+// 保存する。問い合わせに失敗しても、元画像キャッシュにあればそれを使う。
+// 実際の取得は Fetcher に任せる。
+class ImageSource
+{
+ public:
+	// url を取得して body にセットする。
+	// *valp が検証子を持っていれば条件付きで問い合わせ、304 なら *valp を
+	// 更新して NotModified を、そうでなければ *valp を取り直して Fetched を
+	// 返す。失敗すれば *reasonp に失敗の種類をセットして Failed を返す。
+	using Fetcher = std::function<FetchResult(std::vector<uint8>& body,
+		NegativeCache::Reason *reasonp, CacheValidator *valp,
+		const std::string& url)>;
+
+	ImageSource(ImageCache& cache_, NegativeCache& negcache_,
+		const Fetcher& fetcher_);
+
+	void SetDiag(const Diag& diag_) { diag = diag_; }
+
+	// url の元画像を src に用意する。
+	// *valp は入力時には、今キャッシュにある SIXEL の元になった画像の検証子
+	// (SIXEL がなければ空)。元画像キャッシュにない場合でも *valp が
+	// 検証子を持っていれば条件付きで問い合わせる。
+	// 元画像が *valp の時から変わっていなければ、*valp を更新して
+	// FetchResult::NotModified を返す (src は空のまま)。
+	// そうでなければ src に元画像を、*valp にその検証子をセットして
+	// FetchResult::Fetched を返す。
+	// 失敗すれば FetchResult::Failed を返す。
+	// キャッシュを守るロックを持って呼ぶこと。lockp を渡せば
+	// ダウンロード中はそれを離す。
+	FetchResult Get(MemoryStream& src, CacheValidator *valp,
+		const std::string& url, time_t now,
+		std::unique_lock<std::mutex> *lockp = NULL);
+
+	// Get() と同じだが、元画像をコピーせずに *datap, *lenp で返す。
+	// 元画像キャッシュのものなら mmap された領域を指すので、
+	// ロックを持ったまま、キャッシュを操作するまでの間だけ有効。
+	// ダウンロードしたものなら body に入れてそこを指す。
+	FetchResult GetData(const uint8 **datap, size_t *lenp,
+		std::vector<uint8>& body, CacheValidator *valp,
+		const std::string& url, time_t now,
+		std::unique_lock<std::mutex> *lockp = NULL);
+
+ private:
+	ImageCache& cache;			// 元画像キャッシュ
+	NegativeCache& negcache;
+	Fetcher fetcher;
+
+	Diag diag {};
+};
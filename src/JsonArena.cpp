@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// Json の DOM 用のアリーナ
+//
+
+#include "JsonArena.h"
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+// 最初に確保するチャンクの大きさ。Misskey の1ノートが収まる程度。
+static const size_t CHUNK_SIZE = 64 * 1024;
+// リセット後も手元に残しておく大きさの上限。
+// 巨大なメッセージが1つ来ただけでずっと抱えていないように。
+static const size_t MAX_KEEP = 1024 * 1024;
+// 切り出す単位
+static const size_t ALIGN = alignof(std::max_align_t);
+
+thread_local JsonArena *JsonArena::current;
+
+// コンストラクタ
+JsonArena::JsonArena()
+{
+}
+
+// デストラクタ
+JsonArena::~JsonArena()
+{
+	for (auto& c : chunks) {
+		free(c.base);
+	}
+}
+
+// size バイトを確保する。
+void *
+JsonArena::Allocate(size_t size)
+{
+	size = (size + ALIGN - 1) & ~(ALIGN - 1);
+
+	if (__predict_false(chunks.empty() ||
+	    offset + size > chunks.back().size))
+	{
+		AddChunk(std::max(size, CHUNK_SIZE));
+	}
+
+	void *p = chunks.back().base + offset;
+	offset += size;
+	used += size;
+	return p;
+}
+
+// 少なくとも size バイトのチャンクを追加する。
+void
+JsonArena::AddChunk(size_t size)
+{
+	// 足りなくなるたびに倍々にして、チャンクの数を抑える。
+	if (chunks.empty() == false) {
+		size = std::max(size, chunks.back().size * 2);
+	}
+	char *base = (char *)malloc(size);
+	if (base == NULL) {
+		throw std::bad_alloc();
+	}
+	chunks.push_back({ base, size });
+	offset = 0;
+}
+
+// p がこのアリーナの領域なら true を返す。
+bool
+JsonArena::Owns(const void *p) const
+{
+	const char *cp = (const char *)p;
+	for (const auto& c : chunks) {
+		if (c.base <= cp && cp < c.base + c.size) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// 確保したものを全部捨てる。
+// 次回は1つのチャンクで足りるよう、複数になっていたら今回の使用量が
+// 収まる大きさの1つにまとめ直す (ただし MAX_KEEP まで)。
+void
+JsonArena::Reset()
+{
+	peak = std::max(peak, used);
+
+	if (chunks.size() > 1 || GetCapacity() > MAX_KEEP) {
+		size_t size = std::min(std::max(used, CHUNK_SIZE), MAX_KEEP);
+		for (auto& c : chunks) {
+			free(c.base);
+		}
+		chunks.clear();
+		AddChunk(size);
+	}
+	offset = 0;
+	used = 0;
+}
+
+// 手元にあるチャンクの合計バイト数を返す。
+size_t
+JsonArena::GetCapacity() const
+{
+	size_t total = 0;
+	for (const auto& c : chunks) {
+		total += c.size;
+	}
+	return total;
+}
+
+//
+// スコープ
+//
+
+// コンストラクタ
+JsonArena::Scope::Scope(JsonArena& arena_)
+	: arena(arena_)
+{
+	prev = current;
+	current = &arena;
+}
+
+// デストラクタ
+JsonArena::Scope::~Scope()
+{
+	current = prev;
+	if (prev != &arena) {
+		arena.Reset();
+	}
+}
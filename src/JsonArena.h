@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+//
+// Json (nlohmann::json) の DOM 用のアリーナ
+//
+// 1メッセージ分の DOM は数百個の小さな領域 (std::map のノード、値、
+// 配列) からなり、表示し終わるとすぐに全部捨てる。これを毎回 malloc/free
+// すると遅いうえに、メモリの少ない機械では断片化が気になる。
+// そこで Scope の間に確保したものはアリーナから切り出すだけにし、
+// Scope を抜ける時に一括して捨てる。
+//
+// Scope の中で作った Json は Scope より先に破棄すること。
+// Scope の外で作った Json は今まで通りヒープから確保するが、Scope の中で
+// それに要素を足すとアリーナから確保されてしまうので、しないこと。
+// なお値の文字列のうち SSO に収まらない長いものは std::string 自身が
+// ヒープから確保するので、これはアリーナに入らない。
+//
+class JsonArena
+{
+ public:
+	JsonArena();
+	~JsonArena();
+
+	// size バイトを確保する。
+	void *Allocate(size_t size);
+
+	// p がこのアリーナの領域なら true を返す。
+	bool Owns(const void *p) const;
+
+	// 確保したものを全部捨てる。
+	void Reset();
+
+	// 統計情報
+	size_t GetUsed() const { return used; }
+	size_t GetPeak() const { return peak; }
+	size_t GetCapacity() const;
+
+	// このスレッドで使用中のアリーナを返す。なければ NULL。
+	static JsonArena *Current() { return current; }
+
+	// 生存期間中、このスレッドの Json の確保先を arena にする。
+	// 抜ける時に arena をリセットする。
+	class Scope
+	{
+	 public:
+		explicit Scope(JsonArena& arena_);
+		~Scope();
+	 private:
+		JsonArena& arena;
+		JsonArena *prev {};
+	};
+
+ private:
+	struct Chunk {
+		char *base;
+		size_t size;
+	};
+
+	void AddChunk(size_t size);
+
+	std::vector<Chunk> chunks {};
+	// 最後のチャンクの使用済みバイト数
+	size_t offset {};
+	// 今回確保した合計と、その最大値
+	size_t used {};
+	size_t peak {};
+
+	static thread_local JsonArena *current;
+};
+
+// Json の AllocatorType に指定するアロケータ。
+// 使用中のアリーナがあればそこから、なければヒープから確保する。
+template <typename T>
+class JsonAllocator
+{
+ public:
+	using value_type = T;
+
+	JsonAllocator() noexcept { }
+	template <typename U>
+	JsonAllocator(const JsonAllocator<U>&) noexcept { }
+
+	T *allocate(size_t n) {
+		JsonArena *arena = JsonArena::Current();
+		if (arena) {
+			return static_cast<T *>(arena->Allocate(n * sizeof(T)));
+		}
+		return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T *p, size_t n) {
+		JsonArena *arena = JsonArena::Current();
+		if (arena && arena->Owns(p)) {
+			// アリーナはまとめて捨てる。
+			return;
+		}
+		std::allocator<T>().deallocate(p, n);
+	}
+};
+
+template <typename T, typename U>
+inline bool
+operator==(const JsonAllocator<T>&, const JsonAllocator<U>&)
+{
+	return true;
+}
+
+template <typename T, typename U>
+inline bool
+operator!=(const JsonAllocator<T>&, const JsonAllocator<U>&)
+{
+	return false;
+}
@@ -2,4 +2,8 @@
 
 #include "nlohmann/json_fwd.hpp"
 
-using Json = nlohmann::json;
+template <typename T> class JsonAllocator;
+
+// 確保先を JsonArena にできるようにした nlohmann::json。
+using Json = nlohmann::basic_json<std::map, std::vector, std::string, bool,
+	std::int64_t, std::uint64_t, double, JsonAllocator>;
@@ -28,7 +28,8 @@
 // https://github.com/nlohmann/json/releases 3.11.2
 #include "nlohmann/json.hpp"
 
-using Json = nlohmann::json;
+#include "JsonArena.h"
+#include "JsonFwd.h"
 
 // JsonAsString(j) .. 文字列を取り出しやすくするマクロ。
 // j が string なら std::string を返す。
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// kitty graphics protocol で端末に送った画像の管理
+//
+
+#include "KittyImageCache.h"
+#include "Base64.h"
+#include "StringUtil.h"
+#include "term.h"
+#include <algorithm>
+
+// コンストラクタ
+KittyImageCache::KittyImageCache()
+{
+}
+
+// デストラクタ
+KittyImageCache::~KittyImageCache()
+{
+}
+
+// key を探す。
+const KittyImageCache::Entry *
+KittyImageCache::Lookup(const std::string& key)
+{
+	auto it = entries.find(key);
+	if (it == entries.end()) {
+		return NULL;
+	}
+
+	// 先頭に移動
+	lru.splice(lru.begin(), lru, it->second);
+	return &it->second->second;
+}
+
+// key の画像を送ることを記録して、使う ID を返す。
+uint32
+KittyImageCache::Store(const std::string& key, size_t bytes,
+	int width, int height, std::vector<uint32> *evicted)
+{
+	uint32 id = MakeId(key);
+
+	// 古いのがあれば先に取り除く。
+	// ID が衝突した別のキーも取り除く。端末側は同じ ID で送り直すと
+	// 置き換わるので、削除シーケンスは不要。
+	Remove(key);
+	auto iit = ids.find(id);
+	if (iit != ids.end()) {
+		Remove(iit->second->first);
+	}
+
+	// 入るように古いほうから追い出す
+	while (total + bytes > budget && lru.empty() == false) {
+		auto& e = lru.back();
+		evicted->push_back(e.second.id);
+		total -= e.second.bytes;
+		entries.erase(e.first);
+		ids.erase(e.second.id);
+		lru.pop_back();
+		evict++;
+	}
+
+	lru.emplace_front();
+	auto& e = lru.front();
+	e.first = key;
+	e.second.id = id;
+	e.second.bytes = bytes;
+	e.second.width = width;
+	e.second.height = height;
+	entries.emplace(key, lru.begin());
+	ids.emplace(id, lru.begin());
+	total += bytes;
+
+	return id;
+}
+
+// key のエントリを (あれば) 取り除く。
+void
+KittyImageCache::Remove(const std::string& key)
+{
+	auto it = entries.find(key);
+	if (it == entries.end()) {
+		return;
+	}
+	auto lit = it->second;
+	total -= lit->second.bytes;
+	ids.erase(lit->second.id);
+	entries.erase(it);
+	lru.erase(lit);
+}
+
+// key から ID を作る。
+// FNV-1a (32bit) で、0 になったら 1 にする。
+/*static*/ uint32
+KittyImageCache::MakeId(const std::string& key)
+{
+	uint32 h = 2166136261U;
+	for (auto c : key) {
+		h ^= (uint8)c;
+		h *= 16777619U;
+	}
+	if (h == 0) {
+		h = 1;
+	}
+	return h;
+}
+
+// RGB の画像を ID id で送信するシーケンスを返す。
+// 1つのシーケンスで送れる量には上限があるので ChunkSize ずつに分け、
+// 最後以外には m=1 を付ける。q=2 は端末からの応答を抑制する。
+/*static*/ std::string
+KittyImageCache::UploadSequence(uint32 id, const uint8 *rgb,
+	int width, int height)
+{
+	// Base64 で ChunkSize バイトになる元データの長さ
+	const size_t rawchunk = ChunkSize / 4 * 3;
+	size_t len = (size_t)width * height * 3;
+	std::string seq;
+
+	seq.reserve((len + 2) / 3 * 4 + (len / rawchunk + 1) * 16 + 64);
+	size_t pos = 0;
+	do {
+		size_t n = std::min(len - pos, rawchunk);
+		bool more = (pos + n < len);
+
+		seq += ESC "_G";
+		if (pos == 0) {
+			seq += string_format("a=t,f=24,s=%d,v=%d,i=%u,q=2,",
+				width, height, id);
+		}
+		seq += more ? "m=1;" : "m=0;";
+		seq += Base64Encode(rgb + pos, n);
+		seq += ESC "\\";
+
+		pos += n;
+	} while (pos < len);
+	return seq;
+}
+
+// ID id の画像を現在のカーソル位置に表示するシーケンスを返す。
+// 先に IND で rows 行下に移動して (必要ならスクロールして) 場所を空けてから
+// 戻って表示する。C=1 で表示によるカーソル移動は抑制して、最後に自分で
+// rows 行下に移動する。桁位置はどこでも変わらない。
+/*static*/ std::string
+KittyImageCache::PlaceSequence(uint32 id, int rows)
+{
+	std::string ind;
+	for (int i = 0; i < rows; i++) {
+		ind += ESC "D";
+	}
+
+	std::string seq = ind;
+	if (rows > 0) {
+		seq += string_format(CSI "%dA", rows);
+	}
+	seq += string_format(ESC "_Ga=p,i=%u,C=1,q=2" ESC "\\", id);
+	seq += ind;
+	return seq;
+}
+
+// ID id の画像を端末から削除するシーケンスを返す。
+/*static*/ std::string
+KittyImageCache::DeleteSequence(uint32 id)
+{
+	return string_format(ESC "_Ga=d,d=I,i=%u,q=2" ESC "\\", id);
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//
+// kitty graphics protocol で端末に送った画像の管理
+//
+// kitty graphics protocol に対応した端末は、受け取った画像を ID ごとに
+// 保持しておき、後から ID を指定するだけで何度でも表示できる。
+// アイコンのように同じ画像を何度も表示するものは、最初に1回送っておけば
+// 以降は短いエスケープシーケンスだけで済む。
+// ID はキャッシュのキーから作るので、同じ画像はいつも同じ ID になる。
+// 端末側のメモリを使うので、送ったデータの総量を budget で制限し、
+// 超えたら最後に表示したのが古いものから端末側でも削除する。
+//
+class KittyImageCache
+{
+ public:
+	struct Entry {
+		uint32 id {};
+		size_t bytes {};
+		int width {};
+		int height {};
+	};
+
+	KittyImageCache();
+	~KittyImageCache();
+
+	// データ総量の上限 [byte] を設定する。
+	void SetBudget(size_t budget_) { budget = budget_; }
+
+	// key を探す。送信済みなら最近表示したことにしてエントリを返す。
+	// 見付からなければ NULL を返す。
+	// 返したポインタは次に Store() を呼ぶまでの間だけ有効。
+	const Entry *Lookup(const std::string& key);
+
+	// key の画像 (データ量 bytes、大きさ width x height) を送ることを
+	// 記録して、使う ID を返す。
+	// 入るように古いものを追い出し、端末側で削除すべき ID を
+	// *evicted に追加する。
+	uint32 Store(const std::string& key, size_t bytes, int width, int height,
+		std::vector<uint32> *evicted);
+
+	// 統計情報
+	size_t GetCount() const { return entries.size(); }
+	size_t GetBytes() const { return total; }
+	uint64 GetEvict() const { return evict; }
+
+	// key から ID を作る。0 は使えないので 0 にはならない。
+	static uint32 MakeId(const std::string& key);
+
+	// RGB (1ピクセル3バイト、パディングなし) の画像を ID id で
+	// 送信 (表示はしない) するシーケンスを返す。
+	static std::string UploadSequence(uint32 id, const uint8 *rgb,
+		int width, int height);
+
+	// ID id の画像を現在のカーソル位置に表示するシーケンスを返す。
+	// カーソルは SIXEL (の xterm での動作) と同じく、画像の最終行の
+	// 次の行の同じ桁に移動する。rows は画像が占める行数。
+	static std::string PlaceSequence(uint32 id, int rows);
+
+	// ID id の画像を端末から削除するシーケンスを返す。
+	static std::string DeleteSequence(uint32 id);
+
+	// 1回のシーケンスで送る Base64 のバイト数の上限。
+	static const size_t ChunkSize = 4096;
+
+ private:
+	void Remove(const std::string& key);
+
+	using List = std::list<std::pair<std::string, Entry>>;
+
+	// 先頭が最近表示したもの
+	List lru {};
+	std::unordered_map<std::string, List::iterator> entries {};
+	std::unordered_map<uint32, List::iterator> ids {};
+
+	size_t budget {};
+	size_t total {};
+
+	uint64 evict {};
+};
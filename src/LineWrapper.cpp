@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "LineWrapper.h"
+#include "term.h"
+#include <cassert>
+
+// コンストラクタ
+LineWrapper::LineWrapper(std::string& dst_, UString& ubuf_, int left_,
+	int cols_, bool use_ubuf_)
+	: dst(dst_), ubuf(ubuf_), use_ubuf(use_ubuf_),
+	  left(left_), cols(cols_), x(left_)
+{
+	ubuf.clear();
+	indentlen = snprintf(indent, sizeof(indent), CSI "%dC", left);
+	PutIndent();
+}
+
+// 1文字追加する。
+void
+LineWrapper::Put(unichar uni)
+{
+	if (__predict_false(cols == 0)) {
+		// 桁数が分からない場合は何もしない
+		Emit(uni);
+		return;
+	}
+
+	if (__predict_false(in_escape > 0)) {
+		// 1: ESC直後
+		// 2: ESC [
+		// 3: ESC (
+		Emit(uni);
+		switch (in_escape) {
+		 case 1:
+			// ESC 直後の文字で二手に分かれる
+			if (uni == '[') {
+				in_escape = 2;
+			} else {
+				in_escape = 3;	// 手抜き
+			}
+			break;
+		 case 2:
+			// ESC [ 以降 'm' まで
+			if (uni == 'm') {
+				in_escape = 0;
+			}
+			break;
+		 case 3:
+			// ESC ( の次の1文字だけ
+			in_escape = 0;
+			break;
+		}
+		return;
+	}
+
+	uint8 props;
+	if (__predict_true(0x20 <= uni && uni < 0x7f)) {
+		// ASCII の表示文字は幅 1 の GCB_Other。
+		props = 0x01;
+	} else {
+		props = get_eaw_props(uni);
+	}
+
+	if (gcb.Next(props) == false) {
+		// 書記素クラスタの続きなので前の文字と同じ桁に重なる。
+		// ただし国旗は2文字とも幅を数える。
+		Emit(uni);
+		if (__predict_false(gcb.IsRIPair())) {
+			x += EAW_WIDTH(props);
+			if (x > cols - 1) {
+				wrap_pending = true;
+			}
+		}
+		return;
+	}
+
+	// ここからは新しいクラスタ。
+	if (wrap_pending) {
+		Newline();
+	}
+
+	if (uni == ESCchar) {
+		Emit(uni);
+		in_escape = 1;
+	} else if (uni == '\n') {
+		Newline();
+	} else {
+		// 文字幅を取得
+		int width = EAW_WIDTH(props);
+		if (width == 1) {
+			Emit(uni);
+			x++;
+		} else {
+			assert(width == 2);
+			if (x > cols - 2) {
+				Newline();
+			}
+			Emit(uni);
+			x += 2;
+		}
+		if (x > cols - 1) {
+			wrap_pending = true;
+		}
+	}
+}
+
+// 終了する。
+void
+LineWrapper::Finish()
+{
+	if (wrap_pending) {
+		Newline();
+	}
+	if (use_ubuf) {
+		dst += ubuf.ToString();
+	}
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include "UString.h"
+#include "eaw_code.h"
+#include <string>
+
+//
+// print_() の Stage2。
+//
+// 1文字ずつ受け取って、桁数を数えながらインデントと折り返しを付け、
+// 出力文字コードのバイト列にして dst に追加していく。
+// 桁数は書記素クラスタ単位で数え、結合文字や ZWJ で繋いだ絵文字などを
+// 行の途中で分断しないようにする。
+// 出力が UTF-8 ならその場でエンコードする。それ以外の文字コードに
+// 変換する場合は、いったん ubuf に溜めて最後に文字列全体を変換する。
+class LineWrapper
+{
+ public:
+	// left はインデント桁数、cols は画面の桁数 (0 なら折り返さない)。
+	// use_ubuf_ なら UTF-8 以外に変換する。
+	LineWrapper(std::string& dst_, UString& ubuf_, int left_, int cols_,
+		bool use_ubuf_);
+
+	// 1文字追加する。
+	void Put(unichar uni);
+
+	// ASCII 文字列 (エスケープシーケンスを含む) を追加する。
+	void PutASCII(const char *s) {
+		for (; *s; s++) {
+			Put((unsigned char)*s);
+		}
+	}
+
+	// 終了する。
+	void Finish();
+
+ private:
+	// uni を出力する。
+	void Emit(unichar uni) {
+		if (__predict_false(use_ubuf)) {
+			ubuf.Append(uni);
+		} else if (__predict_true(uni < 0x80)) {
+			dst.push_back((char)uni);
+		} else {
+			char tmp[4];
+			int n = UString::UCharToUTF8(tmp, uni);
+			dst.append(tmp, n);
+		}
+	}
+
+	// 改行してインデントする。
+	void Newline() {
+		Emit('\n');
+		PutIndent();
+		x = left;
+		wrap_pending = false;
+	}
+
+	// インデントを出力する。
+	void PutIndent() {
+		for (int i = 0; i < indentlen; i++) {
+			Emit((unsigned char)indent[i]);
+		}
+	}
+
+	std::string& dst;
+	UString& ubuf;
+	bool use_ubuf {};
+
+	int left {};			// インデント桁数
+	int cols {};			// 画面の桁数
+	int x {};				// 現在の桁位置
+	int in_escape {};
+	char indent[16] {};		// インデント用のエスケープシーケンス
+	int indentlen {};
+
+	// 行末まで埋まったので、次のクラスタの前で改行する。
+	// (クラスタの続きの文字はこの行に出す)
+	bool wrap_pending {};
+
+	GraphemeBreak gcb {};
+};
@@ -0,0 +1,645 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// MFM (Misskey Flavored Markdown) の字句解析
+//
+
+#include "MFM.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+// 文字の分類 (ASCII のみ)
+enum {
+	CC_ALNUM	= 0x01,	// 英数字
+	CC_MENT1	= 0x02,	// メンションの1文字目 ("_" + 英数字)
+	CC_MENT2	= 0x04,	// メンションの2文字目以降 (+ "@.-")
+	CC_URL		= 0x08,	// URL (+ "#%&/:;=?^~")
+	CC_EMOJI	= 0x10,	// 絵文字名 ("_+-" + 英数字)
+	CC_FN		= 0x20,	// $[ の名前と引数 (空白と角括弧以外の表示文字)
+	CC_INLINE	= 0x40,	// *x* と _x_ の中身 (英数字と空白とタブ)
+	CC_SPECIAL	= 0x80,	// 字句の先頭になりうる文字
+};
+
+static std::array<uint8, 128>
+make_cctab()
+{
+	std::array<uint8, 128> t {};
+
+	for (int c = 0; c < 128; c++) {
+		uint8 v = 0;
+		if (('0' <= c && c <= '9') ||
+		    ('A' <= c && c <= 'Z') ||
+		    ('a' <= c && c <= 'z'))
+		{
+			v |= CC_ALNUM | CC_MENT1 | CC_MENT2 | CC_URL | CC_EMOJI | CC_INLINE;
+		}
+		if (0x20 < c && c < 0x7f && c != '[' && c != ']') {
+			v |= CC_FN;
+		}
+		t[c] = v;
+	}
+	for (auto p = "_"; *p; p++) {
+		t[(uint8)*p] |= CC_MENT1 | CC_MENT2 | CC_URL | CC_EMOJI;
+	}
+	for (auto p = "@.-"; *p; p++) {
+		t[(uint8)*p] |= CC_MENT2 | CC_URL;
+	}
+	for (auto p = "#%&/:;=?^~"; *p; p++) {
+		t[(uint8)*p] |= CC_URL;
+	}
+	for (auto p = "+-"; *p; p++) {
+		t[(uint8)*p] |= CC_EMOJI;
+	}
+	for (auto p = " \t"; *p; p++) {
+		t[(uint8)*p] |= CC_INLINE;
+	}
+	for (auto p = "<$]@#h*_~`:\\>"; *p; p++) {
+		t[(uint8)*p] |= CC_SPECIAL;
+	}
+	return t;
+}
+
+static const std::array<uint8, 128> cctab = make_cctab();
+
+// c が分類 cc に含まれるか。
+static inline bool
+is_class(unichar c, uint8 cc)
+{
+	return (c < 0x80 && (cctab[c] & cc) != 0);
+}
+
+// ASCII 大文字を小文字にする。
+static inline unichar
+to_lower(unichar c)
+{
+	if ('A' <= c && c <= 'Z') {
+		c += 0x20;
+	}
+	return c;
+}
+
+// コンストラクタ
+MFM::MFM()
+{
+}
+
+// デストラクタ
+MFM::~MFM()
+{
+}
+
+// ハッシュタグの照合器を空にする。
+void
+MFM::ClearTags()
+{
+	tags.clear();
+	tagmask = 0;
+}
+
+// ハッシュタグを1つ追加する。
+void
+MFM::AddTag(const std::string& tag)
+{
+	UString utag = UString::FromUTF8(tag);
+	if (utag.empty()) {
+		return;
+	}
+	for (auto& c : utag) {
+		c = to_lower(c);
+	}
+	tagmask |= 1ULL << (utag[0] & 63);
+
+	// 長いほうを優先して一致させるため、長い順に並べておく。
+	auto it = std::find_if(tags.begin(), tags.end(),
+		[&](const UString& t) { return t.size() < utag.size(); });
+	tags.emplace(it, std::move(utag));
+}
+
+// src を字句解析する。
+const std::vector<MFM::Token>&
+MFM::Parse(const UString& src_)
+{
+	src = &src_;
+	srclen = src_.size();
+	textpos = 0;
+	no_codeblock = false;
+	no_mathblock = false;
+	no_math_until = 0;
+	tokens.clear();
+	stack.clear();
+
+	const unichar *s = src_.data();
+	for (size_t pos = 0; pos < srclen; ) {
+		unichar c = s[pos];
+		if (__predict_true(is_class(c, CC_SPECIAL) == false)) {
+			pos++;
+			continue;
+		}
+
+		size_t n = 0;
+		switch (c) {
+		 case '<':
+			n = LexLT(pos);
+			break;
+		 case '$':
+			n = LexDollar(pos);
+			break;
+		 case ']':
+			if (Close(Fn, pos, 1)) {
+				n = 1;
+			}
+			break;
+		 case '@':
+			n = LexMention(pos);
+			break;
+		 case '#':
+			n = LexHashtag(pos);
+			break;
+		 case 'h':
+			n = LexUrl(pos);
+			break;
+		 case '*':
+			n = LexAsterisk(pos);
+			break;
+		 case '_':
+			n = LexUnderscore(pos);
+			break;
+		 case '~':
+			if (src->At(pos + 1) == '~') {
+				Toggle(Strike, pos, 2);
+				n = 2;
+			}
+			break;
+		 case '`':
+			n = LexCode(pos, (pos == 0 || s[pos - 1] == '\n'));
+			break;
+		 case ':':
+			n = LexEmoji(pos);
+			break;
+		 case '\\':
+			n = LexMath(pos);
+			break;
+		 case '>':
+			// 引用は行頭のみ。
+			if (pos == 0 || s[pos - 1] == '\n') {
+				n = (src->At(pos + 1) == ' ') ? 2 : 1;
+				Add(Quote, None, pos, n);
+			}
+			break;
+		 default:
+			break;
+		}
+		pos += (n > 0) ? n : 1;
+	}
+	Finish();
+
+	return tokens;
+}
+
+// '<' で始まるもの。
+size_t
+MFM::LexLT(size_t pos)
+{
+	static const struct {
+		const char *open;
+		const char *close;
+		Style style;
+	} tagtab[] = {
+		{ "<b>",		"</b>",			Bold },
+		{ "<i>",		"</i>",			Italic },
+		{ "<s>",		"</s>",			Strike },
+		{ "<small>",	"</small>",		Small },
+		{ "<center>",	"</center>",	Center },
+	};
+
+	if (Match(pos, "<plain>")) {
+		// <plain> なら閉じ </plain> までは一切解釈しない。
+		// 閉じタグがなければ最後まで plain 扱いにする。
+		Add(Markup, None, pos, 7);
+		size_t start = pos + 7;
+		size_t e = Find(start, "</plain>", false);
+		if (e == (size_t)-1) {
+			if (srclen > start) {
+				Add(Plain, None, start, srclen - start);
+			}
+			return srclen - pos;
+		}
+		if (e > start) {
+			Add(Plain, None, start, e - start);
+		}
+		Add(Markup, None, e, 8);
+		return e + 8 - pos;
+	}
+
+	if (src->At(pos + 1) == '/') {
+		for (const auto& t : tagtab) {
+			if (Match(pos, t.close)) {
+				size_t len = strlen(t.close);
+				return Close(t.style, pos, len) ? len : 0;
+			}
+		}
+		return 0;
+	}
+
+	for (const auto& t : tagtab) {
+		if (Match(pos, t.open)) {
+			size_t len = strlen(t.open);
+			Open(t.style, pos, len);
+			return len;
+		}
+	}
+
+	// <https://...> は括弧を表示しない URL。
+	if (Match(pos + 1, "https://") || Match(pos + 1, "http://")) {
+		size_t len = UrlLen(pos + 1);
+		if (src->At(pos + 1 + len) == '>') {
+			Add(Markup, None, pos, 1);
+			Add(Url, None, pos + 1, len);
+			Add(Markup, None, pos + 1 + len, 1);
+			return len + 2;
+		}
+	}
+	return 0;
+}
+
+// '$' で始まるもの。
+size_t
+MFM::LexDollar(size_t pos)
+{
+	// "$[name.args " から対応する ']' までが関数。
+	// 関数による装飾は表示できないので中身だけを表示する。
+	if (src->At(pos + 1) != '[') {
+		return 0;
+	}
+	size_t e = pos + 2;
+	while (e < srclen && is_class((*src)[e], CC_FN)) {
+		e++;
+	}
+	if (e == pos + 2 || src->At(e) != ' ') {
+		return 0;
+	}
+	size_t len = e + 1 - pos;
+	Open(Fn, pos, len);
+	return len;
+}
+
+// '@' で始まるもの。
+size_t
+MFM::LexMention(size_t pos)
+{
+	// 英数字に続く '@' (メールアドレスなど) はメンションではない。
+	if (PrevIsAlnum(pos)) {
+		return 0;
+	}
+	// '@' の次が [\w\d_] ならメンション。
+	// 2文字目以降はホスト名も来る可能性がある。
+	if (is_class(src->At(pos + 1), CC_MENT1) == false) {
+		return 0;
+	}
+	size_t e = pos + 2;
+	while (e < srclen && is_class((*src)[e], CC_MENT2)) {
+		e++;
+	}
+	Add(Mention, None, pos, e - pos);
+	return e - pos;
+}
+
+// '#' で始まるもの。
+size_t
+MFM::LexHashtag(size_t pos)
+{
+	// タグはノートに付いてきたものと一致すればタグ。
+	// タグの先頭文字で大半は弾けるので、残ったものだけ長い順に比較する。
+	unichar c1 = to_lower(src->At(pos + 1));
+	if ((tagmask & (1ULL << (c1 & 63))) == 0) {
+		return 0;
+	}
+	for (const auto& tag : tags) {
+		size_t len = tag.size();
+		if (pos + 1 + len > srclen) {
+			continue;
+		}
+		size_t i = 0;
+		for (; i < len; i++) {
+			if (to_lower((*src)[pos + 1 + i]) != tag[i]) {
+				break;
+			}
+		}
+		if (i == len) {
+			// '#' 文字自身も含める。
+			Add(Hashtag, None, pos, len + 1);
+			return len + 1;
+		}
+	}
+	return 0;
+}
+
+// 'h' で始まるもの。
+size_t
+MFM::LexUrl(size_t pos)
+{
+	if (Match(pos, "https://") || Match(pos, "http://")) {
+		size_t len = UrlLen(pos);
+		Add(Url, None, pos, len);
+		return len;
+	}
+	return 0;
+}
+
+// pos からの URL の長さを返す。
+size_t
+MFM::UrlLen(size_t pos) const
+{
+	// URL に使える文字集合がよく分からない。
+	// 括弧 "(",")" は、開き括弧なしで閉じ括弧が来ると URL 終了。
+	// 一方開き括弧は URL 内に来てもよい。
+	// "(http://foo/a)b" は http://foo/a が URL。
+	// "http://foo/a(b)c" は http://foo/a(b)c が URL。
+	// 正気か?
+	int url_in_paren = 0;
+	size_t e = pos;
+	for (; e < srclen; e++) {
+		unichar c = (*src)[e];
+		if (is_class(c, CC_URL)) {
+			continue;
+		} else if (c == '(') {
+			url_in_paren++;
+		} else if (c == ')' && url_in_paren > 0) {
+			url_in_paren--;
+		} else {
+			break;
+		}
+	}
+	return e - pos;
+}
+
+// '*' で始まるもの。
+size_t
+MFM::LexAsterisk(size_t pos)
+{
+	if (src->At(pos + 1) == '*') {
+		Toggle(Bold, pos, 2);
+		return 2;
+	}
+	return LexSimple(pos, '*', Italic);
+}
+
+// '_' で始まるもの。
+size_t
+MFM::LexUnderscore(size_t pos)
+{
+	if (src->At(pos + 1) == '_') {
+		// __x__ は中身が英数字と空白のみ。
+		size_t e = pos + 2;
+		while (e < srclen && is_class((*src)[e], CC_INLINE)) {
+			e++;
+		}
+		if (e > pos + 2 && Match(e, "__")) {
+			Add(Begin, Bold, pos, 2);
+			Add(End, Bold, e, 2);
+			return e + 2 - pos;
+		}
+		return 2;
+	}
+	return LexSimple(pos, '_', Italic);
+}
+
+// *x* と _x_ (中身は英数字と空白のみ、前が英数字なら対象外)。
+size_t
+MFM::LexSimple(size_t pos, unichar delim, Style style)
+{
+	if (PrevIsAlnum(pos)) {
+		return 0;
+	}
+	size_t e = pos + 1;
+	while (e < srclen && is_class((*src)[e], CC_INLINE)) {
+		e++;
+	}
+	if (e == pos + 1 || src->At(e) != delim) {
+		return 0;
+	}
+	Add(Begin, style, pos, 1);
+	Add(End, style, e, 1);
+	return e + 1 - pos;
+}
+
+// '`' で始まるもの。
+size_t
+MFM::LexCode(size_t pos, bool linehead)
+{
+	// 行頭の ``` から次の行頭の ``` まではコードブロック。
+	if (linehead && no_codeblock == false && Match(pos, "```")) {
+		size_t e = Find(pos + 3, "\n```", false);
+		if (e != (size_t)-1) {
+			size_t len = e + 4 - pos;
+			Add(Code, None, pos, len);
+			return len;
+		}
+		no_codeblock = true;
+	}
+
+	// 同じ行の次の '`' まではインラインコード。
+	size_t e = pos + 1;
+	for (; e < srclen; e++) {
+		unichar c = (*src)[e];
+		if (c == '`' || c == '\n') {
+			break;
+		}
+	}
+	if (e > pos + 1 && src->At(e) == '`') {
+		size_t len = e + 1 - pos;
+		Add(Code, None, pos, len);
+		return len;
+	}
+	return 0;
+}
+
+// ':' で始まるもの。
+size_t
+MFM::LexEmoji(size_t pos)
+{
+	// 英数字に続く ':' (時刻など) は絵文字ではない。
+	if (PrevIsAlnum(pos)) {
+		return 0;
+	}
+	size_t e = pos + 1;
+	while (e < srclen && is_class((*src)[e], CC_EMOJI)) {
+		e++;
+	}
+	if (e == pos + 1 || src->At(e) != ':') {
+		return 0;
+	}
+	size_t len = e + 1 - pos;
+	Add(Emoji, None, pos, len);
+	return len;
+}
+
+// '\' で始まるもの。
+size_t
+MFM::LexMath(size_t pos)
+{
+	unichar nc = src->At(pos + 1);
+	size_t e = (size_t)-1;
+	if (nc == '(' && pos >= no_math_until) {
+		e = Find(pos + 2, "\\)", true);
+		if (e == (size_t)-1) {
+			size_t i = pos + 2;
+			while (i < srclen && (*src)[i] != '\n') {
+				i++;
+			}
+			no_math_until = i;
+		}
+	} else if (nc == '[' && no_mathblock == false) {
+		e = Find(pos + 2, "\\]", false);
+		if (e == (size_t)-1) {
+			no_mathblock = true;
+		}
+	}
+	if (e == (size_t)-1) {
+		return 0;
+	}
+	size_t len = e + 2 - pos;
+	Add(Math, None, pos, len);
+	return len;
+}
+
+// 字句を追加する。その前に未確定の文字列があればそれも追加する。
+void
+MFM::Add(Type type, Style style, size_t pos, size_t len)
+{
+	if (pos > textpos) {
+		tokens.push_back({ Text, None, (uint32)textpos, (uint32)(pos - textpos) });
+	}
+	tokens.push_back({ type, style, (uint32)pos, (uint32)len });
+	textpos = pos + len;
+}
+
+// 装飾の開き記号を追加する。
+void
+MFM::Open(Style style, size_t pos, size_t len)
+{
+	Add(Begin, style, pos, len);
+	stack.push_back(tokens.size() - 1);
+}
+
+// 装飾の閉じ記号を追加する。
+// 対応する開き記号がなければ何もせず false を返す。
+bool
+MFM::Close(Style style, size_t pos, size_t len)
+{
+	// 開き記号の1文字目。"</b>" なら "<b>"、']' なら "$[" と対応する。
+	unichar c = (*src)[pos];
+	unichar open = (c == ']') ? '$' : c;
+
+	for (size_t i = stack.size(); i-- > 0; ) {
+		const Token& t = tokens[stack[i]];
+		if (t.style == style && (*src)[t.pos] == open) {
+			// 間にある対応の取れなかった開き記号は文字列に戻す。
+			for (size_t j = i + 1; j < stack.size(); j++) {
+				tokens[stack[j]].type = Text;
+				tokens[stack[j]].style = None;
+			}
+			stack.resize(i);
+			Add(End, style, pos, len);
+			return true;
+		}
+	}
+	return false;
+}
+
+// ** や ~~ のように開きと閉じが同じ記号。
+void
+MFM::Toggle(Style style, size_t pos, size_t len)
+{
+	if (Close(style, pos, len) == false) {
+		Open(style, pos, len);
+	}
+}
+
+// 終端処理。
+void
+MFM::Finish()
+{
+	// 対応の取れなかった開き記号は文字列に戻す。
+	for (auto i : stack) {
+		tokens[i].type = Text;
+		tokens[i].style = None;
+	}
+	stack.clear();
+
+	if (srclen > textpos) {
+		tokens.push_back({ Text, None, (uint32)textpos,
+			(uint32)(srclen - textpos) });
+	}
+
+	// 隣り合った文字列をまとめる。
+	size_t d = 0;
+	for (size_t i = 0, end = tokens.size(); i < end; i++) {
+		if (d > 0 && tokens[i].type == Text && tokens[d - 1].type == Text) {
+			tokens[d - 1].len += tokens[i].len;
+		} else {
+			tokens[d++] = tokens[i];
+		}
+	}
+	tokens.resize(d);
+}
+
+// pos 以降で key (ASCII) の位置を探す。
+// oneline なら改行までで探す。見付からなければ -1 を返す。
+size_t
+MFM::Find(size_t pos, const char *key, bool oneline) const
+{
+	for (size_t i = pos; i < srclen; i++) {
+		unichar c = (*src)[i];
+		if (oneline && c == '\n' && key[0] != '\n') {
+			break;
+		}
+		if (c == (unsigned char)key[0] && Match(i, key)) {
+			return i;
+		}
+	}
+	return (size_t)-1;
+}
+
+// pos からが key (ASCII) と一致するか。
+bool
+MFM::Match(size_t pos, const char *key) const
+{
+	for (size_t i = pos; *key; i++, key++) {
+		if (i >= srclen || (*src)[i] != (unsigned char)*key) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// pos の直前の文字が英数字なら true を返す。
+bool
+MFM::PrevIsAlnum(size_t pos) const
+{
+	return (pos > 0 && is_class((*src)[pos - 1], CC_ALNUM));
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include "UString.h"
+#include <string>
+#include <vector>
+
+//
+// MFM (Misskey Flavored Markdown) の字句解析
+//
+// 本文を1回走査して、表示用の属性付きの区間 (Token) の列にする。
+// 文字の分類は表引き、ハッシュタグはノートごとに作る照合器で探す。
+// 開き記号 (** や <b> や $[ など) は閉じ記号が来た時点で対応が確定し、
+// 最後まで対応の取れなかったものは普通の文字列に戻す。
+// そのため閉じ記号を先読みで探すことはしない。
+//
+// 表示に使う分だけを扱うので、構文木は作らない。
+// 例えばリンク [label](url) は文字列と URL として扱う。
+class MFM
+{
+ public:
+	enum Type : uint8 {
+		Text,		// 文字列
+		Markup,		// 表示しない記号 (<plain> など)
+		Mention,	// @user@host
+		Hashtag,	// #tag ('#' を含む)
+		Url,		// http(s)://...
+		Emoji,		// :name:
+		Code,		// `code` や ```code``` (記号を含む)
+		Math,		// \(math\) や \[math\] (記号を含む)
+		Plain,		// <plain> の中身
+		Quote,		// 行頭の "> "
+		Begin,		// 装飾の開始記号 (style が種類)
+		End,		// 装飾の終了記号 (style が種類)
+	};
+
+	enum Style : uint8 {
+		None,
+		Bold,		// **x**, __x__, <b>x</b>
+		Italic,		// *x*, _x_, <i>x</i>
+		Strike,		// ~~x~~, <s>x</s>
+		Small,		// <small>x</small>
+		Center,		// <center>x</center>
+		Fn,			// $[name.args x]
+	};
+
+	struct Token {
+		Type type {};
+		Style style {};
+		uint32 pos {};		// 元の文字列での開始位置
+		uint32 len {};		// 文字数
+	};
+
+	MFM();
+	~MFM();
+
+	// ハッシュタグの照合器を空にする。
+	void ClearTags();
+	// ハッシュタグを1つ追加する。tag は '#' を含まない UTF-8 文字列。
+	void AddTag(const std::string& tag);
+
+	// src を字句解析する。
+	// 返した参照は次に Parse() を呼ぶまで有効。
+	const std::vector<Token>& Parse(const UString& src);
+
+ private:
+	size_t LexLT(size_t pos);
+	size_t LexDollar(size_t pos);
+	size_t LexMention(size_t pos);
+	size_t LexHashtag(size_t pos);
+	size_t LexUrl(size_t pos);
+	size_t LexAsterisk(size_t pos);
+	size_t LexUnderscore(size_t pos);
+	size_t LexCode(size_t pos, bool linehead);
+	size_t LexEmoji(size_t pos);
+	size_t LexMath(size_t pos);
+	size_t LexSimple(size_t pos, unichar delim, Style style);
+
+	void Add(Type type, Style style, size_t pos, size_t len);
+	void Open(Style style, size_t pos, size_t len);
+	bool Close(Style style, size_t pos, size_t len);
+	void Toggle(Style style, size_t pos, size_t len);
+	void Finish();
+
+	size_t UrlLen(size_t pos) const;
+	size_t Find(size_t pos, const char *key, bool oneline) const;
+	bool Match(size_t pos, const char *key) const;
+	bool PrevIsAlnum(size_t pos) const;
+
+	const UString *src {};
+	size_t srclen {};
+	size_t textpos {};				// 未確定の Text の開始位置
+
+	// 閉じ記号が見付からなかった複数行にわたる記号。
+	// 以降にも閉じ記号はないので、もう探さない。
+	bool no_codeblock {};
+	bool no_mathblock {};
+	// "\(" の閉じ記号がこの位置 (の行末) までにはない。
+	size_t no_math_until {};
+
+	std::vector<Token> tokens {};
+	std::vector<uint32> stack {};	// 対応待ちの Begin の tokens 上の位置
+
+	// ハッシュタグ (英字は小文字にしたもの、長い順)
+	std::vector<UString> tags {};
+	// タグの先頭文字の下位6ビットの集合。一致しない '#' を早く弾くため。
+	uint64 tagmask {};
+};
@@ -87,6 +87,21 @@ MemoryStream::Read(void *dst, size_t dstsize)
 	return rv;
 }
 
+// 書き込み (末尾に追加)
+// 細かい書き込みが続いても chunk が増えないよう、最後の chunk に連結する。
+ssize_t
+MemoryStream::Write(const void *src, size_t srclen)
+{
+	const uint8 *s = (const uint8 *)src;
+
+	if (chunks.empty()) {
+		chunks.emplace_back(std::vector<uint8>(), 0);
+	}
+	auto& buf = chunks.back().first;
+	buf.insert(buf.end(), s, s + srclen);
+	return srclen;
+}
+
 // このストリームの残りバイト数を返す。
 size_t
 MemoryStream::GetSize() const
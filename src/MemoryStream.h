@@ -37,6 +37,7 @@ class MemoryStream : public Stream
 	virtual ~MemoryStream() override;
 
 	ssize_t Read(void *buf, size_t bufsize) override;
+	ssize_t Write(const void *buf, size_t len) override;
 
 	// データを末尾に追加
 	void Append(const std::vector<uint8>& src);
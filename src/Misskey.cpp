@@ -26,8 +26,14 @@
 #include "sayaka.h"
 #include "Display.h"
 #include "JsonInc.h"
+#include "MFM.h"
 #include "Misskey.h"
+#include "Note.h"
+#include "OrderedPipeline.h"
 #include "Random.h"
+#include "SeenNotes.h"
+#include "StageStat.h"
+#include "Stream.h"
 #include "StringUtil.h"
 #include "UString.h"
 #include "WSClient.h"
@@ -36,27 +42,53 @@
 #include <cstdio>
 #include <err.h>
 #include <poll.h>
+#include <sys/resource.h>
 #include <unistd.h>
 
+// ノートを表示用に整形した文字列。
+// 表示するかどうかの判定 (重複、NG、連続リノート) とは関係なく作れるので、
+// 並列再生ではワーカーが前もって作っておく。
+struct NoteText
+{
+	UString header {};			// 名前、ID、インスタンス名
+	UString text {};			// CW と本文
+	UString poll {};			// 投票 (なければ空)
+	UString counts {};			// RN 数とリアクション数
+	UString footer {};			// 時刻と counts
+	UString owner {};			// リノート元 (リノートでなければ空)
+	std::string userid {};		// アイコンのキャッシュ名に使う ID
+	std::string avatarUrl {};
+};
+
 static bool misskey_stream(WSClient&, Random&);
 static void misskey_onmsg(void *aux, wslay_event_context_ptr ctx,
 	const wslay_event_on_msg_recv_arg *msg);
-static bool misskey_show_note(const Json *note, int depth);
-static bool misskey_show_announcement(const Json& note);
-static std::string misskey_format_username(const Json& user);
-static std::string misskey_format_userid(const Json& user);
-static void UString_tolower(UString& str);
-static int UString_ncasecmp(const UString& src, int pos, const UString& key);
-static UString misskey_display_text(const std::string& text, const Json& note);
-static std::string misskey_format_time(const Json& note);
-static bool misskey_show_icon(const Json& user, const std::string& userid);
-static bool misskey_show_noicon(const Json& user, const std::string& userid);
-static UString misskey_display_poll(const Json& poll);
-static bool misskey_show_photo(const Json& f, int resize_width, int index);
-static void misskey_print_filetype(const Json& f, const char *nsfw);
-static UString misskey_display_renote_count(const Json& note);
-static UString misskey_display_reaction_count(const Json& note);
-static UString misskey_display_renote_owner(const Json& note);
+static bool misskey_show_note(const Note& note, int depth,
+	const NoteText *pre);
+static void misskey_format_note(NoteText& dst, const Note& note);
+static void misskey_prefetch_images(const Note& note);
+static bool misskey_show_announcement(const Json& ann, const Note& note);
+static void misskey_render(const Note& note, const Json *ann, uint64 start,
+	const NoteText *pre = NULL);
+static std::string misskey_format_username(const NoteUser& user);
+static std::string misskey_format_userid(const NoteUser& user);
+static Color misskey_style2color(MFM::Style style);
+static UString misskey_display_text(std::string_view text, const Note& note);
+static std::string misskey_format_time(const Note& note);
+static std::string misskey_icon_file(const std::string& avatarUrl,
+	const std::string& userid);
+static bool misskey_show_icon(const std::string& avatarUrl,
+	const std::string& userid);
+static UString misskey_display_poll(const Note& note);
+static void misskey_show_photo(const NoteFile& f, int index);
+static std::string misskey_blurhash_url(const std::string& blurhash,
+	int width, int height, int resize_width, std::string *img_filep);
+static bool misskey_show_blurhash(const std::string& blurhash,
+	int width, int height, int resize_width, int index);
+static void misskey_print_filetype(const std::string& type, const char *nsfw);
+static UString misskey_display_renote_count(const Note& note);
+static UString misskey_display_reaction_count(const Note& note);
+static UString misskey_display_renote_owner(const Note& note);
 
 int
 cmd_misskey_stream()
@@ -70,6 +102,9 @@ cmd_misskey_stream()
 	// -1 は初回。0 は EOF による(正常)リトライ。
 	int retry_count = -1;
 	for (;;) {
+		if (retry_count >= 0) {
+			StageStat::Count(Counter::Reconnect);
+		}
 		if (__predict_false(retry_count > 0)) {
 			time_t now = GetUnixTime();
 			struct tm tm;
@@ -175,8 +210,30 @@ misskey_stream(WSClient& client, Random& rnd)
 			break;
 		}
 
-		while ((r = poll(&pfd, 1, -1)) < 0 && errno == EINTR)
-			;
+		// 端末の大きさが変わったら、変更が落ち着くまで (しばらく
+		// シグナルが来なくなるまで) 待ってから描き直す。受信が続いていても
+		// 待ち時間は延ばさない。
+		// 統計を定期的に書き出すならその時刻にも起きる。
+		for (;;) {
+			check_redraw();
+			int timeout = redraw_timeout();
+			int mtimeout = metrics_timeout();
+			if (mtimeout >= 0 && (timeout < 0 || mtimeout < timeout)) {
+				timeout = mtimeout;
+			}
+			{
+				TraceScope trace("poll");
+				r = poll(&pfd, 1, timeout);
+			}
+			if (r < 0 && errno != EINTR) {
+				break;
+			}
+			check_metrics();
+			if (r <= 0) {
+				continue;
+			}
+			break;
+		}
 		if (r < 0) {
 			warn("%s: poll", __func__);
 			break;
@@ -190,6 +247,7 @@ misskey_stream(WSClient& client, Random& rnd)
 			}
 		}
 		if ((pfd.revents & POLLIN)) {
+			TraceScope trace("recv");
 			r = wslay_event_recv(ctx);
 			if (r == WSLAY_ERR_CALLBACK_FAILURE) {
 				// EOF
@@ -212,6 +270,8 @@ misskey_onmsg(void *aux, wslay_event_context_ptr ctx,
 	if (msg->msg_length == 0) {
 		return;
 	}
+	TraceScope trace("onmsg");
+	StageStat::Count(Counter::BytesIn, msg->msg_length);
 
 	std::string line((const char *)msg->msg, msg->msg_length);
 
@@ -221,12 +281,58 @@ misskey_onmsg(void *aux, wslay_event_context_ptr ctx,
 	misskey_show_object(line);
 }
 
+// --play の計測結果。
+static struct {
+	uint64 count;
+	uint64 parse_usec;		// 並列再生ならワーカーでの処理時間
+	uint64 render_usec;
+	uint64 first_usec;		// 最初のノートの解析を始めた時刻
+	uint64 last_usec;		// 最後のノートを表示し終えた時刻
+	int threads;			// 並列再生のワーカー数 (並列でなければ 0)
+	int window;
+	uint64 emit_waits;
+	uint64 read_waits;
+} play_stat;
+
+// DOM 用のアリーナ
+static JsonArena json_arena;
+
 // 1ノート(文字列)を処理する。
 bool
 misskey_show_object(const std::string& line)
 {
+	// 解析器は作業領域ごと使い回す。
+	static NoteParser parser;
+	uint64 start = 0;
+
+	if (__predict_false(diagShow >= 1)) {
+		start = GetMonotonicUsec();
+	}
+
+	// 普段は DOM を作らずに表示に使うところだけを取り出す。
+	// それで扱えないメッセージだけ DOM で処理する。
+	if (opt_json_sax) {
+		NoteParser::Result r;
+		{
+			StageTimer timer(Stage::Parse);
+			r = parser.Parse(line);
+		}
+		if (__predict_true(r == NoteParser::Result::Note)) {
+			misskey_render(parser.GetNote(), NULL, start);
+			return true;
+		}
+		if (r == NoteParser::Result::Ignore) {
+			return true;
+		}
+	}
+
+	// DOM は表示し終わったらすぐ捨てるので、アリーナから確保する。
+	// (obj0 より先に作っておき、後で破棄されるように)
+	JsonArena::Scope arena_scope(json_arena);
+
 	Json obj0;
 	try {
+		StageTimer timer(Stage::Parse);
 		obj0 = Json::parse(line);
 	} catch (const std::exception& e) {
 		warnx("%s: %s\ninput line is |%s|", __func__, e.what(), line.c_str());
@@ -285,64 +391,380 @@ misskey_show_object(const std::string& line)
 		}
 	}
 
-	bool crlf = misskey_show_note(obj, 0);
-	if (crlf) {
-		printf("\n");
+	// アナウンスなら別処理。構造が全然違う。
+	if (obj->contains("announcement") && (*obj)["announcement"].is_object()) {
+		const Json& ann = (*obj)["announcement"];
+		misskey_render(parser.FromJson(ann), &ann, start);
+	} else {
+		misskey_render(parser.FromJson(*obj), NULL, start);
 	}
 	return true;
 }
 
-// 1ノート(Json)を処理する。
-static bool
-misskey_show_note(const Json *note, int depth)
+// 取り出したノート (ann が NULL でなければアナウンス) を表示する。
+// start は計測中なら解析を始めた時刻。
+// pre は整形済みの文字列 (なければ NULL)。
+static void
+misskey_render(const Note& note, const Json *ann, uint64 start,
+	const NoteText *pre)
 {
-	assert(note->is_object());
+	StageTimer timer(Stage::Note);
+	uint64 parsed = 0;
+	if (__predict_false(start != 0)) {
+		parsed = GetMonotonicUsec();
+	}
 
+	// 1ノート分を溜めて一度に書き出す。
+	BeginRender();
+	bool crlf;
+	if (ann) {
+		crlf = misskey_show_announcement(*ann, note);
+	} else {
+		crlf = misskey_show_note(note, 0, pre);
+	}
+	if (crlf) {
+		outputf("\n");
+	}
+	EndRender();
+
+	if (__predict_false(start != 0)) {
+		uint64 rendered = GetMonotonicUsec();
+		play_stat.count++;
+		play_stat.parse_usec += parsed - start;
+		play_stat.render_usec += rendered - parsed;
+		if (play_stat.first_usec == 0) {
+			play_stat.first_usec = start;
+		}
+		play_stat.last_usec = rendered;
+	}
+}
+
+// 並列再生の1ノート分の作業領域。パイプラインのスロットごとに使い回す。
+struct PlayItem
+{
+	std::string line {};
+	NoteParser parser {};
+	NoteParser::Result result {};
+	NoteText text {};
+	uint64 work_usec {};		// ワーカーでの処理時間 (計測中のみ)
+};
+
+// stream の各行を nthreads 個のワーカーで並列に解析、整形して、
+// 読んだ順に表示する。--play 用。
+// ワーカーはノートを取り出して表示用の文字列を作り、画像をキャッシュに
+// 用意しておく。表示するかどうかの判定 (重複、NG、連続リノート) と出力は
+// 順序に依存するので、これまでどおり1つのスレッド (呼び出し元) で行う。
+// そのため表示されなかったノートの画像もキャッシュには入る。
+// SAX で扱えないメッセージは表示する時に misskey_show_object() で処理する。
+void
+misskey_play_parallel(Stream& stream, int nthreads)
+{
+	// ワーカー1つあたり何ノート先まで読んでおくか。
+	const int WINDOW_PER_THREAD = 8;
+
+	OrderedPipeline<PlayItem> pipe(nthreads, nthreads * WINDOW_PER_THREAD);
+	const bool measure = (diagShow >= 1);
+
+	// 読み込んだが表示していないノート数をキューの長さとする。
+	std::atomic<uint64> nread {};
+	std::atomic<uint64> nemit {};
+
+	auto reader = [&](PlayItem& item) {
+		if (stream.ReadLine(&item.line) <= 0) {
+			return false;
+		}
+		StageStat::SetQueueDepth(++nread - nemit);
+		return true;
+	};
+
+	auto worker = [measure](PlayItem& item) {
+		uint64 start = 0;
+		if (__predict_false(measure)) {
+			start = GetMonotonicUsec();
+		}
+
+		item.result = NoteParser::Result::Fallback;
+		if (opt_json_sax) {
+			StageTimer timer(Stage::Parse);
+			item.result = item.parser.Parse(item.line);
+		}
+		if (__predict_true(item.result == NoteParser::Result::Note)) {
+			const Note& note = item.parser.GetNote();
+			misskey_format_note(item.text, note);
+			misskey_prefetch_images(note);
+		}
+
+		if (__predict_false(measure)) {
+			item.work_usec = GetMonotonicUsec() - start;
+		}
+	};
+
+	auto emitter = [&](PlayItem& item) {
+		// 端末の大きさが変わっていれば (落ち着いてから) 描き直す。
+		check_redraw();
+		check_metrics();
+
+		switch (item.result) {
+		 case NoteParser::Result::Note:
+		 {
+			uint64 start = 0;
+			if (__predict_false(measure)) {
+				start = GetMonotonicUsec();
+			}
+			misskey_render(item.parser.GetNote(), NULL, 0, &item.text);
+			if (__predict_false(measure)) {
+				uint64 rendered = GetMonotonicUsec();
+				play_stat.count++;
+				play_stat.parse_usec += item.work_usec;
+				play_stat.render_usec += rendered - start;
+				play_stat.last_usec = rendered;
+			}
+			break;
+		 }
+		 case NoteParser::Result::Ignore:
+			break;
+		 default:
+			misskey_show_object(item.line);
+			break;
+		}
+		StageStat::SetQueueDepth(nread - ++nemit);
+		return true;
+	};
+
+	if (__predict_false(measure)) {
+		play_stat.first_usec = GetMonotonicUsec();
+	}
+	pipe.Run(reader, worker, emitter);
+
+	play_stat.threads = pipe.GetWorkers();
+	play_stat.window = pipe.GetWindow();
+	play_stat.emit_waits = pipe.GetEmitWaits();
+	play_stat.read_waits = pipe.GetReadWaits();
+}
+
+// 1ノートあたりの解析と表示の時間を表示する。
+// --play の最後に呼ばれる。計測は --debug-show 1 以上の時だけ行う。
+void
+misskey_print_stat()
+{
+	if (diagShow < 1 || play_stat.count == 0) {
+		return;
+	}
+
+	double n = play_stat.count;
+	double elapsed = play_stat.last_usec - play_stat.first_usec;
+	double rate = (elapsed > 0) ? n * 1e6 / elapsed : 0;
+	if (play_stat.threads == 0) {
+		diagShow.Print("%" PRIu64 " notes (%s): "
+			"parse %.1f + render %.1f = %.1f usec/note, %.0f notes/sec",
+			play_stat.count,
+			(opt_json_sax ? "sax" : "dom"),
+			play_stat.parse_usec / n,
+			play_stat.render_usec / n,
+			(play_stat.parse_usec + play_stat.render_usec) / n,
+			rate);
+	} else {
+		// ワーカーの時間は各スレッドで並行して使った時間の合計。
+		diagShow.Print("%" PRIu64 " notes (%s, %d threads): "
+			"worker %.1f + render %.1f usec/note, %.0f notes/sec",
+			play_stat.count,
+			(opt_json_sax ? "sax" : "dom"),
+			play_stat.threads,
+			play_stat.parse_usec / n,
+			play_stat.render_usec / n,
+			rate);
+		diagShow.Print("window %d notes, "
+			"emitter waited %" PRIu64 ", reader waited %" PRIu64,
+			play_stat.window, play_stat.emit_waits, play_stat.read_waits);
+	}
+
+	struct rusage ru;
+	getrusage(RUSAGE_SELF, &ru);
+	diagShow.Print("maxrss %ld KB, json arena peak %zu bytes",
+		(long)ru.ru_maxrss, json_arena.GetPeak());
+}
+
+// 最近表示したノートの ID。
+static SeenNotes seen_notes;
+
+// 1ノートを処理する。
+// pre は整形済みの文字列で、NULL なら表示すると決まってから整形する。
+static bool
+misskey_show_note(const Note& note, int depth, const NoteText *pre)
+{
 	// acl
 
 	// 録画?
 	// 階層変わるのはどうする?
 
-	// NG ワード
+	// 再接続時などに同じノートが再送されてきたら無視する。
+	if (note.id.empty() == false) {
+		if (seen_notes.CheckAndAdd(note.id)) {
+			Debug(diagShow, "show_note: duplicated id %.*s -> false",
+				(int)note.id.size(), note.id.data());
+			return false;
+		}
+	}
 
-	// アナウンスなら別処理。
-	if (note->contains("announcement") && (*note)["announcement"].is_object()) {
-		return misskey_show_announcement((*note)["announcement"]);
+	// NG ワード
+	NGStatus ngstat;
+	if (ngword_list.Match(&ngstat, note)) {
+		// マッチしたらここで表示
+		Debug(diagShow, "show_note: ng -> false");
+		if (opt_show_ng) {
+			UString name;
+			UString userid;
+			if (ngstat.user) {
+				name = coloring(misskey_format_username(*ngstat.user),
+					Color::NG);
+				userid = coloring(misskey_format_userid(*ngstat.user),
+					Color::NG);
+			}
+			auto time = coloring(misskey_format_time(*ngstat.note), Color::NG);
+			auto msg = coloring("NG:" + ngstat.ngword, Color::NG);
+
+			print_(name + ' ' + userid);
+			outputf("\n");
+			print_(time + ' ' + msg);
+			outputf("\n");
+			return true;
+		}
+		return false;
 	}
 
 	// 地文なら note == renote。
 	// リノートなら RN 元を note、RN 先を renote。
-	const Json *renote;
-	bool has_renote = false;
-	if (note->contains("renote") && (*note)["renote"].is_object()) {
-		// XXX text があったらどうするのかとか。
-		renote = &(*note)["renote"];
-		has_renote = true;
+	// XXX text があったらどうするのかとか。
+	const bool has_renote = (note.renote != NULL);
+	const Note& renote = has_renote ? *note.renote : note;
+
+	// 簡略表示の判定。
+	if (has_renote) {
+		const std::string rn_id(renote.id);
+		// 簡略表示の1行。
+		auto brief = [&]() {
+			if (pre) {
+				return pre->owner + pre->counts;
+			}
+			return misskey_display_renote_owner(note) +
+				misskey_display_renote_count(renote) +
+				misskey_display_reaction_count(renote);
+		};
+
+		// 直前のノートが (フォロー氏による) 元ノートで
+		// 続けてこれがそれをリノートしたものなら簡略表示だが、
+		// この二者は別なので1行空けたまま表示。
+		if (rn_id == last_id) {
+			if (last_id_count++ < last_id_max) {
+				print_(brief());
+				outputf("\n");
+				// これ以降のリノートは連続とみなす
+				last_id += "_RN";
+				return true;
+			}
+		}
+		// 直前のノートがすでに誰か氏によるリノートで
+		// 続けてこれが同じノートをリノートしたものなら簡略表示だが、
+		// これはどちらも他者のリノートなので区別しなくていい。
+		if (rn_id + "_RN" == last_id) {
+			if (last_id_count++ < last_id_max) {
+				outputf(CSI "1A");
+				print_(brief());
+				outputf("\n");
+				return true;
+			}
+		}
+	}
+	// 表示確定。
+	// 次回の簡略表示のために覚えておく。その際今回表示するのが
+	// 元ノートかリノートかで次回の連続表示が変わる。
+	if (has_renote) {
+		last_id = std::string(renote.id) + "_RN";
 	} else {
-		renote = note;
-		has_renote = false;
+		last_id = std::string(note.id);
+	}
+	last_id_count = 0;
+
+	NoteText text;
+	if (pre == NULL) {
+		misskey_format_note(text, note);
+		pre = &text;
+	}
+
+	std::string avatarUrl = pre->avatarUrl;
+	std::string userid_str = pre->userid;
+	ShowIcon([avatarUrl, userid_str]() {
+		return misskey_show_icon(avatarUrl, userid_str);
+	});
+	print_(pre->header);
+	outputf("\n");
+	print_(pre->text);
+	outputf("\n");
+
+	// これらは本文付随なので CW 以降を表示する時だけ表示する。
+	if (renote.cw.empty() || opt_show_cw) {
+		// picture
+		Draw([]() {
+			image_count = 0;
+			image_next_cols = 0;
+			image_max_rows = 0;
+		});
+		for (int i = 0, end = renote.files.size(); i < end; i++) {
+			misskey_show_photo(renote.files[i], i);
+		}
+
+		// 投票(poll)
+		if (pre->poll.empty() == false) {
+			print_(pre->poll);
+			outputf("\n");
+		}
+	}
+
+	// 引用部分
+
+	// 時刻と、あればこのノートの既 RN 数、リアクション数。
+	print_(pre->footer);
+	outputf("\n");
+
+	// リノート元
+	if (has_renote) {
+		print_(pre->owner);
+		outputf("\n");
 	}
 
-	const Json& nullobj = Json(nullptr);
-	const Json *user = &nullobj;
-	std::string userid_str;
+	return true;
+}
+
+// ノートを表示用に整形して dst に格納する。
+// グローバルな状態には触らないので、ワーカーからも呼べる。
+static void
+misskey_format_note(NoteText& dst, const Note& note)
+{
+	StageTimer timer(Stage::Format);
+
+	const bool has_renote = (note.renote != NULL);
+	const Note& renote = has_renote ? *note.renote : note;
+
 	UString name;
 	UString userid;
 	UString instance_name;
-	if (renote->contains("user") && (*renote)["user"].is_object()) {
-		user = &(*renote)["user"];
-
-		name = coloring(misskey_format_username(*user), Color::Username);
-		userid_str = misskey_format_userid(*user);
-		userid = coloring(userid_str, Color::UserId);
-
-		if (user->contains("instance") && (*user)["instance"].is_object()) {
-			const Json *instance = &(*user)["instance"];
-			std::string iname = JsonAsString((*instance)["name"]);
+	dst.userid.clear();
+	dst.avatarUrl.clear();
+	if (renote.has_user) {
+		const NoteUser& user = renote.user;
+
+		name = coloring(misskey_format_username(user), Color::Username);
+		dst.userid = misskey_format_userid(user);
+		userid = coloring(dst.userid, Color::UserId);
+		dst.avatarUrl = std::string(user.avatarUrl);
+
+		if (user.has_instance) {
+			std::string iname(user.instance_name);
 			instance_name = UString(" ") +
 				coloring("[" + iname + "]", Color::Username);
 		}
 	}
+	dst.header = name + ' ' + userid + instance_name;
 
 	// cw	text	--show-cw	display
 	// ----	----	---------	-------
@@ -350,109 +772,120 @@ misskey_show_note(const Json *note, int depth)
 	// -	y		y			text
 	// y	*		n			cw [CW]
 	// y	*		y			cw [CW] text
-	std::string cw_str = JsonAsString((*renote)["cw"]);
-	std::string text_str;
+	std::string_view cw_str = renote.cw;
+	std::string_view text_str;
 	if (cw_str.empty() || opt_show_cw) {
-		text_str = JsonAsString((*renote)["text"]);
+		text_str = renote.text;
 	}
-	UString text;
+	dst.text.clear();
 	if (cw_str.empty() == false) {
-		text += misskey_display_text(cw_str, *renote);
-		text.AppendASCII(" [CW]");
+		dst.text += misskey_display_text(cw_str, renote);
+		dst.text.AppendASCII(" [CW]");
 		if (opt_show_cw) {
-			text += '\n';
-			text += misskey_display_text(text_str, *renote);
+			dst.text += '\n';
+			dst.text += misskey_display_text(text_str, renote);
 		}
 	} else {
-		text = misskey_display_text(text_str, *renote);
+		dst.text = misskey_display_text(text_str, renote);
 	}
 
-	ShowIcon(misskey_show_icon, *user, userid_str);
-	print_(name + ' ' + userid + instance_name);
-	printf("\n");
-	print_(text);
-	printf("\n");
+	dst.poll.clear();
+	if ((cw_str.empty() || opt_show_cw) && renote.has_poll) {
+		dst.poll = misskey_display_poll(renote);
+	}
 
-	// これらは本文付随なので CW 以降を表示する時だけ表示する。
-	if (cw_str.empty() || opt_show_cw) {
-		// picture
-		image_count = 0;
-		image_next_cols = 0;
-		image_max_rows = 0;
-		if (renote->contains("files") && (*renote)["files"].is_array()) {
-			const Json& files = (*renote)["files"];
-			for (int i = 0, end = files.size(); i < end; i++) {
-				const Json& f = files[i];
-
-				auto indent = (indent_depth + 1) * indent_cols;
-				printf(CSI "%dC", indent);
-				misskey_show_photo(f, imagesize, i);
-				printf("\r");
-			}
-		}
+	dst.counts = misskey_display_renote_count(renote) +
+		misskey_display_reaction_count(renote);
+	dst.footer = coloring(misskey_format_time(renote), Color::Time) +
+		dst.counts;
 
-		// 投票(poll)
-		if (renote->contains("poll") && (*renote)["poll"].is_object()) {
-			UString pollstr = misskey_display_poll((*renote)["poll"]);
-			if (pollstr.empty() == false) {
-				print_(pollstr);
-				printf("\n");
-			}
-		}
+	dst.owner.clear();
+	if (has_renote) {
+		dst.owner = misskey_display_renote_owner(note);
 	}
+}
 
-	// 引用部分
-
-	// 時刻と、あればこのノートの既 RN 数、リアクション数。
-	auto time = coloring(misskey_format_time(*renote), Color::Time);
-	auto rnmsg = misskey_display_renote_count(*renote);
-	auto reactmsg = misskey_display_reaction_count(*renote);
-	print_(time + rnmsg + reactmsg);
-	printf("\n");
+// ノートのアイコンと添付画像をキャッシュに用意しておく。
+// 何を用意するかは misskey_show_note() と misskey_show_photo() に合わせる。
+// 並列再生のワーカーから呼ばれる。
+static void
+misskey_prefetch_images(const Note& note)
+{
+	if (use_sixel == UseSixel::No) {
+		return;
+	}
 
-	// リノート元
-	if (has_renote) {
-		print_(misskey_display_renote_owner(*note));
-		printf("\n");
+	const Note& renote = note.renote ? *note.renote : note;
+	if (renote.has_user) {
+		std::string avatarUrl(renote.user.avatarUrl);
+		std::string userid = misskey_format_userid(renote.user);
+		if (avatarUrl.empty() == false) {
+			PrefetchImage(misskey_icon_file(avatarUrl, userid), avatarUrl,
+				iconsize);
+		}
 	}
 
-	return true;
+	if (renote.cw.empty() == false && opt_show_cw == false) {
+		return;
+	}
+	for (const auto& f : renote.files) {
+		std::string img_file;
+		std::string img_url;
+		if (f.isSensitive && opt_show_nsfw == false) {
+			std::string blurhash(f.blurhash);
+			if (blurhash.empty()) {
+				continue;
+			}
+			img_url = misskey_blurhash_url(blurhash, f.width, f.height,
+				imagesize, &img_file);
+		} else {
+			img_url = std::string(f.thumbnailUrl);
+			if (img_url.empty()) {
+				continue;
+			}
+			img_file = GetCacheFilename(img_url);
+		}
+		PrefetchImage(img_file, img_url, imagesize);
+	}
 }
 
 // アナウンス文を処理する。構造が全然違う。
+// note は ann から作った Note (本文の整形に使う)。
 static bool
-misskey_show_announcement(const Json& ann)
+misskey_show_announcement(const Json& ann, const Note& note)
 {
 	// "icon":"info" はどうしたらいいんだ…。
-	ShowIcon(misskey_show_noicon, ann, "");
+	ShowIcon([]() { return false; });
 
 	UString name = coloring("announcement", Username);
 	print_(name);
-	printf("\n");
+	outputf("\n");
 
 	std::string title_str = JsonAsString(ann["title"]);
 	if (title_str.empty() == false) {
-		auto title = misskey_display_text(title_str, ann);
+		auto title = misskey_display_text(title_str, note);
 		print_(title);
-		printf("\n\n");
+		outputf("\n\n");
 	}
 	std::string text_str = JsonAsString(ann["text"]);
 	if (text_str.empty() == false) {
-		auto text = misskey_display_text(text_str, ann);
+		auto text = misskey_display_text(text_str, note);
 		print_(text);
-		printf("\n");
+		outputf("\n");
 	}
 
 	std::string imageUrl = JsonAsString(ann["imageUrl"]);
 	if (imageUrl.empty() == false) {
 		// picture
-		image_count = 0;
-		image_next_cols = 0;
-		image_max_rows = 0;
-		printf(CSI "%dC", indent_cols);
-		std::string img_file = GetCacheFilename(imageUrl);
-		ShowImage(img_file, imageUrl, imagesize, 0);
-		printf("\r");
+		Draw([imageUrl]() {
+			image_count = 0;
+			image_next_cols = 0;
+			image_max_rows = 0;
+			outputf(CSI "%dC", indent_cols);
+			std::string img_file = GetCacheFilename(imageUrl);
+			ShowImage(img_file, imageUrl, imagesize, 0);
+			outputf("\r");
+		});
 	}
 
 	// 時間は updatedAt と createdAt があるので順に探す。
@@ -464,295 +897,192 @@ misskey_show_announcement(const Json& ann)
 		time_t unixtime = DecodeISOTime(at_str);
 		auto time = coloring(format_time(unixtime), Color::Time);
 		print_(time);
-		printf("\n");
+		outputf("\n");
 	}
 	return true;
 }
 
 // user からユーザ名(表示名)の文字列を取得。
 static std::string
-misskey_format_username(const Json& user)
+misskey_format_username(const NoteUser& user)
 {
 	// name が空なら username を使う仕様。
-	std::string name = JsonAsString(user["name"]);
-	return !name.empty() ? name : JsonAsString(user["username"]);
+	return std::string(!user.name.empty() ? user.name : user.username);
 }
 
 // user からアカウント名(+外部ならホスト名) の文字列を取得。
 // @user[@host] 形式。
 static std::string
-misskey_format_userid(const Json& user)
+misskey_format_userid(const NoteUser& user)
 {
-	std::string userid = "@" + JsonAsString(user["username"]);
-	std::string host = JsonAsString(user["host"]);
-	if (host.empty() == false) {
-		userid += "@" + host;
+	std::string userid = "@";
+	userid += user.username;
+	if (user.host.empty() == false) {
+		userid += '@';
+		userid += user.host;
 	}
 	return userid;
 }
 
-// str の ASCII 大文字を小文字にインプレース変換します。
-static void
-UString_tolower(UString& str)
-{
-	for (int i = 0, end = str.size(); i < end; i++) {
-		unichar c = str[i];
-		if ('A' <= c && c <= 'Z') {
-			str[i] = c + 0x20;
-		}
-	}
-}
-
-// src の pos 文字目からが key と ASCII 大文字小文字を無視して一致するか。
-// key は英字をすべて小文字にしてあること。
-// 一致すれば 0 を、一致しなければ 0 以外を返す(大小は再現していない)。
-static int
-UString_ncasecmp(const UString& src, int pos, const UString& key)
+// MFM の装飾に対応する属性。Color::Max なら属性なし。
+static Color
+misskey_style2color(MFM::Style style)
 {
-	int len = key.size();
-	for (int i = 0; i < len; i++) {
-		unichar s = src[pos + i];
-
-		if ('A' <= s && s <= 'Z') s += 0x20;
-		if (s != key[i]) {
-			return 1;
-		}
+	switch (style) {
+	 case MFM::Bold:	return Color::Bold;
+	 case MFM::Italic:	return Color::Italic;
+	 case MFM::Strike:	return Color::Strike;
+	 case MFM::Small:	return Color::Small;
+	 default:
+		break;
 	}
-	return 0;
+	return Color::Max;
 }
 
 // 本文を表示用に整形。
 static UString
-misskey_display_text(const std::string& text, const Json& note)
+misskey_display_text(std::string_view text, const Note& note)
 {
-	UString src = UString::FromUTF8(text);
-	//printf("src=%s\n", src.dump().c_str());
+	// 字句解析器は作業領域ごと使い回す。
+	// 並列再生ではワーカーからも呼ばれるので、スレッドごとに持つ。
+	static thread_local MFM mfm;
+	// 適用中の装飾。属性の終了は全属性のリセットなので、
+	// 内側の属性を終えたら外側の属性を付け直す。
+	static thread_local std::vector<Color> attrs;
+
+	UString src = UString::FromUTF8(std::string(text));
 	UString dst;
+	// 色を付ける分だけ少し伸びる。
+	dst.reserve(src.size() + 64);
+
+	// タグを照合器に登録する。
+	mfm.ClearTags();
+	for (const auto& tag : note.tags) {
+		mfm.AddTag(std::string(tag));
+	}
 
-	// 記号をどれだけ含むかだけが違う。
-	// Mention 1文字目は   "_" + Alnum
-	// Mention 2文字目以降 "_" + Alnum + "@.-"
-	// URL は              "_" + Alnum + "@.-" + "#%&/:;=?^~"
-	static const char urlchars[] =
-		"#%&/:;=?^~"
-		"@.-"
-		"_0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
-	#define ment2chars (urlchars + 9)
-	#define ment1chars (urlchars + 9 + 3)
-
-	// タグを集めて小文字にしておく。
-	std::vector<UString> tags;
-	if (note.contains("tags") && note["tags"].is_array()) {
-		for (auto tagj : note["tags"]) {
-			if (tagj.is_string()) {
-				auto tag = tagj.get<std::string>();
-				auto utag = UString::FromUTF8(tag);
-				UString_tolower(utag);
-				tags.emplace_back(utag);
+	auto append = [&](const MFM::Token& t) {
+		dst.insert(dst.end(), src.begin() + t.pos, src.begin() + t.pos + t.len);
+	};
+	auto reapply = [&]() {
+		for (const auto col : attrs) {
+			if (col != Color::Max) {
+				dst += ColorBegin(col);
 			}
 		}
-	}
+	};
 
-	int mfmtag = 0;
-	for (int pos = 0, posend = src.size(); pos < src.size(); ) {
-		auto c = src[pos];
-
-		if (c == '<') {
-			if (src.SubMatch(pos + 1, "plain>")) {
-				// <plain> なら閉じ </plain> を探す。
-				pos += 7;
-				int e;
-				// ループは本当は posend-7 くらいまでで十分だが、閉じタグが
-				// なければ最後まで plain 扱いにするために posend まで回す。
-				for (e = pos; e < posend; e++) {
-					if (src[e] == '<' && src.SubMatch(e + 1, "/plain>")) {
-						break;
-					}
-				}
-				// この間は無加工で出力。
-				for (; pos < e; pos++) {
-					dst += src[pos];
-				}
-				pos += 8;
-				continue;
+	attrs.clear();
+	for (const auto& t : mfm.Parse(src)) {
+		Color col;
+		switch (t.type) {
+		 case MFM::Markup:
+			break;
+
+		 case MFM::Mention:
+		 case MFM::Hashtag:
+		 case MFM::Url:
+			if (t.type == MFM::Mention) {
+				col = Color::UserId;
+			} else if (t.type == MFM::Hashtag) {
+				col = Color::Tag;
+			} else {
+				col = Color::Url;
 			}
-			// 他の HTML タグはとりあえず放置。
-
-		} else if (c == '$' && src.At(pos + 1) == '[') {
-			// MFM タグ開始。
-			int e = pos + 2;
-			// タグは全部無視するのでタグ名をスキップ。
-			for (; e < posend && src[e] != ' '; e++)
-				;
-			// 空白の次から ']' の手前までが本文。
-			mfmtag++;
-			pos = e + 1;
-			continue;
-
-		} else if (c == ']' && mfmtag > 0) {
-			// MFM タグ終端。
-			mfmtag--;
-			pos++;
-			continue;
-
-		} else if (c == '@') {
-			// '@' の次が [\w\d_] ならメンション。
-			auto nc = src.At(pos + 1);
-			if (nc < 0x80 && strchr(ment1chars, nc) != NULL) {
-				dst += ColorBegin(Color::UserId);
-				dst += c;
-				dst += nc;
-				// 2文字目以降はホスト名も来る可能性がある。
-				for (pos += 2; pos < posend; pos++) {
-					c = src[pos];
-					if (c < 0x80 && strchr(ment2chars, c) != NULL) {
-						dst += c;
-					} else {
-						break;
-					}
-				}
-				dst += ColorEnd(Color::UserId);
-				continue;
+			dst += ColorBegin(col);
+			append(t);
+			dst += ColorEnd(col);
+			reapply();
+			break;
+
+		 case MFM::Begin:
+			col = misskey_style2color(t.style);
+			if (col != Color::Max) {
+				dst += ColorBegin(col);
 			}
+			attrs.push_back(col);
+			break;
 
-		} else if (c == '#') {
-			// タグはこの時点で範囲(長さ)が分かるのでステート分岐不要。
-			int i = 0;
-			int tagcount = tags.size();
-			for (; i < tagcount; i++) {
-				if (UString_ncasecmp(src, pos + 1, tags[i]) == 0) {
-					// 複数回同じタグがあるかも知れないので念のため
-					// tags から削除はしないでおく。
-					break;
-				}
+		 case MFM::End:
+			col = attrs.empty() ? Color::Max : attrs.back();
+			if (attrs.empty() == false) {
+				attrs.pop_back();
 			}
-			if (i != tagcount) {
-				// 一致したらタグ。'#' 文字自身も含めてコピーする。
-				dst += ColorBegin(Color::Tag);
-				dst += c;
-				pos++;
-				int end = pos + tags[i].size();
-				// tags は正規化によって何が起きてるか分からないので、
-				// src.size() のほうを信じる。
-				end = std::min(end, (int)posend);
-				for (; pos < end; pos++) {
-					dst += src[pos];
-				}
-				dst += ColorEnd(Color::Tag);
-				continue;
+			if (col != Color::Max) {
+				dst += ColorEnd(col);
+				reapply();
 			}
+			break;
 
-		} else if (c == 'h' &&
-			(src.SubMatch(pos, "https://") ||
-			 src.SubMatch(pos, "http://")))
-		{
-			// URL
-			int url_in_paren = 0;
-			dst += ColorBegin(Color::Url);
-			for (; pos < posend; pos++) {
-				// URL に使える文字集合がよく分からない。
-				// 括弧 "(",")" は、開き括弧なしで閉じ括弧が来ると URL 終了。
-				// 一方開き括弧は URL 内に来てもよい。
-				// "(http://foo/a)b" は http://foo/a が URL。
-				// "http://foo/a(b)c" は http://foo/a(b)c が URL。
-				// 正気か?
-				c = src[pos];
-				if (c < 0x80 && strchr(urlchars, c) != NULL) {
-					dst += c;
-				} else if (c == '(') {
-					url_in_paren++;
-					dst += c;
-				} else if (c == ')' && url_in_paren > 0) {
-					url_in_paren--;
-					dst += c;
-				} else {
-					break;
-				}
-			}
-			dst += ColorEnd(Color::Url);
-			continue;
+		 default:
+			// 文字列、絵文字、コードなどはそのまま。
+			append(t);
+			break;
 		}
-
-		// どれでもなければここに落ちてくる。
-		dst += c;
-		pos++;
 	}
 
-	//printf("dst=%s\n", dst.dump().c_str());
 	return dst;
 }
 
 // note から時刻の文字列を取得。
 static std::string
-misskey_format_time(const Json& note)
+misskey_format_time(const Note& note)
 {
-	std::string createdAt = JsonAsString(note["createdAt"]);
+	std::string createdAt(note.createdAt);
 	time_t unixtime = DecodeISOTime(createdAt);
 	return format_time(unixtime);
 }
 
 // アイコン表示のサービス固有部コールバック。
 static bool
-misskey_show_icon(const Json& user, const std::string& userid)
+misskey_show_icon(const std::string& avatarUrl, const std::string& userid)
 {
-	std::string avatarUrl = JsonAsString(user["avatarUrl"]);
-
 	if (avatarUrl.empty() || userid.empty()) {
 		return false;
 	}
 
+	auto img_file = misskey_icon_file(avatarUrl, userid);
+	return ShowImage(img_file, avatarUrl, iconsize, -1);
+}
+
+// アイコンのキャッシュ内でのキーを返す。
+static std::string
+misskey_icon_file(const std::string& avatarUrl, const std::string& userid)
+{
 	// URL の FNV1 ハッシュをキャッシュのキーにする。
 	// Misskey の画像 URL は長いのと URL がネストした構造をしているので
 	// 単純に一部を切り出して使う方法は無理。
 	uint32 fnv1 = FNV1(avatarUrl);
 
-	auto img_file = string_format("icon-%dx%d-%s-%08x",
+	return string_format("icon-%dx%d-%s-%08x",
 		iconsize, iconsize, userid.c_str(), fnv1);
-	return ShowImage(img_file, avatarUrl, iconsize, -1);
-}
-
-// アイコン表示のコールバックだけど、何も表示しない版。アナウンスで使う。
-static bool
-misskey_show_noicon(const Json& user, const std::string& userid)
-{
-	return false;
 }
 
 // 投票を表示用に整形して返す。
 static UString
-misskey_display_poll(const Json& poll)
+misskey_display_poll(const Note& note)
 {
 	// "poll" : {
 	//   "choices" : [ { choice1, choice2 } ],
 	//   "expiresAt" : null (or string?),
 	//   "multiple" : bool,
 	// }
+	// choice は {
+	//   "isVoted" : bool (自分が投票したかかな?)
+	//   "text" : string
+	//   "votes" : number
+	// }
 
+	// 本当は列整形したいところだが表示文字数のカウントが面倒。
+
+	// 整形。
 	std::string str;
-	if (poll.contains("choices") && poll["choices"].is_array()) {
-		const Json& choices = poll["choices"];
-		// choice は {
-		//   "isVoted" : bool (自分が投票したかかな?)
-		//   "text" : string
-		//   "votes" : number
-		// }
-
-		// 本当は列整形したいところだが表示文字数のカウントが面倒。
-
-		// 整形。
-		for (const Json& choice : choices) {
-			bool voted = (choice["isVoted"].is_boolean() &&
-				choice["isVoted"].get<bool>());
-			std::string text = JsonAsString(choice["text"]);
-			int votes = (choice["votes"].is_number()
-				? choice["votes"].get<int>() : 0);
-
-			str += string_format(
-				" [%c] %s : %d\n",
-				(voted ? '*' : ' '),
-				text.c_str(),
-				votes);
-		}
+	for (const auto& choice : note.choices) {
+		str += string_format(
+			" [%c] %.*s : %d\n",
+			(choice.isVoted ? '*' : ' '),
+			(int)choice.text.size(), choice.text.data(),
+			choice.votes);
 	}
 	// 最後の改行は除く。
 	string_rtrim(str);
@@ -774,85 +1104,117 @@ misskey_display_poll(const Json& poll)
 //   "type" : "image/jpeg",
 //   "url" : "...",
 // }
-static bool
-misskey_show_photo(const Json& f, int resize_width, int index)
+// 表示位置や画像サイズは画面の大きさに依存するので、f から必要なものだけを
+// 取り出して、表示そのものは Draw() に任せる。
+static void
+misskey_show_photo(const NoteFile& f, int index)
 {
-	std::string img_url;
-	std::string img_file;
+	std::string type(f.type);
 
-	bool isSensitive = JsonAsBool(f["isSensitive"]);
-	if (isSensitive && opt_show_nsfw == false) {
-		auto blurhash = JsonAsString(f["blurhash"]);
+	if (f.isSensitive && opt_show_nsfw == false) {
+		std::string blurhash(f.blurhash);
 		if (blurhash.empty()) {
 			// 画像でないなど Blurhash がなければ
 			// ファイルタイプだけでも表示しておくか。
-			misskey_print_filetype(f, " [NSFW]");
-			return false;
-		}
-		int width = 0;
-		int height = 0;
-		if (f.contains("properties") && f["properties"].is_object()) {
-			const Json& p = f["properties"];
-			width  = JsonAsInt(p["width"]);
-			height = JsonAsInt(p["height"]);
-
-			// 原寸のアスペクト比を維持したまま長編が resize_width になる
-			// ようにする。
-			// SixelConverter には入力画像サイズとしてこのサイズを、
-			// 出力画像サイズも同じサイズを指定することで等倍で動作させる。
-			if (width > height) {
-				height = height * resize_width / width;
-				width = resize_width;
-			} else {
-				width = width * resize_width / height;
-				height = resize_width;
-			}
-		}
-		if (width < 1) {
-			width = resize_width;
+			Draw([type]() {
+				outputf(CSI "%dC", (indent_depth + 1) * indent_cols);
+				misskey_print_filetype(type, " [NSFW]");
+				outputf("\r");
+			});
+			return;
 		}
-		if (height < 1) {
-			height = resize_width;
-		}
-		// Json オブジェクトでエンコードも出来るけど、このくらいならええやろ。
-		img_url = string_format(R"(blurhash://{"hash":"%s","w":%d,"h":%d})",
-			blurhash.c_str(), width, height);
-		img_file = string_format("blurhash-%s-%d-%d",
-			UrlEncode(blurhash).c_str(), width, height);
+		int width = f.width;
+		int height = f.height;
+		Draw([blurhash, width, height, index]() {
+			outputf(CSI "%dC", (indent_depth + 1) * indent_cols);
+			misskey_show_blurhash(blurhash, width, height, imagesize, index);
+			outputf("\r");
+		});
 	} else {
 		// thumbnailUrl があればそっちを使う。
-		img_url = JsonAsString(f["thumbnailUrl"]);
+		std::string img_url(f.thumbnailUrl);
 		if (img_url.empty()) {
 			// なければ、ファイルタイプだけでも表示しとく?
-			misskey_print_filetype(f, "");
-			return false;
+			Draw([type]() {
+				outputf(CSI "%dC", (indent_depth + 1) * indent_cols);
+				misskey_print_filetype(type, "");
+				outputf("\r");
+			});
+			return;
 		}
-		img_file = GetCacheFilename(img_url);
+		Draw([img_url, index]() {
+			outputf(CSI "%dC", (indent_depth + 1) * indent_cols);
+			auto img_file = GetCacheFilename(img_url);
+			ShowImage(img_file, img_url, imagesize, index);
+			outputf("\r");
+		});
 	}
+}
+
+// Blurhash を表示する。width, height は原寸 (不明なら 0)。
+static bool
+misskey_show_blurhash(const std::string& blurhash, int width, int height,
+	int resize_width, int index)
+{
+	std::string img_file;
+	auto img_url = misskey_blurhash_url(blurhash, width, height, resize_width,
+		&img_file);
 	return ShowImage(img_file, img_url, resize_width, index);
 }
 
+// Blurhash を ShowImage() に渡す URL (独自形式) を返す。
+// キャッシュ内でのキーを *img_filep に格納する。
+// width, height は原寸 (不明なら 0)。
+static std::string
+misskey_blurhash_url(const std::string& blurhash, int width, int height,
+	int resize_width, std::string *img_filep)
+{
+	if (width > 0 || height > 0) {
+		// 原寸のアスペクト比を維持したまま長編が resize_width になる
+		// ようにする。
+		// SixelConverter には入力画像サイズとしてこのサイズを、
+		// 出力画像サイズも同じサイズを指定することで等倍で動作させる。
+		if (width > height) {
+			height = height * resize_width / width;
+			width = resize_width;
+		} else {
+			width = width * resize_width / height;
+			height = resize_width;
+		}
+	}
+	if (width < 1) {
+		width = resize_width;
+	}
+	if (height < 1) {
+		height = resize_width;
+	}
+	// Json オブジェクトでエンコードも出来るけど、このくらいならええやろ。
+	auto img_url = string_format(R"(blurhash://{"hash":"%s","w":%d,"h":%d})",
+		blurhash.c_str(), width, height);
+	*img_filep = string_format("blurhash-%s-%d-%d",
+		UrlEncode(blurhash).c_str(), width, height);
+	return img_url;
+}
+
 // 改行してファイルタイプだけを出力する。
 static void
-misskey_print_filetype(const Json& f, const char *nsfw)
+misskey_print_filetype(const std::string& type, const char *nsfw)
 {
 	image_count = 0;
 	image_max_rows = 0;
 	image_next_cols = 0;
 
-	auto type = JsonAsString(f["type"]);
-	printf("\r" CSI "%dC(%s)%s\n",
+	outputf("\r" CSI "%dC(%s)%s\n",
 		(indent_depth + 1) * indent_cols, type.c_str(), nsfw);
 }
 
 // リノート数を表示用に整形して返す。
 static UString
-misskey_display_renote_count(const Json& note)
+misskey_display_renote_count(const Note& note)
 {
 	UString str;
 
-	auto rncnt = note.contains("renoteCount") ?
-		note.value("renoteCount", 0) : 0;
+	auto rncnt = note.renoteCount;
 	if (rncnt > 0) {
 		str = coloring(string_format(" %dRN", rncnt), Color::Retweet);
 	}
@@ -861,20 +1223,11 @@ misskey_display_renote_count(const Json& note)
 
 // リアクション数を表示用に整形して返す。
 static UString
-misskey_display_reaction_count(const Json& note)
+misskey_display_reaction_count(const Note& note)
 {
 	UString str;
-	int cnt = 0;
-
-	if (note.contains("reactions") && note["reactions"].is_object()) {
-		const Json& reactions = note["reactions"];
-		for (auto& [key, val] : reactions.items()) {
-			if (val.is_number()) {
-				cnt += val.get<int>();
-			}
-		}
-	}
 
+	int cnt = note.reactionCount;
 	if (cnt > 0) {
 		str = coloring(string_format(" %dReact", cnt), Color::Favorite);
 	}
@@ -883,17 +1236,15 @@ misskey_display_reaction_count(const Json& note)
 
 // リノート元通知を表示用に整形して返す。
 static UString
-misskey_display_renote_owner(const Json& note)
+misskey_display_renote_owner(const Note& note)
 {
 	std::string rn_time = misskey_format_time(note);
 	std::string rn_name;
 	std::string rn_userid;
 
-	if (note.contains("user") && note["user"].is_object()) {
-		const Json& user = note["user"];
-
-		rn_name = misskey_format_username(user);
-		rn_userid = misskey_format_userid(user);
+	if (note.has_user) {
+		rn_name = misskey_format_username(note.user);
+		rn_userid = misskey_format_userid(note.user);
 	}
 
 	auto str = string_format("%s %s %s renoted",
@@ -27,5 +27,9 @@
 
 #include <string>
 
+class Stream;
+
 extern int cmd_misskey_stream();
 extern bool misskey_show_object(const std::string& line);
+extern void misskey_play_parallel(Stream& stream, int nthreads);
+extern void misskey_print_stat();
@@ -0,0 +1,1130 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// NG ワードの照合に使うオートマトン
+//
+
+#include "NGMatcher.h"
+#include <algorithm>
+#include <cctype>
+#include <deque>
+
+// NFA のノード数の上限。{n,m} の展開などで巨大にならないようにする。
+static const size_t MAX_NFA = 100000;
+// 繰り返し回数の上限。
+static const int MAX_REPEAT = 1000;
+// 括弧の入れ子の上限。
+static const int MAX_DEPTH = 100;
+// DFA の遷移表の大きさの上限 (要素数)。これを超えたら作り直す。
+static const size_t MAX_TRANS = 256 * 1024;
+
+// ASCII の大文字だけを小文字にする。
+static inline uint8
+ascii_lower(uint8 c)
+{
+	return ((uint8)(c - 'A') < 26) ? (c + 0x20) : c;
+}
+
+//
+// Aho-Corasick
+//
+
+// コンストラクタ
+AhoCorasick::AhoCorasick()
+{
+}
+
+// デストラクタ
+AhoCorasick::~AhoCorasick()
+{
+}
+
+// 全部消す。
+void
+AhoCorasick::Clear()
+{
+	nodes.clear();
+	edges.clear();
+	outs.clear();
+	trie.clear();
+	trie_outs.clear();
+	std::fill(std::begin(root_next), std::end(root_next), 0);
+}
+
+// 文字列 word を id で登録する。空文字列は無視する。
+void
+AhoCorasick::Add(const std::string& word, int id)
+{
+	if (word.empty()) {
+		return;
+	}
+	if (trie.empty()) {
+		trie.emplace_back();
+		trie_outs.emplace_back();
+	}
+
+	int n = 0;
+	for (auto ch : word) {
+		uint8 c = ascii_lower(ch);
+		auto it = trie[n].find(c);
+		if (it != trie[n].end()) {
+			n = it->second;
+		} else {
+			int m = trie.size();
+			trie.emplace_back();
+			trie_outs.emplace_back();
+			trie[n][c] = m;
+			n = m;
+		}
+	}
+	trie_outs[n].push_back(id);
+}
+
+// ノード n から文字 c での遷移先を返す。なければ -1 を返す。
+// 子の数はほとんどの場合数個なので線形に探す。
+inline int
+AhoCorasick::Next(int n, uint8 c) const
+{
+	const Node& node = nodes[n];
+	const auto *e = &edges[node.edge];
+	const auto *end = e + node.nedge;
+	for (; e < end; e++) {
+		if (e->first == c) {
+			return e->second;
+		}
+		if (e->first > c) {
+			break;
+		}
+	}
+	return -1;
+}
+
+// 失敗遷移を構築して検索用の形に詰め直す。
+void
+AhoCorasick::Build()
+{
+	nodes.clear();
+	edges.clear();
+	outs.clear();
+	std::fill(std::begin(root_next), std::end(root_next), 0);
+	if (trie.empty()) {
+		return;
+	}
+
+	// トライを配列に詰める。
+	nodes.resize(trie.size());
+	for (int n = 0, end = trie.size(); n < end; n++) {
+		Node& node = nodes[n];
+		node.edge = edges.size();
+		node.nedge = trie[n].size();
+		for (const auto& kv : trie[n]) {
+			edges.emplace_back(kv.first, kv.second);
+		}
+		node.out = outs.size();
+		node.nout = trie_outs[n].size();
+		outs.insert(outs.end(), trie_outs[n].begin(), trie_outs[n].end());
+	}
+	for (const auto& kv : trie[0]) {
+		root_next[kv.first] = kv.second;
+	}
+
+	// 幅優先で失敗遷移を求める。
+	// 失敗遷移先は必ず自分より浅いので、先に求まっている。
+	std::deque<int> queue;
+	for (const auto& kv : trie[0]) {
+		queue.push_back(kv.second);
+	}
+	while (queue.empty() == false) {
+		int u = queue.front();
+		queue.pop_front();
+
+		for (const auto& kv : trie[u]) {
+			uint8 c = kv.first;
+			int v = kv.second;
+			int f = nodes[u].fail;
+			for (;;) {
+				if (f == 0) {
+					f = root_next[c];
+					break;
+				}
+				int t = Next(f, c);
+				if (t >= 0) {
+					f = t;
+					break;
+				}
+				f = nodes[f].fail;
+			}
+			nodes[v].fail = f;
+			nodes[v].dict = (nodes[f].nout != 0) ? f : nodes[f].dict;
+			queue.push_back(v);
+		}
+	}
+
+	// 構築用のトライはもう要らない。
+	trie.clear();
+	trie_outs.clear();
+}
+
+// text を走査して、登録された文字列が出現するたびに callback を呼ぶ。
+bool
+AhoCorasick::Search(std::string_view text, const NGMatchCallback& callback)
+	const
+{
+	if (outs.empty()) {
+		return false;
+	}
+
+	int s = 0;
+	for (auto ch : text) {
+		uint8 c = ascii_lower(ch);
+		for (;;) {
+			if (s == 0) {
+				s = root_next[c];
+				break;
+			}
+			int t = Next(s, c);
+			if (t >= 0) {
+				s = t;
+				break;
+			}
+			s = nodes[s].fail;
+		}
+
+		// ここで終わる単語を全部通知する。
+		int o = (nodes[s].nout != 0) ? s : nodes[s].dict;
+		for (; __predict_false(o != 0); o = nodes[o].dict) {
+			const Node& node = nodes[o];
+			for (uint32 i = node.out, end = i + node.nout; i < end; i++) {
+				if (callback(outs[i])) {
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+
+//
+// 正規表現の構文解析
+//
+
+class RegexDFA::Parser
+{
+ public:
+	Parser(const std::string& src_, std::vector<RNode>& tree_,
+		std::vector<ByteSet>& sets_)
+		: src(src_), tree(tree_), sets(sets_)
+	{
+	}
+
+	// 構文木を作って根のノード番号を返す。
+	// 扱えない構文か構文エラーなら -1 を返す。
+	int Parse();
+
+ private:
+	int ParseAlt();
+	int ParseCat();
+	int ParseRepeat();
+	int ParseAtom();
+	int ParseClass();
+	int ParseEscape(ByteSet& cs, bool in_class);
+	bool ParseInt(int *val);
+
+	int New(RNode::Op op);
+	int NewSet(ByteSet& cs);
+
+	bool Peek(char c) const { return pos < src.size() && src[pos] == c; }
+
+	const std::string& src;
+	std::vector<RNode>& tree;
+	std::vector<ByteSet>& sets;
+	size_t pos {};
+	int depth {};
+};
+
+// ASCII の英字はもう一方の大文字小文字も集合に加える。
+static void
+fold_case(std::bitset<256>& cs)
+{
+	for (int c = 'a'; c <= 'z'; c++) {
+		if (cs[c] || cs[c - 0x20]) {
+			cs.set(c);
+			cs.set(c - 0x20);
+		}
+	}
+}
+
+int
+RegexDFA::Parser::Parse()
+{
+	int n = ParseAlt();
+	// 対応しない ')' が残っていればエラー。
+	if (n < 0 || pos != src.size()) {
+		return -1;
+	}
+	return n;
+}
+
+int
+RegexDFA::Parser::New(RNode::Op op)
+{
+	tree.emplace_back();
+	tree.back().op = op;
+	return tree.size() - 1;
+}
+
+int
+RegexDFA::Parser::NewSet(ByteSet& cs)
+{
+	int n = New(RNode::Set);
+	tree[n].set = sets.size();
+	sets.push_back(cs);
+	return n;
+}
+
+// 選択 (a|b|c)
+int
+RegexDFA::Parser::ParseAlt()
+{
+	std::vector<int> kids;
+	for (;;) {
+		int n = ParseCat();
+		if (n < 0) {
+			return -1;
+		}
+		kids.push_back(n);
+		if (Peek('|') == false) {
+			break;
+		}
+		pos++;
+	}
+	if (kids.size() == 1) {
+		return kids[0];
+	}
+	int n = New(RNode::Alt);
+	tree[n].kids = std::move(kids);
+	return n;
+}
+
+// 連接 (abc)
+int
+RegexDFA::Parser::ParseCat()
+{
+	std::vector<int> kids;
+	while (pos < src.size() && src[pos] != '|' && src[pos] != ')') {
+		int n = ParseRepeat();
+		if (n < 0) {
+			return -1;
+		}
+		kids.push_back(n);
+	}
+	if (kids.empty()) {
+		return New(RNode::Empty);
+	}
+	if (kids.size() == 1) {
+		return kids[0];
+	}
+	int n = New(RNode::Cat);
+	tree[n].kids = std::move(kids);
+	return n;
+}
+
+// 量指定子付きの要素。
+int
+RegexDFA::Parser::ParseRepeat()
+{
+	int n = ParseAtom();
+	if (n < 0) {
+		return -1;
+	}
+
+	// ECMAScript では量指定子は1つだけ (a** はエラー)。
+	if (pos < src.size()) {
+		int min;
+		int max;
+		char c = src[pos];
+		if (c == '*') {
+			min = 0;
+			max = -1;
+			pos++;
+		} else if (c == '+') {
+			min = 1;
+			max = -1;
+			pos++;
+		} else if (c == '?') {
+			min = 0;
+			max = 1;
+			pos++;
+		} else if (c == '{') {
+			// {n} {n,} {n,m}
+			pos++;
+			if (ParseInt(&min) == false) {
+				return -1;
+			}
+			if (Peek(',')) {
+				pos++;
+				if (Peek('}')) {
+					max = -1;
+				} else if (ParseInt(&max) == false || max < min) {
+					return -1;
+				}
+			} else {
+				max = min;
+			}
+			if (Peek('}') == false) {
+				return -1;
+			}
+			pos++;
+			if (min > MAX_REPEAT || max > MAX_REPEAT) {
+				return -1;
+			}
+		} else {
+			return n;
+		}
+
+		// アンカーは繰り返せない。
+		if (tree[n].op == RNode::Bol || tree[n].op == RNode::Eol) {
+			return -1;
+		}
+		// 最短一致指定は一致するかどうかには関係ないので読み捨てる。
+		if (Peek('?')) {
+			pos++;
+		}
+
+		int r = New(RNode::Repeat);
+		tree[r].min = min;
+		tree[r].max = max;
+		tree[r].kids.push_back(n);
+		n = r;
+	}
+	return n;
+}
+
+// 10進数を読む。
+bool
+RegexDFA::Parser::ParseInt(int *val)
+{
+	size_t start = pos;
+	int v = 0;
+	while (pos < src.size() && '0' <= src[pos] && src[pos] <= '9') {
+		v = v * 10 + (src[pos] - '0');
+		if (v > MAX_REPEAT * 10) {
+			return false;
+		}
+		pos++;
+	}
+	if (pos == start) {
+		return false;
+	}
+	*val = v;
+	return true;
+}
+
+// 1要素。
+int
+RegexDFA::Parser::ParseAtom()
+{
+	ByteSet cs;
+	char c = src[pos++];
+
+	switch (c) {
+	 case '(':
+	 {
+		if (Peek('?')) {
+			// (?: ) 以外の先読みなどは扱えない。
+			if (pos + 1 < src.size() && src[pos + 1] == ':') {
+				pos += 2;
+			} else {
+				return -1;
+			}
+		}
+		if (++depth > MAX_DEPTH) {
+			return -1;
+		}
+		int n = ParseAlt();
+		if (n < 0 || Peek(')') == false) {
+			return -1;
+		}
+		pos++;
+		depth--;
+		return n;
+	 }
+
+	 case '.':
+		// 改行以外の1バイト。
+		cs.set();
+		cs.reset('\n');
+		cs.reset('\r');
+		return NewSet(cs);
+
+	 case '[':
+		return ParseClass();
+
+	 case '^':
+		return New(RNode::Bol);
+
+	 case '$':
+		return New(RNode::Eol);
+
+	 case '\\':
+		if (ParseEscape(cs, false) < -1) {
+			return -1;
+		}
+		fold_case(cs);
+		return NewSet(cs);
+
+	 case '*':
+	 case '+':
+	 case '?':
+	 case '{':
+		// 繰り返す対象がない。
+		return -1;
+
+	 default:
+		cs.set((uint8)c);
+		fold_case(cs);
+		return NewSet(cs);
+	}
+}
+
+// 文字クラス [...] 。'[' の次から。
+int
+RegexDFA::Parser::ParseClass()
+{
+	ByteSet cs;
+	bool negate = false;
+
+	if (Peek('^')) {
+		negate = true;
+		pos++;
+	}
+	for (;;) {
+		if (pos >= src.size()) {
+			return -1;
+		}
+		if (src[pos] == ']') {
+			pos++;
+			break;
+		}
+
+		// 1文字かクラスエスケープを読む。
+		ByteSet item;
+		int lo;
+		if (src[pos] == '\\') {
+			pos++;
+			lo = ParseEscape(item, true);
+			if (lo < -1) {
+				return -1;
+			}
+		} else {
+			lo = (uint8)src[pos++];
+			item.set(lo);
+		}
+
+		// 範囲指定
+		if (Peek('-') && pos + 1 < src.size() && src[pos + 1] != ']') {
+			pos++;
+			int hi;
+			if (src[pos] == '\\') {
+				pos++;
+				hi = ParseEscape(item, true);
+			} else {
+				hi = (uint8)src[pos++];
+			}
+			if (lo < 0 || hi < 0 || lo > hi) {
+				return -1;
+			}
+			for (int i = lo; i <= hi; i++) {
+				cs.set(i);
+			}
+		} else {
+			cs |= item;
+		}
+	}
+
+	fold_case(cs);
+	if (negate) {
+		cs.flip();
+	}
+	return NewSet(cs);
+}
+
+static int
+hexval(char c)
+{
+	if ('0' <= c && c <= '9') {
+		return c - '0';
+	}
+	c |= 0x20;
+	if ('a' <= c && c <= 'f') {
+		return c - 'a' + 10;
+	}
+	return -1;
+}
+
+// '\\' の次から1つ読んで、表す文字の集合を cs に格納する。
+// 1文字ならその文字を、\d のようなクラスなら -1 を返す。
+// 扱えないかエラーなら -2 を返す。
+int
+RegexDFA::Parser::ParseEscape(ByteSet& cs, bool in_class)
+{
+	if (pos >= src.size()) {
+		return -2;
+	}
+
+	int ch = (uint8)src[pos++];
+	switch (ch) {
+	 case 'd':
+	 case 'D':
+		for (int c = '0'; c <= '9'; c++) {
+			cs.set(c);
+		}
+		break;
+	 case 'w':
+	 case 'W':
+		for (int c = '0'; c <= '9'; c++) {
+			cs.set(c);
+		}
+		for (int c = 'a'; c <= 'z'; c++) {
+			cs.set(c);
+			cs.set(c - 0x20);
+		}
+		cs.set('_');
+		break;
+	 case 's':
+	 case 'S':
+		for (auto c : " \t\n\v\f\r") {
+			cs.set((uint8)c);
+		}
+		cs.reset(0);	// 上の文字列の終端
+		break;
+
+	 case 't':	ch = '\t';	goto single;
+	 case 'n':	ch = '\n';	goto single;
+	 case 'r':	ch = '\r';	goto single;
+	 case 'f':	ch = '\f';	goto single;
+	 case 'v':	ch = '\v';	goto single;
+
+	 case '0':
+		// \0 の後ろに数字が続くのは8進数か後方参照。
+		if (pos < src.size() && '0' <= src[pos] && src[pos] <= '9') {
+			return -2;
+		}
+		ch = 0;
+		goto single;
+
+	 case 'b':
+		// 文字クラスの中ならバックスペース、外なら単語境界 (扱えない)。
+		if (in_class == false) {
+			return -2;
+		}
+		ch = '\b';
+		goto single;
+
+	 case 'x':
+	 case 'u':
+	 {
+		int len = (ch == 'x') ? 2 : 4;
+		if (pos + len > src.size()) {
+			return -2;
+		}
+		int v = 0;
+		for (int i = 0; i < len; i++) {
+			int h = hexval(src[pos + i]);
+			if (h < 0) {
+				return -2;
+			}
+			v = v * 16 + h;
+		}
+		pos += len;
+		// バイト単位で照合しているので ASCII 以外の \u は表せない。
+		if (ch == 'u' && v >= 0x80) {
+			return -2;
+		}
+		ch = v;
+		goto single;
+	 }
+
+	 default:
+		// 後方参照 (\1..\9)、\B や \c などの未知の英数字は扱えない。
+		// 記号 (と非 ASCII のバイト) はその文字自身。
+		if (ch < 0x80 && isalnum(ch)) {
+			return -2;
+		}
+		goto single;
+	}
+
+	// ここはクラスエスケープ。大文字なら補集合。
+	if (isupper(ch)) {
+		cs.flip();
+	}
+	return -1;
+
+ single:
+	cs.set(ch);
+	return ch;
+}
+
+
+//
+// 正規表現をまとめた DFA
+//
+
+// コンストラクタ
+RegexDFA::RegexDFA()
+{
+}
+
+// デストラクタ
+RegexDFA::~RegexDFA()
+{
+}
+
+// 全部消す。
+void
+RegexDFA::Clear()
+{
+	sets.clear();
+	nfa.clear();
+	rule_start.clear();
+	start = -1;
+	class_rep.clear();
+	nclass = 0;
+	restart.clear();
+	states.clear();
+	trans.clear();
+	accepting.clear();
+	index.clear();
+	mark.clear();
+}
+
+// 正規表現 re を id で登録する。
+bool
+RegexDFA::Add(const std::string& re, int id)
+{
+	size_t nsets = sets.size();
+	size_t nnfa = nfa.size();
+
+	std::vector<RNode> tree;
+	Parser parser(re, tree, sets);
+	int root = parser.Parse();
+	if (root >= 0) {
+		int m = NewNode(NNode::Match, -1);
+		nfa[m].id = id;
+		int s = Compile(tree, root, m);
+		if (nfa.size() <= MAX_NFA) {
+			rule_start.push_back(s);
+			return true;
+		}
+	}
+
+	// 失敗したら追加した分を戻す。
+	sets.resize(nsets);
+	nfa.resize(nnfa);
+	return false;
+}
+
+// NFA のノードを追加する。
+int
+RegexDFA::NewNode(NNode::Op op, int out, int out1)
+{
+	nfa.emplace_back();
+	NNode& node = nfa.back();
+	node.op = op;
+	node.out = out;
+	node.out1 = out1;
+	return nfa.size() - 1;
+}
+
+// 構文木のノード n を、一致したら next に進む NFA にして
+// その入口を返す。
+int
+RegexDFA::Compile(const std::vector<RNode>& tree, int n, int next)
+{
+	const RNode& r = tree[n];
+
+	// 展開しすぎたら諦める (呼び出し元で検出する)。
+	if (nfa.size() > MAX_NFA) {
+		return next;
+	}
+
+	switch (r.op) {
+	 case RNode::Set:
+	 {
+		int b = NewNode(NNode::Byte, next);
+		nfa[b].set = r.set;
+		return b;
+	 }
+
+	 case RNode::Cat:
+		for (int i = r.kids.size() - 1; i >= 0; i--) {
+			next = Compile(tree, r.kids[i], next);
+		}
+		return next;
+
+	 case RNode::Alt:
+	 {
+		int s = Compile(tree, r.kids.back(), next);
+		for (int i = r.kids.size() - 2; i >= 0; i--) {
+			int k = Compile(tree, r.kids[i], next);
+			s = NewNode(NNode::Split, k, s);
+		}
+		return s;
+	 }
+
+	 case RNode::Repeat:
+	 {
+		int kid = r.kids[0];
+		int cur = next;
+		if (r.max < 0) {
+			// 上限なしの部分は x*
+			int sp = NewNode(NNode::Split, -1, next);
+			nfa[sp].out = Compile(tree, kid, sp);
+			cur = sp;
+		} else {
+			// 上限までの部分は (x(x)?)? のように入れ子にする
+			for (int i = r.min; i < r.max; i++) {
+				int body = Compile(tree, kid, cur);
+				cur = NewNode(NNode::Split, body, next);
+			}
+		}
+		for (int i = 0; i < r.min; i++) {
+			cur = Compile(tree, kid, cur);
+		}
+		return cur;
+	 }
+
+	 case RNode::Bol:
+		return NewNode(NNode::Bol, next);
+
+	 case RNode::Eol:
+		return NewNode(NNode::Eol, next);
+
+	 case RNode::Empty:
+	 default:
+		return next;
+	}
+}
+
+// 登録を終えて DFA を準備する。
+void
+RegexDFA::Build()
+{
+	start = -1;
+	restart.clear();
+	if (rule_start.empty()) {
+		return;
+	}
+
+	// 全ルールの入口を選択でつないだものを開始ノードにする。
+	int s = rule_start.back();
+	for (int i = rule_start.size() - 2; i >= 0; i--) {
+		s = NewNode(NNode::Split, rule_start[i], s);
+	}
+	start = s;
+
+	// どの文字集合に含まれるかが同じバイト同士は同じ遷移をするので、
+	// 1つのクラスにまとめて遷移表を小さくする。
+	std::map<std::vector<bool>, int> sigmap;
+	class_rep.clear();
+	for (int c = 0; c < 256; c++) {
+		std::vector<bool> sig(sets.size());
+		for (int i = 0, end = sets.size(); i < end; i++) {
+			sig[i] = sets[i][c];
+		}
+		auto it = sigmap.find(sig);
+		if (it == sigmap.end()) {
+			it = sigmap.emplace(std::move(sig), class_rep.size()).first;
+			class_rep.push_back(c);
+		}
+		byteclass[c] = it->second;
+	}
+	nclass = class_rep.size();
+
+	mark.assign(nfa.size(), 0);
+	markgen = 0;
+
+	// 2文字目以降の位置でも開始ノードから一致を試みるため、
+	// その ε閉包を求めておく。
+	stack.clear();
+	stack.push_back(start);
+	Closure(restart, stack, false, false);
+
+	Flush();
+}
+
+// stack にある NFA ノードの ε閉包を dst に追加する。stack は空になる。
+// bol、eol はそれぞれ文字列の先頭、末尾にいるかどうか。
+// 末尾でない時の Eol は後で末尾の判定ができるよう集合に残しておく。
+void
+RegexDFA::Closure(std::vector<int>& dst, std::vector<int>& stk,
+	bool bol, bool eol) const
+{
+	if (__predict_false(++markgen == 0)) {
+		std::fill(mark.begin(), mark.end(), 0);
+		markgen = 1;
+	}
+
+	while (stk.empty() == false) {
+		int n = stk.back();
+		stk.pop_back();
+		if (n < 0 || mark[n] == markgen) {
+			continue;
+		}
+		mark[n] = markgen;
+
+		const NNode& node = nfa[n];
+		switch (node.op) {
+		 case NNode::Byte:
+		 case NNode::Match:
+			dst.push_back(n);
+			break;
+		 case NNode::Split:
+			stk.push_back(node.out1);
+			stk.push_back(node.out);
+			break;
+		 case NNode::Bol:
+			if (bol) {
+				stk.push_back(node.out);
+			}
+			break;
+		 case NNode::Eol:
+			if (eol) {
+				stk.push_back(node.out);
+			} else {
+				dst.push_back(n);
+			}
+			break;
+		}
+	}
+}
+
+// DFA のキャッシュを捨てて、初期状態だけを作り直す。
+void
+RegexDFA::Flush() const
+{
+	states.clear();
+	trans.clear();
+	accepting.clear();
+	index.clear();
+
+	// 初期状態 (0番) は先頭でだけ使うので index には登録しない。
+	std::vector<int> init;
+	stack.clear();
+	stack.push_back(start);
+	Closure(init, stack, true, false);
+	std::sort(init.begin(), init.end());
+	AddState(std::move(init), false);
+}
+
+// NFA ノードの集合 set を DFA の状態として追加して、その番号を返す。
+int
+RegexDFA::AddState(std::vector<int>&& set, bool register_index) const
+{
+	int s = states.size();
+	states.emplace_back();
+	DState& st = states.back();
+	st.nfa = std::move(set);
+	for (int n : st.nfa) {
+		const NNode& node = nfa[n];
+		if (node.op == NNode::Match) {
+			st.accepts.push_back(node.id);
+		} else if (node.op == NNode::Eol) {
+			st.has_eol = true;
+		}
+	}
+	trans.resize(states.size() * nclass, -1);
+	accepting.push_back(st.accepts.empty() ? 0 : 1);
+	if (register_index) {
+		index.emplace(st.nfa, s);
+	}
+	return s;
+}
+
+// 状態 s からクラス cls の文字で遷移する先を求めて返す。
+int
+RegexDFA::Step(int s, int cls) const
+{
+	uint8 c = class_rep[cls];
+
+	stack.clear();
+	for (int n : states[s].nfa) {
+		const NNode& node = nfa[n];
+		if (node.op == NNode::Byte && sets[node.set][c]) {
+			stack.push_back(node.out);
+		}
+	}
+	work.clear();
+	Closure(work, stack, false, false);
+	work.insert(work.end(), restart.begin(), restart.end());
+	std::sort(work.begin(), work.end());
+	work.erase(std::unique(work.begin(), work.end()), work.end());
+
+	auto it = index.find(work);
+	if (it != index.end()) {
+		trans[s * nclass + cls] = it->second;
+		return it->second;
+	}
+
+	if (__predict_false(trans.size() + nclass > MAX_TRANS)) {
+		// 作り直したら s はもうないので遷移は記録しない。
+		Flush();
+		return AddState(std::vector<int>(work), true);
+	}
+	int t = AddState(std::vector<int>(work), true);
+	trans[s * nclass + cls] = t;
+	return t;
+}
+
+// 状態 s で文字列が終わった時に新たに一致する id を返す。
+const std::vector<int>&
+RegexDFA::EofAccepts(int s) const
+{
+	DState& st = states[s];
+	if (st.eof_done == false) {
+		std::vector<int> dst;
+		stack = st.nfa;
+		Closure(dst, stack, (s == 0), true);
+		for (int n : dst) {
+			const NNode& node = nfa[n];
+			if (node.op == NNode::Match) {
+				auto& acc = st.accepts;
+				if (std::find(acc.begin(), acc.end(), node.id) == acc.end()) {
+					st.eof_accepts.push_back(node.id);
+				}
+			}
+		}
+		st.eof_done = true;
+	}
+	return st.eof_accepts;
+}
+
+// text を検索して、一致した正規表現ごとに callback を呼ぶ。
+bool
+RegexDFA::Search(std::string_view text, const NGMatchCallback& callback)
+	const
+{
+	if (start < 0) {
+		return false;
+	}
+
+	int s = 0;
+	if (__predict_false(accepting[s])) {
+		for (int id : states[s].accepts) {
+			if (callback(id)) {
+				return true;
+			}
+		}
+	}
+
+	const uint8 *p = (const uint8 *)text.data();
+	const uint8 *end = p + text.size();
+	for (; p < end; p++) {
+		int cls = byteclass[*p];
+		int t = trans[s * nclass + cls];
+		if (__predict_false(t < 0)) {
+			t = Step(s, cls);
+		}
+		s = t;
+		if (__predict_false(accepting[s])) {
+			for (int id : states[s].accepts) {
+				if (callback(id)) {
+					return true;
+				}
+			}
+		}
+	}
+
+	if (states[s].has_eol) {
+		for (int id : EofAccepts(s)) {
+			if (callback(id)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+// re が固定文字列だけからなる正規表現なら、その文字列を *literal に
+// 格納して true を返す。
+/*static*/ bool
+RegexDFA::IsLiteral(const std::string& re, std::string *literal)
+{
+	// メタ文字を含まなければそのまま。
+	if (re.find_first_of("\\^$.|?*+()[]{}") == std::string::npos) {
+		literal->clear();
+		for (auto c : re) {
+			literal->push_back(ascii_lower(c));
+		}
+		return re.empty() == false;
+	}
+
+	// "\.\.\." のようなのも固定文字列として扱えるか構文木で調べる。
+	std::vector<RNode> tree;
+	std::vector<ByteSet> tmpsets;
+	Parser parser(re, tree, tmpsets);
+	int root = parser.Parse();
+	if (root < 0) {
+		return false;
+	}
+
+	std::vector<int> list;
+	if (tree[root].op == RNode::Cat) {
+		list = tree[root].kids;
+	} else {
+		list.push_back(root);
+	}
+
+	std::string str;
+	for (int n : list) {
+		if (tree[n].op != RNode::Set) {
+			return false;
+		}
+		const ByteSet& cs = tmpsets[tree[n].set];
+		// 1文字か、英字の大文字小文字の組なら固定文字。
+		int c = -1;
+		for (int i = 0; i < 256; i++) {
+			if (cs[i]) {
+				c = i;
+				break;
+			}
+		}
+		if (c < 0) {
+			return false;
+		}
+		uint8 lc = ascii_lower(c);
+		ByteSet one;
+		one.set(c);
+		one.set(lc);
+		if (cs != one) {
+			return false;
+		}
+		str.push_back(lc);
+	}
+	*literal = std::move(str);
+	return true;
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include <bitset>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//
+// NG ワードの照合に使うオートマトン
+//
+// ルールがいくつあっても本文を1回走査するだけで済むように、固定文字列は
+// Aho-Corasick 法、正規表現は全ルールをまとめた1つの DFA にする。
+// どちらも ASCII の大文字小文字は区別しない。マルチバイト文字はバイト列
+// として扱う (以前使っていた std::regex<char> の icase と同じ)。
+//
+// 一致したルールは Add() で指定した id で callback に通知する。
+// callback が true を返すとそこで検索を打ち切る。
+using NGMatchCallback = std::function<bool(int)>;
+
+// 固定文字列用の Aho-Corasick オートマトン。
+class AhoCorasick
+{
+ public:
+	AhoCorasick();
+	~AhoCorasick();
+
+	// 全部消す。
+	void Clear();
+
+	// 文字列 word を id で登録する。
+	void Add(const std::string& word, int id);
+
+	// 登録を終えて失敗遷移を構築する。Search() より前に呼ぶこと。
+	void Build();
+
+	// 何も登録されていなければ true を返す。
+	bool empty() const { return outs.empty(); }
+
+	// text を走査して、登録された文字列が出現するたびに callback を呼ぶ。
+	// callback が true を返せば打ち切って true を返す。
+	bool Search(std::string_view text, const NGMatchCallback& callback) const;
+
+ private:
+	struct Node {
+		int fail {};		// 失敗遷移先
+		int dict {};		// 失敗遷移をたどって最初に出力を持つノード
+		uint32 edge {};		// edges[] での子の先頭
+		uint16 nedge {};	// 子の数
+		uint16 nout {};		// 出力の数
+		uint32 out {};		// outs[] での出力の先頭
+	};
+
+	int Next(int n, uint8 c) const;
+
+	std::vector<Node> nodes {};
+	// 子への遷移 (ノードごとに文字順に並べてある)。
+	std::vector<std::pair<uint8, int>> edges {};
+	// ルート直下だけは全文字分の表を持っておく。
+	int root_next[256] {};
+	// 各ノードで一致する id。
+	std::vector<int> outs {};
+
+	// 構築中だけ使うトライ。
+	std::vector<std::map<uint8, int>> trie {};
+	std::vector<std::vector<int>> trie_outs {};
+};
+
+// 正規表現をまとめた DFA。
+//
+// 扱えるのは ECMAScript 構文のうち、選択、グループ、量指定子 (* + ? {n,m})、
+// 文字クラス、. \d \w \s など、^ と $ まで。後方参照や先読みなど正規言語に
+// ならないものは Add() が false を返すので、呼び出し側で別途処理すること。
+// DFA の状態は検索しながら必要になった分だけ作る (状態数が爆発しないよう
+// 上限に達したら作り直す)。
+class RegexDFA
+{
+ public:
+	RegexDFA();
+	~RegexDFA();
+
+	// 全部消す。
+	void Clear();
+
+	// 正規表現 re を id で登録する。
+	// 扱えない構文か構文エラーなら何もせず false を返す。
+	bool Add(const std::string& re, int id);
+
+	// 登録を終えて DFA を準備する。Search() より前に呼ぶこと。
+	void Build();
+
+	// 何も登録されていなければ true を返す。
+	bool empty() const { return rule_start.empty(); }
+
+	// text を検索して、一致した正規表現ごとに callback を呼ぶ。
+	// callback が true を返せば打ち切って true を返す。
+	bool Search(std::string_view text, const NGMatchCallback& callback) const;
+
+	// re が固定文字列 (大文字小文字は問わない) だけからなる正規表現なら
+	// その文字列 (小文字にしたもの) を *literal に格納して true を返す。
+	static bool IsLiteral(const std::string& re, std::string *literal);
+
+	// 作った DFA の状態数を返す (テスト用)
+	size_t GetStateCount() const { return states.size(); }
+
+ private:
+	using ByteSet = std::bitset<256>;
+
+	// 構文木
+	struct RNode {
+		enum Op {
+			Set,		// 文字集合
+			Cat,		// 連接
+			Alt,		// 選択
+			Repeat,		// 繰り返し {min,max} (max < 0 なら上限なし)
+			Bol,		// ^
+			Eol,		// $
+			Empty,		// 空
+		};
+		Op op {};
+		int set {};					// Set の場合の sets[] の番号
+		int min {};
+		int max {};
+		std::vector<int> kids {};
+	};
+	class Parser;
+
+	// NFA
+	struct NNode {
+		enum Op : uint8 {
+			Byte,		// sets[set] に含まれる1バイトを読んで out へ
+			Split,		// out と out1 へ ε遷移 (out1 < 0 なら out だけ)
+			Bol,		// 先頭なら out へ
+			Eol,		// 末尾なら out へ
+			Match,		// id が一致
+		};
+		Op op {};
+		int out {-1};
+		int out1 {-1};
+		int set {};
+		int id {};
+	};
+
+	// DFA の1状態
+	struct DState {
+		std::vector<int> nfa {};		// NFA ノードの集合
+		std::vector<int> accepts {};	// この状態で一致する id
+		bool has_eol {};				// nfa に Eol を含む
+		bool eof_done {};
+		std::vector<int> eof_accepts {};// 末尾で一致する id
+	};
+
+	int Compile(const std::vector<RNode>& tree, int n, int next);
+	int NewNode(NNode::Op op, int out, int out1 = -1);
+	void Closure(std::vector<int>& dst, std::vector<int>& stack,
+		bool bol, bool eol) const;
+	int AddState(std::vector<int>&& nfa, bool register_index) const;
+	int Step(int s, int cls) const;
+	void Flush() const;
+	const std::vector<int>& EofAccepts(int s) const;
+
+	std::vector<ByteSet> sets {};
+	std::vector<NNode> nfa {};
+	std::vector<int> rule_start {};
+	int start {-1};
+
+	// バイトを同じ振る舞いをするクラスにまとめたもの。
+	uint8 byteclass[256] {};
+	std::vector<uint8> class_rep {};	// クラスの代表バイト
+	int nclass {};
+	// 先頭以外で毎回追加する開始状態の ε閉包。
+	std::vector<int> restart {};
+
+	// 以下は検索中に作る DFA のキャッシュ。
+	mutable std::vector<DState> states {};
+	mutable std::vector<int> trans {};	// states.size() * nclass
+	mutable std::vector<uint8> accepting {};	// 状態ごとに accepts があるか
+	mutable std::map<std::vector<int>, int> index {};
+	mutable std::vector<uint32> mark {};
+	mutable uint32 markgen {};
+	mutable std::vector<int> work {};
+	mutable std::vector<int> stack {};
+};
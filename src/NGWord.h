@@ -26,82 +26,47 @@
 #pragma once
 
 #include "JsonFwd.h"
+#include "NGMatcher.h"
+#include "Note.h"
 #include "Regex.h"
-
-class NGStatus;
-class NGWord;
-
-// NGワードリスト
-class NGWordList
-	: public std::vector<NGWord *>
-{
- public:
-	NGWordList();
-	NGWordList(const std::string& filename_)
-		: NGWordList()
-	{
-		SetFileName(filename_);
-	}
-	~NGWordList();
-
-	// ファイル名をセットする
-	bool SetFileName(const std::string& filename);
-
-	// NG ワードリストをファイルから読み込む
-	bool ReadFile();
-
-	// NG ワードリストをファイルに保存する
-	bool WriteFile();
-
-	// NG ワードを追加する
-	NGWord *Add(const std::string& word, const std::string& user);
-
-	// src から NG ワードインスタンスを生成する
-	static NGWord *Parse(const Json& src);
-
-	// NG ワードリストと照合する
-	bool Match(NGStatus *ngstat, const Json& status) const;
-
-	// コマンド
-	bool CmdAdd(const std::string& word, const std::string& user);
-	bool CmdDel(const std::string& ngword_id);
-	bool CmdList();
-
-	std::string Filename {};
-};
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 class NGStatus
 {
  public:
 	bool match {};
-	std::string screen_name {};
-	std::string name {};
-	time_t time {};
+	const NoteUser *user {};	// 一致したユーザ (あるいは本文の投稿者)
+	const Note *note {};		// 一致したノート (時刻の表示用)
 	std::string ngword {};
 };
 
-// NGワード1項目の基本クラス
+// NGワード1項目
+//
+// "ngword" は
+//   "%INSTANCE,<host>" … そのインスタンスのユーザのノート
+//   ""                 … "user" で指定したユーザのノート
+//   それ以外           … 本文 (CW、投票の選択肢、RN 先を含む) を
+//                         大文字小文字を区別しない正規表現として照合
+// "user" は "@user" (ローカル)、"@user@host"、"id:<userId>" のいずれかで、
+// 指定すれば ngword はそのユーザのノートにだけ適用する。
 class NGWord
 {
  public:
 	enum Type
 	{
 		Regular = 0,
-		Live,
-		Delay,
-		Delay2,
-		LessRT,
-		Source,
+		User,
+		Instance,
 		MAX,
 	};
 
- protected:
-	// 必ず継承で作る
-	NGWord(Type type_, int id_,
-		const std::string& ngword_, const std::string& nguser_);
- public:
-	virtual ~NGWord();
+	NGWord(int id_, const std::string& ngword_, const std::string& nguser_);
+	~NGWord();
 
+	Type GetType() const { return type; }
 	int GetId() const { return id; }
 	const std::string& GetWord() const { return ngword; }
 	const std::string& GetUser() const { return nguser; }
@@ -109,24 +74,26 @@ class NGWord
 	// ユーザ指定があれば true を返す
 	bool HasUser() const { return (nguser.empty() == false); }
 
-	// ツイート status がこのユーザのものなら true を返す
-	bool MatchUser(const Json& status) const;
+	// 照合に使う、正規化したユーザ指定を返す
+	const std::string& GetUserKey() const { return userkey; }
+
+	// 照合に使う文字列 (Regular なら正規表現、Instance ならホスト名) を返す
+	const std::string& GetPattern() const { return pattern; }
 
-	// status と照合する。
-	virtual bool Match(const Json& status, const Json **matched_user) const = 0;
+	// Misskey のユーザ user がこのルールのユーザなら true を返す
+	bool MatchUser(const NoteUser& user) const;
 
 	// この NG ワードの内部状態を文字列にして返す
-	// (ベースクラス自身も実体を持っている)
-	virtual std::string Dump() const;
+	std::string Dump() const;
 
 	// type を文字列にして返す
 	static std::string Type2str(Type type);
 
- public:
-	// 本文を正規表現 re と照合する
-	bool MatchText(const Json& status) const;
+	// Misskey のユーザ名とホスト名から照合用のキーを作る
+	static std::string UserKey(const std::string& username,
+		const std::string& host);
 
- protected:
+ private:
 	// 種別
 	Type type {};
 	// 元データ
@@ -134,105 +101,64 @@ class NGWord
 	std::string ngword {};
 	std::string nguser {};
 	// ワーク
-	Regex regex {};
-};
-
-class NGWordLive : public NGWord
-{
-	using inherited = NGWord;
- public:
-	NGWordLive(int id_,
-		const std::string& ngword_, const std::string& nguser_,
-		int wday_, int start_, int end1_, int end2_);
-	virtual ~NGWordLive() override;
-
-	bool Match(const Json& status, const Json **matched_user) const override;
-	std::string Dump() const override;
-
- private:
-	int wday {};
-	int start {};
-	int end1 {};
-	int end2 {};
+	std::string userkey {};
+	std::string pattern {};
 };
 
-class NGWordDelay : public NGWord
-{
-	using inherited = NGWord;
- public:
-	NGWordDelay(int id_,
-		const std::string& ngword_, const std::string& nguser_,
-		int hour_, const std::string& ngtext);
-	virtual ~NGWordDelay() override;
-
-	bool Match(const Json& status, const Json **matched_user) const override;
-	std::string Dump() const override;
-
- private:
-	int delay_sec {};
-	std::string ngtext {};
-};
-
-class NGWordDelay2 : public NGWord
+// NGワードリスト
+//
+// ファイルから読み込んだルールは Compile() で1つの照合器にまとめ、
+// Match() ではノード1つにつき本文などを1回ずつ走査するだけで全ルールと
+// 照合する。
+class NGWordList
+	: public std::vector<NGWord>
 {
-	using inherited = NGWord;
  public:
-	NGWordDelay2(int id_,
-		const std::string& ngword_, const std::string& nguser_,
-		int wday_, int min_, int delay_, const std::string& ngtext);
-	virtual ~NGWordDelay2() override;
-
-	bool Match(const Json& status, const Json **matched_user) const override;
-	std::string Dump() const override;
+	NGWordList();
+	NGWordList(const std::string& filename_)
+		: NGWordList()
+	{
+		SetFileName(filename_);
+	}
+	~NGWordList();
 
- private:
-	int startwday {};
-	int startmin  {};
-	int delayhour {};
-	std::string ngtext {};
-};
+	// ファイル名をセットする
+	bool SetFileName(const std::string& filename);
 
-class NGWordLessRT : public NGWord
-{
-	using inherited = NGWord;
- public:
-	NGWordLessRT(int id_,
-		const std::string& ngword_, const std::string& nguser_, int threshold_);
-	virtual ~NGWordLessRT() override;
+	// NG ワードリストをファイルから読み込んで照合器を作る
+	bool ReadFile();
 
-	bool Match(const Json& status, const Json **matched_user) const override;
-	std::string Dump() const override;
+	// NG ワードリストをファイルに保存する
+	bool WriteFile();
 
- private:
-	int threshold {};
-};
+	// NG ワードを追加する (照合器には反映しない)
+	NGWord *Add(const std::string& word, const std::string& user);
 
-class NGWordSource : public NGWord
-{
-	using inherited = NGWord;
- public:
-	NGWordSource(int id_,
-		const std::string& ngword_, const std::string& nguser_);
-	virtual ~NGWordSource() override;
+	// src から NG ワードを生成する
+	static NGWord Parse(const Json& src);
 
-	bool Match(const Json& status, const Json **matched_user) const override;
-	std::string Dump() const override;
+	// 今のリストから照合器を作り直す
+	void Compile();
 
- private:
-	std::string ngsource {};
-};
+	// ノート note を NG ワードリストと照合する
+	bool Match(NGStatus *ngstat, const Note& note) const;
 
-class NGWordRegular : public NGWord
-{
-	using inherited = NGWord;
- public:
-	NGWordRegular(int id_,
-		const std::string& ngword_, const std::string& nguser_);
-	virtual ~NGWordRegular() override;
+	// コマンド
+	bool CmdAdd(const std::string& word, const std::string& user);
+	bool CmdDel(const std::string& ngword_id);
+	bool CmdList();
 
-	bool Match(const Json& status, const Json **matched_user) const override;
+	std::string Filename {};
 
  private:
-	const Json *MatchStatus(const Json& status, const Json *status2) const;
-	bool MatchName(const Json& status) const;
+	// 固定文字列のルール
+	AhoCorasick words {};
+	// DFA にできる正規表現のルール
+	RegexDFA regexes {};
+	// DFA にできなかった正規表現のルール (std::regex で1つずつ照合する)
+	std::vector<std::pair<std::unique_ptr<Regex>, int>> others {};
+	// ユーザ指定だけのルール。キーはユーザのキー、値は添字
+	std::unordered_map<std::string, int> users {};
+	// インスタンスのルール。キーはホスト名、値は添字
+	std::unordered_map<std::string, int> instances {};
 };
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// 画像取得に失敗した URL を覚えておくキャッシュ
+//
+
+#include "NegativeCache.h"
+#include "ImageCache.h"
+#include <algorithm>
+
+// 保存するレコード (リトルエンディアン)
+//
+//  +0.b	reason
+//  +1.b	連続失敗回数 (255 で飽和)
+//  +2.w	予約 (0)
+//  +4.l	期限 (Unix time)
+static const size_t RecordSize = 8;
+
+// 1回目の失敗の期限 [秒]。続けて失敗するたびに倍にする。
+static const uint32 base_ttl[] = {
+	0,				// None
+	10 * 60,		// Connect
+	10 * 60,		// ServerError
+	6 * 60 * 60,	// ClientError
+	24 * 60 * 60,	// NotImage
+	24 * 60 * 60,	// Decode
+};
+
+// 期限の上限 [秒]
+static const uint32 max_ttl = 7 * 24 * 60 * 60;
+
+const char NegativeCache::KeyPrefix[] = "neg-";
+
+// コンストラクタ
+NegativeCache::NegativeCache(ImageCache& backend_)
+	: backend(backend_)
+{
+}
+
+// デストラクタ
+NegativeCache::~NegativeCache()
+{
+}
+
+// url を保存する際のキーを返す。
+// ハッシュだと別の URL と衝突して無関係な画像まで見送ってしまうので、
+// 元画像キャッシュと同じく URL そのものをキーにする。
+// キーの長さの上限を超える URL は記録できないだけで、実害はない。
+/*static*/ std::string
+NegativeCache::GetKey(const std::string& url)
+{
+	return KeyPrefix + url;
+}
+
+// url の取得を今は見送るべきなら true を返す。
+bool
+NegativeCache::Check(const std::string& url, time_t now)
+{
+	const uint8 *data;
+	size_t len;
+
+	auto key = GetKey(url);
+	if (backend.Lookup(key, &data, &len) == false || len != RecordSize) {
+		return false;
+	}
+
+	auto reason = (Reason)data[0];
+	uint32 fails = data[1];
+	uint32 until = (uint32)data[4] | (data[5] << 8) | (data[6] << 16) |
+		((uint32)data[7] << 24);
+	if ((time_t)until <= now) {
+		// 期限切れなので、もう一度試してみる。
+		// 記録はまた失敗した時に回数を数えるため残しておく。
+		return false;
+	}
+
+	skip++;
+	Debug(diag, "%s: skip %s (%s x%u, %us left; skipped %ju)", __method__,
+		url.c_str(), ReasonStr(reason), fails, (uint32)(until - now),
+		(uintmax_t)skip);
+	return true;
+}
+
+// url の取得に reason で失敗したことを記録する。
+void
+NegativeCache::Fail(const std::string& url, Reason reason, time_t now)
+{
+	const uint8 *data;
+	size_t len;
+	uint32 fails = 0;
+
+	auto key = GetKey(url);
+	if (backend.Lookup(key, &data, &len) && len == RecordSize) {
+		// 理由が変わっても連続失敗には違いないので回数は引き継ぐ
+		fails = data[1];
+	}
+	if (fails < 255) {
+		fails++;
+	}
+
+	uint32 ttl = GetTTL(reason, fails);
+	uint32 until = (uint32)now + ttl;
+	uint8 rec[RecordSize] {};
+	rec[0] = (uint8)reason;
+	rec[1] = fails;
+	rec[4] = until;
+	rec[5] = until >> 8;
+	rec[6] = until >> 16;
+	rec[7] = until >> 24;
+	backend.Store(key, rec, sizeof(rec));
+
+	fail++;
+	Debug(diag, "%s: %s (%s x%u) retry after %us", __method__,
+		url.c_str(), ReasonStr(reason), fails, ttl);
+}
+
+// url の取得に成功したので記録を消す。
+void
+NegativeCache::Success(const std::string& url)
+{
+	const uint8 *data;
+	size_t len;
+
+	auto key = GetKey(url);
+	if (backend.Lookup(key, &data, &len)) {
+		backend.Remove(key);
+	}
+}
+
+// reason で fails 回続けて失敗した時の期限 [秒] を返す。
+/*static*/ uint32
+NegativeCache::GetTTL(Reason reason, int fails)
+{
+	uint32 idx = (uint32)reason;
+	if (idx >= sizeof(base_ttl) / sizeof(base_ttl[0]) || fails < 1) {
+		return 0;
+	}
+
+	uint64 ttl = base_ttl[idx];
+	ttl <<= std::min(fails - 1, 16);
+	return std::min(ttl, (uint64)max_ttl);
+}
+
+/*static*/ const char *
+NegativeCache::ReasonStr(Reason reason)
+{
+	static const char * const names[] = {
+		"None",
+		"Connect",
+		"ServerError",
+		"ClientError",
+		"NotImage",
+		"Decode",
+	};
+
+	uint32 idx = (uint32)reason;
+	if (idx < sizeof(names) / sizeof(names[0])) {
+		return names[idx];
+	}
+	return "?";
+}
+
+// HTTP の応答コードから失敗の種類を返す。
+/*static*/ NegativeCache::Reason
+NegativeCache::FromResultCode(int code)
+{
+	if (code >= 500) {
+		return Reason::ServerError;
+	}
+	if (code >= 400) {
+		return Reason::ClientError;
+	}
+	return Reason::Connect;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include "Diag.h"
+#include <string>
+#include <ctime>
+
+class ImageCache;
+
+//
+// 画像取得に失敗した URL を覚えておくキャッシュ
+//
+// 画像でないものを返すサーバや、応答しないサーバに対して、
+// 同じ人の投稿を表示するたびに接続からタイムアウトまでを
+// 繰り返さないように、失敗した URL をしばらくの間覚えておく。
+// 失敗の種類ごとに期限を決めてあり、続けて失敗するたびに
+// 期限を倍にしていく (上限あり)。
+// 内容は ImageCache に "neg-" で始まるキーで保存するので、
+// 次回起動時にも引き継がれる。
+class NegativeCache
+{
+ public:
+	// 失敗の種類
+	enum class Reason : uint8 {
+		None = 0,
+		Connect,		// 接続できない、タイムアウト
+		ServerError,	// HTTP 5xx
+		ClientError,	// HTTP 4xx
+		NotImage,		// Content-Type が image/* でない
+		Decode,			// 画像として読み込めない
+		Max,
+	};
+
+	explicit NegativeCache(ImageCache& backend_);
+	~NegativeCache();
+
+	void SetDiag(const Diag& diag_) { diag = diag_; }
+
+	// url の取得を今は見送るべきなら true を返す。
+	bool Check(const std::string& url, time_t now);
+
+	// url の取得に reason で失敗したことを記録する。
+	void Fail(const std::string& url, Reason reason, time_t now);
+
+	// url の取得に成功したので記録を消す。
+	void Success(const std::string& url);
+
+	// reason で fails 回続けて失敗した時の期限 [秒] を返す。
+	static uint32 GetTTL(Reason reason, int fails);
+
+	static const char *ReasonStr(Reason reason);
+
+	// HTTP の応答コードから失敗の種類を返す。
+	// 応答を受け取れていない (code が 0) なら Connect。
+	static Reason FromResultCode(int code);
+
+	// 統計情報
+	uint64 GetSkip() const { return skip; }
+	uint64 GetFail() const { return fail; }
+
+	// 保存する際のキーの接頭辞
+	static const char KeyPrefix[];
+
+ private:
+	static std::string GetKey(const std::string& url);
+
+	ImageCache& backend;
+
+	uint64 skip {};		// 見送った回数
+	uint64 fail {};		// 記録した回数
+
+	Diag diag {};
+};
@@ -0,0 +1,1028 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// Misskey のノートの取り出し
+//
+
+#include "Note.h"
+#include "JsonInc.h"
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+// 読み飛ばす値の入れ子の上限。これより深いものは DOM に任せる。
+static const int MAX_DEPTH = 256;
+// ストリームの皮の入れ子の上限。
+static const int MAX_ENVELOPE = 8;
+
+// 中身を空にする。
+void
+Note::Clear()
+{
+	id = {};
+	createdAt = {};
+	text = {};
+	cw = {};
+	has_user = false;
+	user.Clear();
+	tags.clear();
+	files.clear();
+	has_poll = false;
+	choices.clear();
+	renoteCount = 0;
+	reactionCount = 0;
+	renote = NULL;
+}
+
+// コンストラクタ
+NoteParser::NoteParser()
+{
+}
+
+// デストラクタ
+NoteParser::~NoteParser()
+{
+}
+
+// メッセージ msg を解析する。
+NoteParser::Result
+NoteParser::Parse(std::string_view msg)
+{
+	p = msg.data();
+	end = p + msg.size();
+
+	// デコードした文字列が元より長くなることはない。
+	if (scratch.size() < msg.size()) {
+		scratch.resize(msg.size());
+	}
+	scratch_len = 0;
+
+	note.Clear();
+	renote.Clear();
+	result = Result::Note;
+	envelope_level = 0;
+
+	// オブジェクトでなければ DOM 側でエラーにしてもらう。
+	if (Peek() != '{') {
+		return Result::Fallback;
+	}
+	if (ParseNote(note, 0) == false) {
+		return Result::Fallback;
+	}
+	SkipSpace();
+	if (p != end) {
+		return Result::Fallback;
+	}
+	return result;
+}
+
+// p から始まるオブジェクトを dst に取り出す。
+// depth は 0 なら (ストリームの皮かもしれない) ノート、1 なら RN 先。
+// 構文エラーなら false を返す。
+//
+// ストリームから来る JSON は
+// {"type":"channel","body":{"id":..,"type":"note","body":{ノート本体}}}
+// のような構造で、"type" が文字列かつ "body" がオブジェクトなら皮として
+// "type" で判断する (misskey_show_object() の DOM 版と同じ)。
+// 1回で読むために "type" が "body" より先にあることを期待しており、
+// そうでなければ DOM に任せる。
+bool
+NoteParser::ParseNote(Note& dst, int depth)
+{
+	std::string_view type;
+	bool has_type = false;
+	// 皮をむき終わったので、残りのメンバは読み飛ばすだけ。
+	bool done = false;
+
+	p++;	// '{'
+	for (bool first = true; ; first = false) {
+		std::string_view key;
+		int r = NextMember(first, &key);
+		if (r < 0) {
+			return false;
+		}
+		if (r == 0) {
+			break;
+		}
+
+		char c = Peek();
+		bool ok;
+		if (done) {
+			ok = SkipValue();
+		} else if (key == "text" && c == '"') {
+			ok = ParseString(&dst.text);
+		} else if (key == "id" && c == '"') {
+			ok = ParseString(&dst.id);
+		} else if (key == "createdAt" && c == '"') {
+			ok = ParseString(&dst.createdAt);
+		} else if (key == "cw" && c == '"') {
+			ok = ParseString(&dst.cw);
+		} else if (key == "user" && c == '{') {
+			dst.has_user = true;
+			dst.user.Clear();
+			ok = ParseUser(dst.user);
+		} else if (key == "tags" && c == '[') {
+			ok = ParseTags(dst);
+		} else if (key == "files" && c == '[') {
+			ok = ParseFiles(dst);
+		} else if (key == "poll" && c == '{') {
+			ok = ParsePoll(dst);
+		} else if (key == "renoteCount") {
+			ok = ParseInt(&dst.renoteCount);
+		} else if (key == "reactions" && c == '{') {
+			ok = ParseReactions(dst);
+		} else if (depth == 0 && key == "renote" && c == '{') {
+			renote.Clear();
+			ok = ParseNote(renote, depth + 1);
+			dst.renote = &renote;
+		} else if (depth == 0 && key == "type" && c == '"') {
+			ok = ParseString(&type);
+			has_type = true;
+		} else if (depth == 0 && key == "body" && c == '{') {
+			if (has_type == false) {
+				// 皮かどうかまだ分からない。
+				result = Result::Fallback;
+				ok = SkipValue();
+			} else if (type == "channel" || type == "note") {
+				// 皮なので、ここまでに拾ったものは捨てて "body" の下へ。
+				if (++envelope_level > MAX_ENVELOPE) {
+					return false;
+				}
+				note.Clear();
+				renote.Clear();
+				ok = ParseNote(note, 0);
+			} else if (type.substr(0, 5) == "emoji") {
+				// emoji{Added,Deleted} とかは無視でいい。
+				result = Result::Ignore;
+				ok = SkipValue();
+			} else {
+				// アナウンスや知らないタイプは DOM で。
+				result = Result::Fallback;
+				ok = SkipValue();
+			}
+			done = true;
+		} else if (depth == 0 && key == "announcement" && c == '{') {
+			// アナウンスは構造が全然違うので DOM で。
+			result = Result::Fallback;
+			ok = SkipValue();
+		} else {
+			ok = SkipValue();
+		}
+		if (ok == false) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// "user" のオブジェクトを取り出す。
+bool
+NoteParser::ParseUser(NoteUser& dst)
+{
+	p++;	// '{'
+	for (bool first = true; ; first = false) {
+		std::string_view key;
+		int r = NextMember(first, &key);
+		if (r <= 0) {
+			return (r == 0);
+		}
+
+		char c = Peek();
+		bool ok;
+		if (key == "name" && c == '"') {
+			ok = ParseString(&dst.name);
+		} else if (key == "username" && c == '"') {
+			ok = ParseString(&dst.username);
+		} else if (key == "host" && c == '"') {
+			ok = ParseString(&dst.host);
+		} else if (key == "id" && c == '"') {
+			ok = ParseString(&dst.id);
+		} else if (key == "avatarUrl" && c == '"') {
+			ok = ParseString(&dst.avatarUrl);
+		} else if (key == "instance" && c == '{') {
+			dst.has_instance = true;
+			dst.instance_name = {};
+			ok = ParseInstance(dst);
+		} else {
+			ok = SkipValue();
+		}
+		if (ok == false) {
+			return false;
+		}
+	}
+}
+
+// "user" の "instance" のオブジェクトを取り出す。
+bool
+NoteParser::ParseInstance(NoteUser& dst)
+{
+	p++;	// '{'
+	for (bool first = true; ; first = false) {
+		std::string_view key;
+		int r = NextMember(first, &key);
+		if (r <= 0) {
+			return (r == 0);
+		}
+
+		bool ok;
+		if (key == "name" && Peek() == '"') {
+			ok = ParseString(&dst.instance_name);
+		} else {
+			ok = SkipValue();
+		}
+		if (ok == false) {
+			return false;
+		}
+	}
+}
+
+// "tags" の配列を取り出す。文字列でない要素は無視する。
+bool
+NoteParser::ParseTags(Note& dst)
+{
+	dst.tags.clear();
+	p++;	// '['
+	for (bool first = true; ; first = false) {
+		int r = NextElement(first);
+		if (r <= 0) {
+			return (r == 0);
+		}
+
+		bool ok;
+		if (Peek() == '"') {
+			std::string_view tag;
+			ok = ParseString(&tag);
+			dst.tags.push_back(tag);
+		} else {
+			ok = SkipValue();
+		}
+		if (ok == false) {
+			return false;
+		}
+	}
+}
+
+// "files" の配列を取り出す。オブジェクトでない要素は無視する。
+bool
+NoteParser::ParseFiles(Note& dst)
+{
+	dst.files.clear();
+	p++;	// '['
+	for (bool first = true; ; first = false) {
+		int r = NextElement(first);
+		if (r <= 0) {
+			return (r == 0);
+		}
+
+		bool ok;
+		if (Peek() == '{') {
+			dst.files.emplace_back();
+			ok = ParseFile(dst.files.back());
+		} else {
+			ok = SkipValue();
+		}
+		if (ok == false) {
+			return false;
+		}
+	}
+}
+
+// "files" の1要素を取り出す。
+bool
+NoteParser::ParseFile(NoteFile& dst)
+{
+	p++;	// '{'
+	for (bool first = true; ; first = false) {
+		std::string_view key;
+		int r = NextMember(first, &key);
+		if (r <= 0) {
+			return (r == 0);
+		}
+
+		char c = Peek();
+		bool ok;
+		if (key == "type" && c == '"') {
+			ok = ParseString(&dst.type);
+		} else if (key == "thumbnailUrl" && c == '"') {
+			ok = ParseString(&dst.thumbnailUrl);
+		} else if (key == "blurhash" && c == '"') {
+			ok = ParseString(&dst.blurhash);
+		} else if (key == "isSensitive") {
+			ok = ParseBool(&dst.isSensitive);
+		} else if (key == "properties" && c == '{') {
+			dst.width = 0;
+			dst.height = 0;
+			ok = ParseProperties(dst);
+		} else {
+			ok = SkipValue();
+		}
+		if (ok == false) {
+			return false;
+		}
+	}
+}
+
+// "files" の "properties" を取り出す。
+bool
+NoteParser::ParseProperties(NoteFile& dst)
+{
+	p++;	// '{'
+	for (bool first = true; ; first = false) {
+		std::string_view key;
+		int r = NextMember(first, &key);
+		if (r <= 0) {
+			return (r == 0);
+		}
+
+		bool ok;
+		if (key == "width") {
+			ok = ParseInt(&dst.width);
+		} else if (key == "height") {
+			ok = ParseInt(&dst.height);
+		} else {
+			ok = SkipValue();
+		}
+		if (ok == false) {
+			return false;
+		}
+	}
+}
+
+// "poll" のオブジェクトを取り出す。
+bool
+NoteParser::ParsePoll(Note& dst)
+{
+	dst.has_poll = true;
+	dst.choices.clear();
+	p++;	// '{'
+	for (bool first = true; ; first = false) {
+		std::string_view key;
+		int r = NextMember(first, &key);
+		if (r <= 0) {
+			return (r == 0);
+		}
+
+		bool ok;
+		if (key == "choices" && Peek() == '[') {
+			dst.choices.clear();
+			p++;	// '['
+			for (bool efirst = true; ; efirst = false) {
+				int er = NextElement(efirst);
+				if (er < 0) {
+					return false;
+				}
+				if (er == 0) {
+					break;
+				}
+				if (Peek() == '{') {
+					dst.choices.emplace_back();
+					ok = ParseChoice(dst.choices.back());
+				} else {
+					ok = SkipValue();
+				}
+				if (ok == false) {
+					return false;
+				}
+			}
+			ok = true;
+		} else {
+			ok = SkipValue();
+		}
+		if (ok == false) {
+			return false;
+		}
+	}
+}
+
+// 投票の選択肢を1つ取り出す。
+bool
+NoteParser::ParseChoice(NotePollChoice& dst)
+{
+	p++;	// '{'
+	for (bool first = true; ; first = false) {
+		std::string_view key;
+		int r = NextMember(first, &key);
+		if (r <= 0) {
+			return (r == 0);
+		}
+
+		bool ok;
+		if (key == "text" && Peek() == '"') {
+			ok = ParseString(&dst.text);
+		} else if (key == "votes") {
+			ok = ParseInt(&dst.votes);
+		} else if (key == "isVoted") {
+			ok = ParseBool(&dst.isVoted);
+		} else {
+			ok = SkipValue();
+		}
+		if (ok == false) {
+			return false;
+		}
+	}
+}
+
+// "reactions" の値 (数値のもの) を合計する。
+bool
+NoteParser::ParseReactions(Note& dst)
+{
+	dst.reactionCount = 0;
+	p++;	// '{'
+	for (bool first = true; ; first = false) {
+		std::string_view key;
+		int r = NextMember(first, &key);
+		if (r <= 0) {
+			return (r == 0);
+		}
+
+		int cnt;
+		if (ParseInt(&cnt) == false) {
+			return false;
+		}
+		dst.reactionCount += cnt;
+	}
+}
+
+// オブジェクトの次のメンバのキーを読んで ':' の後ろまで進む。
+int
+NoteParser::NextMember(bool first, std::string_view *key)
+{
+	char c = Peek();
+	if (c == '}') {
+		p++;
+		return 0;
+	}
+	if (first == false) {
+		if (c != ',') {
+			return -1;
+		}
+		p++;
+		c = Peek();
+	}
+	if (c != '"') {
+		return -1;
+	}
+	if (ParseString(key) == false) {
+		return -1;
+	}
+	if (Peek() != ':') {
+		return -1;
+	}
+	p++;
+	return 1;
+}
+
+// 配列の次の要素の手前まで進む。
+int
+NoteParser::NextElement(bool first)
+{
+	char c = Peek();
+	if (first) {
+		if (c == ']') {
+			p++;
+			return 0;
+		}
+		return 1;
+	}
+	if (c == ']') {
+		p++;
+		return 0;
+	}
+	if (c != ',') {
+		return -1;
+	}
+	p++;
+	return 1;
+}
+
+// 値を1つ読み飛ばす。
+bool
+NoteParser::SkipValue(int depth)
+{
+	if (__predict_false(depth >= MAX_DEPTH)) {
+		return false;
+	}
+
+	switch (Peek()) {
+	 case '{':
+		p++;
+		for (bool first = true; ; first = false) {
+			std::string_view key;
+			int r = NextMember(first, &key);
+			if (r <= 0) {
+				return (r == 0);
+			}
+			if (SkipValue(depth + 1) == false) {
+				return false;
+			}
+		}
+
+	 case '[':
+		p++;
+		for (bool first = true; ; first = false) {
+			int r = NextElement(first);
+			if (r <= 0) {
+				return (r == 0);
+			}
+			if (SkipValue(depth + 1) == false) {
+				return false;
+			}
+		}
+
+	 case '"':
+	 {
+		std::string_view dummy;
+		return ParseString(&dummy);
+	 }
+
+	 case 't':
+		return ParseLiteral("true", 4);
+	 case 'f':
+		return ParseLiteral("false", 5);
+	 case 'n':
+		return ParseLiteral("null", 4);
+
+	 default:
+	 {
+		double dummy;
+		return ParseNumber(&dummy);
+	 }
+	}
+}
+
+// リテラル lit を読む。
+bool
+NoteParser::ParseLiteral(const char *lit, size_t len)
+{
+	if (end - p < len || memcmp(p, lit, len) != 0) {
+		return false;
+	}
+	p += len;
+	return true;
+}
+
+// 数値を読む。数値でなければ JsonAsInt() と同じく 0 にする。
+bool
+NoteParser::ParseInt(int *dst)
+{
+	char c = Peek();
+	if (c == '-' || ('0' <= c && c <= '9')) {
+		double d;
+		if (ParseNumber(&d) == false) {
+			return false;
+		}
+		if (d >= (double)INT_MAX) {
+			*dst = INT_MAX;
+		} else if (d <= (double)INT_MIN) {
+			*dst = INT_MIN;
+		} else {
+			*dst = (int)d;
+		}
+		return true;
+	}
+	*dst = 0;
+	return SkipValue();
+}
+
+// 真偽値を読む。真偽値でなければ JsonAsBool() と同じく false にする。
+bool
+NoteParser::ParseBool(bool *dst)
+{
+	char c = Peek();
+	if (c == 't') {
+		*dst = true;
+		return ParseLiteral("true", 4);
+	}
+	*dst = false;
+	if (c == 'f') {
+		return ParseLiteral("false", 5);
+	}
+	return SkipValue();
+}
+
+// JSON の数値を読む。
+bool
+NoteParser::ParseNumber(double *dst)
+{
+	const char *start = p;
+	bool neg = false;
+	bool is_int = true;
+	uint64 ival = 0;
+	int digits = 0;
+
+	if (p < end && *p == '-') {
+		neg = true;
+		p++;
+	}
+	// 整数部。先頭の 0 の後ろに数字は続かない。
+	if (p < end && *p == '0') {
+		p++;
+	} else if (p < end && '1' <= *p && *p <= '9') {
+		for (; p < end && '0' <= *p && *p <= '9'; p++) {
+			ival = ival * 10 + (*p - '0');
+			digits++;
+		}
+	} else {
+		return false;
+	}
+	// 小数部。
+	if (p < end && *p == '.') {
+		p++;
+		if (p >= end || *p < '0' || '9' < *p) {
+			return false;
+		}
+		while (p < end && '0' <= *p && *p <= '9') {
+			p++;
+		}
+		is_int = false;
+	}
+	// 指数部。
+	if (p < end && (*p == 'e' || *p == 'E')) {
+		p++;
+		if (p < end && (*p == '+' || *p == '-')) {
+			p++;
+		}
+		if (p >= end || *p < '0' || '9' < *p) {
+			return false;
+		}
+		while (p < end && '0' <= *p && *p <= '9') {
+			p++;
+		}
+		is_int = false;
+	}
+
+	if (is_int && digits <= 18) {
+		// ほとんどはここ。
+		*dst = neg ? -(double)ival : (double)ival;
+	} else {
+		// 終端があるとは限らないのでコピーしてから変換する。
+		std::string buf(start, p - start);
+		*dst = strtod(buf.c_str(), NULL);
+	}
+	return true;
+}
+
+// 4桁の16進数を読む。
+static int
+hex4(const char *s)
+{
+	int val = 0;
+	for (int i = 0; i < 4; i++) {
+		char c = s[i];
+		val <<= 4;
+		if ('0' <= c && c <= '9') {
+			val += c - '0';
+		} else if ('a' <= c && c <= 'f') {
+			val += c - 'a' + 10;
+		} else if ('A' <= c && c <= 'F') {
+			val += c - 'A' + 10;
+		} else {
+			return -1;
+		}
+	}
+	return val;
+}
+
+// s から始まる UTF-8 の1文字のバイト数を返す。
+// 正しくない UTF-8 (nlohmann::json がエラーにするもの) なら 0 を返す。
+static int
+utf8_len(const uint8 *s, size_t n)
+{
+	uint8 c = s[0];
+	uint8 lo = 0x80;
+	uint8 hi = 0xbf;
+	int len;
+
+	if (c < 0x80) {
+		return 1;
+	} else if (c < 0xc2) {
+		return 0;
+	} else if (c < 0xe0) {
+		len = 2;
+	} else if (c < 0xf0) {
+		len = 3;
+		if (c == 0xe0) {
+			lo = 0xa0;
+		} else if (c == 0xed) {
+			hi = 0x9f;
+		}
+	} else if (c < 0xf5) {
+		len = 4;
+		if (c == 0xf0) {
+			lo = 0x90;
+		} else if (c == 0xf4) {
+			hi = 0x8f;
+		}
+	} else {
+		return 0;
+	}
+	if (n < len) {
+		return 0;
+	}
+	if (s[1] < lo || s[1] > hi) {
+		return 0;
+	}
+	for (int i = 2; i < len; i++) {
+		if (s[i] < 0x80 || s[i] > 0xbf) {
+			return 0;
+		}
+	}
+	return len;
+}
+
+// 文字列を読む。p は '"' を指していること。
+// エスケープがなければメッセージの中を、あればデコードした作業領域の
+// 中を指す string_view を dst に返す。
+bool
+NoteParser::ParseString(std::string_view *dst)
+{
+	const char *start = ++p;
+	// エスケープが出てきたら、以降は作業領域に書き出す。
+	char *d = NULL;
+	char *dstart = NULL;
+
+	for (;;) {
+		// エスケープも要注意文字もない ASCII の区間をまとめて進める。
+		const char *run = p;
+		while (p < end) {
+			uint8 c = *p;
+			if (c < 0x20 || c == '"' || c == '\\' || c >= 0x80) {
+				break;
+			}
+			p++;
+		}
+		if (d && p != run) {
+			memcpy(d, run, p - run);
+			d += p - run;
+		}
+		if (__predict_false(p >= end)) {
+			return false;
+		}
+
+		uint8 c = *p;
+		if (c == '"') {
+			break;
+		}
+		if (c >= 0x80) {
+			int len = utf8_len((const uint8 *)p, end - p);
+			if (len == 0) {
+				return false;
+			}
+			if (d) {
+				memcpy(d, p, len);
+				d += len;
+			}
+			p += len;
+			continue;
+		}
+		if (c < 0x20) {
+			// 制御文字はエスケープしないといけない。
+			return false;
+		}
+
+		// ここからエスケープ。
+		if (d == NULL) {
+			dstart = d = scratch.data() + scratch_len;
+			memcpy(d, start, p - start);
+			d += p - start;
+		}
+		p++;
+		if (p >= end) {
+			return false;
+		}
+		switch (*p++) {
+		 case '"':	*d++ = '"';		break;
+		 case '\\':	*d++ = '\\';	break;
+		 case '/':	*d++ = '/';		break;
+		 case 'b':	*d++ = '\b';	break;
+		 case 'f':	*d++ = '\f';	break;
+		 case 'n':	*d++ = '\n';	break;
+		 case 'r':	*d++ = '\r';	break;
+		 case 't':	*d++ = '\t';	break;
+		 case 'u':
+		 {
+			if (end - p < 4) {
+				return false;
+			}
+			int code = hex4(p);
+			if (code < 0) {
+				return false;
+			}
+			p += 4;
+			if (0xdc00 <= code && code <= 0xdfff) {
+				// 単独の下位サロゲート。
+				return false;
+			}
+			if (0xd800 <= code && code <= 0xdbff) {
+				// 上位サロゲートなら下位サロゲートが続くこと。
+				if (end - p < 6 || p[0] != '\\' || p[1] != 'u') {
+					return false;
+				}
+				int low = hex4(p + 2);
+				if (low < 0xdc00 || low > 0xdfff) {
+					return false;
+				}
+				p += 6;
+				code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+			}
+			// UTF-8 にする。6バイトの "\uXXXX" より長くはならない。
+			if (code < 0x80) {
+				*d++ = code;
+			} else if (code < 0x800) {
+				*d++ = 0xc0 | (code >> 6);
+				*d++ = 0x80 | (code & 0x3f);
+			} else if (code < 0x10000) {
+				*d++ = 0xe0 | (code >> 12);
+				*d++ = 0x80 | ((code >> 6) & 0x3f);
+				*d++ = 0x80 | (code & 0x3f);
+			} else {
+				*d++ = 0xf0 | (code >> 18);
+				*d++ = 0x80 | ((code >> 12) & 0x3f);
+				*d++ = 0x80 | ((code >> 6) & 0x3f);
+				*d++ = 0x80 | (code & 0x3f);
+			}
+			break;
+		 }
+		 default:
+			return false;
+		}
+	}
+
+	if (d) {
+		*dst = std::string_view(dstart, d - dstart);
+		scratch_len += d - dstart;
+	} else {
+		*dst = std::string_view(start, p - start);
+	}
+	p++;	// '"'
+	return true;
+}
+
+//
+// DOM からの変換
+//
+
+// obj の key が文字列ならそれを指す string_view を返す。
+static std::string_view
+json_view(const Json& obj, const char *key)
+{
+	auto it = obj.find(key);
+	if (it != obj.end() && it->is_string()) {
+		return it->get_ref<const std::string&>();
+	}
+	return {};
+}
+
+// obj の key がオブジェクトならそれを返す。
+static const Json *
+json_object(const Json& obj, const char *key)
+{
+	auto it = obj.find(key);
+	if (it != obj.end() && it->is_object()) {
+		return &*it;
+	}
+	return NULL;
+}
+
+// obj の key が配列ならそれを返す。
+static const Json *
+json_array(const Json& obj, const char *key)
+{
+	auto it = obj.find(key);
+	if (it != obj.end() && it->is_array()) {
+		return &*it;
+	}
+	return NULL;
+}
+
+// obj の key が数値ならその値を返す。
+static int
+json_int(const Json& obj, const char *key)
+{
+	auto it = obj.find(key);
+	if (it != obj.end()) {
+		return JsonAsInt(*it);
+	}
+	return 0;
+}
+
+// obj の key が真偽値ならその値を返す。
+static bool
+json_bool(const Json& obj, const char *key)
+{
+	auto it = obj.find(key);
+	if (it != obj.end()) {
+		return JsonAsBool(*it);
+	}
+	return false;
+}
+
+// src から Note を作る。depth は 0 ならノート、1 なら RN 先。
+static void
+note_from_json(Note& dst, Note& renote, const Json& src, int depth)
+{
+	dst.Clear();
+	dst.id = json_view(src, "id");
+	dst.createdAt = json_view(src, "createdAt");
+	dst.text = json_view(src, "text");
+	dst.cw = json_view(src, "cw");
+
+	if (const Json *user = json_object(src, "user")) {
+		dst.has_user = true;
+		dst.user.id = json_view(*user, "id");
+		dst.user.name = json_view(*user, "name");
+		dst.user.username = json_view(*user, "username");
+		dst.user.host = json_view(*user, "host");
+		dst.user.avatarUrl = json_view(*user, "avatarUrl");
+		if (const Json *instance = json_object(*user, "instance")) {
+			dst.user.has_instance = true;
+			dst.user.instance_name = json_view(*instance, "name");
+		}
+	}
+
+	if (const Json *tags = json_array(src, "tags")) {
+		for (const auto& tag : *tags) {
+			if (tag.is_string()) {
+				dst.tags.push_back(tag.get_ref<const std::string&>());
+			}
+		}
+	}
+
+	if (const Json *files = json_array(src, "files")) {
+		for (const auto& f : *files) {
+			if (f.is_object() == false) {
+				continue;
+			}
+			NoteFile& file = dst.files.emplace_back();
+			file.type = json_view(f, "type");
+			file.blurhash = json_view(f, "blurhash");
+			file.thumbnailUrl = json_view(f, "thumbnailUrl");
+			file.isSensitive = json_bool(f, "isSensitive");
+			if (const Json *prop = json_object(f, "properties")) {
+				file.width = json_int(*prop, "width");
+				file.height = json_int(*prop, "height");
+			}
+		}
+	}
+
+	if (const Json *poll = json_object(src, "poll")) {
+		dst.has_poll = true;
+		if (const Json *choices = json_array(*poll, "choices")) {
+			for (const auto& c : *choices) {
+				if (c.is_object() == false) {
+					continue;
+				}
+				NotePollChoice& choice = dst.choices.emplace_back();
+				choice.text = json_view(c, "text");
+				choice.votes = json_int(c, "votes");
+				choice.isVoted = json_bool(c, "isVoted");
+			}
+		}
+	}
+
+	dst.renoteCount = json_int(src, "renoteCount");
+	if (const Json *reactions = json_object(src, "reactions")) {
+		for (const auto& [key, val] : reactions->items()) {
+			dst.reactionCount += JsonAsInt(val);
+		}
+	}
+
+	if (depth == 0) {
+		if (const Json *rn = json_object(src, "renote")) {
+			note_from_json(renote, renote, *rn, depth + 1);
+			dst.renote = &renote;
+		}
+	}
+}
+
+// ストリームの皮をむいたノートの DOM obj から Note を作って返す。
+const Note&
+NoteParser::FromJson(const Json& obj)
+{
+	note_from_json(note, renote, obj, 0);
+	return note;
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include "JsonFwd.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+//
+// 表示に使う分だけを取り出した Misskey のノート
+//
+// 文字列はすべて受信したメッセージ (か NoteParser の作業領域) を指す
+// string_view なので、元のメッセージより長生きさせてはいけない。
+// 値が文字列でない (null や欠落) なら空になるのは JsonAsString() と同じ。
+//
+
+// ノートの投稿者。
+struct NoteUser
+{
+	std::string_view id {};
+	std::string_view name {};
+	std::string_view username {};
+	std::string_view host {};
+	std::string_view avatarUrl {};
+	bool has_instance {};				// "instance" がオブジェクトなら true
+	std::string_view instance_name {};	// "instance":{"name"}
+
+	void Clear() { *this = NoteUser(); }
+};
+
+// 添付ファイル。
+struct NoteFile
+{
+	std::string_view type {};
+	std::string_view blurhash {};
+	std::string_view thumbnailUrl {};
+	bool isSensitive {};
+	int width {};						// "properties":{"width"}
+	int height {};						// "properties":{"height"}
+};
+
+// 投票の選択肢。
+struct NotePollChoice
+{
+	std::string_view text {};
+	int votes {};
+	bool isVoted {};
+};
+
+struct Note
+{
+	std::string_view id {};
+	std::string_view createdAt {};
+	std::string_view text {};
+	std::string_view cw {};
+
+	bool has_user {};					// "user" がオブジェクトなら true
+	NoteUser user {};
+
+	std::vector<std::string_view> tags {};
+	std::vector<NoteFile> files {};
+
+	bool has_poll {};					// "poll" がオブジェクトなら true
+	std::vector<NotePollChoice> choices {};
+
+	int renoteCount {};
+	int reactionCount {};				// "reactions" の値の合計
+
+	// リノート (引用を含む) なら RN 先。そうでなければ NULL。
+	const Note *renote {};
+
+	// 中身を空にする。vector の領域は再利用のため解放しない。
+	void Clear();
+};
+
+//
+// Misskey のストリームから来る1メッセージから Note を取り出す
+//
+// Parse() は DOM を作らずにメッセージを先頭から1回だけ走査して、表示に
+// 使うキーだけを Note に拾う。拾わない値は構文を確かめながら読み飛ばす。
+// エスケープを含まない文字列はメッセージそのものを、含む文字列は
+// デコードして作業領域に置いたものを指す。
+// ノートでないメッセージ (アナウンスや知らないタイプ) と、構文エラーの
+// 時は Fallback を返すので、呼び出し側は今まで通り DOM で処理すること。
+//
+// FromJson() は DOM (Json) から同じ Note を作る。この場合の文字列は
+// Json 内の文字列を指す。
+//
+class NoteParser
+{
+ public:
+	enum class Result {
+		Note,		// ノートだった。GetNote() で取り出せる
+		Ignore,		// 表示しなくてよいメッセージ (emoji* など)
+		Fallback,	// ここでは扱えないので DOM で処理すること
+	};
+
+	NoteParser();
+	~NoteParser();
+
+	// メッセージ msg を解析する。
+	// 結果は次に Parse() か FromJson() を呼ぶまで有効。
+	Result Parse(std::string_view msg);
+
+	// ストリームの皮をむいたノートの DOM obj から Note を作って返す。
+	const Note& FromJson(const Json& obj);
+
+	// 直前に取り出したノートを返す。
+	const Note& GetNote() const { return note; }
+
+ private:
+	bool ParseNote(Note& dst, int depth);
+	bool ParseUser(NoteUser& dst);
+	bool ParseInstance(NoteUser& dst);
+	bool ParseFiles(Note& dst);
+	bool ParseFile(NoteFile& dst);
+	bool ParseProperties(NoteFile& dst);
+	bool ParsePoll(Note& dst);
+	bool ParseChoice(NotePollChoice& dst);
+	bool ParseTags(Note& dst);
+	bool ParseReactions(Note& dst);
+
+	bool ParseString(std::string_view *dst);
+	bool ParseNumber(double *dst);
+	bool ParseInt(int *dst);
+	bool ParseBool(bool *dst);
+	bool ParseLiteral(const char *lit, size_t len);
+	bool SkipValue(int depth = 0);
+
+	// オブジェクトの次のメンバのキーを読んで ':' の後ろまで進む。
+	// メンバがあれば 1、'}' で終わりなら 0、構文エラーなら -1 を返す。
+	int NextMember(bool first, std::string_view *key);
+	// 配列の次の要素の手前まで進む。
+	// 要素があれば 1、']' で終わりなら 0、構文エラーなら -1 を返す。
+	int NextElement(bool first);
+
+	void SkipSpace() {
+		while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' ||
+		    *p == '\r')) {
+			p++;
+		}
+	}
+	// 次の (空白でない) 文字を返す。終端なら '\0'。
+	char Peek() {
+		SkipSpace();
+		return (p < end) ? *p : '\0';
+	}
+
+	// 解析中の位置と終端
+	const char *p {};
+	const char *end {};
+
+	// エスケープをデコードした文字列の置き場。
+	// メッセージ長を超えることはないので、最初にその大きさを確保して
+	// 途中で再確保しない (string_view が無効になるため)。
+	std::vector<char> scratch {};
+	size_t scratch_len {};
+
+	// ストリームの皮をむいた結果
+	Result result {};
+	// 皮の深さ
+	int envelope_level {};
+
+	Note note {};
+	Note renote {};
+};
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// 最近表示したノートを画面の大きさに依らない形で保持しておくもの
+//
+
+#include "NoteHistory.h"
+
+// コンストラクタ
+NoteHistory::NoteHistory()
+{
+}
+
+// デストラクタ
+NoteHistory::~NoteHistory()
+{
+}
+
+// 保持するノート数を設定する。
+void
+NoteHistory::SetCapacity(size_t capacity_)
+{
+	capacity = capacity_;
+	while (notes.size() > capacity) {
+		notes.pop_front();
+	}
+}
+
+// 1ノートの記録を開始する。
+void
+NoteHistory::Begin()
+{
+	cur.clear();
+	recording = (capacity > 0);
+	paused = false;
+}
+
+// 1ノートの記録を終了する。
+void
+NoteHistory::End()
+{
+	if (recording == false) {
+		return;
+	}
+	recording = false;
+
+	if (cur.empty()) {
+		return;
+	}
+	// 押し出した一番古いノートの領域は次の記録に使い回す。
+	Note spare;
+	if (notes.size() >= capacity) {
+		spare = std::move(notes.front());
+		notes.pop_front();
+	}
+	notes.emplace_back(std::move(cur));
+	cur = std::move(spare);
+	cur.clear();
+}
+
+// 文字列要素を追加する。
+void
+NoteHistory::AddText(int depth, const UString& text)
+{
+	if (IsRecording() == false) {
+		return;
+	}
+
+	Item item;
+	item.type = Item::Text;
+	item.depth = depth;
+	item.text = text;
+	cur.emplace_back(std::move(item));
+}
+
+// そのまま出力する文字列を追加する。
+// 直前も Raw なら連結して要素数を増やさないようにする。
+void
+NoteHistory::AddRaw(const char *s, size_t len)
+{
+	if (IsRecording() == false || len == 0) {
+		return;
+	}
+
+	if (cur.empty() == false && cur.back().type == Item::Raw) {
+		cur.back().raw.append(s, len);
+		return;
+	}
+
+	Item item;
+	item.type = Item::Raw;
+	item.raw.assign(s, len);
+	cur.emplace_back(std::move(item));
+}
+
+// 画面の大きさに依存する出力を追加する。
+void
+NoteHistory::AddDraw(int depth, const std::function<void()>& fn)
+{
+	if (IsRecording() == false) {
+		return;
+	}
+
+	Item item;
+	item.type = Item::Draw;
+	item.depth = depth;
+	item.draw = fn;
+	cur.emplace_back(std::move(item));
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include "UString.h"
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+//
+// 最近表示したノートを画面の大きさに依らない形で保持しておくもの
+//
+// 端末の大きさが変わった時に、画面に出ているノートを新しい桁数や
+// アイコンサイズで描き直すために使う。
+// 本文などの文字列は折り返す前の UString のまま、画像は表示する処理を
+// (キャッシュのキーの元になる URL などと一緒に) 関数オブジェクトとして
+// 持っておき、描き直す時はそれを今の画面の大きさで実行し直す。
+class NoteHistory
+{
+ public:
+	// 1ノートを構成する描画要素。
+	struct Item {
+		enum Type {
+			Text,		// print_() する文字列
+			Raw,		// そのまま出力する文字列
+			Draw,		// 画面の大きさに依存する出力 (アイコンや画像)
+		};
+		Type type {};
+		int depth {};					// 記録した時の indent_depth
+		UString text {};				// Text の場合
+		std::string raw {};				// Raw の場合
+		std::function<void()> draw {};	// Draw の場合
+	};
+	using Note = std::vector<Item>;
+
+	NoteHistory();
+	~NoteHistory();
+
+	// 保持するノート数を設定する。0 なら何も記録しない。
+	void SetCapacity(size_t capacity_);
+	size_t GetCapacity() const { return capacity; }
+
+	// 1ノートの記録を開始する。
+	void Begin();
+	// 1ノートの記録を終了する。要素が1つもなければ何も残さない。
+	void End();
+
+	// 記録中なら true を返す。
+	bool IsRecording() const { return recording && !paused; }
+
+	// 一時的に記録を止める (Draw の実行中など)。
+	void SetPaused(bool paused_) { paused = paused_; }
+
+	// 要素を追加する。記録中でなければ何もしない。
+	void AddText(int depth, const UString& text);
+	void AddRaw(const char *s, size_t len);
+	void AddRaw(const std::string& s) { AddRaw(s.data(), s.size()); }
+	void AddDraw(int depth, const std::function<void()>& fn);
+
+	// 保持しているノート (古い順)。
+	const std::deque<Note>& GetNotes() const { return notes; }
+	size_t GetCount() const { return notes.size(); }
+
+ private:
+	std::deque<Note> notes {};
+	Note cur {};
+	size_t capacity {};
+	bool recording {};
+	bool paused {};
+};
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include <signal.h>
+
+//
+// 入力順を保ったまま並列に処理するパイプライン
+//
+// 読み込みスレッドが要素を1つずつ読み込み、ワーカースレッドが並列に
+// 処理し、Run() を呼んだスレッドが読み込んだ順に出力する。
+// 後の要素の処理が先に終わっても、前の要素を出力するまでは待たせておく。
+// 読み込んでから出力し終わるまでの要素は最大 window 個で、要素 (T) は
+// その数だけ作っておいて使い回す。出力が遅ければ読み込みも止まるので、
+// 入力がいくら長くてもメモリは増えない。
+//
+// シグナルは Run() を呼んだスレッドだけで受け取るよう、
+// 読み込みスレッドとワーカースレッドではすべてブロックしておく。
+//
+template <typename T>
+class OrderedPipeline
+{
+ public:
+	// 次の要素を item に読み込む。もうなければ false を返す。
+	// 読み込みスレッドで呼ばれる。
+	using Reader = std::function<bool(T&)>;
+
+	// item を処理する。ワーカースレッドで並列に呼ばれる。
+	using Worker = std::function<void(T&)>;
+
+	// item を出力する。Run() を呼んだスレッドで読み込んだ順に呼ばれる。
+	// false を返すとそこで打ち切る。
+	using Emitter = std::function<bool(T&)>;
+
+	OrderedPipeline(int nworkers_, int window_)
+		: nworkers(std::max(nworkers_, 1)),
+		  slots(std::max(window_, 1))
+	{
+	}
+
+	// 全部出力するか打ち切られるまで戻らない。
+	// 打ち切られたら false を返す。
+	// 打ち切る時は読み込みスレッドの終了も待つので、reader が入力待ちで
+	// 止まっていればそれが戻るまで待つことになる。
+	bool Run(const Reader& reader, const Worker& worker,
+		const Emitter& emitter);
+
+	int GetWorkers() const { return nworkers; }
+	int GetWindow() const { return slots.size(); }
+
+	// 出力した要素数。
+	uint64 GetCount() const { return emit_seq; }
+
+	// 出力側が処理の終わりを待った回数 (ワーカーが追いついていない)。
+	uint64 GetEmitWaits() const { return emit_waits; }
+
+	// 読み込み側が空きを待った回数 (出力が追いついていない)。
+	uint64 GetReadWaits() const { return read_waits; }
+
+ private:
+	struct Slot {
+		T item {};
+		bool done {};		// 処理済みなら true
+	};
+
+	void ReaderMain(const Reader& reader);
+	void WorkerMain(const Worker& worker);
+	bool EmitterMain(const Emitter& emitter);
+
+	Slot& SlotOf(uint64 seq) { return slots[seq % slots.size()]; }
+
+	int nworkers {};
+	std::vector<Slot> slots {};
+
+	// 以下は mtx で保護する。
+	// 通し番号が emit_seq <= work_seq <= read_seq <= emit_seq + window
+	// となるように進む。
+	std::mutex mtx {};
+	std::condition_variable space_cv {};	// 読み込み側が空きを待つ
+	std::condition_variable work_cv {};		// ワーカーが仕事を待つ
+	std::condition_variable emit_cv {};		// 出力側が処理の終わりを待つ
+	uint64 read_seq {};		// 次に読み込む要素
+	uint64 work_seq {};		// 次に処理する要素
+	uint64 emit_seq {};		// 次に出力する要素
+	bool eof {};			// 入力が終わった
+	bool abort {};			// 打ち切った
+
+	uint64 emit_waits {};
+	uint64 read_waits {};
+};
+
+template <typename T> bool
+OrderedPipeline<T>::Run(const Reader& reader, const Worker& worker,
+	const Emitter& emitter)
+{
+	read_seq = 0;
+	work_seq = 0;
+	emit_seq = 0;
+	eof = false;
+	abort = false;
+	emit_waits = 0;
+	read_waits = 0;
+	for (auto& slot : slots) {
+		slot.done = false;
+	}
+
+	// 作ったスレッドはシグナルマスクを引き継ぐので、
+	// 全部ブロックした状態で作ってから元に戻す。
+	sigset_t all;
+	sigset_t old;
+	sigfillset(&all);
+	pthread_sigmask(SIG_BLOCK, &all, &old);
+	std::thread reader_thread([&]() { ReaderMain(reader); });
+	std::vector<std::thread> worker_threads;
+	for (int i = 0; i < nworkers; i++) {
+		worker_threads.emplace_back([&]() { WorkerMain(worker); });
+	}
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+	bool rv = EmitterMain(emitter);
+
+	reader_thread.join();
+	for (auto& th : worker_threads) {
+		th.join();
+	}
+	return rv;
+}
+
+// 読み込みスレッド。
+template <typename T> void
+OrderedPipeline<T>::ReaderMain(const Reader& reader)
+{
+	for (;;) {
+		uint64 seq;
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			if (read_seq - emit_seq >= slots.size()) {
+				read_waits++;
+				space_cv.wait(lock, [&]() {
+					return abort || read_seq - emit_seq < slots.size();
+				});
+			}
+			if (abort) {
+				return;
+			}
+			seq = read_seq;
+		}
+
+		// このスロットは出力し終わっていて誰も触らないので
+		// ロックを持たずに読み込んでよい。
+		bool ok = reader(SlotOf(seq).item);
+
+		std::lock_guard<std::mutex> lock(mtx);
+		if (ok == false) {
+			eof = true;
+			work_cv.notify_all();
+			emit_cv.notify_one();
+			return;
+		}
+		read_seq++;
+		work_cv.notify_one();
+	}
+}
+
+// ワーカースレッド。
+template <typename T> void
+OrderedPipeline<T>::WorkerMain(const Worker& worker)
+{
+	for (;;) {
+		uint64 seq;
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			work_cv.wait(lock, [&]() {
+				return abort || eof || work_seq < read_seq;
+			});
+			if (abort || work_seq >= read_seq) {
+				return;
+			}
+			seq = work_seq++;
+		}
+
+		Slot& slot = SlotOf(seq);
+		worker(slot.item);
+
+		std::lock_guard<std::mutex> lock(mtx);
+		slot.done = true;
+		if (seq == emit_seq) {
+			emit_cv.notify_one();
+		}
+	}
+}
+
+// 出力側。Run() を呼んだスレッドで動く。
+template <typename T> bool
+OrderedPipeline<T>::EmitterMain(const Emitter& emitter)
+{
+	for (;;) {
+		Slot *slot;
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			slot = &SlotOf(emit_seq);
+			if (slot->done == false) {
+				if (eof && emit_seq == read_seq) {
+					return true;
+				}
+				emit_waits++;
+				emit_cv.wait(lock, [&]() {
+					return slot->done || (eof && emit_seq == read_seq);
+				});
+				if (slot->done == false) {
+					return true;
+				}
+			}
+		}
+
+		// 処理済みのスロットは出力し終わるまで誰も触らない。
+		bool ok = emitter(slot->item);
+
+		std::lock_guard<std::mutex> lock(mtx);
+		slot->done = false;
+		emit_seq++;
+		space_cv.notify_one();
+		if (__predict_false(ok == false)) {
+			abort = true;
+			space_cv.notify_all();
+			work_cv.notify_all();
+			return false;
+		}
+	}
+}
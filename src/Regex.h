@@ -23,6 +23,8 @@
  * SUCH DAMAGE.
  */
 
+#pragma once
+
 #include <string>
 
 // 正規表現クラス。
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "RenderBuffer.h"
+#include <cerrno>
+#include <unistd.h>
+
+const char RenderBuffer::SyncBegin[] = "\x1b[?2026h";
+const char RenderBuffer::SyncEnd[]   = "\x1b[?2026l";
+
+// 溜め始める。
+void
+RenderBuffer::Begin(bool sync_)
+{
+	buf.clear();
+	sixels.clear();
+	active = true;
+	sync = sync_;
+	last_bytes = 0;
+	last_writes = 0;
+
+	if (sync) {
+		buf += SyncBegin;
+	}
+}
+
+// 文字列を追加する。
+void
+RenderBuffer::Append(const char *s, size_t len)
+{
+	buf.append(s, len);
+}
+
+// 書式付きで文字列を追加する。
+void
+RenderBuffer::Printf(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	VPrintf(fmt, ap);
+	va_end(ap);
+}
+
+// 書式付きで文字列を追加する (va_list 版)。
+void
+RenderBuffer::VPrintf(const char *fmt, va_list ap)
+{
+	char tmp[256];
+	va_list ap2;
+
+	va_copy(ap2, ap);
+	int n = vsnprintf(tmp, sizeof(tmp), fmt, ap2);
+	va_end(ap2);
+	if (__predict_false(n < 0)) {
+		return;
+	}
+	if (__predict_true(n < sizeof(tmp))) {
+		buf.append(tmp, n);
+		return;
+	}
+
+	// 長ければ直接書き込む。
+	auto pos = buf.size();
+	buf.resize(pos + n + 1);
+	vsnprintf(&buf[pos], n + 1, fmt, ap);
+	buf.resize(pos + n);
+}
+
+// SIXEL を追加する。
+void
+RenderBuffer::AppendSixel(const void *data, size_t len)
+{
+	auto start = buf.size();
+	buf.append((const char *)data, len);
+	if (sixels.empty() == false && sixels.back().second == start) {
+		sixels.back().second = buf.size();
+	} else {
+		sixels.emplace_back(start, buf.size());
+	}
+}
+
+// 溜めた内容を fd に書き出して終わる。
+bool
+RenderBuffer::End(int fd, volatile sig_atomic_t *sixelflag)
+{
+	if (active == false) {
+		return true;
+	}
+	active = false;
+
+	if (sync) {
+		buf += SyncEnd;
+	}
+	return Write(fd, sixelflag);
+}
+
+// ここまで溜めた内容を fd に書き出し、続けて溜める。
+bool
+RenderBuffer::Flush(int fd, volatile sig_atomic_t *sixelflag)
+{
+	if (active == false) {
+		return true;
+	}
+	return Write(fd, sixelflag);
+}
+
+// 溜めた内容を fd に書き出して空にする。
+bool
+RenderBuffer::Write(int fd, volatile sig_atomic_t *sixelflag)
+{
+	if (sixels.empty()) {
+		sixelflag = NULL;
+	}
+
+	bool rv = true;
+	bool in_range = false;
+	size_t pos = 0;
+	size_t si = 0;
+	while (pos < buf.size()) {
+		while (si < sixels.size() && sixels[si].second <= pos) {
+			si++;
+		}
+
+		// フラグを使うなら、SIXEL とそれ以外の境界で write(2) を分ける。
+		// フラグは SIXEL を書いている間だけ立てておき、文字の部分では
+		// 下ろしておく (ここで SIGINT が来れば普通に終了する)。
+		size_t end = buf.size();
+		if (sixelflag) {
+			if (si < sixels.size() && sixels[si].first <= pos) {
+				end = sixels[si].second;
+				if (in_range == false) {
+					*sixelflag = true;
+					in_range = true;
+				} else if (__predict_false(*sixelflag == false)) {
+					// 中断されたので、この SIXEL の残りを捨てる。
+					// 同期出力モードの終了は最後にあるので必ず書き出される。
+					pos = end;
+					in_range = false;
+					continue;
+				}
+			} else {
+				if (si < sixels.size()) {
+					end = sixels[si].first;
+				}
+				*sixelflag = false;
+				in_range = false;
+			}
+		}
+
+		ssize_t n = write(fd, buf.data() + pos, end - pos);
+		last_writes++;
+		if (__predict_false(n < 0)) {
+			if (errno == EINTR) {
+				continue;
+			}
+			rv = false;
+			break;
+		}
+		pos += n;
+		last_bytes += n;
+	}
+	if (sixelflag) {
+		*sixelflag = false;
+	}
+
+	// 領域は次のノートでも使う。
+	buf.clear();
+	sixels.clear();
+	return rv;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include <csignal>
+#include <cstdarg>
+#include <string>
+#include <utility>
+#include <vector>
+
+//
+// 1ノート分の出力を溜めておいて一度に書き出すバッファ
+//
+// ノートの表示は本文、カーソル移動、アイコンや添付画像の SIXEL と
+// 細かい出力の繰り返しなので、そのまま書くとシステムコールが多く、
+// 遅い端末では画像と文字が混ざって書き換わっていく様子が見えてしまう。
+// そこで1ノート分をここに溜めておき、最後に1回の write(2) で書き出す。
+// 端末が対応していれば全体を同期出力モード (DEC private mode 2026) で
+// 囲み、端末側でも一度に描画してもらう。
+class RenderBuffer
+{
+ public:
+	// 溜め始める。sync なら同期出力モードで囲む。
+	void Begin(bool sync_);
+
+	// 溜めている途中なら true。
+	bool IsActive() const { return active; }
+
+	// 文字列を追加する。
+	void Append(const char *s, size_t len);
+	void Append(const std::string& s) { Append(s.data(), s.size()); }
+	void Printf(const char *fmt, ...) __printflike(2, 3);
+	void VPrintf(const char *fmt, va_list ap);
+
+	// SIXEL を追加する。
+	// 書き出し中に中断されたら残りを捨てられるよう、範囲を覚えておく。
+	// 直前の SIXEL に続けて追加すると1つの範囲になるので、
+	// 大きな画像は分割して追加してもよい。
+	void AppendSixel(const void *data, size_t len);
+
+	// 溜めた内容を fd に書き出して終わる。
+	// SIXEL があれば、SIXEL を書き出している間だけ *sixelflag を立てておき
+	// (その前後の文字の部分とは write(2) を分ける)、(シグナルハンドラ
+	// などで) 下ろされたら、その時書いている SIXEL の残りを捨てて続きを書く。
+	// 全部書ければ true を返す。
+	bool End(int fd, volatile sig_atomic_t *sixelflag = NULL);
+
+	// ここまで溜めた内容を End() と同じように fd に書き出し、続けて溜める。
+	// 大きな画像をバッファに溜めずに直接書き出したい時に、
+	// 先にそれまでの分を出しておくために使う。
+	bool Flush(int fd, volatile sig_atomic_t *sixelflag = NULL);
+
+	// 直近の Begin() から End() までに書き出したバイト数と write(2) の回数。
+	size_t GetBytes() const { return last_bytes; }
+	int GetWrites() const { return last_writes; }
+
+	// 同期出力モードの開始と終了のシーケンス
+	static const char SyncBegin[];
+	static const char SyncEnd[];
+
+ private:
+	bool Write(int fd, volatile sig_atomic_t *sixelflag);
+
+	bool active {};
+	bool sync {};
+	std::string buf {};
+
+	// buf 中の SIXEL の範囲 [first, second)
+	std::vector<std::pair<size_t, size_t>> sixels {};
+
+	size_t last_bytes {};
+	int last_writes {};
+};
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// 最近表示したノートの ID を覚えておく集合
+//
+
+#include "SeenNotes.h"
+#include <algorithm>
+
+// コンストラクタ
+SeenNotes::SeenNotes(size_t capacity_)
+{
+	ring.resize(std::max(capacity_, (size_t)1));
+
+	// 偽陽性率が 2〜3% 程度になる大きさにする。
+	size_t size = 1;
+	while (size < ring.size() * 8) {
+		size <<= 1;
+	}
+	counters.resize(size);
+	mask = size - 1;
+}
+
+// デストラクタ
+SeenNotes::~SeenNotes()
+{
+}
+
+// 全部忘れる。
+void
+SeenNotes::Clear()
+{
+	std::fill(counters.begin(), counters.end(), 0);
+	head = 0;
+	count = 0;
+}
+
+// id のハッシュ値を返す。
+// FNV-1a (64ビット) の後に下位ビットにも偏りが出ないよう攪拌する。
+/*static*/ uint64
+SeenNotes::Hash(std::string_view id)
+{
+	uint64 h = 0xcbf29ce484222325ULL;
+	for (auto c : id) {
+		h ^= (uint8)c;
+		h *= 0x100000001b3ULL;
+	}
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	return h;
+}
+
+bool
+SeenNotes::Contains(std::string_view id) const
+{
+	return Contains(Hash(id));
+}
+
+void
+SeenNotes::Add(std::string_view id)
+{
+	Add(Hash(id));
+}
+
+bool
+SeenNotes::CheckAndAdd(std::string_view id)
+{
+	uint64 h = Hash(id);
+	if (Contains(h)) {
+		return true;
+	}
+	Add(h);
+	return false;
+}
+
+bool
+SeenNotes::Contains(uint64 h) const
+{
+	for (int i = 0; i < K; i++) {
+		if (counters[Index(h, i)] == 0) {
+			return false;
+		}
+	}
+
+	// フィルタを通ったら実際にあるか確かめる。
+	// 新しいほうから探す (再送は大抵直前のノートなので)。
+	size_t pos = head;
+	for (size_t n = 0; n < count; n++) {
+		pos = (pos == 0 ? ring.size() : pos) - 1;
+		if (ring[pos] == h) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void
+SeenNotes::Add(uint64 h)
+{
+	// 一杯なら一番古いものをフィルタから外す。
+	// 飽和したカウンタはもう減らさない (偽陽性が増えるだけで済む)。
+	if (count == ring.size()) {
+		uint64 old = ring[head];
+		for (int i = 0; i < K; i++) {
+			uint8& c = counters[Index(old, i)];
+			if (c != 255) {
+				c--;
+			}
+		}
+	} else {
+		count++;
+	}
+
+	ring[head] = h;
+	for (int i = 0; i < K; i++) {
+		uint8& c = counters[Index(h, i)];
+		if (c != 255) {
+			c++;
+		}
+	}
+	head++;
+	if (head == ring.size()) {
+		head = 0;
+	}
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include <string_view>
+#include <vector>
+
+//
+// 最近表示したノートの ID を覚えておく集合
+//
+// ストリームに再接続した時などに同じノートを二度表示しないために使う。
+// ずっと起動しっぱなしでもメモリが増えないよう、覚えておくのは最近の
+// capacity 個だけで、それより古いものから忘れる。
+//
+// ID 文字列そのものは持たず、64ビットのハッシュ値をリングバッファに
+// 並べておく。照合はまずカウンタ式のブルームフィルタで引き、ほとんどを
+// 占める初見の ID はここで弾く。フィルタが「あるかも」と言った時だけ
+// リングバッファを探して確かめるので偽陽性でノートが消えることはない。
+class SeenNotes
+{
+ public:
+	explicit SeenNotes(size_t capacity_ = 4096);
+	~SeenNotes();
+
+	// 全部忘れる。
+	void Clear();
+
+	// id を最近見ていれば true を返す。
+	bool Contains(std::string_view id) const;
+
+	// id を記録する。一杯なら一番古いものを忘れる。
+	void Add(std::string_view id);
+
+	// id を最近見ていれば true を返す。
+	// 見ていなければ記録して false を返す。
+	bool CheckAndAdd(std::string_view id);
+
+	size_t GetCount() const { return count; }
+	size_t GetCapacity() const { return ring.size(); }
+
+	// ハッシュ値を返す (テスト用)
+	static uint64 Hash(std::string_view id);
+
+ private:
+	bool Contains(uint64 h) const;
+	void Add(uint64 h);
+
+	// ブルームフィルタのカウンタの位置を返す。
+	uint32 Index(uint64 h, int i) const {
+		uint32 h1 = (uint32)h;
+		uint32 h2 = (uint32)(h >> 32) | 1;
+		return (h1 + i * h2) & mask;
+	}
+
+	// ブルームフィルタのハッシュ関数の数
+	static const int K = 4;
+
+	// ハッシュ値のリングバッファ
+	std::vector<uint64> ring {};
+	size_t head {};		// 次に書き込む位置
+	size_t count {};
+
+	// ブルームフィルタ (要素数は capacity の 8 倍以上の 2 の冪)
+	std::vector<uint8> counters {};
+	uint32 mask {};
+};
@@ -309,6 +309,58 @@ SixelConverter::ConvertToIndexed()
 	Trace(diag, "Converted");
 }
 
+// 減色せずに RGB のまま dst に出力する。
+// 色数の制限がない端末向けなので、リサイズだけを行う。
+// リサイズは面積平均で、ByLoad ならロード時に済んでいるので
+// 実際にはほぼコピーになる。
+void
+SixelConverter::ConvertToRGB(std::vector<uint8>& dst)
+{
+	int width = 0;
+	int height = 0;
+	CalcResize(&width, &height);
+
+	Debug(diag, "Resize to (%d,%d)", width, height);
+
+	const int srcw = img.GetWidth();
+	const int srch = img.GetHeight();
+	const uint8 *src = img.GetBuf();
+	Width = width;
+	Height = height;
+	dst.resize((size_t)Width * Height * 3);
+
+	if (Width == srcw && Height == srch) {
+		memcpy(dst.data(), src, dst.size());
+		return;
+	}
+
+	uint8 *d = dst.data();
+	for (int y = 0; y < Height; y++) {
+		int sy0 = y * srch / Height;
+		int sy1 = std::max((y + 1) * srch / Height, sy0 + 1);
+		for (int x = 0; x < Width; x++) {
+			int sx0 = x * srcw / Width;
+			int sx1 = std::max((x + 1) * srcw / Width, sx0 + 1);
+			uint64 r = 0;
+			uint64 g = 0;
+			uint64 b = 0;
+			for (int sy = sy0; sy < sy1; sy++) {
+				const uint8 *s = src + ((size_t)sy * srcw + sx0) * 3;
+				for (int sx = sx0; sx < sx1; sx++) {
+					r += *s++;
+					g += *s++;
+					b += *s++;
+				}
+			}
+			uint64 n = (uint64)(sy1 - sy0) * (sx1 - sx0);
+			*d++ = r / n;
+			*d++ = g / n;
+			*d++ = b / n;
+		}
+	}
+	Trace(diag, "Converted");
+}
+
 //
 // ----- Sixel 出力
 //
@@ -62,6 +62,9 @@ class SixelConverter
 	// インデックスカラーに変換する
 	void ConvertToIndexed();
 
+	// 減色せずに RGB (1ピクセル3バイト) のまま dst に出力する
+	void ConvertToRGB(std::vector<uint8>& dst);
+
 	// Sixel を stream に出力する
 	bool SixelToStream(Stream *stream);
 
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// 最近表示した SIXEL をメモリに保持しておくキャッシュ
+//
+
+#include "SixelHotCache.h"
+
+// コンストラクタ
+SixelHotCache::SixelHotCache()
+{
+}
+
+// デストラクタ
+SixelHotCache::~SixelHotCache()
+{
+}
+
+// データ総量の上限を設定する。
+void
+SixelHotCache::SetBudget(size_t budget_)
+{
+	budget = budget_;
+	Evict(budget);
+}
+
+// key を探す。
+const SixelHotCache::Entry *
+SixelHotCache::Lookup(const std::string& key)
+{
+	auto it = entries.find(key);
+	if (it == entries.end()) {
+		miss++;
+		return NULL;
+	}
+	hit++;
+
+	// 先頭に移動
+	lru.splice(lru.begin(), lru, it->second);
+	return &it->second->second;
+}
+
+// key に data を格納する。
+void
+SixelHotCache::Store(const std::string& key, const uint8 *data, size_t len,
+	int width, int height)
+{
+	// 古いのがあれば先に取り除く
+	auto it = entries.find(key);
+	if (it != entries.end()) {
+		bytes -= it->second->second.data.size();
+		lru.erase(it->second);
+		entries.erase(it);
+	}
+
+	if (len == 0 || len > budget / 4) {
+		return;
+	}
+
+	// 入るように空ける
+	Evict(budget - len);
+
+	lru.emplace_front();
+	auto& e = lru.front();
+	e.first = key;
+	e.second.data.assign(data, data + len);
+	e.second.width = width;
+	e.second.height = height;
+	entries.emplace(key, lru.begin());
+	bytes += len;
+}
+
+// 総量が limit 以下になるまで古いほうから追い出す。
+void
+SixelHotCache::Evict(size_t limit)
+{
+	while (bytes > limit && lru.empty() == false) {
+		auto& e = lru.back();
+		bytes -= e.second.data.size();
+		entries.erase(e.first);
+		lru.pop_back();
+		evict++;
+	}
+}
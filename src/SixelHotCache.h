@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//
+// 最近表示した SIXEL をメモリに保持しておくキャッシュ
+//
+// ローカルタイムラインなどでは同じ人のアイコンを何度も表示するので、
+// ディスクキャッシュの手前で SIXEL 本体と、解析済みの幅と高さを
+// 保持しておく。ヒットすれば最後の書き出し以外にシステムコールは不要。
+// 12MB 機でも使えるよう、データの総量を budget で制限し、
+// 超えたら最後に参照したのが古いものから追い出す。
+class SixelHotCache
+{
+ public:
+	struct Entry {
+		std::vector<uint8> data {};
+		int width {};
+		int height {};
+	};
+
+	SixelHotCache();
+	~SixelHotCache();
+
+	// データ総量の上限 [byte] を設定する。0 なら何も保持しない。
+	void SetBudget(size_t budget_);
+
+	// key を探す。見付かれば最近参照したことにしてエントリを返す。
+	// 見付からなければ NULL を返す。
+	// 返したポインタは次に Store() を呼ぶまでの間だけ有効。
+	const Entry *Lookup(const std::string& key);
+
+	// key に data を格納する。同じキーがあれば置き換える。
+	// 1つで budget の 1/4 を超えるような大きなものは、他を全部
+	// 追い出してしまうので保持しない。
+	void Store(const std::string& key, const uint8 *data, size_t len,
+		int width, int height);
+
+	// 統計情報
+	size_t GetCount() const { return entries.size(); }
+	size_t GetBytes() const { return bytes; }
+	size_t GetBudget() const { return budget; }
+	uint64 GetHit() const { return hit; }
+	uint64 GetMiss() const { return miss; }
+	uint64 GetEvict() const { return evict; }
+
+ private:
+	void Evict(size_t limit);
+
+	using List = std::list<std::pair<std::string, Entry>>;
+
+	// 先頭が最近参照したもの
+	List lru {};
+	std::unordered_map<std::string, List::iterator> entries {};
+
+	size_t budget {};
+	size_t bytes {};
+
+	uint64 hit {};
+	uint64 miss {};
+	uint64 evict {};
+};
@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "StageStat.h"
+#include <cinttypes>
+#include <ctime>
+
+/*static*/ bool StageStat::enabled;
+/*static*/ std::array<std::atomic<uint64>, StageStat::N> StageStat::nsec_;
+/*static*/ std::array<std::atomic<uint64>, StageStat::N> StageStat::count_;
+/*static*/ std::array<std::atomic<uint64>, StageStat::N> StageStat::max_;
+/*static*/ std::array<std::array<std::atomic<uint32>, StageStat::Buckets>,
+	StageStat::N> StageStat::hist_;
+/*static*/ std::array<std::atomic<uint64>, StageStat::NC> StageStat::counter_;
+/*static*/ std::atomic<uint64> StageStat::queue_depth;
+/*static*/ std::atomic<uint64> StageStat::queue_depth_max;
+
+// 集計をクリアする。
+/*static*/ void
+StageStat::Clear()
+{
+	for (int i = 0; i < N; i++) {
+		nsec_[i] = 0;
+		count_[i] = 0;
+		max_[i] = 0;
+		for (auto& b : hist_[i]) {
+			b = 0;
+		}
+	}
+	for (auto& c : counter_) {
+		c = 0;
+	}
+	queue_depth = 0;
+	queue_depth_max = 0;
+}
+
+// stage に nsec を加算する。
+/*static*/ void
+StageStat::Add(Stage stage, uint64 nsec)
+{
+	int i = (int)stage;
+
+	nsec_[i].fetch_add(nsec, std::memory_order_relaxed);
+	count_[i].fetch_add(1, std::memory_order_relaxed);
+	hist_[i][BucketOf(nsec / 1000)].fetch_add(1, std::memory_order_relaxed);
+
+	// 最大値は CAS で更新する。
+	uint64 old = max_[i].load(std::memory_order_relaxed);
+	while (nsec > old &&
+		!max_[i].compare_exchange_weak(old, nsec, std::memory_order_relaxed))
+		;
+}
+
+// usec が入るバケットを返す。
+// バケット i は [2^(i-1), 2^i) なので、usec のビット長がそのまま番号になる。
+/*static*/ int
+StageStat::BucketOf(uint64 usec)
+{
+	int b = 0;
+	while (usec != 0) {
+		usec >>= 1;
+		b++;
+	}
+	if (b >= Buckets) {
+		b = Buckets - 1;
+	}
+	return b;
+}
+
+// stage の回数の割合 p (0..1) の所要時間の上限 [usec] を返す。
+// バケットの粒度でしか分からないので、そのバケットの上限を返す。
+// 1回もなければ 0 を返す。
+/*static*/ uint64
+StageStat::GetPercentile(Stage stage, double p)
+{
+	const auto& hist = hist_[(int)stage];
+	uint64 total = 0;
+	for (const auto& b : hist) {
+		total += b;
+	}
+	if (total == 0) {
+		return 0;
+	}
+
+	uint64 target = (uint64)(total * p + 0.5);
+	if (target < 1) {
+		target = 1;
+	}
+	uint64 sum = 0;
+	for (int b = 0; b < Buckets; b++) {
+		sum += hist[b];
+		if (sum >= target) {
+			return BucketLimit(b);
+		}
+	}
+	return BucketLimit(Buckets - 1);
+}
+
+// キューの長さを設定する。
+/*static*/ void
+StageStat::SetQueueDepth(uint64 depth)
+{
+	queue_depth = depth;
+	uint64 old = queue_depth_max.load(std::memory_order_relaxed);
+	while (depth > old &&
+		!queue_depth_max.compare_exchange_weak(old, depth,
+			std::memory_order_relaxed))
+		;
+}
+
+// stage の名前を返す。
+/*static*/ const char *
+StageStat::GetName(Stage stage)
+{
+	static const char * const names[] = {
+		"parse",
+		"format",
+		"print",
+		"fetch",
+		"connect",
+		"handshake",
+		"ttfb",
+		"download",
+		"decode",
+		"reduce",
+		"encode",
+		"output",
+		"image",
+		"note",
+	};
+	static_assert(sizeof(names) / sizeof(names[0]) == N, "");
+
+	int i = (int)stage;
+	if (i < 0 || i >= N) {
+		return "?";
+	}
+	return names[i];
+}
+
+// counter の名前を返す。
+/*static*/ const char *
+StageStat::GetName(Counter counter)
+{
+	static const char * const names[] = {
+		"hot_hit",
+		"hot_miss",
+		"kitty_hit",
+		"kitty_miss",
+		"cache_hit",
+		"cache_miss",
+		"source_hit",
+		"source_miss",
+		"bytes_in",
+		"bytes_out",
+		"reconnect",
+	};
+	static_assert(sizeof(names) / sizeof(names[0]) == NC, "");
+
+	int i = (int)counter;
+	if (i < 0 || i >= NC) {
+		return "?";
+	}
+	return names[i];
+}
+
+// 統計を fp に表形式で書き出す。
+// 回数が 0 の段階は省略する。
+// パーセンタイルはヒストグラムのバケットの上限なので、2倍以内の精度。
+/*static*/ void
+StageStat::Print(FILE *fp)
+{
+	fprintf(fp, "%-10s %8s %10s %8s %8s %8s %8s %8s\n",
+		"stage", "count", "total[ms]",
+		"avg[us]", "p50[us]", "p90[us]", "p99[us]", "max[us]");
+	for (int i = 0; i < N; i++) {
+		auto stage = (Stage)i;
+		uint64 count = GetCount(stage);
+		if (count == 0) {
+			continue;
+		}
+		uint64 nsec = GetNsec(stage);
+		fprintf(fp,
+			"%-10s %8" PRIu64 " %10.3f %8.1f"
+			" %8" PRIu64 " %8" PRIu64 " %8" PRIu64 " %8" PRIu64 "\n",
+			GetName(stage), count, (double)nsec / 1e6,
+			(double)nsec / count / 1e3,
+			GetPercentile(stage, 0.50),
+			GetPercentile(stage, 0.90),
+			GetPercentile(stage, 0.99),
+			GetMax(stage) / 1000);
+	}
+
+	for (int i = 0; i < NC; i++) {
+		auto counter = (Counter)i;
+		fprintf(fp, "%-12s %" PRIu64 "\n",
+			GetName(counter), GetCounter(counter));
+	}
+	fprintf(fp, "%-12s %" PRIu64 " (max %" PRIu64 ")\n",
+		"queue_depth", GetQueueDepth(), GetQueueDepthMax());
+	fflush(fp);
+}
+
+// 統計を fp に1行の JSON で書き出す。
+// 外部のツールで集めることを想定していて、書式は次の通り。
+// {"time":<unixtime>,
+//  "stages":{"<name>":{"count":N,"sum_usec":N,"max_usec":N,
+//                      "buckets":[[<上限usec>,N],...]},...},
+//  "counters":{"<name>":N,...},
+//  "queue_depth":N,"queue_depth_max":N}
+// buckets は回数が 0 のものを省略する。
+/*static*/ void
+StageStat::PrintJSON(FILE *fp)
+{
+	fprintf(fp, "{\"time\":%" PRIu64 ",\"stages\":{", (uint64)time(NULL));
+	for (int i = 0; i < N; i++) {
+		auto stage = (Stage)i;
+		fprintf(fp, "%s\"%s\":{\"count\":%" PRIu64
+			",\"sum_usec\":%" PRIu64 ",\"max_usec\":%" PRIu64
+			",\"buckets\":[",
+			(i == 0 ? "" : ","), GetName(stage), GetCount(stage),
+			GetNsec(stage) / 1000, GetMax(stage) / 1000);
+		const char *sep = "";
+		for (int b = 0; b < Buckets; b++) {
+			uint64 n = GetBucket(stage, b);
+			if (n != 0) {
+				fprintf(fp, "%s[%" PRIu64 ",%" PRIu64 "]",
+					sep, BucketLimit(b), n);
+				sep = ",";
+			}
+		}
+		fprintf(fp, "]}");
+	}
+	fprintf(fp, "},\"counters\":{");
+	for (int i = 0; i < NC; i++) {
+		auto counter = (Counter)i;
+		fprintf(fp, "%s\"%s\":%" PRIu64,
+			(i == 0 ? "" : ","), GetName(counter), GetCounter(counter));
+	}
+	fprintf(fp, "},\"queue_depth\":%" PRIu64 ",\"queue_depth_max\":%" PRIu64
+		"}\n",
+		GetQueueDepth(), GetQueueDepthMax());
+	fflush(fp);
+}
+
+// 単調増加する時刻を nsec で返す。
+/*static*/ uint64
+StageStat::Now()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include "Tracer.h"
+#include <array>
+#include <atomic>
+#include <cstdio>
+
+//
+// 処理段階ごとの所要時間の集計
+//
+// ノートの表示にかかる時間がどの段階で使われているかを調べるために使う。
+// 段階ごとに合計時間と、所要時間 [usec] の 2 の冪ごとのヒストグラムを持つ。
+// ベンチマーク (--bench) の内訳と、SIGUSR1 で書き出す統計に使う。
+// sayaka は起動時に Enable() して常に集計しているので、各計測点では
+// 時刻の取得 (clock_gettime) 2回と、合計・回数・ヒストグラムへの
+// アトミックな加算 (と最大値の更新) がかかる。
+// Enable() しなければ (テストなど) 分岐1つだけ。
+// 並列再生ではワーカーからも加算されるので、カウンタはアトミックにしてある。
+//
+enum class Stage
+{
+	Parse = 0,	// JSON の解析
+	Format,		// 本文などの整形
+	Print,		// print_() の折り返しと文字コード変換
+	Fetch,		// 画像のダウンロード (以下の4つを含む)
+	Connect,	// TCP の接続
+	Handshake,	// TLS のハンドシェイク
+	TTFB,		// 要求を送ってから応答ヘッダを受け取るまで
+	Download,	// 応答本文の受信
+	Decode,		// 画像の展開
+	Reduce,		// 減色
+	Encode,		// SIXEL への変換
+	Output,		// 端末への書き出し
+	Image,		// 画像1枚の表示全体
+	Note,		// ノート1つの表示全体
+	Max,
+};
+
+// 回数やバイト数のカウンタ。
+// こちらは Enable() とは関係なく常に数える。
+enum class Counter
+{
+	HotHit = 0,	// メモリ上の SIXEL キャッシュ
+	HotMiss,
+	KittyHit,	// 端末に送り済みの kitty の画像
+	KittyMiss,
+	CacheHit,	// ディスク上の SIXEL キャッシュ
+	CacheMiss,
+	SourceHit,	// 元画像キャッシュ
+	SourceMiss,
+	BytesIn,	// 受信したバイト数 (メッセージと画像)
+	BytesOut,	// 端末に書き出したバイト数
+	Reconnect,	// ストリームの再接続
+	Max,
+};
+
+class StageStat
+{
+	static const int N = (int)Stage::Max;
+	static const int NC = (int)Counter::Max;
+ public:
+	// ヒストグラムのバケット数。
+	// バケット i には [2^(i-1), 2^i) usec を数える (0 は 1 usec 未満)。
+	// 最後のバケットはそれ以上すべて。
+	static const int Buckets = 32;
+
+	// 計測を有効にする。
+	static void Enable(bool enable_) { enabled = enable_; }
+	static bool IsEnabled() { return enabled; }
+
+	// 集計をクリアする。
+	static void Clear();
+
+	// stage に nsec を加算する。
+	static void Add(Stage stage, uint64 nsec);
+
+	// stage の合計時間 [nsec] と回数、最大値 [nsec] を返す。
+	static uint64 GetNsec(Stage stage) { return nsec_[(int)stage]; }
+	static uint64 GetCount(Stage stage) { return count_[(int)stage]; }
+	static uint64 GetMax(Stage stage) { return max_[(int)stage]; }
+
+	// stage のヒストグラムのバケット b の回数を返す。
+	static uint64 GetBucket(Stage stage, int b) {
+		return hist_[(int)stage][b];
+	}
+
+	// usec が入るバケットを返す。
+	static int BucketOf(uint64 usec);
+
+	// バケット b の上限 [usec] を返す (この値未満が入る)。
+	static uint64 BucketLimit(int b) { return (uint64)1 << b; }
+
+	// stage の回数の割合 p (0..1) の所要時間の上限 [usec] を
+	// ヒストグラムから求めて返す。
+	static uint64 GetPercentile(Stage stage, double p);
+
+	// counter に n を加算する。
+	static void Count(Counter counter, uint64 n = 1) {
+		counter_[(int)counter].fetch_add(n, std::memory_order_relaxed);
+	}
+	static uint64 GetCounter(Counter counter) {
+		return counter_[(int)counter];
+	}
+
+	// キューの長さ (並列再生で表示を待っているノート数) を設定する。
+	static void SetQueueDepth(uint64 depth);
+	static uint64 GetQueueDepth() { return queue_depth; }
+	static uint64 GetQueueDepthMax() { return queue_depth_max; }
+
+	// stage、counter の名前を返す。
+	static const char *GetName(Stage stage);
+	static const char *GetName(Counter counter);
+
+	// 統計を fp に表形式で書き出す。
+	static void Print(FILE *fp);
+
+	// 統計を fp に1行の JSON で書き出す。
+	static void PrintJSON(FILE *fp);
+
+	// 単調増加する時刻を nsec で返す。
+	static uint64 Now();
+
+ private:
+	static bool enabled;
+	static std::array<std::atomic<uint64>, N> nsec_;
+	static std::array<std::atomic<uint64>, N> count_;
+	static std::array<std::atomic<uint64>, N> max_;
+	static std::array<std::array<std::atomic<uint32>, Buckets>, N> hist_;
+	static std::array<std::atomic<uint64>, NC> counter_;
+	static std::atomic<uint64> queue_depth;
+	static std::atomic<uint64> queue_depth_max;
+};
+
+// スコープを抜けるまでの時間を stage に加算する。
+// トレーサーが有効なら stage の名前で区間も記録する。
+class StageTimer
+{
+ public:
+	explicit StageTimer(Stage stage_)
+		: stage(stage_)
+	{
+		if (__predict_false(StageStat::IsEnabled() || Tracer::IsEnabled())) {
+			start = StageStat::Now();
+		}
+	}
+
+	~StageTimer()
+	{
+		if (__predict_false(start != 0)) {
+			uint64 end = StageStat::Now();
+			if (StageStat::IsEnabled()) {
+				StageStat::Add(stage, end - start);
+			}
+			if (__predict_false(Tracer::IsEnabled())) {
+				Tracer::Complete(StageStat::GetName(stage), start, end);
+			}
+		}
+	}
+
+ private:
+	Stage stage;
+	uint64 start {};
+};
@@ -257,7 +257,7 @@ Chomp(const std::string& str)
 	}
 	std::string rv = str.substr(pos);
 
-	while (isspace((int)rv.back())) {
+	while (!rv.empty() && isspace((int)rv.back())) {
 		rv.pop_back();
 	}
 	return rv;
@@ -24,6 +24,7 @@
  */
 
 #include "sayaka.h"
+#include "StageStat.h"
 #include "TLSHandle_mbedtls.h"
 #include <cstdarg>
 #include <cstdlib>
@@ -234,38 +235,44 @@ TLSHandle_mbedtls::Connect(const char *hostname, const char *servname)
 
 	// 独自のノンブロッキングコネクト。
 	// 戻り値 -0x004b は EINPROGRESS 相当。
-	r = mbedtls_net_connect_nonblock(&inner->net, hostname, servname,
-		MBEDTLS_NET_PROTO_TCP, family);
-	if (__predict_false(r != -0x004b)) {
-		if (__predict_false(r == 0)) {
-			// 起きることはないはずだが
-			// エラーメッセージが混乱しそうなので分けておく。
-			ERROR("mbedtls_net_connect_nonblock %s:%s - %s",
-				hostname, servname, "Success with blocking mode?");
-			goto abort;
-		} else {
-			ERROR("mbedtls_net_connect_nonblock %s:%s - %s",
-				hostname, servname, errmsg(r));
+	// 接続の完了を待つところまでを Connect として計る。
+	{
+		StageTimer timer(Stage::Connect);
+
+		r = mbedtls_net_connect_nonblock(&inner->net, hostname, servname,
+			MBEDTLS_NET_PROTO_TCP, family);
+		if (__predict_false(r != -0x004b)) {
+			if (__predict_false(r == 0)) {
+				// 起きることはないはずだが
+				// エラーメッセージが混乱しそうなので分けておく。
+				ERROR("mbedtls_net_connect_nonblock %s:%s - %s",
+					hostname, servname, "Success with blocking mode?");
+				goto abort;
+			} else {
+				ERROR("mbedtls_net_connect_nonblock %s:%s - %s",
+					hostname, servname, errmsg(r));
+			}
+			return false;
 		}
-		return false;
-	}
 
-	// ブロッキングに戻す
-	if (SetBlock() == false) {
-		goto abort;
-	}
+		// ブロッキングに戻す
+		if (SetBlock() == false) {
+			goto abort;
+		}
 
-	r = mbedtls_net_poll(&inner->net, MBEDTLS_NET_POLL_WRITE, timeout);
-	if (__predict_false(r < 0)) {
-		ERROR("mbedtls_net_poll failed: %s", errmsg(r));
-		goto abort;
-	}
-	if (__predict_false(r == 0)) {
-		ERROR("mbedtls_net_poll: timed out");
-		goto abort;
+		r = mbedtls_net_poll(&inner->net, MBEDTLS_NET_POLL_WRITE, timeout);
+		if (__predict_false(r < 0)) {
+			ERROR("mbedtls_net_poll failed: %s", errmsg(r));
+			goto abort;
+		}
+		if (__predict_false(r == 0)) {
+			ERROR("mbedtls_net_poll: timed out");
+			goto abort;
+		}
 	}
 
 	if (usessl) {
+		StageTimer timer(Stage::Handshake);
 		while ((r = mbedtls_ssl_handshake(&inner->ssl)) != 0) {
 			if (r != MBEDTLS_ERR_SSL_WANT_READ
 			 && r != MBEDTLS_ERR_SSL_WANT_WRITE) {
@@ -312,6 +319,7 @@ TLSHandle_mbedtls::Close()
 ssize_t
 TLSHandle_mbedtls::Read(void *buf, size_t len)
 {
+	TraceScope trace("tls_read");
 	ssize_t rv;
 
 	VERBOSE("called");
@@ -361,6 +369,7 @@ TLSHandle_mbedtls::Read(void *buf, size_t len)
 ssize_t
 TLSHandle_mbedtls::Write(const void *buf, size_t len)
 {
+	TraceScope trace("tls_write");
 	ssize_t rv;
 
 	VERBOSE("called");
@@ -24,6 +24,7 @@
  */
 
 #include "header.h"
+#include "StageStat.h"
 #include "TLSHandle_openssl.h"
 #include <array>
 #include <err.h>
@@ -98,8 +99,11 @@ TLSHandle_openssl::Connect(const char *hostname, const char *servname)
 {
 	int r;
 
-	if (ConnectSocket(hostname, servname) == false) {
-		return false;
+	{
+		StageTimer timer(Stage::Connect);
+		if (ConnectSocket(hostname, servname) == false) {
+			return false;
+		}
 	}
 
 	if (usessl) {
@@ -118,7 +122,10 @@ TLSHandle_openssl::Connect(const char *hostname, const char *servname)
 			return false;
 		}
 
-		r = SSL_connect(inner->ssl);
+		{
+			StageTimer timer(Stage::Handshake);
+			r = SSL_connect(inner->ssl);
+		}
 		if (r != 1) {
 			ERR_print_errors_fp(stderr);
 			return false;
@@ -235,6 +242,8 @@ TLSHandle_openssl::Close()
 ssize_t
 TLSHandle_openssl::Read(void *buf, size_t len)
 {
+	TraceScope trace("tls_read");
+
 	if (usessl) {
 		return SSL_read(inner->ssl, buf, len);
 	} else {
@@ -245,6 +254,8 @@ TLSHandle_openssl::Read(void *buf, size_t len)
 ssize_t
 TLSHandle_openssl::Write(const void *buf, size_t len)
 {
+	TraceScope trace("tls_write");
+
 	if (usessl) {
 		return SSL_write(inner->ssl, buf, len);
 	} else {
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "Tracer.h"
+#include "StageStat.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <unistd.h>
+
+// 1区間分の記録。
+struct TraceEvent
+{
+	uint64 start;
+	uint64 end;
+	const char *name;
+};
+
+// スレッドごとのリングバッファ。
+// 書き込むのは持ち主のスレッドだけで、head を進めることで公開する。
+// 書き出す側は head より前の Capacity 個を読む。
+struct TraceRing
+{
+	std::vector<TraceEvent> buf = std::vector<TraceEvent>(Tracer::Capacity);
+	std::atomic<uint64> head {};
+	int tid {};
+};
+
+static_assert((Tracer::Capacity & (Tracer::Capacity - 1)) == 0,
+	"Capacity must be a power of 2");
+
+/*static*/ bool Tracer::enabled;
+
+// 時刻の原点。書き出す時刻はここからの相対にする。
+static uint64 trace_base;
+
+// すべてのスレッドのリングバッファ。スレッドが終わっても書き出すまで
+// 残しておく必要があるので、こちらで所有する。
+// 登録と書き出しの時だけロックを取る。
+static std::mutex trace_mtx;
+static std::vector<std::unique_ptr<TraceRing>> trace_rings;
+
+// このスレッドのリングバッファ。最初に記録する時に作る。
+static thread_local TraceRing *trace_ring;
+
+/*static*/ void
+Tracer::Enable(bool enable)
+{
+	if (enable && trace_base == 0) {
+		trace_base = Now();
+	}
+	enabled = enable;
+}
+
+// 記録を捨てる。
+// 他のスレッドが記録していない時に呼ぶこと。
+/*static*/ void
+Tracer::Clear()
+{
+	std::lock_guard<std::mutex> lock(trace_mtx);
+	for (auto& ring : trace_rings) {
+		ring->head = 0;
+	}
+}
+
+// 呼び出したスレッドに区間を記録する。
+/*static*/ void
+Tracer::Complete(const char *name, uint64 start, uint64 end)
+{
+	TraceRing *ring = trace_ring;
+	if (__predict_false(ring == NULL)) {
+		std::lock_guard<std::mutex> lock(trace_mtx);
+		trace_rings.emplace_back(new TraceRing());
+		ring = trace_rings.back().get();
+		ring->tid = trace_rings.size();
+		trace_ring = ring;
+	}
+
+	uint64 h = ring->head.load(std::memory_order_relaxed);
+	auto& ev = ring->buf[h & (Capacity - 1)];
+	ev.start = start;
+	ev.end = end;
+	ev.name = name;
+	ring->head.store(h + 1, std::memory_order_release);
+}
+
+// 記録を Chrome の Trace Event Format (JSON Object Format) で書き出す。
+// 区間は開始時刻と長さを持つ complete event ("ph":"X") にする。
+// 時刻の単位は usec。
+// 記録中のスレッドがあっても書き出せるが、その時一番古いあたりは
+// 上書きされている途中かも知れない。
+/*static*/ size_t
+Tracer::Write(FILE *fp)
+{
+	std::lock_guard<std::mutex> lock(trace_mtx);
+	int pid = getpid();
+	size_t count = 0;
+
+	fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	fprintf(fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+		"\"args\":{\"name\":\"sayaka\"}}", pid);
+	for (const auto& ring : trace_rings) {
+		uint64 head = ring->head.load(std::memory_order_acquire);
+		uint64 n = std::min(head, (uint64)Capacity);
+		for (uint64 i = head - n; i < head; i++) {
+			const auto& ev = ring->buf[i & (Capacity - 1)];
+			if (__predict_false(ev.start < trace_base)) {
+				continue;
+			}
+			fprintf(fp, ",\n{\"name\":\"%s\",\"ph\":\"X\","
+				"\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}",
+				ev.name,
+				(double)(ev.start - trace_base) / 1000,
+				(double)(ev.end - ev.start) / 1000,
+				pid, ring->tid);
+			count++;
+		}
+	}
+	fprintf(fp, "\n]}\n");
+	fflush(fp);
+	return count;
+}
+
+// 単調増加する時刻を nsec で返す。StageStat と同じ時計を使う。
+/*static*/ uint64
+Tracer::Now()
+{
+	return StageStat::Now();
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "header.h"
+#include <cstdio>
+
+//
+// 処理の区間を時系列で記録するトレーサー
+//
+// 集計 (StageStat) では分からない「いつ何が待たされていたか」を見るために、
+// 区間の開始と終了の時刻をスレッドごとに記録しておき、
+// Chrome の about:tracing や Perfetto で読める JSON で書き出す。
+// 記録先はスレッドごとのリングバッファで、書き込みにロックは取らない。
+// いっぱいになったら古いものから上書きするので、残るのは直近の分だけ。
+// Enable() しない限り、各計測点のコストは分岐1つだけ。
+//
+class Tracer
+{
+ public:
+	// スレッドごとに保持するイベント数。2 の冪であること。
+	static const size_t Capacity = 32768;
+
+	static void Enable(bool enable);
+	static bool IsEnabled() { return enabled; }
+
+	// 記録を捨てる。
+	static void Clear();
+
+	// 呼び出したスレッドに区間 name [start, end) を記録する。
+	// 時刻は StageStat::Now() のもの。
+	// name は JSON にそのまま書き出すので、エスケープの要らない
+	// 静的な文字列であること。
+	static void Complete(const char *name, uint64 start, uint64 end);
+
+	// 記録を Chrome の Trace Event Format で fp に書き出す。
+	// 書き出したイベント数を返す。
+	static size_t Write(FILE *fp);
+
+	// 単調増加する時刻を nsec で返す。
+	static uint64 Now();
+
+ private:
+	static bool enabled;
+};
+
+// スコープを抜けるまでを区間 name として記録する。
+class TraceScope
+{
+ public:
+	explicit TraceScope(const char *name_)
+		: name(name_)
+	{
+		if (__predict_false(Tracer::IsEnabled())) {
+			start = Tracer::Now();
+		}
+	}
+
+	~TraceScope()
+	{
+		if (__predict_false(start != 0)) {
+			Tracer::Complete(name, start, Tracer::Now());
+		}
+	}
+
+ private:
+	const char *name;
+	uint64 start {};
+};
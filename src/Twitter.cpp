@@ -28,6 +28,7 @@
 #include "Dictionary.h"
 #include "Display.h"
 #include "RichString.h"
+#include "StageStat.h"
 #include "StringUtil.h"
 #include "Twitter.h"
 #include "subr.h"
@@ -79,8 +80,16 @@ twitter_show_line(const std::string& line)
 		return true;
 	}
 
+	// DOM は表示し終わったらすぐ捨てるので、アリーナから確保する。
+	static JsonArena arena;
+	JsonArena::Scope arena_scope(arena);
+
 	// line (文字列) から obj (JSON) に。
-	Json obj = Json::parse(line);
+	Json obj;
+	{
+		StageTimer timer(Stage::Parse);
+		obj = Json::parse(line);
+	}
 	if (obj.is_null()) {
 		warnx("%s: Json parser failed.\n"
 			"There may be something wrong with twitter.", __func__);
@@ -256,7 +265,9 @@ showstatus(const Json *status, bool is_quoted)
 	std::vector<MediaInfo> mediainfo;
 	auto msg = display_msg(*s, &mediainfo);
 
-	ShowIcon(twitter_show_icon, s_user, screen_name);
+	ShowIcon([s_user, screen_name]() {
+		return twitter_show_icon(s_user, screen_name);
+	});
 	print_(name + ' ' + userid + verified + protected_mark);
 	printf("\n");
 	print_(msg);
@@ -24,43 +24,106 @@
  */
 
 #include "UString.h"
+#include "jis_data.h"
+#include "term.h"
+#include <algorithm>
 #include <array>
 #include <cstring>
+#include <tuple>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define USE_NEON 1
+#endif
+
+// 出力文字コード。
+/*static*/ UString::OutCode UString::outcode = OUT_UTF8;
+
+// 内蔵テーブルで変換できる文字のビットマップ。
+/*static*/ std::array<uint32, 0x10000 / 32> UString::convertible;
 
-// 出力文字コードが UTF-8 以外 (iconv による変換が必要) なら true。
-/*static*/ bool UString::use_iconv = false;
+// ISO-2022-JP の文字集合
+enum {
+	JIS_ASCII,		// ESC ( B
+	JIS_ROMAN,		// ESC ( J (JIS X 0201 ローマ字)
+	JIS_X0208,		// ESC $ B
+};
+/*static*/ int UString::jis_state = JIS_ASCII;
 
 #if defined(HAVE_ICONV)
-// UTF-32 から UTF-8 以外の出力文字コードへの変換用
+// UTF-32 から内蔵テーブル以外の出力文字コードへの変換用
 /*static*/ iconv_t UString::cd = (iconv_t)-1;
 #endif
 
+// ゲタ'〓'(U+3013) の JIS X 0208 コード。
+static const uint16 JIS_GETA = 0x222e;
+
+// 内蔵テーブルから BMP の文字 uni の値を引く。
+// 値の意味は jis_gen.cpp 参照。変換できなければ 0 を返す。
+static inline uint16
+jis_lookup(unichar uni)
+{
+	return jis_table[jis_index[uni >> 7] * 128 + (uni & 0x7f)];
+}
+
 // 文字コードの初期化。codeset は出力文字コード名。
 // 失敗すれば errno をセットし false を返す。
 /*static*/ bool
 UString::Init(const std::string& codeset)
 {
-	use_iconv = false;
+	outcode = OUT_UTF8;
+	jis_state = JIS_ASCII;
 
 	if (codeset.empty()) {
-		// UTF-8 なら iconv 不要。
+		// UTF-8 なら変換不要。
 		return true;
-	} else {
-#if defined(HAVE_ICONV)
-		// UTF-8 以外なら iconv を使う。
-		cd = iconv_open(codeset.c_str(), "utf-8");
-		if (cd == (iconv_t)-1) {
-			return false;
+	}
+
+	// EUC-JP と ISO-2022-JP は内蔵テーブルで変換する。
+	if (strcasecmp(codeset.c_str(), "euc-jp") == 0) {
+		outcode = OUT_EUCJP;
+	} else if (strcasecmp(codeset.c_str(), "iso-2022-jp") == 0) {
+		outcode = OUT_JIS;
+	}
+	if (outcode != OUT_UTF8) {
+		// 変換できる文字のビットマップを作っておく。
+		// ISO-2022-JP は JIS X 0201 ローマ字と JIS X 0208 のみ。
+		convertible.fill(0);
+		for (unichar uni = 0; uni < 0x10000; uni++) {
+			bool ok;
+			if (uni < 0x80) {
+				ok = true;
+			} else {
+				uint16 code = jis_lookup(uni);
+				if (outcode == OUT_EUCJP) {
+					ok = (code != 0);
+				} else {
+					ok = (0 < code && code < 0x80) ||
+						(0x2121 <= code && code < 0x8000);
+				}
+			}
+			if (ok) {
+				convertible[uni / 32] |= 1U << (uni % 32);
+			}
 		}
-		use_iconv = true;
 		return true;
-#else
-		// UTF-8 以外が指定されたのに iconv がなければエラー。
-		// (iconv_open() のエラーと区別つけるため errno = 0 にする)
-		errno = 0;
+	}
+
+#if defined(HAVE_ICONV)
+	// それ以外なら iconv を使う。
+	cd = iconv_open(codeset.c_str(), "utf-8");
+	if (cd == (iconv_t)-1) {
 		return false;
-#endif
 	}
+	outcode = OUT_ICONV;
+	return true;
+#else
+	// 内蔵テーブル以外が指定されたのに iconv がなければエラー。
+	// (iconv_open() のエラーと区別つけるため errno = 0 にする)
+	errno = 0;
+	return false;
+#endif
 }
 
 // pos 文字目から key.size() 文字が key と一致すれば true を返す。
@@ -86,41 +149,334 @@ UString::FromUTF8(const std::string& str)
 {
 	UString ustr;
 
-	const char *s = str.c_str();
-	for (int i = 0, end = str.size(); i < end; ) {
-		auto [ code, len ] = UCharFromUTF8(s + i);
+	ustr.AppendUTF8(str);
+	return ustr;
+}
+
+// s から n バイトのうち、先頭から続く ASCII 文字のバイト数を返す。
+static inline size_t
+ascii_run(const uint8 *s, size_t n)
+{
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	for (; i + 16 <= n; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+		int mask = _mm_movemask_epi8(v);
+		if (mask != 0) {
+			return i + __builtin_ctz(mask);
+		}
+	}
+#elif defined(USE_NEON)
+	for (; i + 16 <= n; i += 16) {
+		uint8x16_t v = vld1q_u8(s + i);
+		if (vmaxvq_u8(v) >= 0x80) {
+			break;
+		}
+	}
+#else
+	// 8バイトずつ最上位ビットを調べる。
+	for (; i + 8 <= n; i += 8) {
+		uint64 w;
+		memcpy(&w, s + i, sizeof(w));
+		if ((w & 0x8080808080808080ULL) != 0) {
+			break;
+		}
+	}
+#endif
+	for (; i < n && s[i] < 0x80; i++)
+		;
+	return i;
+}
+
+// ASCII 文字列 src の n バイトを dst に unichar として書き出す。
+static inline void
+widen_ascii(unichar *dst, const uint8 *src, size_t n)
+{
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= n; i += 16) {
+		__m128i v  = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i lo = _mm_unpacklo_epi8(v, zero);
+		__m128i hi = _mm_unpackhi_epi8(v, zero);
+		__m128i *d = (__m128i *)(dst + i);
+		_mm_storeu_si128(d + 0, _mm_unpacklo_epi16(lo, zero));
+		_mm_storeu_si128(d + 1, _mm_unpackhi_epi16(lo, zero));
+		_mm_storeu_si128(d + 2, _mm_unpacklo_epi16(hi, zero));
+		_mm_storeu_si128(d + 3, _mm_unpackhi_epi16(hi, zero));
+	}
+#elif defined(USE_NEON)
+	for (; i + 16 <= n; i += 16) {
+		uint8x16_t v  = vld1q_u8(src + i);
+		uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+		uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+		vst1q_u32(dst + i +  0, vmovl_u16(vget_low_u16(lo)));
+		vst1q_u32(dst + i +  4, vmovl_u16(vget_high_u16(lo)));
+		vst1q_u32(dst + i +  8, vmovl_u16(vget_low_u16(hi)));
+		vst1q_u32(dst + i + 12, vmovl_u16(vget_high_u16(hi)));
+	}
+#endif
+	for (; i < n; i++) {
+		dst[i] = src[i];
+	}
+}
 
-		ustr.Append(code);
-		i += len;
+// src から n 文字のうち、先頭から続く ASCII 文字を dst にバイトとして
+// 書き出し、その文字数を返す。
+static inline size_t
+narrow_ascii(char *dst, const unichar *src, size_t n)
+{
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= n; i += 16) {
+		const __m128i *s = (const __m128i *)(src + i);
+		__m128i v0 = _mm_loadu_si128(s + 0);
+		__m128i v1 = _mm_loadu_si128(s + 1);
+		__m128i v2 = _mm_loadu_si128(s + 2);
+		__m128i v3 = _mm_loadu_si128(s + 3);
+		// どれか 0x80 以上なら残りは1文字ずつ。
+		__m128i or4 = _mm_or_si128(_mm_or_si128(v0, v1), _mm_or_si128(v2, v3));
+		__m128i hib = _mm_srli_epi32(or4, 7);
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(hib, zero)) != 0xffff) {
+			break;
+		}
+		// 全部 0x7f 以下なので飽和しない。
+		__m128i w0 = _mm_packs_epi32(v0, v1);
+		__m128i w1 = _mm_packs_epi32(v2, v3);
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(w0, w1));
 	}
+#elif defined(USE_NEON)
+	for (; i + 8 <= n; i += 8) {
+		uint32x4_t v0 = vld1q_u32(src + i);
+		uint32x4_t v1 = vld1q_u32(src + i + 4);
+		if (vmaxvq_u32(vorrq_u32(v0, v1)) >= 0x80) {
+			break;
+		}
+		uint16x8_t w = vcombine_u16(vmovn_u32(v0), vmovn_u32(v1));
+		vst1_u8((uint8 *)dst + i, vmovn_u16(w));
+	}
+#endif
+	for (; i < n && src[i] < 0x80; i++) {
+		dst[i] = (char)src[i];
+	}
+	return i;
+}
 
-	return ustr;
+// s から始まる n バイトが正しい UTF-8 の1文字 (2-4 バイト) なら
+// *codep にコードポイントをセットしてそのバイト数を返す。
+// 冗長な表現、サロゲート、範囲外なども含めて正しくなければ 0 を返す。
+static inline int
+decode_utf8(const uint8 *s, size_t n, unichar *codep)
+{
+	uint8 c = s[0];
+	unichar code;
+
+	if (__predict_true(0xe0 <= c && c <= 0xef)) {
+		if (n >= 3 && (s[1] & 0xc0) == 0x80 && (s[2] & 0xc0) == 0x80) {
+			code = ((c & 0x0f) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+			if (code >= 0x800 && (code < 0xd800 || code > 0xdfff)) {
+				*codep = code;
+				return 3;
+			}
+		}
+	} else if (0xc2 <= c && c <= 0xdf) {
+		if (n >= 2 && (s[1] & 0xc0) == 0x80) {
+			*codep = ((c & 0x1f) << 6) | (s[1] & 0x3f);
+			return 2;
+		}
+	} else if (0xf0 <= c && c <= 0xf4) {
+		if (n >= 4 && (s[1] & 0xc0) == 0x80 && (s[2] & 0xc0) == 0x80 &&
+		    (s[3] & 0xc0) == 0x80)
+		{
+			code = ((c & 0x07) << 18) | ((s[1] & 0x3f) << 12) |
+				((s[2] & 0x3f) << 6) | (s[3] & 0x3f);
+			if (0x10000 <= code && code <= 0x10ffff) {
+				*codep = code;
+				return 4;
+			}
+		}
+	}
+	return 0;
+}
+
+// Unicode コードポイント code を UTF-8 に変換して dst に書き出し、
+// そのバイト数を返す。UCharToUTF8() の本体。
+static inline int
+encode_utf8(char *dst, unichar code)
+{
+	if (code < 0x80) {
+		// 1バイト
+		*dst = (char)code;
+		return 1;
+
+	} else if (code < 0x800) {
+		// 2バイト
+		*dst++ = 0xc0 | (code >> 6);
+		*dst++ = 0x80 | (code & 0x3f);
+		return 2;
+
+	} else if (code < 0x10000) {
+		// 3バイト
+		*dst++ = 0xe0 |  (code >> 12);
+		*dst++ = 0x80 | ((code >> 6) & 0x3f);
+		*dst++ = 0x80 |  (code & 0x3f);
+		return 3;
+
+	} else {
+		// 4バイト
+		*dst++ = 0xf0 |  (code >> 18);
+		*dst++ = 0x80 | ((code >> 12) & 0x3f);
+		*dst++ = 0x80 | ((code >>  6) & 0x3f);
+		*dst++ = 0x80 |  (code & 0x3f);
+		return 4;
+	}
+}
+
+// UTF-8 文字列 str を変換しながら末尾に追加する。
+// 一時オブジェクトを作らないので FromUTF8() で作って足すより安い。
+// ASCII が続くところはまとめて変換する。
+// 正しくない UTF-8 は UCharFromUTF8() で1文字ずつ、今まで通りに扱う。
+UString&
+UString::AppendUTF8(const std::string& str)
+{
+	// 文字数はバイト数以下なので、これで足りる。
+	// 繰り返し呼ばれた時に毎回確保し直さないよう、足りない時は倍にする。
+	auto need = size() + str.size();
+	if (need > capacity()) {
+		reserve(std::max(need, capacity() * 2));
+	}
+
+	const uint8 *s = (const uint8 *)str.c_str();
+	size_t n = str.size();
+	for (size_t i = 0; i < n; ) {
+		if (s[i] < 0x80) {
+			size_t run = ascii_run(s + i, n - i);
+			size_t pos = size();
+			resize(pos + run);
+			widen_ascii(data() + pos, s + i, run);
+			i += run;
+		} else {
+			unichar code;
+			int len = decode_utf8(s + i, n - i, &code);
+			if (__predict_false(len == 0)) {
+				// c_str() なので末尾の '\0' で止まる。
+				std::tie(code, len) = UCharFromUTF8((const char *)s + i);
+			}
+			Append(code);
+			i += len;
+		}
+	}
+	return *this;
 }
 
 // この UString を Init() で指定した文字コードの std::string に変換する。
 std::string
 UString::ToString() const
 {
-	std::vector<char> dst(size() * 4 + 1);
-
-	// まず1文字ずつ UTF-8 文字列に変換する
-	int offset = 0;
-	for (const auto code : *this) {
-		int len = UCharToUTF8(&dst[offset], code);
-		offset += len;
+	// EUC-JP と ISO-2022-JP なら内蔵テーブルで直接変換する。
+	if (outcode == OUT_EUCJP || outcode == OUT_JIS) {
+		std::string str;
+		str.reserve(size() * 2 + 8);
+		EncodeJIS(str);
+		return str;
 	}
-	dst[offset] = '\0';
 
-	std::string utf8((const char *)dst.data());
+	// まず UTF-8 文字列に変換する。
+	// 途中に '\0' があっても切れないよう、長さで扱う。
+	std::string utf8;
+	utf8.resize(size() * 4);
+	char *dst = &utf8[0];
+	const unichar *src = data();
+	size_t n = size();
+	size_t offset = 0;
+	for (size_t i = 0; i < n; ) {
+		// ASCII が続くところはまとめて、
+		size_t run = narrow_ascii(dst + offset, src + i, n - i);
+		offset += run;
+		i += run;
+		// それ以外は1文字ずつ。
+		for (; i < n && src[i] >= 0x80; i++) {
+			offset += encode_utf8(dst + offset, src[i]);
+		}
+	}
+	utf8.resize(offset);
 
 #if defined(HAVE_ICONV)
-	if (use_iconv) {
+	if (outcode == OUT_ICONV) {
 		return UTF8ToOutCode(utf8);
 	}
 #endif
 	return utf8;
 }
 
+// 内蔵テーブルで EUC-JP か ISO-2022-JP に変換して dst に追加する。
+// 変換できない文字はゲタ'〓'にする。
+void
+UString::EncodeJIS(std::string& dst) const
+{
+	bool is_jis = (outcode == OUT_JIS);
+
+	for (const auto uni : *this) {
+		if (__predict_true(uni < 0x80)) {
+			if (__predict_false(is_jis && jis_state != JIS_ASCII)) {
+				dst += ESC "(B";
+				jis_state = JIS_ASCII;
+			}
+			dst += (char)uni;
+			continue;
+		}
+
+		uint16 code;
+		if (__predict_true(uni < 0x10000) &&
+		    __predict_true(convertible[uni / 32] & (1U << (uni % 32))))
+		{
+			code = jis_lookup(uni);
+		} else if (0xe0000 <= uni && uni <= 0xe007f && !is_jis) {
+			// タグ文字は EUC-JP では何も出力しない。(iconv と同じ)
+			continue;
+		} else {
+			code = JIS_GETA;
+		}
+
+		if (is_jis) {
+			if (code < 0x80) {
+				if (jis_state != JIS_ROMAN) {
+					dst += ESC "(J";
+					jis_state = JIS_ROMAN;
+				}
+				dst += (char)code;
+			} else {
+				if (jis_state != JIS_X0208) {
+					dst += ESC "$B";
+					jis_state = JIS_X0208;
+				}
+				dst += (char)(code >> 8);
+				dst += (char)(code & 0xff);
+			}
+		} else {
+			if (code < 0xa0) {
+				// JIS X 0201 ローマ字と C1 制御文字はそのまま 1バイト
+				dst += (char)code;
+			} else if (code < 0x100) {
+				// JIS X 0201 カタカナ
+				dst += (char)0x8e;
+				dst += (char)code;
+			} else {
+				// JIS X 0212 なら SS3 が前につく
+				if ((code & 0x8000)) {
+					dst += (char)0x8f;
+				}
+				dst += (char)((code >> 8) | 0x80);
+				dst += (char)((code & 0xff) | 0x80);
+			}
+		}
+	}
+}
+
 #if defined(HAVE_ICONV)
 // UTF-8 文字列 utf8 を Init() で設定した出力文字コードに変換して返す。
 /*static*/ std::string
@@ -134,7 +490,7 @@ UString::UTF8ToOutCode(const std::string& utf8)
 	size_t dstlen = srcleft * 2 + 6 + 1;
 	std::vector<char> dstbuf(dstlen);
 	char *dst = dstbuf.data();
-	while (*src) {
+	while (srcleft > 0) {
 		size_t r = ICONV(cd, &src, &srcleft, &dst, &dstlen);
 		if (r == (size_t)-1) {
 			if (errno == EILSEQ) {
@@ -159,8 +515,7 @@ UString::UTF8ToOutCode(const std::string& utf8)
 		}
 	}
 
-	*dst = '\0';
-	std::string str((const char *)dstbuf.data());
+	std::string str(dstbuf.data(), dst - dstbuf.data());
 
 	return str;
 }
@@ -171,8 +526,16 @@ UString::UTF8ToOutCode(const std::string& utf8)
 /*static*/ bool
 UString::IsUCharConvertible(unichar uni)
 {
+	if (outcode == OUT_EUCJP || outcode == OUT_JIS) {
+		if (__predict_true(uni < 0x10000)) {
+			return (convertible[uni / 32] & (1U << (uni % 32)));
+		}
+		// タグ文字は EUC-JP では捨てるので変換できる扱い。
+		return (outcode == OUT_EUCJP && 0xe0000 <= uni && uni <= 0xe007f);
+	}
+
 #if defined(HAVE_ICONV)
-	if (use_iconv) {
+	if (outcode == OUT_ICONV) {
 		// UTF-32 の uni を UTF-8 の srcbuf に変換
 		std::array<char, 4> srcbuf;
 		size_t srcleft = UCharToUTF8(srcbuf.data(), uni);
@@ -248,32 +611,7 @@ UString::UCharFromUTF8(const char *src)
 /*static*/ int
 UString::UCharToUTF8(char *dst, unichar code)
 {
-	if (code < 0x80) {
-		// 1バイト
-		*dst = (char)code;
-		return 1;
-
-	} else if (code < 0x7ff) {
-		// 2バイト
-		*dst++ = 0xc0 | (code >> 6);
-		*dst++ = 0x80 | (code & 0x3f);
-		return 2;
-
-	} else if (code < 0x10000) {
-		// 3バイト
-		*dst++ = 0xe0 |  (code >> 12);
-		*dst++ = 0x80 | ((code >> 6) & 0x3f);
-		*dst++ = 0x80 |  (code & 0x3f);
-		return 3;
-
-	} else {
-		// 4バイト
-		*dst++ = 0xf0 |  (code >> 18);
-		*dst++ = 0x80 | ((code >> 12) & 0x3f);
-		*dst++ = 0x80 | ((code >>  6) & 0x3f);
-		*dst++ = 0x80 |  (code & 0x3f);
-		return 4;
-	}
+	return encode_utf8(dst, code);
 }
 
 std::string
@@ -27,6 +27,7 @@
 
 #include "header.h"
 #include "StringUtil.h"
+#include <array>
 #include <vector>
 #if defined(HAVE_ICONV)
 #include <iconv.h>
@@ -49,7 +50,7 @@ class UString : public std::vector<unichar>
 	UString(const UString& s)		// コピーコンストラクタ
 		: inherited(s) { }
 	UString(UString&& s) noexcept	// ムーブコンストラクタ
-		: inherited(s) { }
+		: inherited(std::move(s)) { }
 	UString(std::initializer_list<unichar> il)	// 初期化子リストを受け取る
 		: inherited(il) { }
 
@@ -62,6 +63,10 @@ class UString : public std::vector<unichar>
 		inherited::operator=(s);
 		return *this;
 	}
+	UString& operator=(UString&& s) noexcept {
+		inherited::operator=(std::move(s));
+		return *this;
+	}
 
 	// UString s を末尾に追加
 	UString& Append(const UString& s) {
@@ -90,6 +95,9 @@ class UString : public std::vector<unichar>
 		return *this;
 	}
 
+	// UTF-8 文字列 s を変換しながら末尾に追加
+	UString& AppendUTF8(const std::string& s);
+
 	// pos 文字目を返す。pos が終端以降を指していれば 0 を返す。
 	unichar At(size_type pos) const
 	{
@@ -121,13 +129,30 @@ class UString : public std::vector<unichar>
 	std::string dump() const;
 
  private:
+	// 内蔵テーブルで EUC-JP か ISO-2022-JP に変換して dst に追加する
+	void EncodeJIS(std::string& dst) const;
+
 	// UTF-8 文字列を Init() で設定した出力文字コードに変換する
 	static std::string UTF8ToOutCode(const std::string& utf8);
 
-	// 出力文字コードにするのに iconv 変換が必要かどうか
-	static bool use_iconv;
+	// 出力文字コード
+	enum OutCode {
+		OUT_UTF8,		// UTF-8 (変換不要)
+		OUT_EUCJP,		// EUC-JP (内蔵テーブル)
+		OUT_JIS,		// ISO-2022-JP (内蔵テーブル)
+		OUT_ICONV,		// それ以外 (iconv)
+	};
+	static OutCode outcode;
+
+	// 内蔵テーブルで変換できる文字のビットマップ (BMP のみ)。
+	// Init() で出力文字コードに合わせて作る。
+	static std::array<uint32, 0x10000 / 32> convertible;
 
  protected:	// テストから参照する
+	// ISO-2022-JP の現在の文字集合。
+	// iconv と同じく ToString() をまたいで保持する。
+	static int jis_state;
+
 #if defined(HAVE_ICONV)
 	// UTF-32 から UTF-8 以外の出力文字コードへの変換用。
 	// 運用時は ^C でとめるので解放せず放置する。
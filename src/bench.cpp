@@ -0,0 +1,1018 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// ベンチマーク
+//
+// 各項目は1回分の処理を、1回の計測が -t msec 以上になるまで繰り返して
+// 1回あたりの時間を求める。これを -n 回行って最小値と中央値を表示する。
+// 出力は1項目1行で、
+//	<名前> <最小 [nsec]> <中央値 [nsec]> [<基準の中央値> <増減%>] [# 処理速度]
+// の形式。'#' 以降はコメント。
+// この出力を保存したものを -c で指定すると、それを基準として比較する。
+//
+
+#include "header.h"
+#include "Blurhash.h"
+#include "FileStream.h"
+#include "Image.h"
+#include "ImageLoaderWebp.h"
+#if defined(USE_STB_IMAGE)
+#include "ImageLoaderSTB.h"
+#else
+#include "ImageLoaderGIF.h"
+#include "ImageLoaderJPEG.h"
+#include "ImageLoaderPNG.h"
+#endif
+#include "ImageReductor.h"
+#include "JsonInc.h"
+#include "LineWrapper.h"
+#include "MFM.h"
+#include "MemoryStream.h"
+#include "NGWord.h"
+#include "Note.h"
+#include "PeekableStream.h"
+#include "Regex.h"
+#include "SixelConverter.h"
+#include "StringUtil.h"
+#include "UString.h"
+#include "eaw_code.h"
+#include "subr.h"
+#include <cstdio>
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <dirent.h>
+#include <err.h>
+#include <getopt.h>
+#include <unistd.h>
+#if !defined(USE_STB_IMAGE)
+#include <jpeglib.h>
+#endif
+
+[[noreturn]] static void usage();
+
+static int opt_samples = 7;			// 計測回数
+static int opt_msec = 20;			// 1回の計測の最低時間 [msec]
+static std::string opt_filter;		// 名前にこれを含む項目だけ実行する
+static std::map<std::string, double> baseline;	// 基準の中央値 [nsec]
+
+// 最適化で処理が消えないように結果を書き込む先。
+static volatile uint64 sink;
+
+// 現在時刻を nsec で返す。
+static uint64
+now_nsec()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// name の項目を実行するなら true を返す。
+static bool
+selected(const std::string& name)
+{
+	return opt_filter.empty() || name.find(opt_filter) != std::string::npos;
+}
+
+// func を繰り返し実行して1回あたりの時間を測り、結果を1行表示する。
+// unit は1回あたりの処理量で、0 より大きければ unitname を単位とした
+// 処理速度もコメントとして表示する。
+static void
+run(const std::string& name, double unit, const char *unitname,
+	const std::function<void()>& func)
+{
+	if (selected(name) == false) {
+		return;
+	}
+
+	// 1回目は準備運動を兼ねて、繰り返し回数を決めるのに使う。
+	uint64 start = now_nsec();
+	func();
+	uint64 t = std::max(now_nsec() - start, (uint64)1);
+	uint64 target = (uint64)opt_msec * 1000000;
+	uint64 reps = (t < target) ? target / t : 1;
+
+	std::vector<double> samples;
+	for (int i = 0; i < opt_samples; i++) {
+		start = now_nsec();
+		for (uint64 r = 0; r < reps; r++) {
+			func();
+		}
+		samples.push_back((double)(now_nsec() - start) / reps);
+	}
+	std::sort(samples.begin(), samples.end());
+	double min = samples.front();
+	double median = samples[samples.size() / 2];
+
+	printf("%-44s %14.1f %14.1f", name.c_str(), min, median);
+	auto it = baseline.find(name);
+	if (it != baseline.end() && it->second > 0) {
+		printf(" %14.1f %+7.1f%%",
+			it->second, (median / it->second - 1) * 100);
+	}
+	if (unit > 0) {
+		printf("  # %.4g M%s/s", unit / min * 1e3, unitname);
+	}
+	printf("\n");
+	fflush(stdout);
+}
+
+// 以前の出力 filename を基準として読み込む。
+static void
+load_baseline(const char *filename)
+{
+	std::ifstream ifs(filename);
+	if (!ifs) {
+		err(1, "%s", filename);
+	}
+	std::string line;
+	while (std::getline(ifs, line)) {
+		if (line.empty() || line[0] == '#') {
+			continue;
+		}
+		char name[256];
+		double min;
+		double median;
+		if (sscanf(line.c_str(), "%255s %lf %lf", name, &min, &median) == 3) {
+			baseline[name] = median;
+		}
+	}
+}
+
+// 日本語、英語、絵文字、結合文字、色付けの混ざった本文。
+static const char mixed_text[] =
+	"今日は\x1b[36m#sayaka\x1b[0m の新しいバージョンを"
+	"リリースしました。NetBSD/x68k でも動きます "
+	"\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7 "
+	"The quick brown fox jumps over the lazy dog. "
+	"Cafe\xcc\x81 na\xc3\xafve \xf0\x9f\x87\xaf\xf0\x9f\x87\xb5 "
+	"\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd \xe2\x9d\xa4\xef\xb8\x8f "
+	"\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4 "
+	"\xd0\xa0\xd1\x83\xd1\x81\xd1\x81\xd0\xba\xd0\xb8\xd0\xb9 "
+	"\x1b[1;33m\xe2\x98\x85\xe2\x98\x85\xe2\x98\x85\x1b[0m\n";
+
+// ASCII だけの本文。
+static const char ascii_text[] =
+	"Released a new version of #sayaka today. It also runs on NetBSD/x68k. "
+	"The quick brown fox jumps over the lazy dog. "
+	"See https://github.com/isaki68k/sayaka for details.\n";
+
+// 日本語だけの本文。
+static const char japanese_text[] =
+	"今日は新しいバージョンをリリースしました。"
+	"古い計算機でもちゃんと動きます。"
+	"吾輩は猫である。名前はまだ無い。どこで生れたかとんと見当がつかぬ。\n";
+
+// 絵文字 (サロゲートペア、ZWJ 結合、異体字セレクタ、国旗、肌の色) の多い本文。
+static const char emoji_text[] =
+	"\xf0\x9f\x8e\x89\xf0\x9f\x8e\x89 "
+	"\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7 "
+	"\xf0\x9f\x87\xaf\xf0\x9f\x87\xb5\xf0\x9f\x87\xba\xf0\x9f\x87\xb8 "
+	"\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbf "
+	"\xe2\x9d\xa4\xef\xb8\x8f\xe2\x9c\xa8\xf0\x9f\x98\x82\xf0\x9f\x98\xad "
+	"\xf0\x9f\x90\x88\xe2\x80\x8d\xe2\xac\x9b\xf0\x9f\x8d\xa3\xf0\x9f\x8d\xbb "
+	"\xf0\x9f\x8f\xb3\xef\xb8\x8f\xe2\x80\x8d\xf0\x9f\x8c\x88\n";
+
+// text を4回繰り返した文字列を返す。
+static std::string
+text4(const char *text)
+{
+	std::string s;
+	for (int i = 0; i < 4; i++) {
+		s += text;
+	}
+	return s;
+}
+
+// mixed_text を4回繰り返した文字列を返す。
+static std::string
+mixed_text4()
+{
+	return text4(mixed_text);
+}
+
+//
+// 画像
+//
+
+// 合成画像を作る。
+// グラデーションに細かい模様を重ねて、減色や圧縮が単調にならないようにする。
+static void
+make_image(Image& img, int width, int height)
+{
+	img.Create(width, height);
+	uint8 *d = img.GetBuf();
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			*d++ = x * 255 / width;
+			*d++ = y * 255 / height;
+			*d++ = ((x ^ y) & 0x3f) * 4 + ((x * y) & 3);
+		}
+	}
+}
+
+// PNG 用の CRC32 を返す。
+static uint32
+png_crc(const uint8 *buf, size_t len, uint32 crc = 0)
+{
+	static uint32 table[256];
+	if (table[1] == 0) {
+		for (uint32 n = 0; n < 256; n++) {
+			uint32 c = n;
+			for (int k = 0; k < 8; k++) {
+				c = (c & 1) ? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+			}
+			table[n] = c;
+		}
+	}
+	crc = ~crc;
+	for (size_t i = 0; i < len; i++) {
+		crc = table[(crc ^ buf[i]) & 0xff] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+static void
+put_be32(std::vector<uint8>& dst, uint32 v)
+{
+	dst.push_back(v >> 24);
+	dst.push_back(v >> 16);
+	dst.push_back(v >> 8);
+	dst.push_back(v);
+}
+
+// PNG のチャンクを dst に追加する。
+static void
+png_chunk(std::vector<uint8>& dst, const char *type,
+	const std::vector<uint8>& data)
+{
+	put_be32(dst, data.size());
+	size_t pos = dst.size();
+	dst.insert(dst.end(), type, type + 4);
+	dst.insert(dst.end(), data.begin(), data.end());
+	put_be32(dst, png_crc(&dst[pos], dst.size() - pos));
+}
+
+// img を PNG にする。
+// 圧縮ライブラリを使わないよう、deflate は無圧縮ブロックで作る。
+static std::vector<uint8>
+encode_png(Image& img)
+{
+	int width = img.GetWidth();
+	int height = img.GetHeight();
+	int stride = img.GetStride();
+	const uint8 *buf = img.GetBuf();
+
+	std::vector<uint8> dst { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+	std::vector<uint8> ihdr;
+	put_be32(ihdr, width);
+	put_be32(ihdr, height);
+	ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 });	// RGB 8bit
+	png_chunk(dst, "IHDR", ihdr);
+
+	// 各行の先頭にフィルタ種別 (0) を付けたもの。
+	std::vector<uint8> raw;
+	for (int y = 0; y < height; y++) {
+		raw.push_back(0);
+		raw.insert(raw.end(), buf + y * stride, buf + (y + 1) * stride);
+	}
+	std::vector<uint8> z { 0x78, 0x01 };
+	for (size_t pos = 0; pos < raw.size(); ) {
+		size_t len = std::min(raw.size() - pos, (size_t)65535);
+		bool final = (pos + len == raw.size());
+		z.push_back(final ? 1 : 0);
+		z.push_back(len);
+		z.push_back(len >> 8);
+		z.push_back(~len);
+		z.push_back(~len >> 8);
+		z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + len);
+		pos += len;
+	}
+	uint32 a = 1;
+	uint32 b = 0;
+	for (auto c : raw) {
+		a = (a + c) % 65521;
+		b = (b + a) % 65521;
+	}
+	put_be32(z, (b << 16) | a);
+	png_chunk(dst, "IDAT", z);
+	png_chunk(dst, "IEND", {});
+	return dst;
+}
+
+// img を 6x6x6 色の GIF にする。
+// LZW 辞書を使わず、すべての画素をリテラルのまま出力する。
+// 辞書が 9 ビットに収まるうちにクリアコードを入れ直すことで、
+// 符号長を 9 ビット固定にしている。
+static std::vector<uint8>
+encode_gif(Image& img)
+{
+	int width = img.GetWidth();
+	int height = img.GetHeight();
+	const uint8 *buf = img.GetBuf();
+
+	std::vector<uint8> dst { 'G', 'I', 'F', '8', '9', 'a' };
+	dst.insert(dst.end(), {
+		(uint8)width, (uint8)(width >> 8),
+		(uint8)height, (uint8)(height >> 8),
+		0xf7, 0, 0,		// 256 色のグローバルカラーテーブル
+	});
+	for (int i = 0; i < 256; i++) {
+		int c = (i < 216) ? i : 0;
+		dst.push_back((c / 36) * 51);
+		dst.push_back((c / 6 % 6) * 51);
+		dst.push_back((c % 6) * 51);
+	}
+	dst.insert(dst.end(), {
+		',', 0, 0, 0, 0,
+		(uint8)width, (uint8)(width >> 8),
+		(uint8)height, (uint8)(height >> 8),
+		0,
+		8,				// LZW 最小符号長
+	});
+
+	const int clear = 256;
+	const int eoi = 257;
+	std::vector<uint8> codes;
+	uint32 acc = 0;
+	int bits = 0;
+	auto put = [&](int code) {
+		acc |= code << bits;
+		bits += 9;
+		while (bits >= 8) {
+			codes.push_back(acc);
+			acc >>= 8;
+			bits -= 8;
+		}
+	};
+	int n = 0;
+	for (int i = 0; i < width * height; i++) {
+		if (n == 0) {
+			put(clear);
+		}
+		const uint8 *p = &buf[i * 3];
+		put((p[0] / 51) * 36 + (p[1] / 51) * 6 + (p[2] / 51));
+		if (++n == 250) {
+			n = 0;
+		}
+	}
+	put(eoi);
+	if (bits > 0) {
+		codes.push_back(acc);
+	}
+	for (size_t pos = 0; pos < codes.size(); ) {
+		size_t len = std::min(codes.size() - pos, (size_t)255);
+		dst.push_back(len);
+		dst.insert(dst.end(), codes.begin() + pos, codes.begin() + pos + len);
+		pos += len;
+	}
+	dst.push_back(0);
+	dst.push_back(';');
+	return dst;
+}
+
+#if !defined(USE_STB_IMAGE)
+// img を JPEG にする。
+static std::vector<uint8>
+encode_jpeg(Image& img)
+{
+	struct jpeg_compress_struct cinfo;
+	struct jpeg_error_mgr jerr;
+	unsigned char *mem = NULL;
+	unsigned long memlen = 0;
+
+	cinfo.err = jpeg_std_error(&jerr);
+	jpeg_create_compress(&cinfo);
+	jpeg_mem_dest(&cinfo, &mem, &memlen);
+	cinfo.image_width = img.GetWidth();
+	cinfo.image_height = img.GetHeight();
+	cinfo.input_components = 3;
+	cinfo.in_color_space = JCS_RGB;
+	jpeg_set_defaults(&cinfo);
+	jpeg_set_quality(&cinfo, 85, TRUE);
+	jpeg_start_compress(&cinfo, TRUE);
+	while (cinfo.next_scanline < cinfo.image_height) {
+		JSAMPROW row = img.GetBuf() + cinfo.next_scanline * img.GetStride();
+		jpeg_write_scanlines(&cinfo, &row, 1);
+	}
+	jpeg_finish_compress(&cinfo);
+	jpeg_destroy_compress(&cinfo);
+
+	std::vector<uint8> dst(mem, mem + memlen);
+	free(mem);
+	return dst;
+}
+#endif
+
+// loader で読み込めるか調べる。
+// 読み込めれば Load() の成否を *okp に書き戻して true を返す。
+template <typename T> static bool
+try_load(PeekableStream& stream, Image& img, bool *okp)
+{
+	T loader(&stream, Diag());
+	bool ok = loader.Check();
+	stream.Rewind();
+	if (ok) {
+		*okp = loader.Load(img);
+	}
+	return ok;
+}
+
+// data を SixelConverter::LoadFromStream() と同じ順で各ローダに試し、
+// 読み込めたローダの名前を返す。読み込めなければ NULL を返す。
+static const char *
+load_image(const std::vector<uint8>& data, Image& img)
+{
+	MemoryStream src(data);
+	PeekableStream stream(&src);
+	bool ok = false;
+
+	if (try_load<ImageLoaderWebp>(stream, img, &ok)) {
+		return ok ? "Webp" : NULL;
+	}
+#if defined(USE_STB_IMAGE)
+	if (try_load<ImageLoaderSTB>(stream, img, &ok)) {
+		return ok ? "STB" : NULL;
+	}
+#else
+	if (try_load<ImageLoaderJPEG>(stream, img, &ok)) {
+		return ok ? "JPEG" : NULL;
+	}
+	if (try_load<ImageLoaderPNG>(stream, img, &ok)) {
+		return ok ? "PNG" : NULL;
+	}
+	if (try_load<ImageLoaderGIF>(stream, img, &ok)) {
+		return ok ? "GIF" : NULL;
+	}
+#endif
+	return NULL;
+}
+
+// filename を読み込んで返す。
+static std::vector<uint8>
+read_file(const std::string& filename)
+{
+	std::ifstream ifs(filename, std::ios::binary);
+	return std::vector<uint8>(std::istreambuf_iterator<char>(ifs), {});
+}
+
+// 画像ローダの速度を測る。
+// files (と dir 内のファイル) と、合成画像を各形式にしたものを読み込む。
+static void
+bench_ImageLoader(const std::string& dir, const std::vector<std::string>& files)
+{
+	std::vector<std::pair<std::string, std::vector<uint8>>> corpus;
+
+	std::vector<std::string> names;
+	DIR *d = opendir(dir.c_str());
+	if (d) {
+		struct dirent *ent;
+		while ((ent = readdir(d)) != NULL) {
+			if (ent->d_name[0] != '.') {
+				names.emplace_back(dir + "/" + ent->d_name);
+			}
+		}
+		closedir(d);
+		std::sort(names.begin(), names.end());
+	}
+	names.insert(names.end(), files.begin(), files.end());
+	for (const auto& name : names) {
+		auto slash = name.rfind('/');
+		auto base = (slash == std::string::npos) ? name : name.substr(slash + 1);
+		corpus.emplace_back(base, read_file(name));
+	}
+
+	Image img;
+	make_image(img, 640, 480);
+	corpus.emplace_back("synthetic-640x480.png", encode_png(img));
+	corpus.emplace_back("synthetic-640x480.gif", encode_gif(img));
+#if !defined(USE_STB_IMAGE)
+	corpus.emplace_back("synthetic-640x480.jpg", encode_jpeg(img));
+#endif
+
+	for (const auto& [base, data] : corpus) {
+		Image dst;
+		const char *loader = load_image(data, dst);
+		if (loader == NULL) {
+			if (selected("ImageLoader/" + base)) {
+				warnx("%s: cannot load", base.c_str());
+			}
+			continue;
+		}
+		double pixels = (double)dst.GetWidth() * dst.GetHeight();
+		run(string_format("ImageLoader/%s/%s", loader, base.c_str()),
+			pixels, "pixel", [&] {
+				Image tmp;
+				load_image(data, tmp);
+				sink += tmp.GetWidth();
+			}
+		);
+	}
+}
+
+// 減色の速度を測る。
+static void
+bench_ImageReductor()
+{
+	const int width = 640;
+	const int height = 480;
+	const double pixels = (double)width * height;
+
+	Image img;
+	make_image(img, width, height);
+	std::vector<uint8> dst(width * height);
+
+	auto reduce = [&](const std::string& name, ReductorReduceMode mode,
+		ReductorColorMode color, ReductorFinderMode finder,
+		ReductorDiffuseMethod method)
+	{
+		ImageReductor ir;
+		ir.Init(Diag());
+		ir.SetColorMode(color, finder, 256);
+		ir.HighQualityDiffuseMethod = method;
+		run("ImageReductor/" + name, pixels, "pixel", [&] {
+			ir.Convert(mode, img, dst, width, height);
+			sink += dst[0];
+		});
+	};
+
+	// 減色方法 (と誤差拡散アルゴリズム) ごと。
+	for (auto mode : { Fast, Simple }) {
+		reduce(string_format("%s/Fixed256", ImageReductor::RRM2str(mode)),
+			mode, Fixed256, RFM_Default, RDM_FS);
+	}
+	for (int m = RDM_FS; m <= RDM_RGB; m++) {
+		auto method = (ReductorDiffuseMethod)m;
+		reduce(string_format("HighQuality/%s/Fixed256",
+				ImageReductor::RDM2str(method)),
+			HighQuality, Fixed256, RFM_Default, method);
+	}
+
+	// 色モードごと。
+	for (auto color : { Mono, Gray, Fixed8, FixedX68k, FixedANSI16,
+		Fixed256RGBI })
+	{
+		reduce(string_format("HighQuality/FS/%s",
+				ImageReductor::RCM2str(color)),
+			HighQuality, color, RFM_Default, RDM_FS);
+	}
+	reduce("HighQuality/FS/Fixed256/HSV",
+		HighQuality, Fixed256, RFM_HSV, RDM_FS);
+}
+
+// 書き込んだバイト数を数えるだけのストリーム。
+class NullStream : public Stream
+{
+ public:
+	ssize_t Write(const void *buf, size_t len) override {
+		bytes += len;
+		return len;
+	}
+
+	uint64 bytes {};
+};
+
+// SIXEL 出力の速度を測る。
+static void
+bench_SixelToStream()
+{
+	Image img;
+	make_image(img, 640, 480);
+	auto png = encode_png(img);
+
+	auto sixel = [&](const std::string& name, ReductorColorMode color,
+		SixelOutputMode mode)
+	{
+		SixelConverter sx;
+		sx.ColorMode = color;
+		sx.OutputMode = mode;
+		MemoryStream src(png);
+		if (sx.LoadFromStream(&src) == false) {
+			warnx("SixelToStream: cannot load");
+			return;
+		}
+		sx.ConvertToIndexed();
+		double pixels = (double)sx.GetWidth() * sx.GetHeight();
+		run("SixelToStream/" + name, pixels, "pixel", [&] {
+			NullStream out;
+			sx.SixelToStream(&out);
+			sink += out.bytes;
+		});
+	};
+
+	sixel("Normal/Fixed256", Fixed256, SixelOutputMode::Normal);
+	sixel("Or/Fixed256", Fixed256, SixelOutputMode::Or);
+	sixel("Normal/FixedX68k", FixedX68k, SixelOutputMode::Normal);
+	sixel("Or/FixedX68k", FixedX68k, SixelOutputMode::Or);
+}
+
+// Blurhash の展開の速度を測る。
+static void
+bench_Blurhash()
+{
+	static const std::string hash = "LEHV6nWB2yk8pyo0adR*.7kCMdnj";
+
+	for (auto size : { Size { 120, 96 }, Size { 400, 320 } }) {
+		std::vector<uint8> dst(size.w * size.h * 3);
+		run(string_format("Blurhash/Decode/%dx%d", size.w, size.h),
+			(double)size.w * size.h, "pixel", [&] {
+				Blurhash bh(hash);
+				bh.Decode(dst.data(), size.w, size.h);
+				sink += dst[0];
+			}
+		);
+	}
+}
+
+//
+// 文字列
+//
+
+// UString の変換の速度を測る。
+static void
+bench_UString()
+{
+	std::string src = mixed_text4();
+
+	run("UString/FromUTF8", src.size(), "byte", [&] {
+		UString u = UString::FromUTF8(src);
+		sink += u.size();
+	});
+
+	UString u = UString::FromUTF8(src);
+	for (const char *codeset : { "", "euc-jp", "iso-2022-jp" }) {
+		UString::Init(codeset);
+		run(string_format("UString/ToString/%s",
+				codeset[0] ? codeset : "utf-8"),
+			u.size(), "char", [&] {
+				std::string s = u.ToString();
+				sink += s.size();
+			}
+		);
+	}
+	UString::Init("");
+
+	// 文字種ごとの変換速度。
+	// ASCII は一括変換の効く最良の場合、日本語と絵文字はそれが効かない場合。
+	static const std::pair<const char *, const char *> corpora[] = {
+		{ "ascii",		ascii_text },
+		{ "japanese",	japanese_text },
+		{ "emoji",		emoji_text },
+	};
+	for (const auto& corpus : corpora) {
+		std::string text = text4(corpus.second);
+		run(string_format("UString/FromUTF8/%s", corpus.first),
+			text.size(), "byte", [&] {
+				UString ut = UString::FromUTF8(text);
+				sink += ut.size();
+			}
+		);
+		UString utext = UString::FromUTF8(text);
+		run(string_format("UString/ToString/utf-8/%s", corpus.first),
+			utext.size(), "char", [&] {
+				std::string s = utext.ToString();
+				sink += s.size();
+			}
+		);
+	}
+}
+
+// 文字幅を求める速度を測る。
+static void
+bench_get_eaw_width()
+{
+	UString u = UString::FromUTF8(mixed_text4());
+
+	run("get_eaw_width", u.size(), "char", [&] {
+		int width = 0;
+		for (const auto c : u) {
+			width += get_eaw_width(c);
+		}
+		sink += width;
+	});
+}
+
+// print_() の折り返し (LineWrapper) の速度を測る。
+static void
+bench_LineWrapper(const char *codeset)
+{
+	UString::Init(codeset);
+	bool use_ubuf = (codeset[0] != '\0');
+
+	UString src = UString::FromUTF8(mixed_text4());
+	std::string dst;
+	UString ubuf;
+	run(string_format("LineWrapper/%s", use_ubuf ? codeset : "utf-8"),
+		src.size(), "char", [&] {
+			dst.clear();
+			LineWrapper out(dst, ubuf, 6, 80, use_ubuf);
+			for (const auto c : src) {
+				out.Put(c);
+			}
+			out.Finish();
+			sink += dst.size();
+		}
+	);
+
+	UString::Init("");
+}
+
+// MFM の字句解析の速度を測る。
+static void
+bench_MFM()
+{
+	static const char note[] =
+		"$[tada リリース] しました! **sayaka** https://example.com/a(b) "
+		"#sayaka #misskey @isaki@misskey.io さん <small>小さい</small> "
+		"`make -j4` :arrow_right: <plain>**x**</plain> ~~取り消し~~ "
+		"今日はいい天気ですね。The quick brown fox jumps over the lazy dog.\n";
+
+	UString src;
+	for (int i = 0; i < 4; i++) {
+		src.AppendUTF8(note);
+	}
+
+	MFM mfm;
+	run("MFM/Parse", src.size(), "char", [&] {
+		// タグの登録もノートごとに行う。
+		mfm.ClearTags();
+		mfm.AddTag("sayaka");
+		mfm.AddTag("misskey");
+		sink += mfm.Parse(src).size();
+	});
+}
+
+// 日時の解析の速度を測る。
+static void
+bench_DecodeISOTime()
+{
+	static const std::string times[] = {
+		"2024-03-03T12:34:56.789Z",
+		"2024-03-03T21:34:56+09:00",
+		"2024-03-03T21:34:56+0900",
+		"2024-03-03T12:34:56Z",
+	};
+	const int n = sizeof(times) / sizeof(times[0]);
+
+	run("DecodeISOTime", n, "call", [&] {
+		for (const auto& s : times) {
+			sink += DecodeISOTime(s);
+		}
+	});
+}
+
+// 1行読み出しの速度を測る。
+// --play の入力のような長めの行を MemoryStream と FileStream で読む。
+static void
+bench_ReadLine()
+{
+	std::string line = "{\"type\":\"note\",\"body\":{\"text\":\"";
+	while (line.size() < 1000) {
+		line += mixed_text4().substr(0, 200);
+	}
+	line += "\"}}\n";
+	std::vector<uint8> data;
+	for (int i = 0; i < 100; i++) {
+		data.insert(data.end(), line.begin(), line.end());
+	}
+
+	run("ReadLine/MemoryStream", data.size(), "byte", [&] {
+		MemoryStream stream(data);
+		std::string s;
+		while (stream.ReadLine(&s) > 0) {
+			sink += s.size();
+		}
+	});
+
+	FILE *fp = tmpfile();
+	if (fp == NULL) {
+		warn("ReadLine/FileStream: tmpfile");
+		return;
+	}
+	fwrite(data.data(), 1, data.size(), fp);
+	FileStream stream(fp, true);
+	run("ReadLine/FileStream", data.size(), "byte", [&] {
+		stream.Rewind();
+		std::string s;
+		while (stream.ReadLine(&s) > 0) {
+			sink += s.size();
+		}
+	});
+}
+
+//
+// NG ワード
+//
+
+// NG ワード 1000 個との照合の速度を測る。
+// filename があればそれを (--record で記録した) タイムラインとして使う。
+static void
+bench_NGWord(const char *filename)
+{
+	// タイムラインを読み込む。ストリームの皮はむいておく。
+	std::vector<Json> notes;
+	if (filename) {
+		std::ifstream ifs(filename);
+		std::string line;
+		while (std::getline(ifs, line)) {
+			Json obj;
+			try {
+				obj = Json::parse(line);
+			} catch (...) {
+				continue;
+			}
+			while (obj.is_object() && obj.contains("body") &&
+			       obj["body"].is_object()) {
+				Json body = obj["body"];
+				obj = std::move(body);
+			}
+			if (obj.is_object()) {
+				notes.emplace_back(std::move(obj));
+			}
+		}
+	} else {
+		for (int i = 0; i < 100; i++) {
+			Json note;
+			note["text"] = string_format("%s %d", mixed_text, i);
+			note["user"] = { { "id", "9a" }, { "username", "isaki" },
+				{ "host", nullptr } };
+			notes.emplace_back(std::move(note));
+		}
+	}
+	if (notes.empty()) {
+		warnx("NGWord: %s: no notes", filename);
+		return;
+	}
+
+	// 固定文字列 900 個と正規表現 100 個。
+	// 照合を最後までやらせるため、概ね一致しないものにする。
+	static const char * const regex_fmt[] = {
+		"spam%d[0-9]+",
+		"^ad%d\\s",
+		"(foo|bar)%dbaz",
+		"x%d.*y%d",
+		"colou?r%d$",
+	};
+	NGWordList list;
+	for (int i = 0; i < 900; i++) {
+		list.Add(string_format("ngword%04d", i), "");
+	}
+	for (int i = 0; i < 100; i++) {
+		list.Add(string_format(regex_fmt[i % 5], i, i), "");
+	}
+	list.Compile();
+
+	// 照合は Note に対して行うので、先に DOM から作っておく。
+	// Note は各 NoteParser の中にあるので、ノートごとに用意する。
+	std::vector<std::unique_ptr<NoteParser>> parsers;
+	for (const auto& obj : notes) {
+		parsers.emplace_back(std::make_unique<NoteParser>());
+		parsers.back()->FromJson(obj);
+	}
+
+	run("NGWord/compiled", parsers.size(), "note", [&] {
+		for (const auto& parser : parsers) {
+			NGStatus ngstat;
+			sink += list.Match(&ngstat, parser->GetNote());
+		}
+	});
+
+	// 比較用に、以前のようにルールごとに std::regex で照合した場合。
+	// 遅いので先頭の 10 ノートだけ。
+	std::vector<std::unique_ptr<Regex>> regexes;
+	for (const auto& ng : list) {
+		regexes.emplace_back(std::make_unique<Regex>());
+		regexes.back()->Assign(ng.GetWord());
+	}
+	std::vector<std::string> texts;
+	for (size_t i = 0; i < notes.size() && texts.size() < 10; i++) {
+		const Json& note = notes[i];
+		const Json& body = (note.contains("renote") &&
+			note["renote"].is_object()) ? note["renote"] : note;
+		if (body.contains("text")) {
+			texts.emplace_back(JsonAsString(body["text"]));
+		}
+	}
+	run("NGWord/regex", texts.size(), "note", [&] {
+		for (const auto& text : texts) {
+			for (const auto& re : regexes) {
+				if (re->Search(text)) {
+					sink += 1;
+					break;
+				}
+			}
+		}
+	});
+}
+
+int
+main(int ac, char *av[])
+{
+	std::string imagedir = "../image";
+	const char *timeline = NULL;
+	int c;
+
+	while ((c = getopt(ac, av, "c:f:i:n:r:t:h")) != -1) {
+		switch (c) {
+		 case 'c':
+			load_baseline(optarg);
+			break;
+		 case 'f':
+			opt_filter = optarg;
+			break;
+		 case 'i':
+			imagedir = optarg;
+			break;
+		 case 'n':
+			opt_samples = stou32def(optarg, 0);
+			if (opt_samples < 1) {
+				usage();
+			}
+			break;
+		 case 'r':
+			timeline = optarg;
+			break;
+		 case 't':
+			opt_msec = stou32def(optarg, 0);
+			if (opt_msec < 1) {
+				usage();
+			}
+			break;
+		 default:
+			usage();
+		}
+	}
+	// 残りの引数は追加の画像ファイル。
+	std::vector<std::string> files;
+	for (int i = optind; i < ac; i++) {
+		files.emplace_back(av[i]);
+	}
+
+	opt_eaw_a = 2;
+	opt_eaw_n = 1;
+	init_eaw_width();
+
+	printf("# name min[nsec] median[nsec]%s\n",
+		baseline.empty() ? "" : " baseline[nsec] diff");
+	printf("# samples=%d msec=%d\n", opt_samples, opt_msec);
+
+	bench_ImageReductor();
+	bench_SixelToStream();
+	bench_Blurhash();
+	bench_ImageLoader(imagedir, files);
+	bench_UString();
+	bench_get_eaw_width();
+	bench_LineWrapper("");
+	bench_LineWrapper("euc-jp");
+	bench_LineWrapper("iso-2022-jp");
+	bench_MFM();
+	bench_DecodeISOTime();
+	bench_ReadLine();
+	bench_NGWord(timeline);
+	return 0;
+}
+
+static void
+usage()
+{
+	fprintf(stderr,
+R"(usage: bench [<options>...] [<imagefile>...]
+	-c <file> : compare with the saved output <file>.
+	-f <str>  : run only benchmarks whose name contains <str>.
+	-i <dir>  : image directory. default ../image
+	-n <n>    : number of samples. default 7.
+	-r <file> : timeline (recorded JSON) for NGWord.
+	-t <msec> : minimum time per sample. default 20.
+)"
+	);
+	exit(1);
+}
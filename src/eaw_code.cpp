@@ -24,49 +24,96 @@
  */
 
 #include "eaw_code.h"
-#include "eaw_data.h"
 
 int opt_eaw_a;
 int opt_eaw_n;
 
-// Unicode コードポイント c の文字幅を返す。
-// Narrow, HalfWidth は 1、
-// Wide, FullWidth は 2、
-// Neutral と Ambiguous は設定値による。
-int
-get_eaw_width(unichar c)
+std::array<uint8, std::tuple_size<decltype(eaw_pages)>::value> eaw_resolved;
+
+// opt_eaw_a, opt_eaw_n から文字幅テーブルを作る。
+// eaw_pages の下位2ビットの East Asian Width を文字幅に置き換える。
+void
+init_eaw_width()
 {
-	uint8 packed;
-	uint8 val;
+	const uint8 width[4] = {
+		1,						// H (Narrow, HalfWidth)
+		2,						// F (Wide, FullWidth)
+		(uint8)(opt_eaw_n & 3),	// N (Neutral)
+		(uint8)(opt_eaw_a & 3),	// A (Ambiguous)
+	};
 
-	if (__predict_true((c / 2) < eaw2width_packed.size())) {
-		packed = eaw2width_packed[c / 2];
-	} else {
-		// 安全のため FullWidth としておく
-		packed = 0x11;
+	for (size_t i = 0; i < eaw_pages.size(); i++) {
+		uint8 v = eaw_pages[i];
+		eaw_resolved[i] = (v & ~3) | width[v & 3];
 	}
+}
+
+// get_eaw_props() が props の文字の直前で区切れるなら true を返す。
+bool
+GraphemeBreak::Next(uint8 props)
+{
+	uint8 cur = EAW_GCB(props);
+	bool curpict = EAW_EXTPICT(props);
+	uint8 p = prev;
+	bool was_pict_zwj = pict_zwj;
+	bool was_ri_odd = ri_odd;
 
-	// 1バイトに2文字分埋め込んである
-	if (c % 2 == 0) {
-		val = packed >> 4;
+	// 状態を更新
+	prev = cur;
+	if (curpict) {
+		pict = true;
+		pict_zwj = false;
+	} else if (cur == GCB_Extend) {
+		pict_zwj = false;
+	} else if (cur == GCB_ZWJ) {
+		pict_zwj = pict;
+		pict = false;
 	} else {
-		val = packed & 0xf;
+		pict = false;
+		pict_zwj = false;
 	}
+	ri_odd = (cur == GCB_RI) ? !was_ri_odd : false;
+	ri_pair = false;
 
-	switch (val) {
-	 case 0x0:	// H (Narrow, HalfWidth)
-		return 1;
-
-	 case 0x1:	// F (Wide, FullWidth)
-		return 2;
-
-	 case 0x2:	// N (Neutral)
-		return opt_eaw_n;
-
-	 case 0x3:	// A (Ambiguous)
-		return opt_eaw_a;
-
-	 default:
-		__builtin_unreachable();
+	// GB3: CR × LF
+	if (p == GCB_CR && cur == GCB_LF) {
+		return false;
+	}
+	// GB4, GB5: 制御文字の前後は区切る
+	if (p == GCB_Control || p == GCB_CR || p == GCB_LF) {
+		return true;
+	}
+	if (cur == GCB_Control || cur == GCB_CR || cur == GCB_LF) {
+		return true;
+	}
+	// GB6-GB8: ハングル音節
+	if (p == GCB_L &&
+	    (cur == GCB_L || cur == GCB_V || cur == GCB_LV || cur == GCB_LVT)) {
+		return false;
+	}
+	if ((p == GCB_LV || p == GCB_V) && (cur == GCB_V || cur == GCB_T)) {
+		return false;
+	}
+	if ((p == GCB_LVT || p == GCB_T) && cur == GCB_T) {
+		return false;
+	}
+	// GB9, GB9a: 結合文字、ZWJ、SpacingMark は前につく
+	if (cur == GCB_Extend || cur == GCB_ZWJ || cur == GCB_SpacingMark) {
+		return false;
+	}
+	// GB9b: Prepend は後につく
+	if (p == GCB_Prepend) {
+		return false;
+	}
+	// GB11: ExtPict Extend* ZWJ × ExtPict (ZWJ で繋いだ絵文字)
+	if (was_pict_zwj && curpict) {
+		return false;
+	}
+	// GB12, GB13: RI は2文字ずつ組にする (国旗)
+	if (p == GCB_RI && cur == GCB_RI && was_ri_odd) {
+		ri_pair = true;
+		return false;
 	}
+	// GB999
+	return true;
 }
@@ -26,8 +26,91 @@
 #pragma once
 
 #include "header.h"
+#include "eaw_data.h"
 
 extern int opt_eaw_a;
 extern int opt_eaw_n;
 
-extern int get_eaw_width(unichar c);
+// 書記素クラスタの区切り属性 (Grapheme_Cluster_Break)。
+// eaw_gen.cpp と揃えること。
+enum {
+	GCB_Other,
+	GCB_Control,
+	GCB_CR,
+	GCB_LF,
+	GCB_Extend,
+	GCB_ZWJ,
+	GCB_RI,
+	GCB_Prepend,
+	GCB_SpacingMark,
+	GCB_L,
+	GCB_V,
+	GCB_T,
+	GCB_LV,
+	GCB_LVT,
+};
+
+// get_eaw_props() の値
+#define EAW_WIDTH(p)	((p) & 0x03)			// 文字幅 (1 か 2)
+#define EAW_GCB(p)		(((p) >> 2) & 0x0f)		// GCB_*
+#define EAW_EXTPICT(p)	(((p) & 0x40) != 0)		// Extended_Pictographic
+
+// opt_eaw_a, opt_eaw_n を解決済みの eaw_pages。
+extern std::array<uint8, std::tuple_size<decltype(eaw_pages)>::value>
+	eaw_resolved;
+
+// opt_eaw_a, opt_eaw_n から文字幅テーブルを作る。
+// get_eaw_width() などを使う前と、これらを変更したら呼ぶこと。
+extern void init_eaw_width();
+
+// Unicode コードポイント c の文字幅と書記素クラスタの属性を返す。
+static inline uint8
+get_eaw_props(unichar c)
+{
+	if (__predict_false(c >= 0x110000)) {
+		// 安全のため FullWidth としておく
+		return 0x02;
+	}
+	return eaw_resolved[eaw_index[c >> 8] * 256 + (c & 0xff)];
+}
+
+// Unicode コードポイント c の文字幅を返す。
+// Narrow, HalfWidth は 1、
+// Wide, FullWidth は 2、
+// Neutral と Ambiguous は設定値による。
+static inline int
+get_eaw_width(unichar c)
+{
+	// ASCII の表示文字は常に 1。
+	if (__predict_true(0x20 <= c && c < 0x7f)) {
+		return 1;
+	}
+	return EAW_WIDTH(get_eaw_props(c));
+}
+
+// 書記素クラスタの区切りを判定する (UAX #29 の GB3-GB13)。
+class GraphemeBreak
+{
+ public:
+	// get_eaw_props() が props の文字の直前で区切れるなら true を返す。
+	bool Next(uint8 props);
+
+	// 初期状態に戻す。次の文字の前では必ず区切れる。
+	void Reset() {
+		prev = GCB_Control;
+		pict = false;
+		pict_zwj = false;
+		ri_odd = false;
+	}
+
+	// 直前の Next() が国旗 (Regional Indicator の2文字目) で
+	// 区切らなかったら true。
+	bool IsRIPair() const { return ri_pair; }
+
+ private:
+	uint8 prev { GCB_Control };		// 直前の文字の GCB_*
+	bool pict {};					// ExtPict Extend* の途中
+	bool pict_zwj {};				// ExtPict Extend* ZWJ の直後
+	bool ri_odd {};					// 直前まで RI が奇数個続いている
+	bool ri_pair {};
+};
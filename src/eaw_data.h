@@ -3,4 +3,5 @@
 #include "header.h"
 #include <array>
 
-extern const std::array<uint8,0x10000> eaw2width_packed;
+extern const std::array<uint8,0x1100> eaw_index;
+extern const std::array<uint8,0x7a00> eaw_pages;
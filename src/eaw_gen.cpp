@@ -23,12 +23,41 @@
  * SUCH DAMAGE.
  */
 
+#include <array>
 #include <cstdio>
 #include <cstring>
 #include <string>
+#include <vector>
 #include <err.h>
 #include <unicode/uchar.h>
 
+// 出力するテーブルの値は以下のビットの組み合わせ。
+//  bit1-0: East Asian Width (0=H, 1=F, 2=N, 3=A)
+//  bit5-2: Grapheme_Cluster_Break (下の GCB_*)
+//  bit6:   Extended_Pictographic
+// GCB_* は eaw_code.h と揃えること。
+enum {
+	GCB_Other,
+	GCB_Control,
+	GCB_CR,
+	GCB_LF,
+	GCB_Extend,
+	GCB_ZWJ,
+	GCB_RI,
+	GCB_Prepend,
+	GCB_SpacingMark,
+	GCB_L,
+	GCB_V,
+	GCB_T,
+	GCB_LV,
+	GCB_LVT,
+};
+static const int EXTPICT = 0x40;
+
+// 256文字を1ページとして、同じ内容のページはまとめる。
+static const int PAGE_SIZE = 256;
+static const int NUMPAGES = 0x110000 / PAGE_SIZE;
+
 // U+0000-FFFF:   Plane0 BMP
 // U+10000-1FFFF: Plane1 SMP
 // U+20000-2FFFF: Plane2 SIP
@@ -42,10 +71,11 @@
 // さばけるかも分からないし、そもそも範囲外はすべて安全のため 2桁に振って
 // あるので、上限についてはあまり気にしないことにする。
 // とりあえず BMP、SMP をカバーしておけばいいだろう。
+// (書記素クラスタの区切りは全面について出力する)
 static const int MAXCHARS = 0x20000;
 
 // Unicode 文字 c の文字幅を示す文字を返す。
-char
+static char
 conv(int c)
 {
 	char r;
@@ -93,50 +123,110 @@ conv(int c)
 	return r;
 }
 
-void
-preamble()
+// Unicode 文字 c の書記素クラスタの区切り属性を返す。
+static int
+gcb(int c)
 {
-	// For header
-	printf("extern const std::array<uint8,0x%x> eaw2width_packed;\n",
-		MAXCHARS / 2);
+	int r;
 
-	printf("#include \"eaw_data.h\"\n");
-	printf("\n");
-	const char *name = "HFNA";
-	for (int i = 0; i < strlen(name); i++) {
-		for (int j = 0; j < strlen(name); j++) {
-			printf("#define %c%c (0x%x%x)\n", name[i], name[j], i, j);
-		}
+	auto val = (UGraphemeClusterBreak)u_getIntPropertyValue(c,
+		UCHAR_GRAPHEME_CLUSTER_BREAK);
+	switch (val) {
+	 case U_GCB_OTHER:				r = GCB_Other;			break;
+	 case U_GCB_CONTROL:			r = GCB_Control;		break;
+	 case U_GCB_CR:					r = GCB_CR;				break;
+	 case U_GCB_LF:					r = GCB_LF;				break;
+	 case U_GCB_EXTEND:				r = GCB_Extend;			break;
+	 case U_GCB_ZWJ:				r = GCB_ZWJ;			break;
+	 case U_GCB_REGIONAL_INDICATOR:	r = GCB_RI;				break;
+	 case U_GCB_PREPEND:			r = GCB_Prepend;		break;
+	 case U_GCB_SPACING_MARK:		r = GCB_SpacingMark;	break;
+	 case U_GCB_L:					r = GCB_L;				break;
+	 case U_GCB_V:					r = GCB_V;				break;
+	 case U_GCB_T:					r = GCB_T;				break;
+	 case U_GCB_LV:					r = GCB_LV;				break;
+	 case U_GCB_LVT:				r = GCB_LVT;			break;
+	 default:
+		errx(1, "0x%x has unknown GCB %d\n", c, (int)val);
 	}
-	printf("\n");
-	printf("const std::array<uint8,0x%x> eaw2width_packed = {\n",
-		MAXCHARS / 2);
+	return r;
 }
 
-void
-postamble()
+// Unicode 文字 c のテーブルの値を返す。
+static int
+value(int c)
 {
-	printf("};\n");
+	int eaw;
+
+	if (c < MAXCHARS) {
+		eaw = strchr("HFNA", conv(c)) - "HFNA";
+	} else {
+		// 範囲外は安全のため FullWidth としておく
+		eaw = 1;
+	}
+
+	int r = eaw | (gcb(c) << 2);
+	if (u_hasBinaryProperty(c, UCHAR_EXTENDED_PICTOGRAPHIC)) {
+		r |= EXTPICT;
+	}
+	return r;
 }
 
 int
 main(int ac, char *av[])
 {
-	std::string line;
-	const int LCHARS = 32;
-
-	preamble();
-	for (int i = 0; i < MAXCHARS; ) {
-		line += conv(i++);
-		line += conv(i++);
-		line += ',';
-		if (i % LCHARS != 0) {
-			line += ' ';
-		} else {
-			printf(" %s // %04x\n", line.c_str(), (i - LCHARS));
-			line.clear();
+	// 同じ内容のページをまとめる。
+	std::array<int, NUMPAGES> index;
+	std::vector<std::array<int, PAGE_SIZE>> pages;
+	for (int p = 0; p < NUMPAGES; p++) {
+		std::array<int, PAGE_SIZE> page;
+		for (int i = 0; i < PAGE_SIZE; i++) {
+			page[i] = value(p * PAGE_SIZE + i);
 		}
+		int n;
+		for (n = 0; n < pages.size(); n++) {
+			if (pages[n] == page) {
+				break;
+			}
+		}
+		if (n == pages.size()) {
+			pages.push_back(page);
+		}
+		index[p] = n;
 	}
-	postamble();
+	if (pages.size() > 256) {
+		errx(1, "too many pages: %zu", pages.size());
+	}
+
+	// For header
+	printf("extern const std::array<uint8,0x%x> eaw_index;\n", NUMPAGES);
+	printf("extern const std::array<uint8,0x%x> eaw_pages;\n",
+		(int)pages.size() * PAGE_SIZE);
+
+	printf("#include \"eaw_data.h\"\n");
+	printf("\n");
+	printf("const std::array<uint8,0x%x> eaw_index = {\n", NUMPAGES);
+	for (int p = 0; p < NUMPAGES; p += 16) {
+		printf(" ");
+		for (int i = 0; i < 16; i++) {
+			printf(" %3d,", index[p + i]);
+		}
+		printf(" // %04x\n", p * PAGE_SIZE);
+	}
+	printf("};\n");
+	printf("\n");
+	printf("const std::array<uint8,0x%x> eaw_pages = {\n",
+		(int)pages.size() * PAGE_SIZE);
+	for (int n = 0; n < pages.size(); n++) {
+		printf(" // page %d\n", n);
+		for (int i = 0; i < PAGE_SIZE; i += 16) {
+			printf(" ");
+			for (int j = 0; j < 16; j++) {
+				printf(" 0x%02x,", pages[n][i + j]);
+			}
+			printf("\n");
+		}
+	}
+	printf("};\n");
 	return 0;
 }
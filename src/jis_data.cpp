@@ -0,0 +1,3169 @@
+// generated by jis_gen.cpp
+
+#include "jis_data.h"
+
+const std::array<uint8,0x200> jis_index = {
+    0,   1,   2,   3,   0,   4,   0,   5,   6,   0,   0,   0,   0,   0,   0,   0, // 0000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 0800
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1800
+    7,   0,   8,   9,  10,  11,  12,   0,   0,   0,  13,  14,  15,   0,   0,   0, // 2000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 2800
+   16,  17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 3000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 3800
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 4000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  18,  19,  20,  21, // 4800
+   22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37, // 5000
+   38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53, // 5800
+   54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69, // 6000
+   70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85, // 6800
+   86,  87,  88,  89,  90,  91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101, // 7000
+  102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, // 7800
+  118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, // 8000
+  134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, // 8800
+  150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, // 9000
+  166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, // 9800
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // a000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // a800
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // b000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // b800
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // c000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // c800
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // d000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // d800
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // e000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // e800
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // f000
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 182, 183, // f800
+};
+
+const std::array<uint16,0x5c00> jis_table = {
+ // page 0 (empty)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 1 (U+0080)
+  0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+  0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x0000, 0x0000,
+  0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+  0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+  0x0000, 0xa242, 0x2171, 0x2172, 0xa270, 0x005c, 0xa243, 0x2178,
+  0x212f, 0xa26d, 0xa26c, 0x0000, 0x224c, 0x0000, 0xa26e, 0xa234,
+  0x216b, 0x215e, 0x0000, 0x0000, 0x212d, 0x0000, 0x2279, 0x0000,
+  0xa231, 0x0000, 0xa26b, 0x0000, 0x0000, 0x0000, 0x0000, 0xa244,
+  0xaa22, 0xaa21, 0xaa24, 0xaa2a, 0xaa23, 0xaa29, 0xa921, 0xaa2e,
+  0xaa32, 0xaa31, 0xaa34, 0xaa33, 0xaa40, 0xaa3f, 0xaa42, 0xaa41,
+  0x0000, 0xaa50, 0xaa52, 0xaa51, 0xaa54, 0xaa58, 0xaa53, 0x215f,
+  0xa92c, 0xaa63, 0xaa62, 0xaa65, 0xaa64, 0xaa72, 0xa930, 0xa94e,
+  0xab22, 0xab21, 0xab24, 0xab2a, 0xab23, 0xab29, 0xa941, 0xab2e,
+  0xab32, 0xab31, 0xab34, 0xab33, 0xab40, 0xab3f, 0xab42, 0xab41,
+  0xa943, 0xab50, 0xab52, 0xab51, 0xab54, 0xab58, 0xab53, 0x2160,
+  0xa94c, 0xab63, 0xab62, 0xab65, 0xab64, 0xab72, 0xa950, 0xab73,
+ // page 2 (U+0100)
+  0xaa27, 0xab27, 0xaa25, 0xab25, 0xaa28, 0xab28, 0xaa2b, 0xab2b,
+  0xaa2c, 0xab2c, 0xaa2f, 0xab2f, 0xaa2d, 0xab2d, 0xaa30, 0xab30,
+  0xa922, 0xa942, 0xaa37, 0xab37, 0x0000, 0x0000, 0xaa36, 0xab36,
+  0xaa38, 0xab38, 0xaa35, 0xab35, 0xaa3a, 0xab3a, 0xaa3b, 0xab3b,
+  0xaa3d, 0xab3d, 0xaa3c, 0x0000, 0xaa3e, 0xab3e, 0xa924, 0xa944,
+  0xaa47, 0xab47, 0xaa45, 0xab45, 0x0000, 0x0000, 0xaa46, 0xab46,
+  0xaa44, 0xa945, 0xa926, 0xa946, 0xaa48, 0xab48, 0xaa49, 0xab49,
+  0xa947, 0xaa4a, 0xab4a, 0xaa4c, 0xab4c, 0xaa4b, 0xab4b, 0xa929,
+  0xa949, 0xa928, 0xa948, 0xaa4d, 0xab4d, 0xaa4f, 0xab4f, 0xaa4e,
+  0xab4e, 0xa94a, 0xa92b, 0xa94b, 0xaa57, 0xab57, 0x0000, 0x0000,
+  0xaa56, 0xab56, 0xa92d, 0xa94d, 0xaa59, 0xab59, 0xaa5b, 0xab5b,
+  0xaa5a, 0xab5a, 0xaa5c, 0xab5c, 0xaa5d, 0xab5d, 0xaa5f, 0xab5f,
+  0xaa5e, 0xab5e, 0xaa61, 0xab61, 0xaa60, 0xab60, 0xa92f, 0xa94f,
+  0xaa6c, 0xab6c, 0xaa69, 0xab69, 0xaa66, 0xab66, 0xaa6b, 0xab6b,
+  0xaa68, 0xab68, 0xaa6a, 0xab6a, 0xaa71, 0xab71, 0xaa74, 0xab74,
+  0xaa73, 0xaa75, 0xab75, 0xaa77, 0xab77, 0xaa76, 0xab76, 0x0000,
+ // page 3 (U+0180)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xaa26, 0xab26, 0xaa43,
+  0xab43, 0xaa55, 0xab55, 0xaa67, 0xab67, 0xaa70, 0xab70, 0xaa6d,
+  0xab6d, 0xaa6f, 0xab6f, 0xaa6e, 0xab6e, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xab39, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 4 (U+0280)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa230,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xa22f, 0xa232, 0xa236, 0xa235, 0x0000, 0xa233, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 5 (U+0380)
+  0x0000, 0x0000, 0x0000, 0x0000, 0xa238, 0xa239, 0xa661, 0x0000,
+  0xa662, 0xa663, 0xa664, 0x0000, 0xa667, 0x0000, 0xa669, 0xa66c,
+  0xa676, 0x2621, 0x2622, 0x2623, 0x2624, 0x2625, 0x2626, 0x2627,
+  0x2628, 0x2629, 0x262a, 0x262b, 0x262c, 0x262d, 0x262e, 0x262f,
+  0x2630, 0x2631, 0x0000, 0x2632, 0x2633, 0x2634, 0x2635, 0x2636,
+  0x2637, 0x2638, 0xa665, 0xa66a, 0xa671, 0xa672, 0xa673, 0xa674,
+  0xa67b, 0x2641, 0x2642, 0x2643, 0x2644, 0x2645, 0x2646, 0x2647,
+  0x2648, 0x2649, 0x264a, 0x264b, 0x264c, 0x264d, 0x264e, 0x264f,
+  0x2650, 0x2651, 0xa678, 0x2652, 0x2653, 0x2654, 0x2655, 0x2656,
+  0x2657, 0x2658, 0xa675, 0xa67a, 0xa677, 0xa679, 0xa67c, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 6 (U+0400)
+  0x0000, 0x2727, 0xa742, 0xa743, 0xa744, 0xa745, 0xa746, 0xa747,
+  0xa748, 0xa749, 0xa74a, 0xa74b, 0xa74c, 0x0000, 0xa74d, 0xa74e,
+  0x2721, 0x2722, 0x2723, 0x2724, 0x2725, 0x2726, 0x2728, 0x2729,
+  0x272a, 0x272b, 0x272c, 0x272d, 0x272e, 0x272f, 0x2730, 0x2731,
+  0x2732, 0x2733, 0x2734, 0x2735, 0x2736, 0x2737, 0x2738, 0x2739,
+  0x273a, 0x273b, 0x273c, 0x273d, 0x273e, 0x273f, 0x2740, 0x2741,
+  0x2751, 0x2752, 0x2753, 0x2754, 0x2755, 0x2756, 0x2758, 0x2759,
+  0x275a, 0x275b, 0x275c, 0x275d, 0x275e, 0x275f, 0x2760, 0x2761,
+  0x2762, 0x2763, 0x2764, 0x2765, 0x2766, 0x2767, 0x2768, 0x2769,
+  0x276a, 0x276b, 0x276c, 0x276d, 0x276e, 0x276f, 0x2770, 0x2771,
+  0x0000, 0x2757, 0xa772, 0xa773, 0xa774, 0xa775, 0xa776, 0xa777,
+  0xa778, 0xa779, 0xa77a, 0xa77b, 0xa77c, 0x0000, 0xa77d, 0xa77e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 7 (U+2000)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x213e, 0x0000, 0x0000, 0x0000, 0x0000, 0x213d, 0x2142, 0x0000,
+  0x2146, 0x2147, 0x0000, 0x0000, 0x2148, 0x2149, 0x0000, 0x0000,
+  0x2277, 0x2278, 0x0000, 0x0000, 0x0000, 0x2145, 0x2144, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2273, 0x0000, 0x216c, 0x216d, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2228, 0x0000, 0x0000, 0x007e, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 8 (U+2100)
+  0x0000, 0x0000, 0x0000, 0x216e, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa271, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xa26f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2272, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 9 (U+2180)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x222b, 0x222c, 0x222a, 0x222d, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x224d, 0x0000, 0x224e, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 10 (U+2200)
+  0x224f, 0x0000, 0x225f, 0x2250, 0x0000, 0x0000, 0x0000, 0x2260,
+  0x223a, 0x0000, 0x0000, 0x223b, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x215d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2265, 0x0000, 0x0000, 0x2267, 0x2167, 0x0000,
+  0x225c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x224a,
+  0x224b, 0x2241, 0x2240, 0x2269, 0x226a, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2168, 0x2268, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2266, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2262, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2162, 0x2261, 0x0000, 0x0000, 0x0000, 0x0000, 0x2165, 0x2166,
+  0x0000, 0x0000, 0x2263, 0x2264, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 11 (U+2280)
+  0x0000, 0x0000, 0x223e, 0x223f, 0x0000, 0x0000, 0x223c, 0x223d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x225d, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 12 (U+2300)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x225e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 13 (U+2500)
+  0x2821, 0x282c, 0x2822, 0x282d, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2823, 0x0000, 0x0000, 0x282e,
+  0x2824, 0x0000, 0x0000, 0x282f, 0x2826, 0x0000, 0x0000, 0x2831,
+  0x2825, 0x0000, 0x0000, 0x2830, 0x2827, 0x283c, 0x0000, 0x0000,
+  0x2837, 0x0000, 0x0000, 0x2832, 0x2829, 0x283e, 0x0000, 0x0000,
+  0x2839, 0x0000, 0x0000, 0x2834, 0x2828, 0x0000, 0x0000, 0x2838,
+  0x283d, 0x0000, 0x0000, 0x2833, 0x282a, 0x0000, 0x0000, 0x283a,
+  0x283f, 0x0000, 0x0000, 0x2835, 0x282b, 0x0000, 0x0000, 0x283b,
+  0x0000, 0x0000, 0x2840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2836, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 14 (U+2580)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2223, 0x2222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2225, 0x2224, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2227, 0x2226, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2221, 0x217e,
+  0x0000, 0x0000, 0x0000, 0x217b, 0x0000, 0x0000, 0x217d, 0x217c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x227e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 15 (U+2600)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x217a, 0x2179, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x216a, 0x0000, 0x2169, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2276, 0x0000, 0x0000, 0x2275, 0x0000, 0x2274,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 16 (U+3000)
+  0x2121, 0x2122, 0x2123, 0x2137, 0x0000, 0x2139, 0x213a, 0x213b,
+  0x2152, 0x2153, 0x2154, 0x2155, 0x2156, 0x2157, 0x2158, 0x2159,
+  0x215a, 0x215b, 0x2229, 0x222e, 0x214c, 0x214d, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2141, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2421, 0x2422, 0x2423, 0x2424, 0x2425, 0x2426, 0x2427,
+  0x2428, 0x2429, 0x242a, 0x242b, 0x242c, 0x242d, 0x242e, 0x242f,
+  0x2430, 0x2431, 0x2432, 0x2433, 0x2434, 0x2435, 0x2436, 0x2437,
+  0x2438, 0x2439, 0x243a, 0x243b, 0x243c, 0x243d, 0x243e, 0x243f,
+  0x2440, 0x2441, 0x2442, 0x2443, 0x2444, 0x2445, 0x2446, 0x2447,
+  0x2448, 0x2449, 0x244a, 0x244b, 0x244c, 0x244d, 0x244e, 0x244f,
+  0x2450, 0x2451, 0x2452, 0x2453, 0x2454, 0x2455, 0x2456, 0x2457,
+  0x2458, 0x2459, 0x245a, 0x245b, 0x245c, 0x245d, 0x245e, 0x245f,
+ // page 17 (U+3080)
+  0x2460, 0x2461, 0x2462, 0x2463, 0x2464, 0x2465, 0x2466, 0x2467,
+  0x2468, 0x2469, 0x246a, 0x246b, 0x246c, 0x246d, 0x246e, 0x246f,
+  0x2470, 0x2471, 0x2472, 0x2473, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x212b, 0x212c, 0x2135, 0x2136, 0x0000,
+  0x0000, 0x2521, 0x2522, 0x2523, 0x2524, 0x2525, 0x2526, 0x2527,
+  0x2528, 0x2529, 0x252a, 0x252b, 0x252c, 0x252d, 0x252e, 0x252f,
+  0x2530, 0x2531, 0x2532, 0x2533, 0x2534, 0x2535, 0x2536, 0x2537,
+  0x2538, 0x2539, 0x253a, 0x253b, 0x253c, 0x253d, 0x253e, 0x253f,
+  0x2540, 0x2541, 0x2542, 0x2543, 0x2544, 0x2545, 0x2546, 0x2547,
+  0x2548, 0x2549, 0x254a, 0x254b, 0x254c, 0x254d, 0x254e, 0x254f,
+  0x2550, 0x2551, 0x2552, 0x2553, 0x2554, 0x2555, 0x2556, 0x2557,
+  0x2558, 0x2559, 0x255a, 0x255b, 0x255c, 0x255d, 0x255e, 0x255f,
+  0x2560, 0x2561, 0x2562, 0x2563, 0x2564, 0x2565, 0x2566, 0x2567,
+  0x2568, 0x2569, 0x256a, 0x256b, 0x256c, 0x256d, 0x256e, 0x256f,
+  0x2570, 0x2571, 0x2572, 0x2573, 0x2574, 0x2575, 0x2576, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2126, 0x213c, 0x2133, 0x2134, 0x0000,
+ // page 18 (U+4E00)
+  0x306c, 0x437a, 0xb021, 0x3c37, 0xb022, 0xb023, 0x0000, 0x4b7c,
+  0x3e66, 0x3b30, 0x3e65, 0x323c, 0xb024, 0x4954, 0x4d3f, 0x0000,
+  0x5022, 0x312f, 0xb025, 0x0000, 0x336e, 0x5023, 0x4024, 0x5242,
+  0x3556, 0x4a3a, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e67, 0xb026,
+  0x0000, 0x4e3e, 0x0000, 0xb027, 0xb028, 0x0000, 0x4a42, 0x0000,
+  0xb029, 0x0000, 0x5024, 0xb02a, 0x0000, 0x4366, 0xb02b, 0xb02c,
+  0xb02d, 0x5025, 0x367a, 0x0000, 0x0000, 0xb02e, 0x5026, 0x0000,
+  0x345d, 0x4330, 0x0000, 0x3c67, 0x5027, 0x0000, 0x0000, 0x5028,
+  0xb02f, 0xb030, 0x5029, 0x4735, 0xb031, 0x3557, 0x0000, 0xb032,
+  0x0000, 0x0000, 0x0000, 0x4737, 0x0000, 0x4663, 0x3843, 0x4b33,
+  0x0000, 0xb033, 0x0000, 0x0000, 0x0000, 0x6949, 0x502a, 0x3e68,
+  0x502b, 0x3235, 0xb034, 0x0000, 0xb035, 0x3665, 0x3870, 0x4c69,
+  0x0000, 0x0000, 0x5626, 0xb036, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xb037, 0xb038, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x4d70, 0x0000, 0x467d, 0xb039, 0xb03a, 0x0000, 0x0000,
+  0x0000, 0xb03b, 0x0000, 0x0000, 0x0000, 0x0000, 0x3425, 0xb03c,
+ // page 19 (U+4E80)
+  0x3535, 0x0000, 0x502c, 0x0000, 0x0000, 0x502d, 0x4e3b, 0x0000,
+  0x4d3d, 0x4168, 0x502f, 0x3b76, 0x4673, 0xb03d, 0x5032, 0x0000,
+  0x0000, 0x313e, 0x385f, 0x0000, 0x385e, 0x3066, 0xb03e, 0xb03f,
+  0x4f4b, 0x4f4a, 0x0000, 0x3a33, 0x3021, 0xb040, 0x5033, 0x5034,
+  0x5035, 0x4b34, 0x5036, 0x0000, 0x3872, 0x3067, 0x4b72, 0x0000,
+  0x357c, 0x0000, 0x0000, 0x357d, 0x357e, 0x4462, 0x4e3c, 0xb041,
+  0x5037, 0x0000, 0x0000, 0x5038, 0x0000, 0x0000, 0x5039, 0x0000,
+  0x0000, 0xb042, 0x3f4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3d3a, 0x3f4e, 0x503e, 0xb043, 0x503c, 0x0000, 0x503d, 0x3558,
+  0x0000, 0x0000, 0x3a23, 0x3270, 0x0000, 0x503b, 0x503a, 0x4a29,
+  0xb044, 0x0000, 0x0000, 0x0000, 0x3b46, 0x3b45, 0x423e, 0x503f,
+  0x4955, 0x4067, 0xb045, 0xb046, 0x0000, 0x2138, 0x5040, 0x5042,
+  0xb047, 0xb048, 0xb049, 0x4265, 0x4e61, 0x304a, 0x0000, 0x0000,
+  0xb04a, 0x0000, 0x0000, 0x0000, 0x0000, 0x5041, 0x323e, 0xb04b,
+  0x3644, 0xb04c, 0x4367, 0xb04d, 0x0000, 0xb04e, 0x376f, 0x5043,
+  0x0000, 0x0000, 0x0000, 0x4724, 0x0000, 0xb04f, 0xb050, 0xb051,
+ // page 20 (U+4F00)
+  0xb052, 0x346b, 0xb053, 0xb054, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xb055, 0x5044, 0x304b, 0xb056, 0xb057, 0x3860, 0x346c, 0x497a,
+  0x4832, 0x3559, 0xb058, 0x0000, 0x0000, 0xb059, 0xb05a, 0xb05b,
+  0x0000, 0xb05c, 0x3271, 0x0000, 0x5067, 0x4541, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb05d, 0x476c,
+  0x5046, 0xb05e, 0x0000, 0xb060, 0x483c, 0xb061, 0x4e62, 0xb062,
+  0x3f2d, 0xb063, 0x3b47, 0xb064, 0x3b77, 0x3240, 0xb065, 0x0000,
+  0xb066, 0x0000, 0xb067, 0x4451, 0x0000, 0x0000, 0x4322, 0x504a,
+  0xb068, 0xb069, 0x0000, 0xb06a, 0xb06b, 0x304c, 0x4463, 0x3d3b,
+  0x3a34, 0x4d24, 0xb06c, 0x424e, 0xb06d, 0x323f, 0xb06e, 0x5049,
+  0xb06f, 0x4d3e, 0x5045, 0x5047, 0x3a6e, 0x5048, 0x5524, 0xb070,
+  0xb05f, 0x0000, 0x0000, 0xb071, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5050, 0xb072, 0x0000, 0xb073, 0x0000, 0xb074, 0x5053,
+  0x5051, 0xb075, 0x0000, 0x3242, 0x0000, 0x4a3b, 0x504b, 0xb076,
+  0xb077, 0xb078, 0xb079, 0x504f, 0x3873, 0xb07a, 0xb07b, 0x3b48,
+ // page 21 (U+4F80)
+  0x0000, 0xb07c, 0xb07d, 0x3426, 0xb07e, 0xb121, 0x5054, 0x0000,
+  0x504c, 0xb122, 0xb123, 0x4e63, 0xb124, 0x3b78, 0xb125, 0x504d,
+  0xb126, 0x5052, 0xb127, 0xb128, 0xb129, 0x0000, 0x5055, 0xb12a,
+  0x504e, 0xb12b, 0xb12c, 0x3621, 0x0000, 0x304d, 0xb12d, 0xb12e,
+  0x3622, 0x3241, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x5525, 0x0000, 0x4b79, 0x496e, 0x3874,
+  0x0000, 0x0000, 0xb12f, 0x0000, 0x0000, 0x3f2f, 0x4e37, 0xb130,
+  0x0000, 0xb131, 0x0000, 0xb132, 0xb133, 0xb134, 0xb135, 0x4a58,
+  0xb136, 0xb137, 0x3738, 0x4225, 0x3264, 0xb138, 0xb139, 0x0000,
+  0xb13a, 0xb13b, 0x3d53, 0xb13c, 0xb13d, 0xb13e, 0x5059, 0xb13f,
+  0x505e, 0x505c, 0xb140, 0x0000, 0x5057, 0x0000, 0x0000, 0x422f,
+  0x505a, 0x0000, 0x505d, 0x505b, 0xb141, 0x4a5d, 0x0000, 0x5058,
+  0xb142, 0x3f2e, 0xb143, 0x4b73, 0x505f, 0x5060, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d24, 0x506d,
+  0xb144, 0x0000, 0xb145, 0x4750, 0x0000, 0x4936, 0x5068, 0x0000,
+  0x4a70, 0x0000, 0x3236, 0x0000, 0xb146, 0xb147, 0x506c, 0xb148,
+ // page 22 (U+5000)
+  0xb149, 0xb14a, 0x0000, 0x0000, 0xb14b, 0x5066, 0x506f, 0xb14c,
+  0x0000, 0x4152, 0xb14d, 0x3844, 0xb14e, 0x475c, 0xb14f, 0x6047,
+  0xb150, 0x506e, 0x455d, 0xb151, 0x5063, 0x0000, 0x3876, 0xb152,
+  0xb153, 0x3875, 0x5061, 0xb154, 0xb155, 0xb156, 0xb157, 0x3c5a,
+  0x0000, 0x5069, 0xb158, 0x4a6f, 0x434d, 0x5065, 0x3771, 0xb159,
+  0x5062, 0x506a, 0x5064, 0x4e51, 0x506b, 0x4f41, 0xb15a, 0x0000,
+  0xb15b, 0x0000, 0xb15c, 0xb15d, 0x0000, 0xb15e, 0x3666, 0x0000,
+  0x0000, 0x3770, 0x0000, 0xb176, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xb15f, 0xb160, 0xb161, 0x5070, 0x0000, 0xb162, 0xb163, 0x5071,
+  0x5075, 0x304e, 0xb164, 0x0000, 0xb165, 0x0000, 0xb166, 0x4a50,
+  0x5074, 0xb167, 0xb168, 0xb169, 0x0000, 0x5073, 0x5077, 0xb16a,
+  0x0000, 0xb16b, 0x5076, 0x0000, 0x4464, 0x0000, 0x0000, 0xb16c,
+  0xb16d, 0x0000, 0xb16e, 0xb16f, 0x0000, 0x3772, 0xb170, 0xb171,
+  0x0000, 0x0000, 0xb172, 0x0000, 0x5078, 0xb173, 0x0000, 0x0000,
+  0xb174, 0xb175, 0x3c45, 0x0000, 0x4226, 0x4465, 0x3676, 0x0000,
+  0x5079, 0x0000, 0x0000, 0x0000, 0x0000, 0x3536, 0x0000, 0x0000,
+ // page 23 (U+5080)
+  0x507a, 0xb177, 0x0000, 0xb178, 0xb179, 0x507c, 0xb17a, 0x0000,
+  0x0000, 0x0000, 0xb17b, 0x0000, 0x0000, 0x4b35, 0xb17c, 0xb17d,
+  0xb17e, 0x3766, 0xb221, 0xb222, 0xb223, 0x0000, 0xb224, 0x0000,
+  0x3b31, 0x4877, 0x507b, 0xb225, 0xb226, 0x0000, 0xb227, 0xb228,
+  0xb229, 0xb22a, 0xb22b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xb22c, 0x0000, 0x3a45, 0x4d43, 0x0000, 0xb22d,
+  0xb22e, 0x0000, 0x507e, 0x5123, 0x507d, 0x3a44, 0x0000, 0x3d7d,
+  0x0000, 0xb22f, 0xb230, 0x0000, 0x0000, 0xb231, 0x3739, 0x0000,
+  0xb232, 0x0000, 0x5124, 0xb233, 0xb234, 0x364f, 0x0000, 0xb235,
+  0x0000, 0x5121, 0x5122, 0x0000, 0xb236, 0x462f, 0xb237, 0x417c,
+  0xb238, 0x3623, 0x0000, 0xb239, 0xb23a, 0x4b4d, 0x5125, 0x0000,
+  0xb23b, 0x0000, 0x4e3d, 0x0000, 0xb23c, 0xb23d, 0x5126, 0xb23e,
+  0x0000, 0x0000, 0xb23f, 0x5129, 0xb240, 0x5127, 0xb241, 0x414e,
+  0xb242, 0xb243, 0x0000, 0x0000, 0x0000, 0x5128, 0x512a, 0xb244,
+  0x0000, 0xb245, 0xb251, 0x0000, 0x0000, 0x512c, 0xb246, 0x0000,
+  0x0000, 0x512b, 0xb247, 0x4a48, 0x0000, 0x0000, 0xb248, 0x0000,
+ // page 24 (U+5100)
+  0x3537, 0x512e, 0x512f, 0xb249, 0x322f, 0x0000, 0xb24a, 0xb24b,
+  0xb24c, 0x512d, 0x0000, 0xb24d, 0xb24e, 0xb24f, 0xb250, 0x0000,
+  0xb252, 0x0000, 0x3c74, 0x0000, 0x5132, 0x5131, 0x5130, 0xb253,
+  0x5056, 0xb254, 0x5133, 0xb255, 0xb256, 0xb257, 0xb258, 0x3d7e,
+  0x0000, 0x5134, 0x0000, 0xb259, 0x0000, 0x0000, 0x0000, 0xb25a,
+  0xb25b, 0x0000, 0x4d25, 0x0000, 0xb25c, 0xb25d, 0x0000, 0xb25e,
+  0x0000, 0xb25f, 0x4c59, 0xb260, 0xb261, 0xb262, 0x0000, 0x5136,
+  0xb263, 0xb264, 0x5135, 0x5138, 0x5137, 0x0000, 0x0000, 0x5139,
+  0x513a, 0x3074, 0xb265, 0x3835, 0x373b, 0x3d3c, 0x437b, 0x3624,
+  0x4068, 0x3877, 0xb266, 0x396e, 0x513c, 0x4c48, 0x4546, 0xb267,
+  0x3b79, 0x0000, 0x513b, 0xb268, 0x513d, 0xb269, 0x0000, 0xb26a,
+  0xb26b, 0x0000, 0x455e, 0x0000, 0x3375, 0x0000, 0x0000, 0xb26c,
+  0x0000, 0x0000, 0x513e, 0x0000, 0xb26d, 0x467e, 0xb26e, 0x0000,
+  0x4134, 0x5140, 0x5141, 0x482c, 0x3878, 0x4f3b, 0x5142, 0x0000,
+  0x0000, 0x3626, 0x0000, 0x0000, 0x0000, 0x4a3c, 0x4236, 0x3671,
+  0x4535, 0x0000, 0x0000, 0x0000, 0x3773, 0x0000, 0xb26f, 0x0000,
+ // page 25 (U+5180)
+  0x5143, 0x0000, 0x5144, 0xb270, 0xb271, 0x4662, 0x315f, 0x0000,
+  0x0000, 0x5147, 0x3a7d, 0xb272, 0x5146, 0x3a46, 0xb273, 0x5148,
+  0x666e, 0x5149, 0x4b41, 0x514a, 0x0000, 0x514b, 0x514c, 0x3e69,
+  0xb274, 0x3c4c, 0x0000, 0x0000, 0x0000, 0xb275, 0x0000, 0x0000,
+  0x3427, 0xb276, 0x514f, 0xb277, 0x514d, 0x4c3d, 0x514e, 0x0000,
+  0x495a, 0x5150, 0x5151, 0x5152, 0x455f, 0xb278, 0x0000, 0x0000,
+  0x5156, 0x5154, 0x5155, 0x5153, 0x3a63, 0x5157, 0x4c6a, 0x4e64,
+  0xb279, 0x0000, 0xb27a, 0x0000, 0xb27b, 0x5158, 0xb27c, 0xb27d,
+  0x0000, 0x0000, 0xb27e, 0x0000, 0x4028, 0x5159, 0x3d5a, 0x0000,
+  0xb321, 0x515a, 0x0000, 0x437c, 0x4e3f, 0x4560, 0x0000, 0xb322,
+  0x0000, 0xb323, 0xb324, 0xb325, 0x0000, 0xb326, 0x5245, 0x0000,
+  0xb327, 0x0000, 0x0000, 0x515b, 0x7425, 0x3645, 0xb328, 0x0000,
+  0x515c, 0x4b5e, 0xb329, 0x0000, 0x0000, 0xb32a, 0x3d68, 0x427c,
+  0x0000, 0x515e, 0x4664, 0x0000, 0x0000, 0x515f, 0xb32b, 0x0000,
+  0x5160, 0x332e, 0xb32c, 0xb32d, 0xb32e, 0x5161, 0x3627, 0xb32f,
+  0x464c, 0x317a, 0x3d50, 0x0000, 0x0000, 0x4821, 0x5162, 0x0000,
+ // page 26 (U+5200)
+  0x4561, 0xb330, 0xb331, 0x3f4f, 0x5163, 0xb332, 0x4a2c, 0x405a,
+  0x3422, 0x0000, 0x3429, 0x5164, 0x0000, 0x0000, 0x5166, 0x0000,
+  0x0000, 0x373a, 0xb333, 0xb334, 0x5165, 0xb335, 0xb336, 0x4e73,
+  0xb337, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d69, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xb338, 0x0000, 0x483d, 0x4a4c, 0x0000, 0x5167,
+  0xb339, 0x4d78, 0x5168, 0x0000, 0x0000, 0x0000, 0x5169, 0x0000,
+  0x457e, 0xb33a, 0xb33b, 0x516a, 0x0000, 0xb33c, 0x4029, 0x3a7e,
+  0x3774, 0x516b, 0x3b49, 0x396f, 0xb33d, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4466, 0x516d, 0xb33e, 0x0000, 0x4227,
+  0x0000, 0xb33f, 0x3a6f, 0x516e, 0x516f, 0x4130, 0x0000, 0x516c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x5171, 0xb340, 0x4b36, 0xb341,
+  0xb342, 0x0000, 0xb343, 0x3964, 0xb344, 0x0000, 0x5170, 0xb345,
+  0xb346, 0xb347, 0x0000, 0x3775, 0x3a5e, 0x476d, 0xb348, 0x0000,
+  0x0000, 0x5174, 0x5172, 0x0000, 0x0000, 0x0000, 0xb349, 0x497b,
+  0x3e6a, 0x517b, 0x3364, 0x5175, 0x5173, 0x414f, 0x0000, 0xb34a,
+  0xb34b, 0xb34c, 0x0000, 0x0000, 0x0000, 0x5177, 0x0000, 0x5176,
+ // page 27 (U+5280)
+  0xb34d, 0x0000, 0xb34e, 0x3344, 0x0000, 0xb34f, 0x0000, 0x3760,
+  0x517c, 0x4e2d, 0xb350, 0x0000, 0xb351, 0x5178, 0x0000, 0x0000,
+  0x0000, 0x517d, 0x517a, 0xb352, 0x5179, 0xb353, 0xb354, 0xb355,
+  0xb356, 0x0000, 0xb357, 0x4e4f, 0xb358, 0x0000, 0x0000, 0x3879,
+  0x3243, 0x0000, 0x0000, 0x4e74, 0xb359, 0xb35a, 0xb35b, 0xb35c,
+  0x0000, 0x3d75, 0x4558, 0x3965, 0x5222, 0x5223, 0x0000, 0xb35d,
+  0xb35e, 0x4e65, 0x0000, 0x0000, 0x4f2b, 0x5225, 0xb35f, 0xb360,
+  0xb361, 0x387a, 0xb362, 0xb363, 0x5224, 0xb364, 0x332f, 0x0000,
+  0xb365, 0x5226, 0x0000, 0x4b56, 0xb366, 0x443c, 0xb367, 0x4d26,
+  0xb368, 0x4a59, 0x0000, 0x0000, 0xb369, 0x5227, 0x0000, 0xb36a,
+  0x0000, 0xb36b, 0x7055, 0x0000, 0xb36c, 0x4630, 0xb36d, 0x5228,
+  0x342a, 0x4c33, 0x0000, 0xb36e, 0xb36f, 0x3e21, 0x5229, 0x4a67,
+  0x522d, 0xb370, 0x402a, 0x522a, 0x3650, 0xb371, 0x522b, 0x342b,
+  0xb372, 0xb373, 0xb374, 0x0000, 0xb375, 0x0000, 0x0000, 0x0000,
+  0xb376, 0xb377, 0x372e, 0x522e, 0xb378, 0x522f, 0xb379, 0xb37a,
+  0x5230, 0x5231, 0x3c5b, 0x0000, 0x0000, 0x0000, 0x387b, 0x4c5e,
+ // page 28 (U+5300)
+  0xb37b, 0x4c68, 0x4677, 0xb37c, 0x0000, 0x4a71, 0x5232, 0x0000,
+  0x5233, 0x0000, 0xb37d, 0xb37e, 0xb421, 0x5235, 0x0000, 0x5237,
+  0x5236, 0xb422, 0x0000, 0xb423, 0x0000, 0x5238, 0x323d, 0x4b4c,
+  0xb424, 0x3a7c, 0x5239, 0xb425, 0xb426, 0x4159, 0xb427, 0xb428,
+  0x3e22, 0x3629, 0x0000, 0x523a, 0x0000, 0xb429, 0x0000, 0xb42a,
+  0xb42b, 0xb42c, 0x485b, 0xb42d, 0xb42e, 0xb42f, 0x0000, 0x523b,
+  0xb430, 0x523c, 0xb431, 0x523d, 0x0000, 0xb432, 0x0000, 0x0000,
+  0x523e, 0x4924, 0x3668, 0x3065, 0xb433, 0xb434, 0xb435, 0x463f,
+  0x523f, 0x3d3d, 0xb436, 0x4069, 0x0000, 0x5241, 0x5240, 0x3e23,
+  0x3861, 0x5243, 0x483e, 0xb438, 0xb437, 0x5244, 0x0000, 0x0000,
+  0x0000, 0x485c, 0x4234, 0x426e, 0x3628, 0x0000, 0x0000, 0x466e,
+  0x4331, 0xb439, 0x476e, 0xb43a, 0x4b4e, 0x0000, 0x5246, 0x0000,
+  0x406a, 0xb43b, 0x0000, 0xb43c, 0x0000, 0xb43d, 0x3735, 0x0000,
+  0x0000, 0x5247, 0x0000, 0x0000, 0xb43e, 0xb43f, 0x5248, 0x312c,
+  0x3075, 0x346d, 0xb440, 0x4228, 0x3551, 0x4d71, 0x0000, 0x524b,
+  0x3237, 0xb441, 0x0000, 0x524a, 0x0000, 0x0000, 0xb442, 0x362a,
+ // page 29 (U+5380)
+  0x0000, 0x0000, 0x524c, 0xb443, 0x4c71, 0x0000, 0x0000, 0xb444,
+  0xb445, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb446, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xb447, 0xb448, 0x0000, 0x524d, 0x0000,
+  0x4e52, 0xb449, 0x387c, 0x0000, 0x0000, 0xb44a, 0x0000, 0x3836,
+  0x524e, 0xb44b, 0x0000, 0x0000, 0xb44c, 0x5250, 0x524f, 0x0000,
+  0x3f5f, 0x3139, 0xb44d, 0xb44e, 0x0000, 0x315e, 0x5251, 0xb44f,
+  0x5252, 0x0000, 0xb450, 0x3837, 0xb451, 0xb452, 0x5253, 0xb453,
+  0xb454, 0x0000, 0xb455, 0x356e, 0x0000, 0xb456, 0x0000, 0x0000,
+  0xb457, 0x0000, 0x3b32, 0x5254, 0x0000, 0xb458, 0x0000, 0x0000,
+  0x4b74, 0x3a35, 0x355a, 0x4d27, 0x4150, 0x483f, 0x3c7d, 0xb459,
+  0x0000, 0x0000, 0xb45a, 0xb45b, 0x3d47, 0xb45c, 0x3c68, 0x3c75,
+  0x0000, 0x3d76, 0xb45d, 0x4840, 0x0000, 0xb45e, 0xb45f, 0x5257,
+  0xb460, 0x3143, 0x4151, 0x387d, 0x3845, 0x3667, 0xb461, 0xb462,
+  0x525b, 0x4321, 0x427e, 0x362b, 0x3e24, 0x525c, 0x525a, 0x3244,
+  0x4266, 0x3c38, 0x3b4b, 0x3126, 0x0000, 0xb463, 0x3370, 0x3966,
+  0x3b4a, 0x0000, 0x525d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 30 (U+5400)
+  0x0000, 0x525e, 0xb464, 0x3549, 0x3346, 0x0000, 0x0000, 0x0000,
+  0x3967, 0x3548, 0x445f, 0x3125, 0x4631, 0x4c3e, 0x3921, 0x4d79,
+  0x4547, 0x387e, 0x0000, 0xb465, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xb466, 0x372f, 0x0000, 0x5267, 0x0000, 0x3663,
+  0x4b4a, 0xb467, 0x0000, 0x0000, 0x0000, 0x0000, 0x485d, 0xb468,
+  0xb469, 0x5266, 0xb46a, 0x345e, 0x5261, 0x5262, 0x5264, 0xb46b,
+  0x0000, 0xb46c, 0x0000, 0x0000, 0xb46d, 0xb46e, 0x5265, 0x0000,
+  0x355b, 0x3f61, 0x0000, 0x4a2d, 0x5263, 0x525f, 0x3863, 0x0000,
+  0x5260, 0x0000, 0x4f24, 0xb46f, 0xb470, 0x0000, 0x4a72, 0xb471,
+  0x4468, 0x3862, 0x3970, 0x0000, 0x0000, 0xb472, 0x5268, 0xb473,
+  0x0000, 0x465d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb474, 0x526c,
+  0x0000, 0x0000, 0xb475, 0x0000, 0xb476, 0x0000, 0xb477, 0xb478,
+  0x3c7e, 0xb479, 0x3c76, 0xb47a, 0x0000, 0xb47b, 0xb47c, 0x0000,
+  0x526f, 0x526d, 0x0000, 0x4c23, 0xb47d, 0x526a, 0x5273, 0x526e,
+  0x0000, 0x0000, 0x0000, 0x5271, 0x3846, 0x4c3f, 0x0000, 0xb47e,
+ // page 31 (U+5480)
+  0x5272, 0xb521, 0x0000, 0xb522, 0x5274, 0xb523, 0x5276, 0x0000,
+  0xb524, 0xb525, 0x0000, 0x3a70, 0x4f42, 0xb526, 0x526b, 0x5269,
+  0x5275, 0xb527, 0x5270, 0x0000, 0x0000, 0xb528, 0xb529, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xb52a, 0x0000, 0x0000, 0xb52b,
+  0x0000, 0xb52c, 0x5278, 0x0000, 0x5323, 0x527a, 0xb52d, 0xb52e,
+  0x527e, 0xb52f, 0xb530, 0x5321, 0x527b, 0xb531, 0xb532, 0x533e,
+  0x0000, 0xb533, 0x3a69, 0x3331, 0x0000, 0x0000, 0x0000, 0xb534,
+  0x5279, 0xb535, 0xb536, 0xb537, 0x5325, 0x3076, 0x5324, 0xb538,
+  0x3025, 0x494a, 0x5322, 0x0000, 0x527c, 0x0000, 0xb539, 0x5277,
+  0x527d, 0x3a48, 0xb53a, 0x0000, 0x0000, 0xb53b, 0xb53c, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5326, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xb53d, 0x3077, 0x532f, 0x0000, 0x0000, 0x5327, 0x5328, 0x0000,
+  0x3e25, 0x4b69, 0xb53e, 0x0000, 0xb53f, 0x532d, 0x532c, 0xb540,
+  0x0000, 0x0000, 0x452f, 0x0000, 0x0000, 0x0000, 0xb541, 0x0000,
+  0x0000, 0x0000, 0x532e, 0x0000, 0xb542, 0x532b, 0xb543, 0xb544,
+ // page 32 (U+5500)
+  0xb545, 0xb546, 0x0000, 0x0000, 0x3134, 0xb547, 0x3a36, 0x3f30,
+  0xb548, 0xb549, 0x0000, 0x0000, 0xb54a, 0xb54b, 0xb54c, 0x5329,
+  0x4562, 0x0000, 0x0000, 0x0000, 0x532a, 0xb54d, 0x3022, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xb54e, 0xb54f, 0x0000, 0x0000, 0x5334, 0x4d23,
+  0x0000, 0x3e27, 0xb550, 0x533a, 0x0000, 0xb551, 0xb552, 0x0000,
+  0x5339, 0x5330, 0x0000, 0xb553, 0xb554, 0xb555, 0x4243, 0x0000,
+  0x5331, 0xb556, 0x0000, 0x0000, 0x426f, 0x5336, 0x3e26, 0xb557,
+  0x0000, 0xb558, 0xb559, 0x0000, 0x5333, 0xb55a, 0x0000, 0x4c64,
+  0xb55b, 0xb55c, 0x0000, 0x373c, 0x0000, 0x0000, 0x5337, 0x5338,
+  0xb55d, 0x0000, 0xb55e, 0xb55f, 0x5335, 0x533b, 0xb560, 0x0000,
+  0xb561, 0xb562, 0x0000, 0x5332, 0xb563, 0x0000, 0xb564, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x5341, 0x5346, 0x0000, 0x5342, 0xb565,
+ // page 33 (U+5580)
+  0x533d, 0xb566, 0xb567, 0x5347, 0x4131, 0x0000, 0xb568, 0x5349,
+  0xb569, 0x3922, 0x533f, 0x437d, 0x0000, 0x0000, 0xb56a, 0xb56b,
+  0x0000, 0xb56c, 0xb56d, 0xb56e, 0xb56f, 0x0000, 0x0000, 0xb570,
+  0x5343, 0x533c, 0x342d, 0x0000, 0x346e, 0x3365, 0x5344, 0x5340,
+  0x0000, 0x0000, 0x0000, 0xb571, 0xb572, 0x0000, 0x0000, 0x3776,
+  0x534a, 0x5348, 0x4153, 0x354a, 0x362c, 0xb573, 0x5345, 0x0000,
+  0x3674, 0x0000, 0xb574, 0x0000, 0x0000, 0x0000, 0x3144, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb575,
+  0x0000, 0xb576, 0x0000, 0xb577, 0x534e, 0x534c, 0xb578, 0x5427,
+  0x0000, 0xb579, 0x0000, 0xb57a, 0xb57b, 0x0000, 0xb57c, 0x0000,
+  0x0000, 0xb57d, 0xb57e, 0xb621, 0x5351, 0x0000, 0x0000, 0xb622,
+  0xb623, 0x0000, 0x534b, 0xb624, 0x534f, 0x0000, 0xb625, 0x534d,
+  0x0000, 0x0000, 0xb626, 0x3b4c, 0x5350, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xb627, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb628, 0x5353,
+  0x0000, 0x5358, 0x0000, 0x0000, 0x0000, 0x5356, 0x5355, 0xb629,
+ // page 34 (U+5600)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb62a, 0x4332, 0x0000,
+  0xb62b, 0x3245, 0xb62c, 0x0000, 0x0000, 0xb62d, 0xb62e, 0xb62f,
+  0xb630, 0xb631, 0xb632, 0x0000, 0x5352, 0x0000, 0x5354, 0x3e28,
+  0x3133, 0xb633, 0x0000, 0x5357, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x325e, 0x0000, 0x0000, 0xb634, 0x0000, 0x0000, 0x5362,
+  0xb635, 0x3e7c, 0x535e, 0xb636, 0x535c, 0xb637, 0x535d, 0xb638,
+  0x535f, 0xb639, 0x0000, 0xb63a, 0xb63b, 0xb63c, 0x0000, 0xb63d,
+  0xb63e, 0xb63f, 0x313d, 0xb640, 0xb641, 0x0000, 0xb642, 0x0000,
+  0x0000, 0xb643, 0x0000, 0xb644, 0x4139, 0xb645, 0x5359, 0xb646,
+  0x535a, 0x0000, 0x0000, 0x0000, 0xb647, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x337a, 0x0000, 0x0000, 0xb648, 0x0000,
+  0xb649, 0xb64a, 0xb64b, 0xb64c, 0x5361, 0x0000, 0xb64d, 0x0000,
+  0x346f, 0xb64e, 0x5364, 0x5360, 0x5363, 0xb64f, 0x0000, 0xb650,
+  0x0000, 0xb651, 0xb652, 0x0000, 0x4a2e, 0xb653, 0x0000, 0x0000,
+  0x4655, 0x0000, 0x4838, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 35 (U+5680)
+  0x5366, 0x0000, 0x0000, 0x0000, 0xb654, 0xb655, 0x5365, 0x3345,
+  0xb656, 0x0000, 0x5367, 0xb657, 0xb658, 0x0000, 0x0000, 0x536a,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x5369, 0xb659, 0x0000, 0x0000,
+  0x0000, 0xb65a, 0xb65b, 0x0000, 0x0000, 0xb65c, 0xb65d, 0xb65e,
+  0x5368, 0x0000, 0x4739, 0x0000, 0x0000, 0x536b, 0xb65f, 0xb660,
+  0xb661, 0xb662, 0x0000, 0xb663, 0xb664, 0xb665, 0x536c, 0x0000,
+  0x0000, 0xb666, 0x0000, 0xb667, 0x536e, 0x0000, 0x536d, 0xb668,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x5370, 0x0000, 0xb669, 0x0000,
+  0x5373, 0x5371, 0x536f, 0x5372, 0x0000, 0xb66a, 0x0000, 0x0000,
+  0x5374, 0xb66b, 0xb66c, 0xb66d, 0xb670, 0xb671, 0x5375, 0xb66e,
+  0xb66f, 0x5376, 0x0000, 0x5377, 0x0000, 0x0000, 0x0000, 0x5378,
+  0x5145, 0xb672, 0x3c7c, 0x3b4d, 0xb673, 0xb674, 0x3273, 0xb675,
+  0x3078, 0xb676, 0x0000, 0x4344, 0xb677, 0xb678, 0xb679, 0xb67a,
+  0xb67b, 0x0000, 0x0000, 0xb67d, 0x0000, 0xb67e, 0x5379, 0x0000,
+  0x3a24, 0xb67c, 0x304f, 0x3f5e, 0x0000, 0x0000, 0xb721, 0xb722,
+  0x0000, 0x537a, 0x3847, 0x0000, 0x0000, 0x3971, 0x0000, 0x537c,
+ // page 36 (U+5700)
+  0x537b, 0xb723, 0xb724, 0x4a60, 0x537d, 0x0000, 0x0000, 0xb725,
+  0x5421, 0x537e, 0xb726, 0x5422, 0xb727, 0x5423, 0x0000, 0x3777,
+  0x0000, 0xb728, 0x3160, 0x5424, 0x0000, 0xb729, 0x5426, 0x0000,
+  0x5425, 0x0000, 0xb72a, 0xb72b, 0x5428, 0xb72c, 0x0000, 0x455a,
+  0xb72d, 0x0000, 0xb72e, 0xb72f, 0xb730, 0xb731, 0x5429, 0x3035,
+  0x3a5f, 0xb732, 0xb733, 0x0000, 0xb734, 0x373d, 0xb735, 0xb736,
+  0x434f, 0x0000, 0x0000, 0xb737, 0xb738, 0x0000, 0x0000, 0x542a,
+  0x542b, 0x0000, 0x0000, 0x542d, 0x0000, 0xb739, 0xb73a, 0xb73b,
+  0x542e, 0x0000, 0x3a64, 0x0000, 0x0000, 0xb73c, 0xb73d, 0x3651,
+  0x0000, 0x0000, 0x4b37, 0x0000, 0xb73e, 0xb73f, 0x542c, 0x542f,
+  0x3a41, 0x3923, 0xb740, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5433, 0xb741, 0x0000, 0x3a25, 0xb742, 0x4333, 0xb743,
+  0xb744, 0x5430, 0x445a, 0xb745, 0x0000, 0xb746, 0xb747, 0xb748,
+  0xb749, 0xb74a, 0x0000, 0xb74b, 0xb74c, 0xb74d, 0x0000, 0xb74e,
+  0x0000, 0xb74f, 0xb750, 0xb751, 0xb752, 0x0000, 0xb753, 0x5434,
+ // page 37 (U+5780)
+  0x0000, 0xb754, 0x3f62, 0xb755, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5432, 0x5435, 0x0000, 0x373f, 0xb756, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x5436, 0xb757, 0xb760, 0x0000, 0xb758,
+  0x0000, 0xb759, 0xb75a, 0x0000, 0xb75b, 0xb75c, 0xb75d, 0xb75e,
+  0x5437, 0xb75f, 0x3924, 0x3340, 0x5439, 0x0000, 0x0000, 0xb761,
+  0xb762, 0xb763, 0x543a, 0x0000, 0xb764, 0x0000, 0x0000, 0x0000,
+  0x543b, 0x0000, 0x0000, 0x5438, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xb765, 0x0000, 0x0000, 0x0000, 0x0000, 0xb766, 0x0000, 0x0000,
+  0x5431, 0x0000, 0x0000, 0x543c, 0x0000, 0x0000, 0x543d, 0xb767,
+  0xb768, 0x0000, 0x0000, 0x4b64, 0xb769, 0x0000, 0x3e6b, 0xb76a,
+  0x0000, 0x0000, 0x543f, 0x5440, 0x543e, 0xb76b, 0x5442, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4738, 0xb76c, 0xb76d, 0x3068,
+  0x4956, 0xb77e, 0x0000, 0x5443, 0xb76e, 0x0000, 0xb76f, 0xb770,
+  0x0000, 0xb771, 0x0000, 0x0000, 0x0000, 0xb772, 0x0000, 0x0000,
+  0xb773, 0x0000, 0x0000, 0x0000, 0x3e7d, 0xb774, 0xb775, 0x3c39,
+  0xb776, 0x475d, 0x3470, 0x0000, 0x3a6b, 0xb777, 0xb778, 0xb779,
+ // page 38 (U+5800)
+  0x4b59, 0x0000, 0x4632, 0xb77a, 0xb77b, 0x3778, 0x424f, 0x0000,
+  0xb77c, 0xb77d, 0x5441, 0x5444, 0xb821, 0xb822, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4244, 0x0000, 0x0000,
+  0x0000, 0x5445, 0x0000, 0xb823, 0x0000, 0x5446, 0xb824, 0xb825,
+  0xb826, 0x5448, 0x0000, 0x0000, 0x4469, 0x0000, 0xb827, 0xb828,
+  0x0000, 0x0000, 0x342e, 0x0000, 0x0000, 0xb829, 0x0000, 0x7421,
+  0x3161, 0x4a73, 0xb82a, 0x0000, 0x3e6c, 0x4548, 0x0000, 0x0000,
+  0x0000, 0xb82b, 0x3a66, 0x0000, 0x0000, 0x544e, 0x0000, 0xb82c,
+  0x4a3d, 0x4e5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xb82d, 0x3274, 0x544a, 0xb82e, 0xb82f, 0x0000, 0xb830,
+  0xb831, 0x413a, 0x544d, 0x0000, 0x4563, 0xb832, 0x0000, 0x4549,
+  0x4564, 0x4839, 0x444d, 0x0000, 0x0000, 0x0000, 0x3a49, 0xb833,
+  0x0000, 0xb834, 0x5449, 0x0000, 0xb835, 0x0000, 0x0000, 0xb836,
+  0xb837, 0x3176, 0x0000, 0x4536, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x544b, 0x0000, 0x5447, 0x0000, 0x0000, 0x3f50, 0x0000, 0x0000,
+  0xb838, 0x544f, 0x0000, 0x0000, 0xb839, 0x0000, 0x3d4e, 0xb83a,
+ // page 39 (U+5880)
+  0xb83b, 0xb83c, 0x0000, 0x362d, 0x0000, 0x5450, 0x0000, 0xb83d,
+  0xb83e, 0xb83f, 0xb840, 0x0000, 0xb841, 0xb842, 0x0000, 0xb843,
+  0xb844, 0x0000, 0x0000, 0x4a68, 0xb845, 0x0000, 0xb846, 0x417d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4446, 0xb847, 0x0000, 0x5452,
+  0xb848, 0xb849, 0xb84a, 0x0000, 0x0000, 0x0000, 0xb84b, 0x0000,
+  0x4b4f, 0xb84c, 0x0000, 0x5453, 0x0000, 0x0000, 0x5458, 0x0000,
+  0x0000, 0xb84d, 0xb84e, 0x4a2f, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5457, 0x5451, 0x5454, 0x5456, 0xb850, 0x0000, 0x3a26, 0x0000,
+  0x0000, 0x4a49, 0xb851, 0x0000, 0xb84f, 0x5459, 0x0000, 0x4345,
+  0xb852, 0x0000, 0x3275, 0x0000, 0x3e6d, 0xb853, 0xb854, 0x0000,
+  0xb855, 0x545b, 0xb856, 0x545a, 0xb857, 0x3968, 0xb858, 0x545c,
+  0x545e, 0x545d, 0xb859, 0x0000, 0x5460, 0xb85a, 0x5455, 0x5462,
+  0x0000, 0xb85b, 0xb85c, 0x0000, 0x5461, 0x545f, 0x0000, 0x0000,
+  0x0000, 0xb85d, 0x0000, 0x3b4e, 0x3f51, 0x0000, 0x4154, 0x5463,
+  0x403c, 0x306d, 0x4764, 0xb85e, 0x0000, 0x0000, 0x0000, 0x445b,
+  0x0000, 0x5465, 0x5464, 0x5466, 0x5467, 0x5468, 0x0000, 0x0000,
+ // page 40 (U+5900)
+  0x0000, 0x0000, 0x5469, 0x0000, 0x0000, 0xb85f, 0xb860, 0x0000,
+  0x0000, 0x4a51, 0x546a, 0xb861, 0xb862, 0x0000, 0x0000, 0x3246,
+  0x546b, 0x0000, 0xb863, 0xb864, 0xb865, 0x4d3c, 0x3330, 0x0000,
+  0x5249, 0x3d48, 0x423f, 0x546c, 0x4c6b, 0xb867, 0x0000, 0x0000,
+  0x0000, 0xb868, 0x4c34, 0xb869, 0xb86a, 0x546e, 0x0000, 0x4267,
+  0xb86b, 0x4537, 0x4240, 0x4957, 0x546f, 0x5470, 0x317b, 0xb86c,
+  0xb86d, 0x3c3a, 0x5471, 0xb86e, 0x0000, 0xb86f, 0xb870, 0x3050,
+  0x5472, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5473, 0xb871,
+  0x0000, 0x0000, 0x0000, 0xb872, 0x3162, 0x0000, 0xb873, 0x3471,
+  0x4660, 0x4a74, 0x0000, 0x0000, 0x0000, 0x0000, 0x5477, 0x4155,
+  0x5476, 0x3740, 0xb874, 0xb875, 0x4b5b, 0x5475, 0x0000, 0x4565,
+  0x5479, 0xb876, 0x5478, 0xb877, 0x0000, 0xb878, 0xb879, 0xb87a,
+  0x547b, 0xb87b, 0x547a, 0xb87c, 0x0000, 0x317c, 0x0000, 0x547c,
+  0x3e29, 0x547e, 0x4325, 0xb87d, 0x547d, 0xb87e, 0x4a33, 0xb921,
+  0x0000, 0x0000, 0xb922, 0x3d77, 0x455b, 0xb923, 0xb924, 0x0000,
+  0x5521, 0xb925, 0x0000, 0xb926, 0xb927, 0x3925, 0x0000, 0x0000,
+ // page 41 (U+5980)
+  0x0000, 0x5522, 0x4721, 0x485e, 0x4c51, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x4725, 0xb928, 0xb929, 0x552b, 0xb92a, 0x0000,
+  0x0000, 0x0000, 0xb92b, 0x3538, 0x0000, 0xb92c, 0x4d45, 0xb92d,
+  0x0000, 0x4c2f, 0x0000, 0x562c, 0x0000, 0x5523, 0x0000, 0xb92e,
+  0x0000, 0x0000, 0x0000, 0x5526, 0xb92f, 0x4245, 0x0000, 0xb930,
+  0x4b38, 0x0000, 0x0000, 0x0000, 0x454a, 0xb931, 0xb932, 0xb933,
+  0xb934, 0x0000, 0x5527, 0xb935, 0x0000, 0x0000, 0x0000, 0xb936,
+  0x0000, 0x4b65, 0xb937, 0x3a4a, 0xb938, 0x0000, 0x3e2a, 0x0000,
+  0x0000, 0xb939, 0x0000, 0xb93a, 0xb93b, 0x0000, 0x5528, 0x0000,
+  0xb93c, 0x3b50, 0xb93d, 0x3b4f, 0x0000, 0xb93e, 0x0000, 0x0000,
+  0x3039, 0x3848, 0xb93f, 0x402b, 0x3051, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x552c, 0x552d, 0x0000, 0x552a, 0xb940, 0xb941, 0xb942,
+  0x0000, 0x0000, 0x0000, 0xb943, 0xb944, 0x3138, 0x342f, 0xb945,
+  0x5529, 0x0000, 0x4c45, 0x4931, 0x0000, 0x0000, 0xb946, 0xb947,
+  0x0000, 0xb948, 0xb949, 0x0000, 0xb94a, 0x0000, 0x3028, 0xb94b,
+  0x0000, 0x0000, 0x0000, 0x3079, 0x0000, 0x0000, 0x0000, 0x3b51,
+ // page 42 (U+5A00)
+  0xb94c, 0x3052, 0x0000, 0x3023, 0xb94d, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5532, 0x0000, 0x0000, 0xb94e, 0xb94f, 0xb950, 0x0000,
+  0x0000, 0x5530, 0xb951, 0xb952, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x4c3c, 0x0000, 0x5533, 0x0000, 0x5531, 0x0000, 0xb953, 0x552f,
+  0x3f31, 0x0000, 0x0000, 0xb954, 0xb955, 0x552e, 0x0000, 0xb956,
+  0xb957, 0x4a5a, 0xb958, 0x0000, 0x0000, 0xb959, 0x0000, 0x3864,
+  0xb95a, 0x0000, 0x0000, 0x0000, 0x0000, 0x5537, 0x5538, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3e2b, 0x0000, 0x0000, 0x0000,
+  0x5534, 0x4f2c, 0x0000, 0x0000, 0xb95b, 0xb95c, 0x474c, 0xb95d,
+  0xb95e, 0x5536, 0x0000, 0x0000, 0xb95f, 0x0000, 0x0000, 0x0000,
+  0xb960, 0x0000, 0x0000, 0x0000, 0x0000, 0xb961, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3a27, 0x0000, 0x0000, 0x0000, 0xb962, 0x0000,
+  0x0000, 0x0000, 0x5539, 0xb963, 0x0000, 0xb964, 0x4958, 0xb965,
+  0x0000, 0x0000, 0x553a, 0x0000, 0x5535, 0xb966, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb967,
+  0x0000, 0x0000, 0xb968, 0xb969, 0x0000, 0x0000, 0xb96a, 0x4c3b,
+ // page 43 (U+5A80)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xb96b, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xb96c, 0x0000, 0x475e, 0xb96d, 0x0000, 0x0000, 0xb96e, 0x0000,
+  0x0000, 0xb96f, 0x553b, 0x4932, 0xb970, 0x0000, 0xb971, 0xb972,
+  0xb973, 0x0000, 0xb974, 0x0000, 0x0000, 0x0000, 0x0000, 0xb975,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xb976, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xb977, 0xb978, 0xb979, 0x0000, 0xb97a, 0x0000, 0x0000,
+  0xb97b, 0x0000, 0xb97c, 0xb97d, 0x553c, 0x5540, 0x553d, 0xb97e,
+  0x0000, 0x3247, 0x553f, 0x0000, 0xba21, 0x0000, 0xba22, 0x0000,
+  0xba23, 0x3c3b, 0x0000, 0x553e, 0x3779, 0x0000, 0x0000, 0xba24,
+  0x554c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5545, 0x5542,
+  0x0000, 0x0000, 0xba25, 0x0000, 0xba26, 0x0000, 0x0000, 0x0000,
+  0xba27, 0x4364, 0x0000, 0x5541, 0x0000, 0xba28, 0x5543, 0x0000,
+  0x0000, 0x5544, 0xba29, 0x0000, 0x0000, 0x0000, 0xba2a, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xba2b, 0xba2c, 0x0000,
+  0x0000, 0x0000, 0x5546, 0x5547, 0x0000, 0xba2d, 0x0000, 0x0000,
+ // page 44 (U+5B00)
+  0xba2e, 0xba2f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xba30, 0x3472, 0x0000, 0x5549, 0x5548, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x554a, 0xba31,
+  0x0000, 0xba33, 0x0000, 0xba34, 0x0000, 0xba35, 0x0000, 0x0000,
+  0x0000, 0xba36, 0x3e6e, 0x0000, 0x0000, 0xba37, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x554d, 0x0000, 0x445c, 0xba38, 0x0000, 0x0000,
+  0x3145, 0x0000, 0x554b, 0x0000, 0xba32, 0x0000, 0x554e, 0x0000,
+  0xba39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x554f, 0x0000,
+  0x5552, 0xba3a, 0x0000, 0x5550, 0x0000, 0x5551, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xba3b, 0xba3c, 0x0000, 0x0000, 0x0000,
+  0x3b52, 0x5553, 0xba3d, 0x0000, 0x3926, 0x5554, 0xba3e, 0x3b7a,
+  0x4238, 0x0000, 0x5555, 0x5556, 0x3b5a, 0x3927, 0xba3f, 0x4c52,
+  0x0000, 0x0000, 0x0000, 0x3528, 0x3849, 0x5557, 0x3358, 0x0000,
+  0xba40, 0x5558, 0x0000, 0x4239, 0x0000, 0x0000, 0xba41, 0xba42,
+  0x5559, 0x5623, 0x0000, 0x555a, 0x0000, 0x555b, 0x0000, 0x0000,
+  0x555c, 0x0000, 0x555e, 0x0000, 0xba43, 0xba44, 0xba45, 0xba46,
+ // page 45 (U+5B80)
+  0x555f, 0xba47, 0x0000, 0x5560, 0xba48, 0x4270, 0xba49, 0x3127,
+  0x3c69, 0x3042, 0xba4a, 0x4157, 0x3430, 0x3c35, 0xba4b, 0x3928,
+  0xba4c, 0xba4d, 0x0000, 0xba4e, 0xba4f, 0x4566, 0xba50, 0x3d21,
+  0x3431, 0x4368, 0x446a, 0x3038, 0x3539, 0x4a75, 0x0000, 0x3c42,
+  0x0000, 0x0000, 0x3552, 0x406b, 0x3c3c, 0x4d28, 0x5561, 0x0000,
+  0xba51, 0xba52, 0x0000, 0x0000, 0xba53, 0xba54, 0x355c, 0xba55,
+  0x3a4b, 0xba56, 0xba57, 0x3332, 0x3163, 0x3e2c, 0x3248, 0xba58,
+  0x5562, 0x4d46, 0xba59, 0x0000, 0xba5a, 0x0000, 0x0000, 0x3d49,
+  0xba5b, 0xba5c, 0x3c64, 0x5563, 0x3473, 0x4652, 0x4c29, 0x5564,
+  0x0000, 0x5565, 0x0000, 0x0000, 0x4959, 0xba5d, 0x0000, 0xba5e,
+  0x5567, 0x0000, 0x3428, 0x3677, 0x5566, 0x0000, 0xba5f, 0xba60,
+  0xba61, 0xba62, 0xba63, 0x3432, 0x0000, 0x3f32, 0x556b, 0x3b21,
+  0xba64, 0x3249, 0x556a, 0x0000, 0x5568, 0x556c, 0x5569, 0x472b,
+  0x5c4d, 0x3f33, 0x0000, 0x556d, 0x0000, 0x0000, 0x4e40, 0xba65,
+  0x556e, 0xba66, 0x0000, 0x5570, 0xba67, 0x437e, 0x556f, 0x0000,
+  0x4023, 0x0000, 0x3b7b, 0x0000, 0x0000, 0xba68, 0x4250, 0x3c77,
+ // page 46 (U+5C00)
+  0x0000, 0x4975, 0x406c, 0x0000, 0x3c4d, 0x5571, 0x3e2d, 0x5572,
+  0x5573, 0x3053, 0x423a, 0x3f52, 0xba69, 0x5574, 0x4633, 0x3e2e,
+  0x0000, 0x3e2f, 0x0000, 0x5575, 0x0000, 0x0000, 0x406d, 0xba6a,
+  0x0000, 0x0000, 0x3e30, 0x0000, 0x0000, 0x0000, 0xba6b, 0xba6c,
+  0x5576, 0x0000, 0x5577, 0xba6d, 0x4c60, 0x0000, 0xba6e, 0x0000,
+  0x5578, 0xba6f, 0x0000, 0xba70, 0xba71, 0x3646, 0xba72, 0x0000,
+  0xba73, 0x3d22, 0xba74, 0x0000, 0x0000, 0xba75, 0xba76, 0x0000,
+  0x5579, 0x557a, 0x3c5c, 0x3f2c, 0x4674, 0x3f54, 0x4878, 0x4722,
+  0x3649, 0x557b, 0x0000, 0x0000, 0x0000, 0x356f, 0x557c, 0x0000,
+  0x367e, 0x0000, 0x464f, 0x3230, 0x0000, 0x3b53, 0x557d, 0x5622,
+  0x5621, 0x367d, 0x0000, 0x557e, 0x0000, 0x4538, 0x0000, 0x0000,
+  0x0000, 0xba77, 0xba78, 0x0000, 0xba79, 0x0000, 0x4230, 0x0000,
+  0x454b, 0x3c48, 0xba7a, 0xba7b, 0x4158, 0x4d7a, 0x0000, 0xba7c,
+  0xba7d, 0xba7e, 0x0000, 0x0000, 0x5624, 0xbb21, 0x5625, 0x4656,
+  0xbb22, 0x3b33, 0x0000, 0x0000, 0xbb23, 0xbb24, 0x5627, 0x0000,
+  0x0000, 0x5628, 0xbb25, 0xbb26, 0xbb27, 0xbb28, 0x0000, 0x0000,
+ // page 47 (U+5C80)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbb29,
+  0xbb2a, 0x0000, 0xbb2b, 0x0000, 0x5629, 0x0000, 0x0000, 0xbb2c,
+  0x3474, 0x562a, 0xbb2d, 0x0000, 0x562b, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbb2e, 0x0000, 0xbb2f,
+  0xbb30, 0x322c, 0xbb31, 0xbb32, 0x0000, 0x0000, 0xbb33, 0x0000,
+  0x413b, 0x3464, 0xbb34, 0x562d, 0x4c28, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x4252, 0xbb35, 0x3359, 0xbb36, 0xbb37, 0x562f, 0x5631,
+  0x345f, 0x0000, 0xbb38, 0x562e, 0x5630, 0x0000, 0x5633, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5632, 0x0000, 0x5634,
+  0x0000, 0xbb39, 0x0000, 0xbb3a, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xbb3b, 0x0000, 0x0000, 0x0000, 0x0000, 0xbb3d,
+  0x0000, 0x5635, 0x0000, 0x0000, 0x0000, 0xbb3c, 0x0000, 0x0000,
+  0x463d, 0x362e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3265, 0x5636, 0x563b, 0x0000, 0x0000, 0x5639, 0xbb3e, 0x4a77,
+  0x4a76, 0xbb3f, 0xbb40, 0x0000, 0xbb41, 0x0000, 0x4567, 0x0000,
+  0x0000, 0x0000, 0x5638, 0x3d54, 0x0000, 0x5637, 0x0000, 0x0000,
+ // page 48 (U+5D00)
+  0x0000, 0xbb42, 0x0000, 0x0000, 0x0000, 0x0000, 0xbb43, 0x3f72,
+  0x0000, 0x0000, 0x0000, 0x563c, 0x0000, 0xbb44, 0x3a6a, 0x0000,
+  0x0000, 0x5642, 0xbb45, 0x0000, 0x5643, 0x563d, 0x3333, 0x563e,
+  0x5647, 0x5646, 0x5645, 0x5641, 0x0000, 0x0000, 0x0000, 0x5640,
+  0x0000, 0x0000, 0x5644, 0xbb47, 0xbb48, 0x0000, 0xbb49, 0xbb4a,
+  0x0000, 0x4a78, 0x0000, 0xbb46, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xbb4b, 0x0000, 0x0000, 0xbb4c, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xbb4d, 0x0000, 0x0000, 0x0000, 0xbb4e, 0x0000, 0xbb4f,
+  0x0000, 0x0000, 0xbb50, 0xbb51, 0x0000, 0x0000, 0xbb52, 0x0000,
+  0xbb53, 0x0000, 0xbb57, 0x564b, 0x5648, 0x0000, 0x564a, 0x0000,
+  0x4d72, 0xbb55, 0x5649, 0x0000, 0x0000, 0xbb54, 0x0000, 0x0000,
+  0x0000, 0xbb56, 0x0000, 0x0000, 0x563f, 0x0000, 0x0000, 0xbb58,
+  0xbb59, 0xbb5a, 0xbb5b, 0x0000, 0xbb5c, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3f73, 0xbb5d, 0x0000, 0x564c, 0xbb5e, 0x0000, 0x3a37,
+  0xbb5f, 0x0000, 0x0000, 0x564d, 0x0000, 0x0000, 0x564e, 0x0000,
+  0x0000, 0xbb60, 0xbb61, 0x0000, 0x0000, 0x0000, 0xbb62, 0xbb63,
+ // page 49 (U+5D80)
+  0x0000, 0xbb64, 0x5651, 0xbb65, 0x5650, 0x0000, 0x0000, 0x564f,
+  0xbb66, 0x0000, 0xbb67, 0x4568, 0x563a, 0x0000, 0x0000, 0x0000,
+  0x5657, 0x0000, 0xbb68, 0xbb69, 0xbb6a, 0xbb6b, 0x0000, 0x0000,
+  0x0000, 0xbb6c, 0x0000, 0xbb6d, 0x0000, 0x5653, 0x0000, 0xbb6e,
+  0xbb6f, 0x0000, 0x5652, 0x0000, 0x0000, 0x0000, 0x0000, 0xbb70,
+  0x0000, 0x0000, 0x0000, 0xbb71, 0x5654, 0x0000, 0x5655, 0x0000,
+  0xbb72, 0x0000, 0xe674, 0x0000, 0xbb73, 0x0000, 0x0000, 0x5658,
+  0xbb74, 0xbb75, 0x4e66, 0x0000, 0x5659, 0x5656, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xbb76, 0x0000, 0x0000, 0x0000, 0xbb77,
+  0x0000, 0x565a, 0x0000, 0xbb78, 0x3460, 0x565b, 0xbb7a, 0x0000,
+  0xbb79, 0x0000, 0x565d, 0x565c, 0x0000, 0x0000, 0x565e, 0x0000,
+  0xbb7b, 0xbb7c, 0x0000, 0x565f, 0x0000, 0x406e, 0x3d23, 0x0000,
+  0xbb7d, 0x3d64, 0x0000, 0x4163, 0xbb7e, 0x3929, 0x3a38, 0x392a,
+  0x3570, 0xbc21, 0x0000, 0x5660, 0x0000, 0x0000, 0x3a39, 0x0000,
+  0x0000, 0x384a, 0x5661, 0x4c26, 0x4743, 0x5662, 0x0000, 0x392b,
+  0xbc22, 0xbc23, 0x0000, 0x342c, 0x0000, 0x4327, 0x3652, 0x0000,
+ // page 50 (U+5E00)
+  0xbc24, 0x0000, 0x3b54, 0x495b, 0x0000, 0x0000, 0x4841, 0xbc25,
+  0x0000, 0x0000, 0x0000, 0x5663, 0x3475, 0xbc26, 0x0000, 0x0000,
+  0x0000, 0x5666, 0xbc27, 0x0000, 0xbc28, 0xbc29, 0x4421, 0x0000,
+  0xbc2a, 0x5665, 0x5664, 0x5667, 0x0000, 0x446b, 0x0000, 0xbc2b,
+  0xbc2c, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f63, 0x0000, 0x0000,
+  0xbc2e, 0x0000, 0x0000, 0x3b55, 0x0000, 0x404a, 0xbc2d, 0x4253,
+  0x3522, 0x0000, 0xbc2f, 0x4422, 0x0000, 0xbc30, 0x5668, 0x5669,
+  0x3e6f, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b39, 0xbc31, 0x0000,
+  0x566c, 0x0000, 0x0000, 0x566b, 0x566a, 0x497d, 0x0000, 0x5673,
+  0x0000, 0xbc34, 0x0000, 0xbc32, 0x4b5a, 0x0000, 0x566d, 0x0000,
+  0xbc33, 0xbc35, 0x0000, 0x0000, 0x566f, 0x4b6b, 0xbc36, 0x566e,
+  0xbc37, 0x0000, 0x0000, 0xbc38, 0xbc39, 0x0000, 0xbc3a, 0x5670,
+  0x0000, 0x4828, 0x5671, 0x4a3e, 0x5672, 0x0000, 0x0000, 0x0000,
+  0xbc3b, 0x0000, 0xbc3c, 0xbc3d, 0xbc3e, 0xbc3f, 0xbc40, 0x0000,
+  0xbc41, 0x0000, 0x3433, 0x4a3f, 0x472f, 0x5674, 0x5675, 0x0000,
+  0x392c, 0x3434, 0x5676, 0x3838, 0x4d44, 0x4d29, 0x3476, 0x5678,
+ // page 51 (U+5E80)
+  0xbc42, 0x4423, 0x0000, 0x392d, 0x3e31, 0x0000, 0x0000, 0x485f,
+  0x0000, 0x0000, 0x3e32, 0xbc43, 0x0000, 0x0000, 0xbc44, 0x3d78,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x446c, 0x4a79, 0x4539,
+  0x0000, 0x0000, 0x392e, 0x0000, 0x495c, 0x0000, 0x0000, 0x0000,
+  0x5679, 0x0000, 0xbc45, 0x0000, 0xbc46, 0xbc47, 0x4559, 0x3a42,
+  0xbc48, 0x0000, 0xbc49, 0x384b, 0xbc4a, 0x446d, 0x0000, 0x0000,
+  0x0000, 0xbc4b, 0x0000, 0xbc4c, 0x0000, 0x3043, 0x3d6e, 0x392f,
+  0x4d47, 0x0000, 0x0000, 0x0000, 0x0000, 0xbc4d, 0xbc4e, 0xbc4f,
+  0x0000, 0x567a, 0x567b, 0x4751, 0x0000, 0x0000, 0xbc50, 0x0000,
+  0x567c, 0x4e77, 0x4f2d, 0xbc52, 0xbc51, 0x0000, 0xbc53, 0x567e,
+  0x567d, 0xbc54, 0xbc55, 0x3347, 0xbc56, 0xbc57, 0x5721, 0x0000,
+  0x0000, 0x0000, 0x5724, 0x5725, 0xbc58, 0x5723, 0xbc59, 0x4940,
+  0x3e33, 0x5727, 0x5726, 0x5722, 0x0000, 0xbc5a, 0x0000, 0x0000,
+  0x5728, 0x5729, 0x0000, 0xbc5b, 0x572a, 0x0000, 0x0000, 0x0000,
+  0x572d, 0x572b, 0x0000, 0x572c, 0x572e, 0x0000, 0x3164, 0x446e,
+  0x572f, 0x0000, 0x377a, 0x3276, 0x4736, 0x0000, 0x5730, 0x467b,
+ // page 52 (U+5F00)
+  0x0000, 0x4a5b, 0xbc5c, 0x5731, 0x4f2e, 0x0000, 0xbc5d, 0xbc5e,
+  0xbc5f, 0x5732, 0x4a40, 0x5735, 0x5021, 0x5031, 0xbc60, 0x3c30,
+  0x4675, 0x5736, 0x0000, 0x355d, 0x4424, 0x307a, 0x5737, 0x4a26,
+  0x3930, 0xbc61, 0x0000, 0x4350, 0xbc62, 0xbc63, 0x0000, 0x446f,
+  0x0000, 0xbc64, 0xbc65, 0xbc66, 0xbc67, 0x4c6f, 0x3839, 0x384c,
+  0xbc68, 0x5738, 0x0000, 0xbc69, 0xbc6a, 0x5739, 0xbc6b, 0x573f,
+  0xbc6c, 0x3c65, 0x0000, 0x0000, 0xbc6d, 0x4425, 0xbc6e, 0x362f,
+  0x573a, 0x0000, 0x0000, 0xbc6f, 0x492b, 0xbc70, 0x4346, 0xbc71,
+  0xbc72, 0x573b, 0x0000, 0x0000, 0xbc73, 0xbc74, 0x0000, 0xbc75,
+  0x573c, 0x0000, 0x3630, 0x0000, 0x573d, 0xbc76, 0x573e, 0x0000,
+  0xbc77, 0x5740, 0x0000, 0x4576, 0xbc78, 0x0000, 0x5741, 0x5742,
+  0xbc79, 0x5743, 0x0000, 0xbc7a, 0x5734, 0x5733, 0x0000, 0x0000,
+  0xbc7b, 0x5744, 0x3741, 0xbc7c, 0xbc7d, 0x0000, 0x4927, 0xbc7e,
+  0x0000, 0x3a4c, 0x4937, 0x4426, 0x494b, 0x5745, 0x0000, 0xbd21,
+  0x3e34, 0x3146, 0xbd22, 0x5746, 0xbd23, 0xbd24, 0x0000, 0x5747,
+  0xbd25, 0x4c72, 0xbd26, 0x0000, 0x4860, 0xbd27, 0xbd28, 0x574a,
+ // page 53 (U+5F80)
+  0x317d, 0x402c, 0x5749, 0x5748, 0x3742, 0x4254, 0x0000, 0x574e,
+  0x574c, 0xbd29, 0x574b, 0x4e27, 0x3865, 0xbd2a, 0x0000, 0xbd2b,
+  0x3d79, 0x574d, 0x454c, 0x3d3e, 0x0000, 0x0000, 0xbd2c, 0x4640,
+  0x5751, 0x5750, 0x0000, 0x0000, 0xbd2d, 0xbd2e, 0x574f, 0x0000,
+  0x5752, 0x3866, 0xbd2f, 0x0000, 0xbd32, 0x0000, 0x0000, 0xbd30,
+  0x5753, 0x497c, 0x3d5b, 0xbd31, 0xbd33, 0x5754, 0x4879, 0xbd34,
+  0xbd35, 0xbd36, 0x0000, 0x4641, 0x4427, 0x0000, 0x0000, 0x0000,
+  0xbd37, 0x4530, 0x0000, 0x0000, 0x5755, 0x352b, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3f34, 0xbd38, 0x492c, 0x0000, 0xbd39,
+  0xbd3a, 0xbd3b, 0x0000, 0xbd3c, 0x3477, 0x4726, 0x0000, 0x0000,
+  0xbd3d, 0xbd3e, 0xbd3f, 0xbd40, 0xbd41, 0x0000, 0x5756, 0x3b56,
+  0x4b3a, 0x4b3b, 0x0000, 0x0000, 0x317e, 0x575b, 0xbd42, 0x0000,
+  0x4369, 0xbd43, 0xbd44, 0x0000, 0x5758, 0x0000, 0x0000, 0x0000,
+  0xbd45, 0xbd46, 0xbd47, 0x3277, 0xbd48, 0xbd49, 0xbd4a, 0xbd4b,
+  0x582d, 0x575a, 0xbd4c, 0xbd4d, 0x0000, 0x4730, 0xbd4e, 0x0000,
+  0x5759, 0x0000, 0xbd4f, 0x5757, 0xbd50, 0x397a, 0x0000, 0x575d,
+ // page 54 (U+6000)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbd51,
+  0x0000, 0x0000, 0xbd52, 0x0000, 0x0000, 0xbd53, 0x5763, 0x5769,
+  0x5761, 0x0000, 0x455c, 0xbd54, 0xbd55, 0x5766, 0x495d, 0xbd56,
+  0xbd57, 0x5760, 0xbd58, 0x5765, 0x4e67, 0x3b57, 0x0000, 0xbd59,
+  0x4255, 0x575e, 0x0000, 0x0000, 0xbd5a, 0x355e, 0x5768, 0x402d,
+  0x3165, 0x5762, 0x3278, 0x5767, 0x0000, 0xbd5b, 0x0000, 0x3631,
+  0x0000, 0x5764, 0x0000, 0xbd5c, 0x0000, 0xbd5d, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x576a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xbd5e, 0x576c, 0x5776, 0x5774, 0x0000, 0x0000, 0x5771, 0xbd5f,
+  0xbd60, 0xbd61, 0x5770, 0x4e78, 0xbd62, 0x5772, 0x0000, 0x0000,
+  0x3632, 0xbd63, 0x3931, 0x0000, 0xbd64, 0x3d7a, 0xbd65, 0xbd66,
+  0x0000, 0x5779, 0x576b, 0x0000, 0x0000, 0xbd67, 0x0000, 0x576f,
+  0x575f, 0xbd68, 0x327a, 0x5773, 0x5775, 0x4351, 0x0000, 0xbd69,
+  0x3a28, 0x3238, 0x576d, 0x5778, 0x5777, 0x3633, 0x0000, 0x4229,
+  0x3366, 0xbd6a, 0x0000, 0x0000, 0x0000, 0x3743, 0x0000, 0x576e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbd6b, 0xbd6c,
+ // page 55 (U+6080)
+  0x0000, 0x577a, 0xbd6d, 0x577d, 0x5821, 0x0000, 0xbd6e, 0x0000,
+  0xbd6f, 0x3c3d, 0xbd70, 0x5827, 0x4470, 0x577b, 0xbd71, 0x0000,
+  0x0000, 0xbd72, 0x5825, 0xbd73, 0x3279, 0xbd74, 0x5823, 0x5824,
+  0xbd75, 0x0000, 0x577e, 0x5822, 0x0000, 0xbd76, 0xbd77, 0x3867,
+  0x4d2a, 0x0000, 0xbd78, 0x3435, 0xbd79, 0xbd7a, 0x3159, 0x5826,
+  0xbd7b, 0x473a, 0x302d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xbd7c, 0xbd7d, 0x4861, 0x575c, 0x582c, 0x5830, 0x4c65, 0xbd7e,
+  0x5829, 0x0000, 0x0000, 0xbe21, 0x4569, 0x582e, 0xbe22, 0x0000,
+  0x0000, 0x0000, 0xbe23, 0x0000, 0xbe24, 0x3e70, 0x582f, 0x4657,
+  0xbe25, 0xbe26, 0xbe27, 0xbe28, 0x0000, 0x0000, 0xbe29, 0xbe2a,
+  0x0000, 0x4f47, 0x0000, 0x582b, 0xbe2b, 0xbe2c, 0x0000, 0x0000,
+  0x5831, 0xbe2d, 0x397b, 0xbe2e, 0x404b, 0xbe2f, 0xbe30, 0x3054,
+  0x582a, 0x5828, 0xbe31, 0x415a, 0x0000, 0xbe32, 0x0000, 0x577c,
+  0x3b34, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x4246, 0x583d, 0xbe33, 0x415b, 0x5838, 0xbe34, 0x5835, 0x5836,
+  0xbe35, 0x3c66, 0x5839, 0x583c, 0xbe36, 0xbe37, 0x0000, 0x0000,
+ // page 56 (U+6100)
+  0x5837, 0x3d25, 0xbe38, 0x583a, 0x0000, 0x0000, 0x5834, 0xbe39,
+  0x4c7c, 0x4c7b, 0xbe3a, 0x0000, 0xbe3b, 0x583e, 0x583f, 0x3055,
+  0xbe3c, 0xbe3d, 0xbe3e, 0xbe3f, 0xbe40, 0x5833, 0xbe41, 0xbe42,
+  0x0000, 0xbe43, 0x3672, 0x3026, 0xbe44, 0x0000, 0xbe45, 0x3436,
+  0x0000, 0x583b, 0xbe46, 0x0000, 0x0000, 0x0000, 0x0000, 0x5843,
+  0x5842, 0x0000, 0xbe47, 0xbe48, 0x5847, 0x0000, 0x0000, 0x0000,
+  0xbe49, 0xbe4a, 0x0000, 0x0000, 0x5848, 0xbe4b, 0xbe4c, 0xbe4d,
+  0x0000, 0xbe4e, 0x0000, 0x0000, 0x5846, 0x5849, 0x5841, 0x5845,
+  0x0000, 0xbe4f, 0x584a, 0x0000, 0x584b, 0xbe50, 0xbe51, 0x5840,
+  0x3b7c, 0xbe52, 0x5844, 0x4256, 0x3932, 0x5832, 0x3f35, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x5858, 0x0000, 0x4a69, 0x0000, 0x0000,
+  0x584e, 0x584f, 0x5850, 0x0000, 0x0000, 0x5857, 0xbe53, 0x5856,
+  0xbe54, 0x0000, 0x4b7d, 0x3437, 0x0000, 0x5854, 0x0000, 0x3745,
+  0x3334, 0x0000, 0x0000, 0x5851, 0xbe55, 0x0000, 0x4e38, 0x5853,
+  0x3056, 0x5855, 0xbe56, 0x584c, 0x5852, 0x5859, 0x3744, 0x584d,
+  0xbe57, 0x0000, 0x0000, 0xbe58, 0xbe59, 0x0000, 0x4d5d, 0xbe5a,
+ // page 57 (U+6180)
+  0xbe5b, 0xbe5c, 0x4d2b, 0xbe5d, 0xbe5e, 0x0000, 0x0000, 0x585c,
+  0x0000, 0x0000, 0x5860, 0xbe5f, 0x0000, 0xbe60, 0x417e, 0x0000,
+  0x4e79, 0x5861, 0xbe61, 0xbe62, 0x585e, 0x0000, 0x585b, 0xbe63,
+  0xbe64, 0x585a, 0x585f, 0x0000, 0xbe65, 0xbe66, 0x0000, 0xbe67,
+  0xbe68, 0x0000, 0x0000, 0x0000, 0x4a30, 0xbe69, 0x0000, 0x4634,
+  0xbe6a, 0x3746, 0xbe6b, 0x5862, 0x585d, 0xbe6c, 0x5863, 0x0000,
+  0x0000, 0x0000, 0x377b, 0x0000, 0x0000, 0x0000, 0x3231, 0x0000,
+  0xbe6d, 0xbe6e, 0x586b, 0x0000, 0xbe6f, 0x0000, 0x3438, 0x0000,
+  0xbe70, 0xbe71, 0xbe72, 0x5869, 0x0000, 0x0000, 0x586a, 0x3a29,
+  0x5868, 0x5866, 0x5865, 0x586c, 0x5864, 0x586e, 0xbe73, 0xbe74,
+  0x327b, 0x0000, 0x0000, 0x0000, 0x0000, 0xbe75, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xbe76, 0xbe77, 0xbe78, 0xbe79,
+  0x0000, 0xbe7a, 0xbe7b, 0x5870, 0x0000, 0xbe7e, 0x586f, 0xbe7c,
+  0x0000, 0xbe7d, 0x0000, 0x0000, 0xbf21, 0xbf22, 0x0000, 0xbf23,
+  0x0000, 0x0000, 0x4428, 0x0000, 0x5873, 0x0000, 0x5871, 0x5867,
+  0x377c, 0x0000, 0x5872, 0x0000, 0x5876, 0x5875, 0x5877, 0x5874,
+ // page 58 (U+6200)
+  0x5878, 0xbf24, 0x0000, 0xbf25, 0xbf26, 0x0000, 0x0000, 0xbf27,
+  0x5879, 0x587a, 0x4a6a, 0x0000, 0x587c, 0x587b, 0x3d3f, 0x0000,
+  0x402e, 0x3266, 0x327c, 0xbf28, 0x587d, 0xbf29, 0x303f, 0x0000,
+  0x0000, 0x0000, 0x404c, 0x587e, 0xbf2a, 0x6c43, 0x5921, 0x3761,
+  0xbf2b, 0x5922, 0xbf2c, 0xbf2d, 0x0000, 0x0000, 0x406f, 0xbf2e,
+  0x0000, 0xbf2f, 0x5923, 0xbf30, 0x0000, 0x0000, 0x5924, 0x353a,
+  0x5925, 0x0000, 0x5926, 0x5927, 0x4257, 0x0000, 0x0000, 0x0000,
+  0x384d, 0xbf31, 0x0000, 0x4c61, 0x0000, 0xbf32, 0x0000, 0x4b3c,
+  0x3d6a, 0x5928, 0xbf33, 0xbf34, 0xbf35, 0x0000, 0xbf36, 0x4070,
+  0x6e3d, 0x4862, 0x0000, 0x3c6a, 0xbf37, 0x3a4d, 0x5929, 0x0000,
+  0xbf38, 0xbf39, 0xbf3a, 0x4247, 0xbf3b, 0x4a27, 0xbf3c, 0x0000,
+  0x4271, 0x0000, 0xbf3d, 0x592c, 0xbf3e, 0x0000, 0x592a, 0x0000,
+  0x592d, 0x0000, 0x0000, 0x592b, 0xbf3f, 0x0000, 0x0000, 0x0000,
+  0x592e, 0x0000, 0x0000, 0x0000, 0x0000, 0xbf40, 0x4a31, 0xbf41,
+  0x0000, 0x3037, 0x0000, 0xbf42, 0x0000, 0x0000, 0x495e, 0x0000,
+  0x0000, 0x4863, 0xbf43, 0x0000, 0x592f, 0xbf44, 0x5932, 0x3e35,
+ // page 59 (U+6280)
+  0x353b, 0x0000, 0x5930, 0x5937, 0x3e36, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5931, 0x4744, 0x0000, 0x0000, 0xbf45, 0xbf46, 0xbf47,
+  0xbf48, 0x4d5e, 0x5933, 0x5934, 0x5938, 0x456a, 0x5935, 0x3933,
+  0x405e, 0x0000, 0x0000, 0x5946, 0x4834, 0x0000, 0x4272, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbf49, 0x0000,
+  0xbf4a, 0x0000, 0x0000, 0x4864, 0x5a2d, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x4a7a, 0x0000, 0xbf4b, 0x0000, 0x4471, 0xbf4c, 0xbf4d,
+  0x0000, 0x4b75, 0xbf4e, 0x593b, 0x3221, 0x436a, 0xbf4f, 0xbf50,
+  0x0000, 0x0000, 0x5944, 0x0000, 0xbf51, 0x4334, 0x593e, 0x5945,
+  0x5940, 0x5947, 0x5943, 0x0000, 0x5942, 0x476f, 0xbf52, 0x593c,
+  0x327d, 0x593a, 0x3571, 0x4273, 0x5936, 0xbf53, 0xbf54, 0x5939,
+  0x3934, 0x405b, 0xbf55, 0x3e37, 0x5941, 0x4752, 0x0000, 0x0000,
+  0x3572, 0x3348, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xbf56, 0x0000, 0x3367, 0x3f21, 0x5949, 0x594e,
+  0x0000, 0x594a, 0xbf57, 0x377d, 0xbf58, 0x594f, 0x3b22, 0x3969,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xbf59, 0xbf5a, 0x3d26, 0x593d,
+ // page 60 (U+6300)
+  0x0000, 0x3b7d, 0x594c, 0xbf5b, 0xbf5c, 0x0000, 0x0000, 0x3b58,
+  0x594d, 0x3044, 0xbf5d, 0xbf5e, 0x5948, 0xbf5f, 0x0000, 0x0000,
+  0xbf60, 0x4429, 0x0000, 0xbf61, 0x0000, 0x0000, 0xbf62, 0x0000,
+  0xbf63, 0x3573, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3634,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x594b,
+  0x3027, 0xbf64, 0xbf65, 0x3a43, 0x0000, 0xbf66, 0x0000, 0x3f36,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbf67, 0xbf68, 0x0000,
+  0x0000, 0xbf69, 0x4472, 0x0000, 0xbf6a, 0x4854, 0x5951, 0x415e,
+  0x0000, 0xbf6b, 0xbf6c, 0xbf6d, 0xbf6e, 0x0000, 0xbf6f, 0x0000,
+  0x0000, 0x422a, 0xbf70, 0xbf71, 0x3b2b, 0x5952, 0xbf72, 0x5954,
+  0x5950, 0x0000, 0xbf73, 0xbf74, 0xbf75, 0x4a61, 0x0000, 0x443d,
+  0xbf76, 0x0000, 0x0000, 0xbf77, 0x415c, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbf78, 0xbf79, 0x4a7b,
+  0x3c4e, 0x5960, 0x0000, 0x595f, 0xbf7a, 0xbf7b, 0x3f78, 0x0000,
+  0x0000, 0xbf7c, 0x377e, 0x0000, 0xbf7d, 0xbf7e, 0x5959, 0x3e39,
+  0xc021, 0x0000, 0x4668, 0x4731, 0xc022, 0xc023, 0x0000, 0xc024,
+ // page 61 (U+6380)
+  0x5957, 0x0000, 0xc025, 0x415d, 0xc026, 0x0000, 0x0000, 0xc027,
+  0x3c78, 0x595c, 0xc028, 0x0000, 0x3e38, 0x0000, 0x5956, 0x595b,
+  0xc029, 0x0000, 0x4753, 0x0000, 0xc02a, 0xc02b, 0x5955, 0x0000,
+  0x3721, 0xc02c, 0xc02d, 0x335d, 0x0000, 0x0000, 0xc02e, 0x595d,
+  0x4e2b, 0x3a4e, 0x4335, 0x595a, 0xc02f, 0x405c, 0xc030, 0x3935,
+  0x3f64, 0x3166, 0x413c, 0x5958, 0x3545, 0xc031, 0xc032, 0xc033,
+  0x0000, 0x0000, 0x3747, 0x0000, 0x444f, 0x595e, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x415f, 0x0000, 0xc034, 0x5961, 0x0000,
+  0x5963, 0xc035, 0x0000, 0x4237, 0x5969, 0xc036, 0x5964, 0x0000,
+  0xc037, 0x5966, 0x0000, 0x0000, 0x0000, 0x0000, 0xc038, 0x4941,
+  0x4473, 0xc039, 0x5967, 0xc03a, 0xc03b, 0xc03c, 0x4d2c, 0x0000,
+  0x0000, 0x0000, 0x4d48, 0x3439, 0xc03d, 0x0000, 0x0000, 0x0000,
+  0xc03e, 0x302e, 0x0000, 0x5965, 0x0000, 0xc03f, 0x0000, 0x0000,
+  0x0000, 0x5962, 0xc040, 0x0000, 0xc041, 0x0000, 0x3478, 0x0000,
+  0x0000, 0x0000, 0xc042, 0xc043, 0x3167, 0xc044, 0x5968, 0x0000,
+  0xc045, 0xc046, 0x4d49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 62 (U+6400)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x596c, 0x0000,
+  0x0000, 0xc047, 0xc048, 0x0000, 0x0000, 0x423b, 0x0000, 0x5973,
+  0xc049, 0x0000, 0xc04a, 0x596d, 0xc04b, 0x0000, 0x596a, 0x5971,
+  0xc04c, 0x0000, 0x0000, 0x0000, 0x5953, 0x0000, 0xc04d, 0x0000,
+  0xc04e, 0x0000, 0xc04f, 0x0000, 0xc050, 0xc051, 0x596e, 0x0000,
+  0x5972, 0xc052, 0xc053, 0x0000, 0x4842, 0x456b, 0x0000, 0xc054,
+  0xc055, 0x0000, 0x0000, 0x0000, 0x596b, 0xc056, 0x596f, 0x0000,
+  0x0000, 0x0000, 0x3748, 0x0000, 0x0000, 0xc057, 0x3a71, 0xc058,
+  0x0000, 0x0000, 0x405d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xc059, 0x0000, 0x0000, 0x5977, 0xc05a,
+  0x0000, 0xc05b, 0xc05c, 0xc05d, 0xc05e, 0x0000, 0x0000, 0x0000,
+  0x4526, 0x0000, 0xc05f, 0xc060, 0xc061, 0xc062, 0x0000, 0xc063,
+  0xc064, 0xc065, 0x0000, 0xc066, 0x0000, 0x0000, 0x0000, 0x5974,
+  0x0000, 0x4b60, 0x0000, 0x0000, 0x0000, 0xc067, 0x0000, 0x5975,
+  0x0000, 0x0000, 0x0000, 0xc068, 0xc069, 0x0000, 0x5976, 0x0000,
+  0x4c4e, 0x0000, 0x4022, 0xc06a, 0x0000, 0xc06b, 0x0000, 0x0000,
+ // page 63 (U+6480)
+  0x0000, 0x0000, 0x0000, 0x3762, 0x0000, 0xc06c, 0x0000, 0xc06d,
+  0x597d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc06e,
+  0xc06f, 0xc070, 0x3b35, 0x597a, 0x0000, 0x5979, 0x0000, 0x0000,
+  0xc071, 0xc072, 0x4732, 0xc073, 0x0000, 0xc074, 0x4635, 0xc075,
+  0x0000, 0xc076, 0x0000, 0xc077, 0x4531, 0x597b, 0xc078, 0x0000,
+  0xc079, 0x597c, 0x0000, 0x496f, 0xc07a, 0x4745, 0x3b23, 0x0000,
+  0x4071, 0x0000, 0x4b50, 0xc07b, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3349, 0x0000, 0x5a25, 0x597e, 0xc07c, 0xc07d, 0xc07e,
+  0x0000, 0x4d4a, 0x5a27, 0x0000, 0xc121, 0x5a23, 0x0000, 0x5a24,
+  0x0000, 0xc122, 0xc123, 0xc124, 0xc125, 0x4160, 0xc126, 0x0000,
+  0xc127, 0xc128, 0x5a22, 0x0000, 0x593f, 0xc129, 0x0000, 0xc12a,
+  0x5a26, 0x0000, 0x5a21, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5a2b, 0x5a2c, 0x4527, 0x5a2e, 0xc12b, 0xc12c, 0x3b24, 0x5a29,
+  0x0000, 0xc12d, 0xc12e, 0x0000, 0x353c, 0xc12f, 0x0000, 0x5a2f,
+  0xc130, 0x5a28, 0x5a33, 0x0000, 0x5a32, 0xc131, 0x5a31, 0xc132,
+  0x0000, 0x0000, 0x5a34, 0xc133, 0x0000, 0x5a36, 0x3e71, 0xc134,
+ // page 64 (U+6500)
+  0x5a35, 0xc135, 0x0000, 0x0000, 0xc136, 0x5a39, 0x0000, 0x0000,
+  0xc137, 0xc138, 0xc139, 0x0000, 0x0000, 0x0000, 0x0000, 0xc13a,
+  0x0000, 0x0000, 0x0000, 0xc13b, 0xc13c, 0x0000, 0xc13d, 0x0000,
+  0x5a37, 0xc13e, 0x0000, 0xc13f, 0x5a38, 0x5970, 0xc140, 0xc141,
+  0x0000, 0x0000, 0xc142, 0x5a3b, 0x5a3a, 0x0000, 0xc143, 0x0000,
+  0x0000, 0xc144, 0x5978, 0x5a3c, 0x5a30, 0x0000, 0xc145, 0x3b59,
+  0x0000, 0xc146, 0x0000, 0x0000, 0x5a3d, 0x5a3e, 0x5a40, 0x5a3f,
+  0x5a41, 0x327e, 0xc147, 0x3936, 0xc148, 0xc149, 0x4a7c, 0x402f,
+  0x0000, 0x0000, 0x0000, 0xc14a, 0x0000, 0x384e, 0x0000, 0xc14b,
+  0x5a43, 0xc14c, 0x0000, 0x0000, 0x0000, 0x5a46, 0x0000, 0x4952,
+  0xc14d, 0x355f, 0xc14e, 0x0000, 0xc14f, 0x5a45, 0x5a44, 0x4754,
+  0x5a47, 0x3635, 0x0000, 0x0000, 0x0000, 0x5a49, 0x5a48, 0xc150,
+  0xc151, 0x0000, 0x343a, 0x3b36, 0x0000, 0x0000, 0x4658, 0xc152,
+  0x0000, 0x0000, 0x0000, 0xc153, 0x3749, 0x0000, 0x0000, 0x0000,
+  0x3f74, 0x0000, 0x5a4a, 0x0000, 0x4030, 0x4528, 0x0000, 0x495f,
+  0x5a4b, 0x0000, 0xc154, 0x0000, 0x0000, 0xc155, 0x0000, 0x0000,
+ // page 65 (U+6580)
+  0x0000, 0xc156, 0x5a4c, 0x5a4d, 0x0000, 0xc157, 0x0000, 0x4a38,
+  0x555d, 0x4046, 0xc158, 0x0000, 0x494c, 0x0000, 0x3a58, 0x0000,
+  0x4865, 0x4843, 0xc159, 0x0000, 0x0000, 0xc15a, 0x0000, 0x454d,
+  0xc15b, 0x4e41, 0x0000, 0x5a4f, 0x3c50, 0xc15c, 0x0000, 0x5a50,
+  0xc15d, 0x3036, 0x0000, 0xc15e, 0x3654, 0x404d, 0xc15f, 0x4960,
+  0x0000, 0x0000, 0x0000, 0x5a51, 0x3b42, 0x4347, 0xc160, 0x3b5b,
+  0x3f37, 0x0000, 0xc161, 0xc162, 0xc163, 0x0000, 0x0000, 0x5a52,
+  0x0000, 0x4a7d, 0x0000, 0x0000, 0x3177, 0x3b5c, 0x0000, 0xc164,
+  0x0000, 0x5a55, 0xc165, 0x5a53, 0x5a56, 0x4e39, 0x5a54, 0x0000,
+  0xc166, 0xc167, 0x0000, 0x407b, 0x5a57, 0x0000, 0xc168, 0x4232,
+  0xc169, 0x0000, 0x5a58, 0x0000, 0xc16a, 0x0000, 0xc16b, 0x347a,
+  0xc16c, 0x5a5a, 0x0000, 0x5a59, 0x0000, 0x0000, 0x0000, 0xc16d,
+  0x5a5b, 0x5a5c, 0x347b, 0x0000, 0x0000, 0x467c, 0x4336, 0x356c,
+  0x3b5d, 0x4161, 0x0000, 0x0000, 0x3d5c, 0x3030, 0x0000, 0x0000,
+  0xc16e, 0x5a5d, 0xc16f, 0x0000, 0xc170, 0xc171, 0x0000, 0x0000,
+  0x0000, 0xc172, 0x3222, 0x5a61, 0x0000, 0x0000, 0xc173, 0xc174,
+ // page 66 (U+6600)
+  0xc175, 0x0000, 0x3937, 0x5a60, 0xc176, 0x0000, 0x3a2b, 0x3e3a,
+  0xc177, 0xc178, 0x5a5f, 0x0000, 0x3e3b, 0xc179, 0x4c40, 0x3a2a,
+  0x0000, 0xc17a, 0xc17b, 0x3057, 0x404e, 0xc17c, 0xc17d, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x5a66, 0xc17e, 0xc221, 0x4031,
+  0x3147, 0xc222, 0xc223, 0xc224, 0xc225, 0x3d55, 0xc226, 0x4b66,
+  0x3a72, 0xc227, 0xc228, 0xc229, 0xc22a, 0x3e3c, 0xc22b, 0x4027,
+  0xc22c, 0xc22d, 0x0000, 0xc22e, 0x5a65, 0x5a63, 0x5a64, 0xc230,
+  0x0000, 0xc22f, 0x0000, 0x0000, 0x436b, 0x0000, 0x0000, 0x5b26,
+  0xc231, 0x5a6a, 0x3b7e, 0x3938, 0x5a68, 0xc232, 0xc233, 0x0000,
+  0x0000, 0x5a69, 0xc234, 0x3f38, 0xc235, 0x0000, 0xc237, 0x5a67,
+  0x0000, 0xc236, 0x3b2f, 0x0000, 0x0000, 0x0000, 0x0000, 0xc238,
+  0xc239, 0xc23a, 0x0000, 0xc23b, 0xc23c, 0x5a6c, 0x5a6b, 0x5a70,
+  0xc23d, 0xc23e, 0x5a71, 0x0000, 0x5a6d, 0x0000, 0x3322, 0x5a6e,
+  0x5a6f, 0x4855, 0xc240, 0xc241, 0xc242, 0x0000, 0x4961, 0x374a,
+  0x5a72, 0x0000, 0x0000, 0xc244, 0x4032, 0xc245, 0x3e3d, 0xc247,
+  0xc248, 0xc249, 0x4352, 0xc24a, 0xc24c, 0x0000, 0xc243, 0xc246,
+ // page 67 (U+6680)
+  0xc24b, 0x3647, 0x0000, 0x5a73, 0x5a77, 0x0000, 0x0000, 0x324b,
+  0x5a74, 0x5a76, 0x0000, 0xc24d, 0xc24e, 0xc24f, 0x5a75, 0x0000,
+  0xc250, 0x3d6b, 0xc251, 0x0000, 0x0000, 0x0000, 0x4348, 0x3045,
+  0x5a78, 0xc252, 0xc253, 0xc254, 0xc255, 0x5a79, 0x0000, 0xc256,
+  0xc257, 0x0000, 0x442a, 0x0000, 0xc258, 0x0000, 0x4e71, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3b43, 0x0000, 0xc259, 0x4a6b, 0x0000,
+  0x0000, 0xc25a, 0xc25b, 0x0000, 0x4b3d, 0xc25c, 0x0000, 0x0000,
+  0x5b22, 0x5a7b, 0x0000, 0xc25d, 0x5a7e, 0x0000, 0x5a7d, 0xc25e,
+  0xc25f, 0x5a7a, 0xc260, 0xc261, 0x5b21, 0x0000, 0x0000, 0x465e,
+  0xc262, 0x5a7c, 0x0000, 0x0000, 0xc263, 0x0000, 0xc264, 0xc265,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xc266, 0x0000, 0x5b23, 0x0000,
+  0x0000, 0x3d6c, 0x5b24, 0xc267, 0x4d4b, 0x4778, 0x0000, 0xc268,
+  0x5b25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5b27, 0x0000,
+  0xc269, 0x5b28, 0x0000, 0xc26a, 0xc26b, 0x0000, 0xc26c, 0x0000,
+  0x5b29, 0x0000, 0x364a, 0x3148, 0x3939, 0x5b2a, 0x0000, 0x5b2b,
+  0x3d71, 0x4162, 0xc26d, 0xc23f, 0x5258, 0x413e, 0x413d, 0x4258,
+ // page 68 (U+6700)
+  0x3a47, 0x0000, 0x0000, 0x5072, 0x0000, 0xc26e, 0x0000, 0xc26f,
+  0x376e, 0x4d2d, 0x0000, 0x4a7e, 0x0000, 0x497e, 0xc270, 0x5b2c,
+  0x0000, 0x0000, 0x0000, 0xc271, 0x3a73, 0x443f, 0x5b2d, 0x4f2f,
+  0x0000, 0xc272, 0x0000, 0x4b3e, 0xc273, 0x442b, 0x5b2e, 0x347c,
+  0xc274, 0x0000, 0xc275, 0x0000, 0x0000, 0x0000, 0x5b2f, 0x5b30,
+  0x4c5a, 0x0000, 0x4c24, 0x4b76, 0x4b5c, 0x3b25, 0x5b32, 0x0000,
+  0x0000, 0x3c6b, 0x0000, 0xc276, 0x4b51, 0x0000, 0x5b34, 0x5b37,
+  0x5b36, 0x0000, 0x3479, 0x0000, 0x0000, 0x3560, 0xc277, 0x5b33,
+  0x0000, 0x5b35, 0x0000, 0x0000, 0x0000, 0xc278, 0x5b38, 0xc279,
+  0xc27a, 0x3f79, 0x0000, 0x0000, 0xc27b, 0x0000, 0x4d7b, 0x3049,
+  0x3a60, 0x423c, 0x0000, 0x3c5d, 0xc27c, 0xc27d, 0x3e73, 0x0000,
+  0x0000, 0x5b3b, 0x0000, 0x0000, 0x454e, 0xc27e, 0x5b39, 0x422b,
+  0x5b3a, 0x3e72, 0x4c5d, 0x5b3c, 0x5b3d, 0x4d68, 0xc321, 0x0000,
+  0x0000, 0x0000, 0x5b42, 0x0000, 0xc322, 0x393a, 0xc323, 0x4755,
+  0x5b3f, 0x456c, 0x5a5e, 0x5a62, 0xc324, 0x354f, 0xc325, 0x4747,
+  0x0000, 0x0000, 0x0000, 0xc326, 0x5b41, 0x0000, 0x3e3e, 0x4844,
+ // page 69 (U+6780)
+  0x0000, 0xc327, 0x0000, 0x0000, 0xc328, 0x5b47, 0x0000, 0x487a,
+  0x0000, 0x5b3e, 0x0000, 0x5b44, 0x5b43, 0x0000, 0xc329, 0xc32a,
+  0x404f, 0xc32b, 0x0000, 0xc32c, 0x0000, 0x4b6d, 0xc32d, 0x4e53,
+  0xc32e, 0xc32f, 0x4b67, 0xc330, 0x324c, 0x3b5e, 0x0000, 0x0000,
+  0x4f48, 0x5b46, 0x3f75, 0x0000, 0x0000, 0x0000, 0x5b45, 0x0000,
+  0x0000, 0x5b40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x384f,
+  0xc331, 0xc332, 0xc333, 0x5b4c, 0x5b4a, 0xc334, 0x324d, 0x5b48,
+  0x5b4e, 0x5b54, 0x0000, 0xc335, 0xc336, 0xc337, 0x0000, 0x0000,
+  0xc339, 0x4248, 0xc33a, 0xc33b, 0x4a41, 0xc33c, 0x5b56, 0x0000,
+  0xc33d, 0xc33e, 0x4922, 0x0000, 0x0000, 0x0000, 0x5b55, 0x4770,
+  0x4b3f, 0x343b, 0xc33f, 0x4077, 0x3d40, 0x0000, 0x0000, 0xc340,
+  0x4453, 0xc341, 0x4d2e, 0x0000, 0xc342, 0x5b51, 0x5b50, 0x0000,
+  0x0000, 0xc343, 0x5b52, 0x0000, 0x5b4f, 0x0000, 0xc344, 0x5b57,
+  0x0000, 0x5b4d, 0x0000, 0x0000, 0x5b4b, 0x0000, 0x5b53, 0x5b49,
+  0xc345, 0x436c, 0xc346, 0x4c78, 0x3c46, 0x3a74, 0xc347, 0xc348,
+  0x0000, 0xc338, 0x0000, 0x3a3a, 0x0000, 0x0000, 0x4b6f, 0x3341,
+ // page 70 (U+6800)
+  0x0000, 0x0000, 0x444e, 0x464a, 0x3149, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4072, 0xc34a, 0x0000, 0x4034, 0x372a,
+  0x0000, 0xc34b, 0x0000, 0x0000, 0x0000, 0xc34c, 0x5b59, 0xc34d,
+  0x0000, 0x393b, 0x337c, 0x0000, 0x0000, 0x0000, 0x0000, 0xc34f,
+  0xc34e, 0x5b5b, 0x3374, 0x5b61, 0xc350, 0xc351, 0x0000, 0xc352,
+  0xc353, 0xc354, 0x5b5e, 0xc355, 0x4073, 0x0000, 0x0000, 0x0000,
+  0x334b, 0x3a2c, 0x0000, 0xc356, 0x334a, 0x3a4f, 0x0000, 0xc357,
+  0x5b5c, 0x3765, 0x374b, 0x456d, 0xc358, 0xc359, 0x5b5a, 0x0000,
+  0x3046, 0x0000, 0xc35a, 0x0000, 0xc35b, 0x5b5d, 0x5b5f, 0x0000,
+  0x364d, 0x372c, 0xc349, 0x343c, 0x354b, 0xc35c, 0x0000, 0xc35d,
+  0xc35e, 0x5b62, 0x0000, 0xc35f, 0x3a79, 0x4b71, 0x0000, 0x3b37,
+  0x0000, 0x0000, 0x0000, 0x5b63, 0x0000, 0x0000, 0x0000, 0x4930,
+  0x0000, 0x0000, 0x0000, 0xc360, 0x0000, 0x0000, 0xc361, 0xc362,
+  0xc363, 0xc364, 0xc365, 0x0000, 0x5b6f, 0xc366, 0x3233, 0x5b64,
+  0x0000, 0xc367, 0xc368, 0xc369, 0xc36a, 0x0000, 0x5b75, 0x5b65,
+ // page 71 (U+6880)
+  0x0000, 0x4e42, 0xc36b, 0x5b6c, 0xc36c, 0x475f, 0xc36d, 0x0000,
+  0xc36e, 0x0000, 0x0000, 0x0000, 0x0000, 0x5b74, 0x0000, 0x5b67,
+  0x0000, 0x0000, 0x0000, 0x3034, 0x5b69, 0x0000, 0xc36f, 0x393c,
+  0xc370, 0x0000, 0xc371, 0x5b6b, 0xc372, 0x5b6a, 0x0000, 0x5b66,
+  0x5b71, 0xc373, 0x3e3f, 0xc374, 0x0000, 0xc375, 0x546d, 0x3868,
+  0x4d7c, 0xc376, 0xc377, 0x0000, 0x0000, 0x5b68, 0xc378, 0x4474,
+  0x3323, 0x3a2d, 0xc379, 0x5b60, 0x0000, 0x5b70, 0x3361, 0x0000,
+  0x0000, 0x5b6e, 0x5b72, 0xc37a, 0x456e, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x347e, 0xc37b, 0x5c32, 0x0000,
+  0xc37c, 0x4c49, 0x5b77, 0x347d, 0xc37d, 0x5b7e, 0x0000, 0xc37e,
+  0xc421, 0xc422, 0x4b40, 0xc423, 0x5c21, 0x5c23, 0xc424, 0x5c27,
+  0x5b79, 0xc425, 0x432a, 0x0000, 0xc426, 0xc427, 0x0000, 0x456f,
+  0x5c2b, 0x5b7c, 0x0000, 0x5c28, 0x0000, 0xc428, 0x0000, 0x5c22,
+  0xc429, 0x0000, 0xc42a, 0xc42b, 0xc42c, 0xc42d, 0x3f39, 0x5c2c,
+  0xc42e, 0xc42f, 0x4033, 0x0000, 0x0000, 0xc430, 0xc431, 0x0000,
+  0x0000, 0x5c2a, 0x343d, 0xc432, 0xc433, 0xc434, 0x0000, 0x0000,
+ // page 72 (U+6900)
+  0x4f50, 0x5b76, 0x0000, 0x0000, 0x5c26, 0x3058, 0xc435, 0x0000,
+  0x5b78, 0xc436, 0xc437, 0x4c3a, 0x5b7d, 0x3f22, 0x4447, 0x5b73,
+  0xc438, 0xc439, 0x5c25, 0xc43a, 0x0000, 0x0000, 0xc43b, 0xc43c,
+  0x0000, 0x3f7a, 0x5c2f, 0x3371, 0x3821, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5c31, 0x5b7a, 0x5c30, 0x0000, 0x5c29, 0x5b7b, 0x0000,
+  0x5c2d, 0x0000, 0x5c2e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5c3f, 0xc43d, 0x0000, 0xc43e, 0x464e, 0xc43f, 0x5c24, 0x0000,
+  0xc440, 0x5c3b, 0x0000, 0xc441, 0x0000, 0x5c3d, 0x0000, 0x4458,
+  0x0000, 0x0000, 0xc442, 0x0000, 0x0000, 0xc443, 0x0000, 0x0000,
+  0x0000, 0xc444, 0x4d4c, 0x0000, 0x0000, 0x0000, 0xc445, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4976, 0x5c38, 0x424a, 0x0000, 0xc446,
+  0x0000, 0x5c3e, 0x413f, 0xc447, 0x5c35, 0x5c42, 0x5c41, 0x0000,
+  0x466f, 0x5c40, 0x466a, 0xc448, 0xc449, 0xc44a, 0xc44b, 0x0000,
+  0xc44c, 0xc44d, 0x5c44, 0x5c37, 0xc44e, 0x3648, 0x5c3a, 0x3d5d,
+  0xc44f, 0xc450, 0xc451, 0x4760, 0x5c3c, 0x364b, 0x0000, 0x5c34,
+  0x5c36, 0x5c33, 0xc452, 0xc453, 0x4f30, 0x335a, 0x5c39, 0xc454,
+ // page 73 (U+6980)
+  0xc455, 0x5c43, 0x3335, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3a67, 0x0000, 0x0000, 0xc456, 0x315d, 0x0000,
+  0x0000, 0x5c54, 0xc457, 0x0000, 0x4f31, 0x5c57, 0xc458, 0x0000,
+  0xc459, 0x0000, 0x0000, 0x3f3a, 0x5c56, 0x0000, 0x0000, 0x0000,
+  0x5c55, 0xc45a, 0x0000, 0x0000, 0x0000, 0xc45b, 0xc45c, 0x5c52,
+  0xc45d, 0x0000, 0x0000, 0xc45e, 0x0000, 0xc45f, 0x5c46, 0xc460,
+  0x0000, 0x5c63, 0x5c45, 0x0000, 0x5c58, 0x0000, 0x0000, 0xc461,
+  0xc462, 0x0000, 0xc463, 0x5c50, 0xc464, 0x0000, 0x5c4b, 0x5c48,
+  0x0000, 0x5c49, 0x0000, 0x5c51, 0x0000, 0xc465, 0x0000, 0x7422,
+  0xc466, 0x0000, 0x5c4e, 0x393d, 0x4448, 0x4164, 0x5c4c, 0x0000,
+  0x5c47, 0xc467, 0x0000, 0x5c4a, 0x0000, 0x0000, 0xc468, 0xc469,
+  0x4d4d, 0x4b6a, 0x0000, 0x0000, 0x0000, 0x5c4f, 0x5c59, 0x0000,
+  0x0000, 0x0000, 0xc46a, 0x0000, 0x0000, 0xc46b, 0x0000, 0x5c61,
+  0x5c5a, 0x0000, 0x0000, 0x5c67, 0x0000, 0x5c65, 0xc46c, 0xc46d,
+  0x0000, 0xc46e, 0x5c60, 0xc46f, 0x0000, 0xc470, 0x0000, 0x0000,
+  0x0000, 0x5c5f, 0x0000, 0x4450, 0x0000, 0x4165, 0xc471, 0x5c5d,
+ // page 74 (U+6A00)
+  0xc472, 0xc473, 0x5c5b, 0xc474, 0x0000, 0x5c62, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x5c68, 0x4875, 0x5c6e, 0x0000, 0x0000, 0xc475,
+  0x0000, 0xc476, 0x5c69, 0x5c6c, 0x5c66, 0xc477, 0x0000, 0x4374,
+  0x0000, 0x4938, 0xc478, 0x5c5c, 0x0000, 0xc479, 0x5c64, 0x3e40,
+  0xc47a, 0x4c4f, 0x5c78, 0x5c6b, 0xc47b, 0x0000, 0x0000, 0x0000,
+  0xc47c, 0x3822, 0x3223, 0x335f, 0x0000, 0x0000, 0x5c53, 0x0000,
+  0xc47d, 0x0000, 0xc47e, 0x0000, 0xc521, 0x3e41, 0x5c70, 0xc522,
+  0x5c77, 0x3c79, 0x3372, 0xc523, 0x0000, 0x432e, 0xc524, 0xc525,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x5c6d, 0xc526, 0xc527, 0x5c72,
+  0x5c76, 0xc528, 0xc529, 0x3636, 0x0000, 0x0000, 0xc52a, 0x0000,
+  0xc52b, 0xc52c, 0xc52d, 0x0000, 0x0000, 0xc52e, 0xc52f, 0x0000,
+  0x354c, 0x5c74, 0x0000, 0xc530, 0x0000, 0x0000, 0x0000, 0x3521,
+  0x0000, 0x464b, 0x5c73, 0x0000, 0xc531, 0x0000, 0x5c75, 0xc532,
+  0x0000, 0x0000, 0xc533, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xc534, 0x5c6f, 0xc535, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5c71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc536, 0x3360,
+ // page 75 (U+6A80)
+  0x4349, 0xc537, 0x0000, 0xc538, 0x5c7c, 0x0000, 0xc539, 0xc53a,
+  0x0000, 0xc53b, 0x0000, 0xc53c, 0x0000, 0x5c7a, 0x3869, 0x0000,
+  0x5c79, 0xc53d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5d21,
+  0x0000, 0x0000, 0x0000, 0xc53e, 0x5b58, 0xc53f, 0xc540, 0xc541,
+  0x5c7b, 0x0000, 0x5c7d, 0x5c7e, 0x0000, 0xc542, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x5d2c, 0xc543, 0x5d28, 0x0000, 0x5b6d, 0xc544,
+  0xc545, 0xc546, 0x0000, 0x5d27, 0xc547, 0x0000, 0x0000, 0x0000,
+  0x5d26, 0x0000, 0x0000, 0x5d23, 0x0000, 0xc548, 0xc549, 0xc54a,
+  0x0000, 0x5c6a, 0x5d25, 0x5d24, 0x0000, 0x0000, 0xc54b, 0x0000,
+  0xc54d, 0xc54c, 0x0000, 0x0000, 0xc54e, 0x0000, 0x0000, 0x0000,
+  0xc54f, 0x5d2a, 0x0000, 0x4f26, 0xc550, 0xc551, 0xc552, 0x0000,
+  0x0000, 0x0000, 0x5d2d, 0x367b, 0xc553, 0xc554, 0x5d29, 0x5d2b,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xc555, 0x0000, 0x0000, 0xc556,
+  0x4827, 0x0000, 0x5d2e, 0x0000, 0xc557, 0x0000, 0x0000, 0x0000,
+  0xc558, 0xc559, 0xc55a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x5d32, 0x5d2f, 0xc55b, 0xc55c, 0x0000, 0x0000,
+ // page 76 (U+6B00)
+  0x0000, 0x0000, 0xc55d, 0xc55e, 0x4d73, 0x5d30, 0xc55f, 0xc560,
+  0x0000, 0xc561, 0x5c5e, 0x0000, 0x0000, 0x0000, 0x0000, 0xc562,
+  0xc563, 0xc564, 0x5d33, 0x0000, 0x0000, 0x0000, 0x5d34, 0xc565,
+  0x0000, 0x0000, 0x0000, 0xc566, 0x0000, 0x3135, 0xc567, 0x5d36,
+  0x3767, 0x3c21, 0x0000, 0x3655, 0xc568, 0x0000, 0x0000, 0x3224,
+  0xc569, 0x0000, 0x0000, 0xc56a, 0xc56b, 0x0000, 0x0000, 0xc56c,
+  0x0000, 0x0000, 0x4d5f, 0x0000, 0x0000, 0xc56d, 0xc56e, 0x5d38,
+  0x5d37, 0x5d3a, 0x353d, 0xc56f, 0x0000, 0x3656, 0x343e, 0xc570,
+  0x0000, 0x0000, 0x0000, 0x5d3d, 0x0000, 0x0000, 0xc571, 0x5d3c,
+  0x0000, 0x5d3e, 0xc572, 0x0000, 0x324e, 0xc573, 0x4337, 0x0000,
+  0x5d3f, 0x0000, 0xc574, 0x343f, 0x5d41, 0x0000, 0xc575, 0x0000,
+  0xc576, 0x5d40, 0x0000, 0x5d42, 0x0000, 0xc577, 0x0000, 0x5d43,
+  0xc578, 0x5d44, 0x3b5f, 0x4035, 0x3a21, 0x0000, 0x4970, 0xc579,
+  0x0000, 0x4a62, 0x4f44, 0xc57a, 0x0000, 0x0000, 0xc57b, 0x3b75,
+  0xc57c, 0x0000, 0x0000, 0x3a50, 0x4e72, 0xc57d, 0x0000, 0x0000,
+  0x5d45, 0x5d46, 0x0000, 0x3b60, 0x0000, 0xc57e, 0xc621, 0x5d47,
+ // page 77 (U+6B80)
+  0x5d48, 0x0000, 0xc622, 0x5d4a, 0x5d49, 0xc623, 0x4b58, 0x0000,
+  0x0000, 0x3d5e, 0x3c6c, 0x3b44, 0x0000, 0x5d4b, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5d4d, 0x3f23, 0xc624,
+  0x5d4c, 0x0000, 0x0000, 0xc625, 0x0000, 0x0000, 0x5d4e, 0xc626,
+  0xc627, 0x0000, 0xc628, 0xc629, 0x5d4f, 0x0000, 0x0000, 0x0000,
+  0xc62a, 0xc62b, 0x5d50, 0x5d51, 0xc62c, 0xc62d, 0xc62e, 0x5d52,
+  0xc62f, 0x5d54, 0x5d53, 0x5d55, 0x3225, 0x434a, 0x0000, 0x5d56,
+  0xc630, 0xc631, 0x3b26, 0x334c, 0x5d57, 0xc632, 0xc633, 0x4542,
+  0x544c, 0x0000, 0x0000, 0xc634, 0xc635, 0x3523, 0x5d58, 0x0000,
+  0x0000, 0xc636, 0x0000, 0x5d59, 0xc637, 0x4a6c, 0x4b68, 0x0000,
+  0x0000, 0x0000, 0x4647, 0x5d5a, 0x4866, 0x0000, 0xc638, 0x0000,
+  0x487b, 0x0000, 0xc639, 0x4c53, 0x0000, 0x0000, 0x0000, 0x5d5b,
+  0x0000, 0xc63a, 0x0000, 0xc63b, 0x0000, 0x0000, 0xc63c, 0xc63d,
+  0x0000, 0x0000, 0x0000, 0x5d5d, 0x5d5c, 0x0000, 0xc63e, 0x5d5f,
+  0x0000, 0xc63f, 0x0000, 0x5d5e, 0x0000, 0x0000, 0x0000, 0xc640,
+  0x0000, 0xc641, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc642,
+ // page 78 (U+6C00)
+  0x0000, 0x0000, 0xc643, 0x0000, 0xc644, 0xc645, 0x0000, 0x0000,
+  0x5d61, 0xc646, 0x0000, 0x0000, 0x0000, 0xc647, 0xc648, 0x3b61,
+  0xc649, 0x4c31, 0xc64a, 0x5d62, 0x5d63, 0x0000, 0x0000, 0x3524,
+  0x0000, 0xc64b, 0x0000, 0x5d64, 0x0000, 0x0000, 0x0000, 0xc64c,
+  0x0000, 0x0000, 0x0000, 0x5d66, 0x5d65, 0x0000, 0xc64d, 0xc64e,
+  0xc64f, 0x0000, 0x0000, 0x0000, 0xc650, 0x0000, 0xc651, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xc652, 0x3f65, 0xc653, 0xc654, 0x4939,
+  0x314a, 0x0000, 0xc655, 0xc656, 0x0000, 0x0000, 0x4845, 0xc657,
+  0x4475, 0x3d41, 0x3561, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xc658, 0xc659, 0x0000, 0xc65a, 0x4846, 0xc65b,
+  0x3c2e, 0x0000, 0xc65c, 0x0000, 0xc65d, 0x5d68, 0x0000, 0x3440,
+  0x0000, 0xc65e, 0x3178, 0xc65f, 0xc660, 0x4672, 0x5d67, 0x393e,
+  0x4353, 0x0000, 0x5d69, 0x0000, 0x0000, 0x0000, 0x0000, 0xc736,
+  0x5d71, 0x0000, 0x5d6a, 0xc661, 0x0000, 0xc662, 0x0000, 0xc663,
+  0x4241, 0x0000, 0x3562, 0x5d72, 0xc664, 0x0000, 0xc665, 0x0000,
+  0xc666, 0xc667, 0x3768, 0xc668, 0x0000, 0x3525, 0x5d70, 0x0000,
+ // page 79 (U+6C80)
+  0x0000, 0x5d6e, 0x5d6b, 0x4d60, 0x0000, 0xc669, 0xc66a, 0xc66b,
+  0x4440, 0xc66c, 0x0000, 0x0000, 0x4659, 0x5d6c, 0x0000, 0x0000,
+  0x5d74, 0x0000, 0x5d73, 0x3723, 0xc66d, 0xc66e, 0x322d, 0xc66f,
+  0xc670, 0x3a3b, 0x5d6d, 0x5d6f, 0xc671, 0x0000, 0x0000, 0xc672,
+  0x0000, 0x4b57, 0x4274, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4b77, 0x0000, 0x0000, 0x5d7c, 0x0000,
+  0xc673, 0x5d7d, 0xc674, 0x324f, 0xc675, 0x0000, 0x0000, 0x0000,
+  0x4a28, 0x4c7d, 0x5e21, 0x3c23, 0x3e42, 0x5d78, 0x5d7e, 0x3168,
+  0x0000, 0x3637, 0xc676, 0x0000, 0x5d75, 0x5d7a, 0xc677, 0x0000,
+  0x0000, 0x4074, 0x4771, 0x0000, 0x4867, 0xc678, 0x0000, 0xc679,
+  0xc67a, 0xc67b, 0xc67c, 0x5d77, 0xc67d, 0x4b21, 0xc67e, 0x5d79,
+  0x0000, 0x5e24, 0xc721, 0x5e22, 0xc722, 0x5d7b, 0x0000, 0x0000,
+  0xc723, 0x4b22, 0x4748, 0x3563, 0x0000, 0x4525, 0x0000, 0xc724,
+  0x436d, 0xc725, 0x5e25, 0xc726, 0xc727, 0x0000, 0xc728, 0x5e23,
+  0x4259, 0x5d76, 0xc729, 0x314b, 0xc72a, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 80 (U+6D00)
+  0x0000, 0x0000, 0x0000, 0x0000, 0xc72b, 0x0000, 0x0000, 0xc72c,
+  0x0000, 0x0000, 0xc72d, 0x4d4e, 0x5e30, 0x0000, 0xc72e, 0xc72f,
+  0x0000, 0xc730, 0x5e2f, 0xc731, 0x0000, 0x0000, 0x0000, 0x4076,
+  0x0000, 0x5e2c, 0xc732, 0x4d6c, 0x0000, 0x0000, 0x4636, 0x5e26,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4445, 0xc733, 0xc734,
+  0xc735, 0x314c, 0x393f, 0x5e29, 0x0000, 0x0000, 0xc737, 0xc738,
+  0x0000, 0xc739, 0x3d27, 0x5e2e, 0x0000, 0x5e2d, 0x5e28, 0x0000,
+  0x5e2b, 0xc73a, 0x0000, 0x3368, 0xc73b, 0x5e2a, 0x4749, 0xc73c,
+  0x0000, 0x4e2e, 0x0000, 0x0000, 0x3e74, 0x4075, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc73d,
+  0x0000, 0x5e36, 0x5e34, 0x0000, 0x494d, 0x0000, 0xc73e, 0xc73f,
+  0x0000, 0xc740, 0x0000, 0x5e31, 0x5e33, 0xc741, 0x313a, 0xc742,
+  0x0000, 0x3940, 0x4f32, 0x0000, 0x333d, 0x0000, 0x4962, 0xc743,
+  0xc744, 0x0000, 0x0000, 0x0000, 0x4d61, 0x0000, 0x0000, 0x3324,
+  0x3f3b, 0x5e35, 0x0000, 0x0000, 0xc745, 0x0000, 0x0000, 0x0000,
+ // page 81 (U+6D80)
+  0x0000, 0x0000, 0xc746, 0x0000, 0x0000, 0x5e3a, 0x0000, 0xc747,
+  0x3e43, 0x0000, 0x0000, 0x0000, 0x4d30, 0x0000, 0x5e37, 0x0000,
+  0x0000, 0xc748, 0xc749, 0x5e32, 0xc74a, 0x5e38, 0xc74b, 0xc74c,
+  0xc74d, 0x4e5e, 0x0000, 0x4573, 0x4642, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xc74e, 0x0000, 0xc74f, 0x0000, 0x0000, 0x3336,
+  0x0000, 0x0000, 0x3155, 0x0000, 0xc750, 0x5e3e, 0x0000, 0xc751,
+  0x5e41, 0xc752, 0x0000, 0x0000, 0x4e43, 0xc753, 0x0000, 0xc754,
+  0x4d64, 0x0000, 0x0000, 0x0000, 0xc755, 0x5e48, 0x5e42, 0x5e3f,
+  0xc756, 0x0000, 0xc757, 0x4e54, 0x5e45, 0x0000, 0xc758, 0xc759,
+  0x0000, 0x3d4a, 0x5e47, 0x0000, 0x0000, 0x5e4c, 0xc75a, 0x0000,
+  0x4571, 0x5e4a, 0x0000, 0xc75b, 0x0000, 0xc75c, 0x5e44, 0xc75d,
+  0xc75e, 0x4338, 0xc75f, 0x0000, 0x5e4b, 0xc760, 0x5e40, 0x0000,
+  0x5e46, 0xc761, 0x5e4d, 0x307c, 0x5e43, 0x0000, 0x5e4e, 0xc762,
+  0xc763, 0x3f3c, 0x0000, 0x3d5f, 0xc764, 0x4a25, 0xc765, 0x3a2e,
+  0x0000, 0x5e3b, 0x5e49, 0x453a, 0xc766, 0x0000, 0x0000, 0x0000,
+ // page 82 (U+6E00)
+  0xc767, 0x0000, 0x0000, 0x0000, 0xc768, 0x4036, 0x0000, 0x3369,
+  0x3a51, 0x3e44, 0x5e3d, 0x3d42, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x374c, 0x0000, 0x5e3c, 0x0000, 0x0000,
+  0x0000, 0x5e52, 0x3d6d, 0x383a, 0x0000, 0x5e61, 0xc769, 0x5e5b,
+  0x3574, 0x454f, 0xc76a, 0x5e56, 0x5e5f, 0x302f, 0x3132, 0xc76b,
+  0x0000, 0x3239, 0x0000, 0x5e58, 0x422c, 0x5e4f, 0x5e51, 0x3941,
+  0x0000, 0x0000, 0xc76c, 0x0000, 0x0000, 0x0000, 0xc76d, 0x0000,
+  0x5e62, 0xc76e, 0x5e5d, 0xc76f, 0xc770, 0x0000, 0x5e55, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x5e5c, 0xc771, 0xc772, 0x0000, 0x0000,
+  0xc773, 0xc774, 0x4c2b, 0xc775, 0x0000, 0x5e5a, 0x5e5e, 0xc776,
+  0x0000, 0xc777, 0xc778, 0xc779, 0xc77a, 0x0000, 0x3850, 0xc77b,
+  0x3e45, 0x0000, 0x0000, 0x4339, 0xc77c, 0xc77d, 0xc77e, 0x5e54,
+  0x0000, 0x0000, 0xc821, 0xc822, 0x0000, 0x0000, 0x0000, 0x4d2f,
+  0xc823, 0x0000, 0x0000, 0x5e57, 0x0000, 0x0000, 0x5e50, 0x4572,
+  0x0000, 0x0000, 0x5e53, 0xc824, 0x0000, 0x0000, 0x5e59, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xc825, 0x0000, 0xc826, 0x4f51, 0x3c3e,
+ // page 83 (U+6E80)
+  0x4b7e, 0x0000, 0x5e63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x482e, 0xc827, 0x0000, 0x5e6f,
+  0x383b, 0x0000, 0x0000, 0xc828, 0x0000, 0x0000, 0x3d60, 0x0000,
+  0x5e65, 0xc829, 0x0000, 0x0000, 0x4e2f, 0x3942, 0x0000, 0x5e72,
+  0xc82a, 0x0000, 0x306e, 0x0000, 0x0000, 0x5e70, 0x0000, 0xc82b,
+  0x0000, 0x0000, 0x5e64, 0x0000, 0x0000, 0xc82c, 0xc82d, 0x5e6a,
+  0x0000, 0xc82e, 0x5e6c, 0xc82f, 0x0000, 0x0000, 0x4d4f, 0x5e67,
+  0x0000, 0x0000, 0x452e, 0xc830, 0x0000, 0x5e69, 0x0000, 0xc831,
+  0xc832, 0xc833, 0x5e71, 0xc834, 0x5e6b, 0x4c47, 0x0000, 0xc835,
+  0xc836, 0x5e66, 0xc837, 0x3c22, 0x5e7e, 0xc838, 0xc839, 0xc83a,
+  0x0000, 0x336a, 0x0000, 0x5e68, 0x5e6d, 0x5e6e, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x426c, 0x425a, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xc83b, 0x5e76, 0xc83c, 0xc83d, 0x5e7c,
+  0x0000, 0x0000, 0x5e7a, 0x0000, 0x4529, 0x0000, 0x0000, 0x5f23,
+  0x5e77, 0xc83e, 0x0000, 0xc83f, 0x0000, 0xc840, 0x5e78, 0x5e60,
+ // page 84 (U+6F00)
+  0x0000, 0x3579, 0x493a, 0x0000, 0xc841, 0x0000, 0x3c3f, 0x0000,
+  0xc842, 0x3977, 0xc843, 0x0000, 0xc844, 0xc845, 0x0000, 0x4f33,
+  0x0000, 0x5e74, 0x0000, 0x5f22, 0x3169, 0x4166, 0xc846, 0x0000,
+  0xc847, 0x0000, 0xc848, 0xc849, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x4779, 0x0000, 0x3441, 0x4e7a, 0x0000, 0x0000, 0xc84a, 0x0000,
+  0x0000, 0xc84b, 0xc84c, 0x4c21, 0x4452, 0xc853, 0x0000, 0xc84d,
+  0xc84e, 0x5e7b, 0x5e7d, 0xc84f, 0x0000, 0x0000, 0xc850, 0x0000,
+  0x4132, 0x0000, 0x0000, 0xc851, 0xc852, 0x0000, 0x5f21, 0x5e79,
+  0x0000, 0x5e73, 0x0000, 0x0000, 0x0000, 0x3443, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc854,
+  0x0000, 0xc855, 0xc856, 0xc857, 0x3769, 0x0000, 0x0000, 0xc858,
+  0x5f2f, 0xc859, 0xc85a, 0x5f2a, 0x4078, 0xc85b, 0xc85c, 0x3363,
+  0x0000, 0xc85d, 0xc85e, 0x0000, 0x3d61, 0x0000, 0x5f33, 0x0000,
+  0xc85f, 0x0000, 0x0000, 0x0000, 0xc860, 0x5f2c, 0x442c, 0x5f29,
+  0x4459, 0x0000, 0x0000, 0x0000, 0x5f4c, 0x0000, 0x0000, 0x0000,
+  0x5f26, 0x0000, 0x5f25, 0x0000, 0x5f2e, 0xc861, 0xc862, 0x0000,
+ // page 85 (U+6F80)
+  0x5f28, 0x5f27, 0x5f2d, 0xc863, 0x4021, 0x0000, 0x5f24, 0xc864,
+  0xc865, 0x0000, 0x0000, 0xc866, 0xc867, 0xc868, 0x5f30, 0x0000,
+  0xc869, 0x5f31, 0xc86a, 0xc86b, 0xc86c, 0x0000, 0xc86d, 0x3442,
+  0x0000, 0x0000, 0xc86e, 0x0000, 0x0000, 0x0000, 0x0000, 0xc86f,
+  0xc870, 0x5f36, 0x0000, 0x5f35, 0x5f37, 0xc871, 0xc872, 0xc873,
+  0xc874, 0x0000, 0x5f3a, 0x0000, 0x0000, 0x0000, 0xc875, 0xc876,
+  0xc877, 0x4543, 0x0000, 0x5f34, 0x0000, 0xc878, 0xc879, 0x0000,
+  0x0000, 0x5f38, 0x0000, 0x0000, 0xc87a, 0x0000, 0x0000, 0x0000,
+  0x3763, 0x4279, 0x5f32, 0x473b, 0x0000, 0xc87b, 0x5f39, 0xc87c,
+  0xc87d, 0x0000, 0xc87e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x5f3e, 0x5f3c, 0x0000, 0x0000,
+  0x5f3f, 0x0000, 0xc921, 0x5f42, 0x0000, 0x0000, 0xc922, 0x5f3b,
+  0x396a, 0x4728, 0x0000, 0x0000, 0x5e39, 0x0000, 0x0000, 0x0000,
+  0xc923, 0xc924, 0x0000, 0x4d74, 0x5f3d, 0x0000, 0x5f41, 0x4275,
+  0xc925, 0x5f40, 0x0000, 0x5f2b, 0x0000, 0xc926, 0x6f69, 0x0000,
+  0x0000, 0xc927, 0x5f45, 0x0000, 0xc928, 0xc929, 0x5f49, 0x0000,
+ // page 86 (U+7000)
+  0xc92a, 0x5f47, 0x0000, 0x0000, 0x0000, 0xc92b, 0xc92c, 0xc92d,
+  0x0000, 0x5f43, 0x0000, 0x5f44, 0x0000, 0xc92e, 0x0000, 0x5f48,
+  0x0000, 0x5f46, 0x0000, 0x0000, 0x0000, 0x494e, 0x0000, 0xc92f,
+  0x5f4e, 0x0000, 0x5f4b, 0x5f4a, 0x0000, 0x5f4d, 0x4654, 0x5f4f,
+  0xc930, 0x0000, 0x0000, 0xc931, 0x0000, 0x0000, 0x4375, 0x426d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4025, 0x0000, 0x0000, 0xc932,
+  0x5f50, 0x0000, 0x5f52, 0x0000, 0xc933, 0x0000, 0x0000, 0xc934,
+  0x0000, 0xc935, 0x0000, 0x0000, 0xc936, 0x0000, 0x5f51, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xc937, 0xc938, 0x0000, 0x0000, 0x0000,
+  0xc939, 0xc93a, 0xc93b, 0xc93c, 0x5e75, 0x0000, 0xc941, 0x0000,
+  0x0000, 0x5f53, 0x0000, 0x0000, 0xc93d, 0xc93e, 0x0000, 0x0000,
+  0x4667, 0x0000, 0x0000, 0x0000, 0x0000, 0xc93f, 0xc940, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x5f54, 0xc942, 0xc943, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3250, 0xc944, 0x0000, 0xc945, 0x4574,
+  0x3325, 0x0000, 0x0000, 0x0000, 0x0000, 0xc946, 0xc947, 0x0000,
+  0x3564, 0x0000, 0x0000, 0x0000, 0x3c5e, 0x3a52, 0xc948, 0x0000,
+ // page 87 (U+7080)
+  0x0000, 0xc949, 0x0000, 0x0000, 0x0000, 0xc94a, 0xc94b, 0x0000,
+  0x0000, 0x4f27, 0x3f66, 0x0000, 0x0000, 0x0000, 0x316a, 0x0000,
+  0x0000, 0x0000, 0x5f56, 0x0000, 0xc94c, 0xc94d, 0xc94e, 0xc94f,
+  0xc950, 0x5f55, 0x0000, 0xc951, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xc952, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xc953, 0x5f59, 0x433a, 0x5f5c, 0x5f57,
+  0xc954, 0xc955, 0x0000, 0x5f5b, 0xc956, 0x0000, 0x0000, 0xc957,
+  0x5f5a, 0x4540, 0x3059, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x4e75, 0x0000, 0xc958, 0x5f5e, 0x0000, 0x0000, 0x0000, 0x3128,
+  0x0000, 0xc959, 0x0000, 0xc95a, 0xc95b, 0xc95c, 0xc95d, 0x0000,
+  0xc95e, 0x5f60, 0x0000, 0x0000, 0xc95f, 0x5f5f, 0x0000, 0x5f5d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xc960, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5f58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x4b23, 0xc961, 0x0000, 0x0000, 0x5f62, 0x0000, 0x0000,
+ // page 88 (U+7100)
+  0x0000, 0x0000, 0x0000, 0xc962, 0xc963, 0xc964, 0xc965, 0xc966,
+  0x0000, 0x5f61, 0x0000, 0xc967, 0xc968, 0x0000, 0x0000, 0xc969,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x316b, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5f64, 0x4a32, 0x0000, 0x5f63, 0x0000, 0xc96a, 0x0000,
+  0xc96b, 0x4c35, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e47, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xc96c, 0x0000, 0xc96d, 0x0000, 0xc96e,
+  0xc96f, 0xc970, 0x0000, 0x0000, 0x0000, 0x0000, 0x4133, 0x0000,
+  0xc971, 0x0000, 0x0000, 0x0000, 0x3e46, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xc972, 0x0000, 0x0000, 0x0000, 0xc973, 0xc974, 0xc975,
+  0x0000, 0x4e7b, 0xc976, 0xc977, 0x5f6a, 0x0000, 0x4079, 0x0000,
+  0xc978, 0x0000, 0xc979, 0x0000, 0x0000, 0x5f66, 0x5f6b, 0xc97a,
+  0x0000, 0x316c, 0xc97b, 0x0000, 0xc97c, 0x0000, 0xc97d, 0x0000,
+  0xc97e, 0x0000, 0x5f69, 0x0000, 0x4761, 0x5f65, 0x5f68, 0x3e48,
+  0xca21, 0x4851, 0x0000, 0x0000, 0x5f6c, 0x0000, 0x3c51, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xca22, 0x0000, 0x0000, 0x0000, 0x407a, 0x0000, 0x0000,
+ // page 89 (U+7180)
+  0xca23, 0x0000, 0x0000, 0x0000, 0x5f6f, 0xca24, 0x0000, 0xca25,
+  0x5f67, 0x0000, 0x3727, 0x0000, 0xca26, 0x0000, 0x0000, 0x5f6d,
+  0x0000, 0x0000, 0xca27, 0x0000, 0x4d50, 0x5f70, 0x0000, 0x0000,
+  0x0000, 0x7426, 0xca28, 0xca29, 0x0000, 0x0000, 0x0000, 0x3d4f,
+  0xca2a, 0x0000, 0xca2b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5f71, 0x0000, 0x0000, 0x0000, 0x5f72, 0x0000, 0x0000, 0xca2c,
+  0xca2d, 0x472e, 0xca2e, 0xca2f, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5f74, 0xca30, 0x0000, 0x0000, 0x0000, 0x5f75, 0xca31,
+  0xca32, 0xca33, 0x0000, 0x4733, 0xca34, 0x0000, 0x0000, 0x0000,
+  0x4575, 0x5f77, 0x0000, 0xca35, 0xca36, 0x0000, 0x5f79, 0x0000,
+  0x4e55, 0x0000, 0x5f76, 0xca37, 0x5f78, 0x316d, 0xca38, 0x5f73,
+  0x0000, 0xca39, 0xca3a, 0x0000, 0xca3b, 0x0000, 0x0000, 0x535b,
+  0x5f7a, 0x0000, 0x0000, 0x0000, 0x0000, 0x4167, 0x3b38, 0x5f7c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x5f7b, 0x3f24, 0x5259, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5f7d, 0x0000, 0x0000,
+  0xca3c, 0x6021, 0x0000, 0x5f6e, 0x5f7e, 0x0000, 0xca3d, 0x6022,
+ // page 90 (U+7200)
+  0xca3e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x477a, 0xca3f,
+  0xca40, 0xca41, 0x0000, 0x0000, 0x0000, 0x6023, 0x0000, 0x0000,
+  0x6024, 0x0000, 0x0000, 0xca42, 0x0000, 0x0000, 0x0000, 0xca43,
+  0x0000, 0x0000, 0xca44, 0x6025, 0x0000, 0xca45, 0x0000, 0xca46,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xca47, 0x0000, 0x0000, 0x0000,
+  0x6026, 0x0000, 0x445e, 0xca48, 0x6028, 0x6027, 0x0000, 0xca49,
+  0x6029, 0x0000, 0x602a, 0x0000, 0xca4a, 0x3c5f, 0x4963, 0x0000,
+  0xca4b, 0xca4c, 0x4c6c, 0x602b, 0x602c, 0x4156, 0x3c24, 0x602d,
+  0x602e, 0xca4d, 0xca4e, 0xca4f, 0x0000, 0xca50, 0x602f, 0x4a52,
+  0x4847, 0x0000, 0x0000, 0x6030, 0x4757, 0x0000, 0xca51, 0xca52,
+  0xca53, 0x0000, 0x442d, 0xca54, 0x0000, 0xca55, 0xca56, 0x0000,
+  0x6031, 0x3267, 0xca57, 0x356d, 0xca58, 0x4c46, 0xca59, 0x4c36,
+  0xca5a, 0x3234, 0x4f34, 0xca5b, 0x0000, 0x0000, 0x0000, 0x4b52,
+  0xca5c, 0x4a2a, 0x0000, 0xca5d, 0x0000, 0x0000, 0xca5e, 0xca5f,
+  0x0000, 0xca60, 0x4037, 0x0000, 0x6032, 0x0000, 0x0000, 0xca61,
+  0xca62, 0x4643, 0x0000, 0xca63, 0xca64, 0x3823, 0x6033, 0xca65,
+ // page 91 (U+7280)
+  0x3a54, 0x6035, 0x6034, 0x0000, 0xca66, 0x0000, 0x0000, 0x6036,
+  0x0000, 0xca67, 0x0000, 0x0000, 0x0000, 0xca68, 0xca69, 0x0000,
+  0x0000, 0x0000, 0x6037, 0xca6a, 0x0000, 0x0000, 0x6038, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xca6b, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x353e, 0x0000, 0x6039, 0x0000, 0x0000, 0x0000, 0x0000, 0x603a,
+  0xca6c, 0x0000, 0x0000, 0x0000, 0x3824, 0xca6d, 0xca6e, 0x4848,
+  0x0000, 0xca6f, 0x603c, 0x0000, 0xca70, 0x0000, 0x3e75, 0x0000,
+  0x0000, 0x603b, 0x0000, 0x0000, 0x0000, 0x0000, 0xca71, 0x0000,
+  0x0000, 0xca72, 0x3638, 0x603d, 0x603f, 0x0000, 0x603e, 0xca73,
+  0x0000, 0xca74, 0x0000, 0x0000, 0xca75, 0x0000, 0x6040, 0x0000,
+  0x3851, 0x0000, 0x6041, 0x0000, 0x0000, 0xca76, 0xca77, 0x3669,
+  0xca78, 0x4140, 0x0000, 0x397d, 0x0000, 0x0000, 0x0000, 0xca79,
+  0x6043, 0x6044, 0x6042, 0x0000, 0x0000, 0xca7a, 0x0000, 0x0000,
+  0x0000, 0x3c6d, 0x0000, 0x0000, 0x4648, 0x3639, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xca7b, 0xca7c, 0x0000, 0x0000, 0x6046,
+  0x432c, 0x6045, 0xca7d, 0xca7e, 0x4f35, 0x4762, 0xcb21, 0x0000,
+ // page 92 (U+7300)
+  0x0000, 0x0000, 0xcb22, 0x0000, 0xcb23, 0xcb24, 0x0000, 0xcb25,
+  0x0000, 0x0000, 0x6049, 0xcb26, 0x0000, 0xcb27, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xcb28, 0xcb29, 0x0000, 0x0000, 0x604b, 0x6048,
+  0xcb2a, 0xcb2b, 0x0000, 0x4c54, 0x604a, 0x604c, 0xcb2c, 0x4e44,
+  0x0000, 0x0000, 0xcb2d, 0x0000, 0xcb2e, 0x6050, 0x0000, 0xcb2f,
+  0xcb30, 0x604f, 0x4376, 0x472d, 0xcb31, 0x0000, 0x3825, 0x604e,
+  0x0000, 0xcb32, 0xcb33, 0x0000, 0x604d, 0xcb34, 0x4d31, 0x4d32,
+  0x0000, 0x0000, 0xcb35, 0xcb36, 0x0000, 0xcb37, 0x6051, 0x316e,
+  0x0000, 0x0000, 0x0000, 0xcb38, 0x3976, 0x3b62, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xcb39, 0x6052, 0x6053,
+  0xcb3a, 0x0000, 0xcb3b, 0x0000, 0x0000, 0x0000, 0xcb3c, 0x6055,
+  0xcb3d, 0x0000, 0x0000, 0x0000, 0x0000, 0xcb3e, 0xcb3f, 0xcb40,
+  0xcb41, 0x0000, 0x0000, 0x3d43, 0x0000, 0x0000, 0xcb42, 0xcb43,
+  0x6057, 0xcb44, 0x6056, 0xcb45, 0xcb46, 0x0000, 0xcb47, 0xcb48,
+  0x6058, 0xcb49, 0x334d, 0x0000, 0x0000, 0x605a, 0x0000, 0xcb4a,
+  0x6059, 0xcb4b, 0x605c, 0x605b, 0xcb4c, 0x0000, 0x0000, 0x0000,
+ // page 93 (U+7380)
+  0xcb4d, 0xcb4e, 0x0000, 0xcb4f, 0x383c, 0xcb50, 0xcb51, 0x4e28,
+  0x0000, 0x364c, 0x0000, 0x3226, 0x0000, 0x0000, 0xcb52, 0x0000,
+  0xcb53, 0x0000, 0x0000, 0xcb54, 0x0000, 0xcb55, 0x366a, 0xcb56,
+  0xcb57, 0x0000, 0x0000, 0x0000, 0xcb58, 0x0000, 0xcb59, 0xcb5a,
+  0xcb5b, 0x0000, 0xcb5c, 0x0000, 0x0000, 0xcb5d, 0xcb5e, 0x0000,
+  0x0000, 0x3461, 0xcb5f, 0xcb60, 0x0000, 0xcb61, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x4e68, 0x605e, 0x0000, 0xcb62, 0x0000, 0xcb63,
+  0x0000, 0xcb64, 0x0000, 0x6060, 0xcb65, 0xcb66, 0x0000, 0xcb67,
+  0x6061, 0x0000, 0x3251, 0x0000, 0x0000, 0xcb68, 0xcb69, 0x0000,
+  0x605d, 0xcb6a, 0x3b39, 0xcb6b, 0xcb6c, 0x4441, 0x605f, 0xcb6d,
+  0x0000, 0x0000, 0xcb6e, 0xcb6f, 0x0000, 0x0000, 0xcb70, 0x0000,
+  0x0000, 0xcb71, 0x0000, 0x0000, 0x0000, 0xcb72, 0x6064, 0x0000,
+  0x3c6e, 0xcb73, 0x0000, 0xcb74, 0x0000, 0x6062, 0xcb75, 0xcb76,
+  0x0000, 0xcb77, 0x373e, 0x0000, 0x0000, 0x4849, 0x6063, 0x0000,
+  0x0000, 0x607e, 0x0000, 0x0000, 0xcb78, 0xcb79, 0x0000, 0xcb7a,
+  0x6069, 0xcb7b, 0xcb7c, 0xcb7d, 0x0000, 0xcb7e, 0x383d, 0xcc21,
+ // page 94 (U+7400)
+  0xcc22, 0xcc23, 0x0000, 0x3565, 0xcc24, 0x6066, 0x4d7d, 0xcc25,
+  0x0000, 0x4e30, 0xcc26, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xcc27, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xcc28, 0xcc29, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x4276, 0x0000, 0xcc2a, 0x6068, 0xcc2b, 0x0000,
+  0xcc2c, 0xcc2d, 0xcc2e, 0xcc2f, 0xcc30, 0xcc31, 0xcc32, 0xcc33,
+  0xcc34, 0xcc35, 0x606a, 0x4e56, 0x3657, 0x487c, 0x474a, 0x0000,
+  0x0000, 0xcc36, 0x606b, 0x0000, 0x0000, 0x0000, 0x0000, 0x606d,
+  0xcc37, 0x6070, 0x0000, 0xcc38, 0xcc39, 0x0000, 0xcc3a, 0xcc3b,
+  0x0000, 0x0000, 0x0000, 0xcc3c, 0x0000, 0xcc3d, 0x0000, 0x0000,
+  0x0000, 0xcc3e, 0xcc3f, 0x0000, 0x0000, 0x606c, 0x0000, 0xcc40,
+  0x0000, 0x606f, 0x386a, 0x314d, 0x6071, 0xcc41, 0x3f70, 0x606e,
+  0x4e5c, 0x0000, 0xcc42, 0x6074, 0x7424, 0x0000, 0xcc43, 0xcc44,
+  0xcc45, 0x6072, 0x6075, 0xcc46, 0x0000, 0xcc47, 0xcc48, 0x6067,
+  0x6073, 0xcc49, 0xcc4a, 0x3a3c, 0x0000, 0x0000, 0x6076, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6077, 0x0000,
+ // page 95 (U+7480)
+  0xcc4b, 0xcc4c, 0x0000, 0x4d7e, 0x0000, 0xcc4d, 0xcc4e, 0xcc4f,
+  0x0000, 0xcc50, 0x0000, 0x6078, 0x0000, 0x0000, 0x0000, 0xcc51,
+  0xcc52, 0xcc53, 0xcc54, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xcc55, 0xcc56, 0xcc57, 0x0000, 0xcc58, 0x0000, 0x6079, 0xcc59,
+  0xcc5a, 0xcc5b, 0x6065, 0xcc5c, 0x0000, 0x0000, 0xcc5d, 0x607a,
+  0xcc5e, 0xcc5f, 0xcc60, 0xcc61, 0x0000, 0x0000, 0xcc62, 0xcc63,
+  0x3444, 0xcc64, 0xcc65, 0x0000, 0x0000, 0xcc66, 0x0000, 0x0000,
+  0x0000, 0xcc67, 0x0000, 0xcc68, 0x0000, 0x3c25, 0x0000, 0xcc69,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xcc6a, 0xcc6b, 0x607b, 0x0000, 0xcc6c, 0x0000, 0x0000, 0x607c,
+  0xcc6d, 0x0000, 0x0000, 0xcc6e, 0x607d, 0x0000, 0x0000, 0x0000,
+  0xcc6f, 0x0000, 0xcc70, 0xcc71, 0x313b, 0x0000, 0xcc72, 0xcc73,
+  0x6121, 0x0000, 0x493b, 0x6122, 0xcc74, 0x0000, 0x3424, 0x6123,
+  0xcc75, 0x6124, 0xcc76, 0xcc77, 0x0000, 0x0000, 0x6125, 0xcc78,
+  0x6127, 0x6128, 0x6126, 0x0000, 0xcc79, 0x0000, 0x4953, 0x612a,
+  0x6129, 0x0000, 0xcc7a, 0xcc7b, 0xcc7c, 0x0000, 0x0000, 0xcc7d,
+ // page 96 (U+7500)
+  0x0000, 0x0000, 0x0000, 0x612c, 0x612b, 0x612d, 0xcc7e, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x612e, 0x6130, 0x612f, 0x0000,
+  0x0000, 0x3979, 0xcd21, 0x6132, 0x0000, 0x6131, 0xcd22, 0xcd23,
+  0x3445, 0x0000, 0x3f53, 0x0000, 0x453c, 0x0000, 0x6133, 0x4038,
+  0xcd24, 0xcd25, 0x0000, 0x3b3a, 0xcd26, 0x3179, 0x6134, 0xcd27,
+  0x4d51, 0xcd28, 0xcd29, 0x4a63, 0x6135, 0x0000, 0x0000, 0xcd2a,
+  0x4544, 0x4d33, 0x3943, 0x3f3d, 0x0000, 0x0000, 0xcd2b, 0x434b,
+  0x5234, 0xcd2c, 0x442e, 0x3268, 0x6136, 0xcd2d, 0xcd2e, 0xcd2f,
+  0xcd30, 0x0000, 0x0000, 0xcd31, 0x6137, 0x0000, 0x613c, 0xcd32,
+  0xcd33, 0x613a, 0x6139, 0x5a42, 0x3326, 0x6138, 0xcd34, 0x305a,
+  0xcd35, 0x482a, 0xcd36, 0x0000, 0x484a, 0x0000, 0x0000, 0xcd37,
+  0x0000, 0x4e31, 0x613d, 0x613b, 0x435c, 0x4026, 0xcd38, 0xcd39,
+  0x482b, 0xcd3a, 0x492d, 0x0000, 0x613f, 0x4e2c, 0x374d, 0x6140,
+  0x0000, 0x613e, 0x4856, 0x6141, 0x0000, 0x6142, 0x0000, 0xcd3b,
+  0x305b, 0xcd3c, 0x0000, 0x3e76, 0x6147, 0x0000, 0x6144, 0x466d,
+  0x6143, 0xcd3d, 0xcd3e, 0xcd3f, 0xcd40, 0xcd41, 0xcd42, 0x3526,
+ // page 97 (U+7580)
+  0x0000, 0xcd43, 0x614a, 0x0000, 0x0000, 0xcd44, 0x6145, 0x6146,
+  0x0000, 0x6149, 0x6148, 0x4925, 0x0000, 0x0000, 0x4142, 0x4141,
+  0xcd45, 0x353f, 0xcd46, 0xcd47, 0x614b, 0xcd48, 0x0000, 0x0000,
+  0x0000, 0xcd49, 0x614c, 0x0000, 0xcd4a, 0x614d, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xcd4b, 0x614f, 0xcd4c, 0x614e, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3156, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x6157, 0x4868, 0x6151, 0xcd4d, 0x6153, 0x0000, 0x0000,
+  0x6155, 0x3f3e, 0xcd4e, 0x0000, 0x6156, 0x6154, 0x3c40, 0xcd4f,
+  0xcd50, 0xcd51, 0x6150, 0x6152, 0xcd52, 0x4942, 0xcd53, 0x3e49,
+  0x0000, 0x0000, 0x6159, 0x0000, 0xcd54, 0x6158, 0xcd55, 0xcd56,
+  0x0000, 0x0000, 0x615a, 0x0000, 0x3c26, 0x3a2f, 0x0000, 0xcd57,
+  0x4577, 0x615b, 0x0000, 0x444b, 0xcd58, 0x0000, 0x615d, 0xcd59,
+  0xcd5a, 0xcd5b, 0x4e21, 0x615c, 0xcd5c, 0x0000, 0x0000, 0xcd5d,
+  0x0000, 0x4169, 0x0000, 0x0000, 0xcd5e, 0x0000, 0xcd5f, 0xcd60,
+  0x6162, 0xcd61, 0x6164, 0x6165, 0x4354, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xcd62, 0x6163, 0x0000, 0x6160, 0x0000, 0x615e, 0x615f,
+ // page 98 (U+7600)
+  0xcd63, 0x6161, 0xcd64, 0xcd65, 0xcd66, 0x0000, 0x0000, 0xcd67,
+  0xcd68, 0x6168, 0xcd69, 0x6166, 0xcd6a, 0x6167, 0x0000, 0xcd6b,
+  0x0000, 0x0000, 0xcd6c, 0xcd6d, 0x0000, 0xcd6e, 0xcd6f, 0x0000,
+  0x0000, 0xcd70, 0x0000, 0xcd71, 0xcd72, 0xcd73, 0xcd74, 0x6169,
+  0x616b, 0x616c, 0x616d, 0xcd75, 0x616e, 0xcd76, 0xcd77, 0x616a,
+  0x0000, 0xcd78, 0x0000, 0x0000, 0x0000, 0xcd79, 0x0000, 0x0000,
+  0x6170, 0x0000, 0xcd7a, 0xcd7b, 0x616f, 0xcd7c, 0x0000, 0x0000,
+  0xcd7d, 0xcd7e, 0xce21, 0x6171, 0xce22, 0x0000, 0x0000, 0x0000,
+  0xce24, 0xce25, 0x4e45, 0xce26, 0xce27, 0xce28, 0x6174, 0x6172,
+  0x6173, 0xce29, 0xce23, 0xce2a, 0x3462, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x4c7e, 0x0000, 0x0000, 0xce2b, 0x4a4a, 0x0000,
+  0x6176, 0xce2c, 0x0000, 0x0000, 0x6175, 0x0000, 0x0000, 0xce2d,
+  0x0000, 0x6177, 0x6178, 0x0000, 0xce2e, 0xce2f, 0x0000, 0x617c,
+  0x6179, 0x617a, 0x617b, 0x0000, 0x617d, 0xce30, 0xce31, 0xce32,
+  0x617e, 0xce33, 0x6221, 0x0000, 0xce34, 0x0000, 0x6222, 0x0000,
+  0x6223, 0x0000, 0x482f, 0x4550, 0x6224, 0x4772, 0x4934, 0x0000,
+ // page 99 (U+7680)
+  0x6225, 0xce35, 0x0000, 0x6226, 0x452a, 0xce36, 0x3327, 0x3944,
+  0x6227, 0x0000, 0x0000, 0x6228, 0xce37, 0xce38, 0x6229, 0x0000,
+  0x3b29, 0x0000, 0x0000, 0x622b, 0x0000, 0xce39, 0x622a, 0x0000,
+  0x0000, 0x622c, 0x622d, 0xce3a, 0xce3b, 0xce3c, 0x0000, 0xce3d,
+  0xce3e, 0x0000, 0xce3f, 0xce40, 0xce41, 0xce42, 0xce43, 0xce44,
+  0xce45, 0x0000, 0xce46, 0x0000, 0x0000, 0xce47, 0x4869, 0x0000,
+  0x622e, 0x0000, 0x0000, 0x0000, 0x622f, 0x0000, 0x0000, 0x7369,
+  0x6230, 0x6231, 0x6232, 0x0000, 0x0000, 0xce48, 0x0000, 0x3b2e,
+  0x0000, 0xce49, 0x6233, 0x4756, 0x0000, 0xce4a, 0x4b5f, 0x0000,
+  0x314e, 0xce4b, 0x3157, 0xce4c, 0xce4d, 0x6234, 0xce4e, 0x0000,
+  0x0000, 0x0000, 0x6236, 0x0000, 0xce4f, 0x0000, 0x6235, 0x4570,
+  0x0000, 0xce50, 0x0000, 0x4039, 0x5d39, 0x0000, 0x6237, 0x4c41,
+  0xce51, 0x6238, 0x0000, 0x3446, 0x4857, 0x6239, 0xce52, 0x623a,
+  0xce53, 0x0000, 0x623b, 0x0000, 0xce54, 0x0000, 0x4c5c, 0x0000,
+  0xce55, 0xce56, 0x4c55, 0x0000, 0x443e, 0x0000, 0xce57, 0x0000,
+  0x416a, 0xce58, 0x0000, 0x623d, 0xce59, 0x0000, 0x3d62, 0x0000,
+ // page 100 (U+7700)
+  0xce5a, 0x3e4a, 0x0000, 0x0000, 0x6240, 0x0000, 0xce5b, 0x623f,
+  0x623e, 0x487d, 0xce5c, 0x3447, 0x3829, 0x0000, 0xce5d, 0x0000,
+  0x0000, 0x0000, 0xce5e, 0x0000, 0xce5f, 0xce60, 0x0000, 0xce61,
+  0x0000, 0xce62, 0xce63, 0x6246, 0xce64, 0x0000, 0x6243, 0x3f3f,
+  0x4c32, 0x0000, 0xce65, 0x0000, 0x6242, 0x6244, 0x6245, 0x0000,
+  0xce66, 0x6241, 0x0000, 0x0000, 0x0000, 0xce67, 0xce68, 0xce69,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xce6a, 0xce6b, 0xce6c, 0x6247,
+  0x6248, 0xce6d, 0x442f, 0x0000, 0x3463, 0xce6e, 0xce6f, 0x0000,
+  0x4365, 0x0000, 0xce70, 0x0000, 0x0000, 0xce71, 0xce72, 0x6249,
+  0x0000, 0x0000, 0xce73, 0x0000, 0x0000, 0xce74, 0xce75, 0xce76,
+  0x0000, 0x0000, 0xce77, 0x0000, 0x0000, 0x0000, 0xce78, 0xce79,
+  0x0000, 0x0000, 0x624a, 0x624d, 0xce7a, 0x0000, 0xce7b, 0xce7c,
+  0xce7d, 0x3f67, 0xce7e, 0x4644, 0xcf21, 0x624e, 0x4b53, 0xcf22,
+  0x624b, 0x0000, 0xcf23, 0x624c, 0xcf24, 0x0000, 0x0000, 0x0000,
+  0xcf25, 0x0000, 0xcf26, 0xcf27, 0xcf28, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x6251, 0xcf29, 0x0000, 0x0000, 0xcf2a, 0x6250, 0x624f,
+ // page 101 (U+7780)
+  0xcf2b, 0x0000, 0x0000, 0x0000, 0xcf2c, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x6253, 0xcf2d, 0xcf2e, 0x6252, 0x0000,
+  0x0000, 0x6254, 0x0000, 0x0000, 0xcf2f, 0xcf30, 0xcf31, 0x0000,
+  0x0000, 0x0000, 0xcf32, 0x0000, 0x0000, 0x0000, 0x6256, 0xcf33,
+  0x6255, 0x0000, 0xcf34, 0x0000, 0x0000, 0x4a4d, 0x0000, 0xcf35,
+  0x0000, 0x0000, 0xcf36, 0x0000, 0x3d56, 0x4e46, 0xcf37, 0xcf38,
+  0x6257, 0xcf39, 0x0000, 0x4637, 0x0000, 0xcf3a, 0x6258, 0x0000,
+  0x0000, 0x6259, 0x0000, 0x625d, 0x625b, 0x625c, 0xcf3b, 0x625a,
+  0x0000, 0x0000, 0x0000, 0xcf3c, 0x0000, 0x0000, 0x0000, 0x625e,
+  0x0000, 0xcf3d, 0x0000, 0x0000, 0x0000, 0x625f, 0x0000, 0x0000,
+  0x0000, 0xcf3e, 0xcf3f, 0x0000, 0x0000, 0xcf40, 0x0000, 0x6260,
+  0x0000, 0xcf41, 0x6261, 0x4c37, 0x6262, 0x0000, 0xcf42, 0xcf43,
+  0xcf44, 0x0000, 0x4c70, 0x6263, 0xcf45, 0x434e, 0xcf46, 0x476a,
+  0x0000, 0x366b, 0xcf47, 0x0000, 0xcf48, 0x433b, 0x6264, 0x363a,
+  0xcf49, 0xcf4a, 0x0000, 0x4050, 0xcf4b, 0x0000, 0x0000, 0x0000,
+  0xcf4c, 0x0000, 0x0000, 0xcf4d, 0x6265, 0x0000, 0x0000, 0x0000,
+ // page 102 (U+7800)
+  0x0000, 0x0000, 0x3a3d, 0x0000, 0x0000, 0xcf4e, 0xcf4f, 0x0000,
+  0x0000, 0xcf50, 0x0000, 0x0000, 0x6266, 0xcf51, 0xcf52, 0x0000,
+  0x0000, 0xcf53, 0x6267, 0x0000, 0x3826, 0x3a55, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xcf54, 0x0000, 0x0000,
+  0x6269, 0xcf55, 0xcf56, 0xcf57, 0x0000, 0x4556, 0x3a56, 0x354e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xcf58, 0xcf59, 0x0000,
+  0xcf5a, 0x0000, 0x4b24, 0x0000, 0x474b, 0xcf5b, 0x0000, 0xcf5c,
+  0x0000, 0x0000, 0x4557, 0x0000, 0x0000, 0x0000, 0x0000, 0x395c,
+  0x0000, 0x0000, 0x0000, 0xcf5d, 0xcf5e, 0x626b, 0x0000, 0xcf5f,
+  0xcf60, 0x0000, 0x0000, 0x0000, 0xcf61, 0x0000, 0xcf62, 0x0000,
+  0x0000, 0x0000, 0xcf63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xcf64, 0x3e4b, 0xcf65, 0x0000,
+  0xcf66, 0xcf67, 0x0000, 0xcf68, 0xcf69, 0x0000, 0x0000, 0x0000,
+  0xcf6a, 0x0000, 0xcf6b, 0x4e32, 0x3945, 0x0000, 0xcf6c, 0x3827,
+  0x0000, 0x0000, 0x4823, 0x0000, 0x626d, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xcf6d, 0x0000, 0x626f, 0x0000, 0xcf6e, 0x0000,
+ // page 103 (U+7880)
+  0x0000, 0x386b, 0x0000, 0x0000, 0x0000, 0x0000, 0x626e, 0x4476,
+  0x0000, 0x0000, 0xcf6f, 0x0000, 0x6271, 0x3337, 0x626c, 0xcf70,
+  0x0000, 0x486a, 0x0000, 0x3130, 0xcf71, 0x3a6c, 0x0000, 0x4f52,
+  0xcf72, 0x0000, 0x6270, 0x0000, 0x0000, 0xcf74, 0xcf75, 0xcf76,
+  0x0000, 0xcf73, 0x0000, 0x6272, 0xcf77, 0x0000, 0x0000, 0x4a4b,
+  0xcf78, 0x4059, 0x6274, 0x0000, 0xcf79, 0xcf7a, 0x0000, 0x6275,
+  0xcf7b, 0xcf7c, 0xcf7d, 0xcf7e, 0x0000, 0x6273, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x334e, 0xd021, 0x627b, 0xd022, 0x627a, 0xd023,
+  0x0000, 0x3c27, 0x0000, 0x0000, 0x0000, 0x627c, 0x6277, 0xd024,
+  0xd025, 0xd026, 0x627d, 0x6278, 0xd027, 0x0000, 0xd028, 0x0000,
+  0x4858, 0x6276, 0xd029, 0xd02a, 0x6279, 0xd02b, 0xd02c, 0x0000,
+  0x0000, 0x0000, 0x6322, 0xd02e, 0x0000, 0x0000, 0x0000, 0xd02f,
+  0xd030, 0xd031, 0x0000, 0x0000, 0xd02d, 0x0000, 0xd032, 0x6321,
+  0x4b61, 0x0000, 0xd033, 0x0000, 0x627e, 0x0000, 0x0000, 0x306b,
+  0x0000, 0x0000, 0xd034, 0xd035, 0x6324, 0x0000, 0xd037, 0xd038,
+  0x0000, 0x0000, 0xd039, 0xd03a, 0x0000, 0x6323, 0x0000, 0xd03b,
+ // page 104 (U+7900)
+  0xd036, 0x3e4c, 0x0000, 0x0000, 0x0000, 0x0000, 0xd03c, 0x6325,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xd03d, 0x0000, 0x4143, 0x0000,
+  0xd03e, 0x6327, 0x6326, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x6328, 0xd03f, 0x0000, 0xd040, 0x0000, 0xd041, 0xd042,
+  0xd043, 0x0000, 0x0000, 0x0000, 0x0000, 0xd044, 0x6268, 0xd045,
+  0x0000, 0xd046, 0x626a, 0x632a, 0x6329, 0xd047, 0x0000, 0x0000,
+  0x0000, 0xd048, 0x0000, 0x0000, 0xd049, 0xd04a, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3c28, 0xd04b, 0x4e69, 0xd04c, 0x3c52, 0xd04d,
+  0x632b, 0x3737, 0x0000, 0x0000, 0xd04e, 0xd04f, 0xd050, 0x3540,
+  0x3527, 0x3b63, 0xd051, 0xd052, 0x0000, 0x0000, 0x0000, 0xd053,
+  0x4d34, 0xd054, 0x0000, 0x6331, 0xd055, 0x6330, 0x4144, 0x632d,
+  0xd056, 0x0000, 0x632f, 0xd057, 0xd058, 0x3d4b, 0x3f40, 0x632e,
+  0x632c, 0x0000, 0x472a, 0x0000, 0x0000, 0x3e4d, 0x0000, 0xd059,
+  0x493c, 0xd05a, 0x0000, 0xd05b, 0x0000, 0x3a57, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xd05c, 0x0000, 0x0000, 0x0000, 0x0000, 0x4578,
+  0x0000, 0xd05d, 0x6332, 0xd05e, 0xd05f, 0x0000, 0xd060, 0x6333,
+ // page 105 (U+7980)
+  0x6349, 0x3658, 0x0000, 0x0000, 0x4f3d, 0x4135, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x6334, 0xd061, 0xd062, 0x3252, 0x4477, 0x4a21,
+  0x0000, 0xd063, 0x0000, 0xd064, 0xd065, 0xd066, 0xd067, 0x0000,
+  0xd068, 0x0000, 0x0000, 0xd069, 0xd06a, 0x6335, 0x0000, 0x0000,
+  0x0000, 0xd06b, 0x0000, 0x0000, 0x0000, 0x0000, 0x357a, 0x6336,
+  0xd06c, 0xd06d, 0x6338, 0xd06e, 0x0000, 0x0000, 0x6339, 0xd06f,
+  0x4729, 0xd070, 0x0000, 0x633a, 0xd071, 0x0000, 0x0000, 0x0000,
+  0xd072, 0x633b, 0x633c, 0xd073, 0x0000, 0x3659, 0x3253, 0x4645,
+  0x3d28, 0x3b64, 0xd074, 0x0000, 0xd075, 0x0000, 0x0000, 0xd076,
+  0xd077, 0x633d, 0xd078, 0x3d29, 0x0000, 0x0000, 0x0000, 0xd079,
+  0x0000, 0x324a, 0x4943, 0x0000, 0xd07a, 0x633e, 0xd07b, 0x0000,
+  0x486b, 0x0000, 0xd07c, 0x0000, 0x0000, 0xd07d, 0xd07e, 0x4145,
+  0xd121, 0x6341, 0xd122, 0x6342, 0x4769, 0xd123, 0x3f41, 0x633f,
+  0x0000, 0x4361, 0xd124, 0xd125, 0x6340, 0xd126, 0x0000, 0x0000,
+  0x3e4e, 0xd127, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xd128, 0x0000, 0x0000, 0x305c, 0xd129, 0x0000, 0x0000, 0x0000,
+ // page 106 (U+7A00)
+  0x3529, 0x0000, 0xd12a, 0xd12b, 0x0000, 0x0000, 0x0000, 0xd12c,
+  0x6343, 0xd12d, 0xd12e, 0x4478, 0xd12f, 0x6344, 0x4047, 0x0000,
+  0x0000, 0xd130, 0x0000, 0x0000, 0x4c2d, 0xd131, 0x0000, 0x4923,
+  0x6345, 0x6346, 0x4355, 0xd132, 0x4e47, 0x0000, 0xd133, 0x6348,
+  0x6347, 0xd134, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd135,
+  0x0000, 0x0000, 0x0000, 0xd136, 0x0000, 0xd137, 0x3c6f, 0xd138,
+  0xd139, 0x634a, 0x3070, 0x0000, 0xd13a, 0xd13b, 0x0000, 0x634d,
+  0xd13c, 0xd13d, 0xd13e, 0x634b, 0x3254, 0x374e, 0x634c, 0x3946,
+  0x3972, 0x0000, 0x4a66, 0x634e, 0xd13f, 0xd140, 0x4b54, 0xd141,
+  0xd142, 0x6350, 0x0000, 0x0000, 0xd143, 0x4051, 0x314f, 0x323a,
+  0x302c, 0x0000, 0x0000, 0x0000, 0x0000, 0xd144, 0xd145, 0x634f,
+  0x0000, 0xd146, 0x0000, 0x0000, 0xd147, 0xd148, 0x0000, 0xd149,
+  0xd14a, 0x6351, 0x6352, 0x3e77, 0x0000, 0xd14b, 0x0000, 0xd14c,
+  0x0000, 0x6353, 0xd14d, 0x334f, 0x0000, 0xd14e, 0x0000, 0x0000,
+  0x6355, 0x0000, 0x0000, 0x0000, 0x376a, 0xd14f, 0x3566, 0x0000,
+  0xd150, 0x6356, 0x3675, 0x0000, 0x0000, 0x6357, 0xd151, 0x407c,
+ // page 107 (U+7A80)
+  0xd152, 0x464d, 0xd153, 0x4060, 0x3a75, 0xd154, 0xd155, 0x0000,
+  0x6358, 0x0000, 0xd156, 0xd157, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xd158, 0xd159, 0x4362, 0x416b, 0xd15a, 0x635a, 0x635c, 0x6359,
+  0x635b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd15b, 0x3722,
+  0xd15c, 0x0000, 0x0000, 0xd15d, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x635d, 0x3726, 0x0000, 0xd15e, 0x0000, 0x3567, 0x4d52,
+  0x635f, 0x0000, 0x0000, 0xd15f, 0x0000, 0xd160, 0x6360, 0x0000,
+  0x0000, 0xd161, 0x312e, 0xd162, 0xd163, 0x0000, 0x0000, 0x6363,
+  0x0000, 0x0000, 0x0000, 0x3376, 0x6362, 0x6361, 0xd164, 0x6365,
+  0x635e, 0xd165, 0x6366, 0x4e29, 0xd166, 0x6367, 0xd167, 0x6368,
+  0x0000, 0xd168, 0x5474, 0x636a, 0x0000, 0x6369, 0x0000, 0x0000,
+  0x0000, 0x636b, 0x636c, 0xd169, 0x4e35, 0x636d, 0x0000, 0x706f,
+  0x3e4f, 0x636e, 0x636f, 0x3d57, 0x0000, 0x4638, 0x6370, 0x0000,
+  0xd16a, 0xd16b, 0x4328, 0xd16c, 0xd16d, 0x6371, 0x0000, 0x433c,
+  0x6372, 0xd16e, 0x0000, 0x0000, 0xd16f, 0x0000, 0x3625, 0x0000,
+  0x513f, 0x435d, 0x3c33, 0xd170, 0x0000, 0xd171, 0xd172, 0x3448,
+ // page 108 (U+7B00)
+  0x0000, 0x0000, 0x6373, 0x0000, 0x6422, 0x0000, 0x6376, 0xd173,
+  0x3568, 0x0000, 0x6375, 0x6424, 0x0000, 0x0000, 0x0000, 0x6374,
+  0x0000, 0x3e50, 0x0000, 0x0000, 0xd174, 0x0000, 0x0000, 0x0000,
+  0x6378, 0x6379, 0x0000, 0x452b, 0x0000, 0x0000, 0x637a, 0xd175,
+  0x335e, 0x0000, 0x0000, 0xd176, 0x0000, 0x3f5a, 0x4964, 0xd177,
+  0x637c, 0xd178, 0xd179, 0xd17a, 0x4268, 0xd17b, 0xd17c, 0xd17d,
+  0xd17e, 0xd221, 0x0000, 0x6377, 0xd222, 0x637b, 0x637d, 0x0000,
+  0x0000, 0x3a7b, 0x0000, 0x0000, 0x0000, 0xd223, 0x0000, 0xd224,
+  0xd225, 0xd226, 0x0000, 0x0000, 0x0000, 0x6426, 0x492e, 0xd227,
+  0x4826, 0x4579, 0x0000, 0x365a, 0x6425, 0x6423, 0xd228, 0x4835,
+  0x637e, 0x435e, 0x457b, 0x0000, 0x457a, 0xd229, 0x3a76, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6438, 0x0000, 0x0000,
+  0xd22a, 0x0000, 0x0000, 0x0000, 0xd22b, 0x6428, 0xd22c, 0x642a,
+  0x0000, 0xd22d, 0xd22e, 0x0000, 0x642d, 0xd22f, 0x642e, 0xd230,
+  0x642b, 0x642c, 0xd231, 0xd232, 0x6429, 0x6427, 0x0000, 0xd233,
+  0x0000, 0x0000, 0x6421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 109 (U+7B80)
+  0x0000, 0x0000, 0x0000, 0x0000, 0xd234, 0x0000, 0x4a4f, 0x3255,
+  0x0000, 0xd235, 0x0000, 0x6435, 0x0000, 0x6432, 0xd236, 0x6437,
+  0xd237, 0xd238, 0x6436, 0x0000, 0x4773, 0x4c27, 0xd239, 0x3b3b,
+  0x6430, 0x6439, 0x6434, 0xd23a, 0x6433, 0x642f, 0xd23b, 0x6431,
+  0xd23c, 0x3449, 0x0000, 0x0000, 0x0000, 0xd23d, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x433d, 0x0000, 0xd23e, 0x407d, 0x0000, 0xd23f,
+  0xd240, 0x4822, 0xd241, 0x0000, 0x643e, 0xd242, 0xd243, 0x0000,
+  0x4824, 0x0000, 0xd244, 0xd245, 0xd246, 0xd247, 0x0000, 0x0000,
+  0x4061, 0x643b, 0xd248, 0x0000, 0x484f, 0xd249, 0x643f, 0x4a53,
+  0xd24a, 0x435b, 0xd24b, 0x643a, 0x643c, 0x0000, 0x0000, 0x643d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xd24c, 0x0000, 0xd24d, 0xd24e,
+  0x0000, 0xd24f, 0xd250, 0xd251, 0x0000, 0x6440, 0x0000, 0x0000,
+  0x3c44, 0x0000, 0x0000, 0x0000, 0x4646, 0x6445, 0x6444, 0x0000,
+  0xd252, 0x6441, 0xd253, 0x0000, 0x0000, 0x4f36, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xd254, 0x644a, 0xd255, 0xd256, 0x644e, 0x644b,
+  0xd257, 0xd258, 0xd259, 0x0000, 0xd25a, 0x0000, 0xd25b, 0x0000,
+ // page 110 (U+7C00)
+  0x6447, 0xd25c, 0xd25d, 0xd25e, 0xd25f, 0x0000, 0xd260, 0x6448,
+  0x0000, 0xd261, 0x0000, 0xd262, 0xd263, 0x644d, 0xd264, 0xd265,
+  0x0000, 0x6442, 0x5255, 0x6449, 0x6443, 0x0000, 0x0000, 0x644c,
+  0x0000, 0xd266, 0x0000, 0xd267, 0x0000, 0x0000, 0x0000, 0x6452,
+  0xd268, 0x344a, 0x0000, 0x644f, 0x0000, 0xd269, 0xd26a, 0x6450,
+  0xd26b, 0x0000, 0x6451, 0x6454, 0xd26c, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xd26d, 0x0000, 0xd26e, 0xd26f, 0x0000, 0xd270, 0x6453,
+  0x4876, 0xd271, 0xd272, 0x0000, 0x0000, 0x6455, 0x4e7c, 0x4a6d,
+  0x645a, 0x0000, 0x0000, 0x6457, 0x0000, 0x0000, 0xd273, 0x0000,
+  0x0000, 0x0000, 0xd274, 0x0000, 0x6456, 0x4052, 0x0000, 0x6459,
+  0x645b, 0xd276, 0xd277, 0xd278, 0x6458, 0xd275, 0x645f, 0x0000,
+  0x645c, 0xd279, 0xd27a, 0xd27b, 0xd27c, 0xd27d, 0xd27e, 0x645d,
+  0x6446, 0xd321, 0x0000, 0xd322, 0x645e, 0x6460, 0x0000, 0xd323,
+  0x0000, 0xd324, 0x0000, 0x0000, 0x6461, 0xd325, 0xd326, 0x0000,
+  0xd327, 0x0000, 0xd328, 0x4a46, 0x0000, 0x6462, 0x0000, 0x0000,
+  0x0000, 0xd329, 0x0000, 0x0000, 0xd32a, 0xd32b, 0x4c62, 0x0000,
+ // page 111 (U+7C80)
+  0x0000, 0x364e, 0x3729, 0x6463, 0x0000, 0x0000, 0xd32c, 0xd32d,
+  0x0000, 0x4a34, 0x0000, 0x3f68, 0x0000, 0x4c30, 0x0000, 0xd32e,
+  0x6464, 0x0000, 0x4e33, 0x0000, 0xd32f, 0x4774, 0x0000, 0x4146,
+  0x4734, 0x0000, 0x0000, 0x3d4d, 0x0000, 0x0000, 0xd330, 0x3040,
+  0xd331, 0x6469, 0x6467, 0x0000, 0x6465, 0x3421, 0xd332, 0x3e51,
+  0x646a, 0x0000, 0x0000, 0x6468, 0x0000, 0x6466, 0x646e, 0x0000,
+  0xd333, 0x646d, 0x646c, 0x646b, 0x0000, 0x0000, 0xd334, 0xd335,
+  0x0000, 0x646f, 0xd336, 0xd337, 0xd338, 0x6470, 0x403a, 0xd339,
+  0x6471, 0x0000, 0x6473, 0x0000, 0xd33a, 0x6472, 0x0000, 0xd33b,
+  0xd33c, 0xd33d, 0x3852, 0x0000, 0x0000, 0xd33e, 0x4138, 0xd33f,
+  0x0000, 0x0000, 0x6475, 0xd340, 0xd341, 0xd342, 0x457c, 0xd343,
+  0x6474, 0xd344, 0xd345, 0x0000, 0x6476, 0xd346, 0x4a35, 0x416c,
+  0x3947, 0x0000, 0x6477, 0x0000, 0x0000, 0x0000, 0xd347, 0x4e48,
+  0x0000, 0xd348, 0x0000, 0xd349, 0x0000, 0x0000, 0x0000, 0x6479,
+  0x0000, 0x0000, 0x647a, 0x0000, 0x647b, 0xd34a, 0x647c, 0x0000,
+  0x3b65, 0x0000, 0x647d, 0x374f, 0x0000, 0x0000, 0x356a, 0x0000,
+ // page 112 (U+7D00)
+  0x352a, 0x0000, 0x6521, 0xd34b, 0x4c73, 0x3948, 0x647e, 0xd34c,
+  0xd34d, 0xd34e, 0x6524, 0x4c66, 0x0000, 0x473c, 0x0000, 0xd34f,
+  0x4933, 0xd350, 0xd351, 0xd352, 0x3d63, 0x6523, 0xd353, 0x3c53,
+  0x3949, 0x3b66, 0x3569, 0x4a36, 0x6522, 0xd354, 0xd355, 0x0000,
+  0x4147, 0x4b42, 0x3a77, 0xd356, 0x0000, 0x0000, 0xd357, 0x0000,
+  0x0000, 0x0000, 0xd358, 0x3b67, 0x445d, 0xd359, 0x6527, 0x4e5f,
+  0x3a59, 0xd35a, 0x6528, 0x3f42, 0x0000, 0x652a, 0x0000, 0x0000,
+  0x0000, 0x3e52, 0x3a30, 0x0000, 0xd35b, 0xd35c, 0xd35d, 0x6529,
+  0xd35e, 0xd35f, 0x3d2a, 0x383e, 0x4148, 0x6525, 0x652b, 0xd360,
+  0xd361, 0x0000, 0x0000, 0x6526, 0x3750, 0xd362, 0x652e, 0x6532,
+  0x376b, 0xd363, 0x0000, 0xd364, 0x0000, 0x0000, 0x652d, 0xd365,
+  0x0000, 0xd366, 0xd367, 0x6536, 0xd368, 0xd369, 0x394a, 0x0000,
+  0x0000, 0x4d6d, 0x303c, 0x6533, 0x0000, 0xd36a, 0x356b, 0xd36b,
+  0x6530, 0x0000, 0xd36c, 0x0000, 0x0000, 0x0000, 0x6531, 0x0000,
+  0xd36d, 0x457d, 0x652f, 0x652c, 0x0000, 0x3328, 0x4064, 0x0000,
+  0xd36e, 0x3828, 0xd36f, 0xd370, 0x0000, 0x6538, 0x0000, 0xd371,
+ // page 113 (U+7D80)
+  0x0000, 0xd372, 0xd373, 0xd374, 0x0000, 0xd375, 0xd376, 0x0000,
+  0xd377, 0x6535, 0x0000, 0xd378, 0xd379, 0xd37a, 0x0000, 0x6537,
+  0x0000, 0xd37b, 0x0000, 0x6534, 0x0000, 0x0000, 0xd37c, 0xd37d,
+  0x0000, 0x3751, 0x4233, 0x6539, 0x416e, 0xd37e, 0xd421, 0x6546,
+  0x0000, 0x0000, 0x6542, 0x653c, 0x0000, 0x0000, 0xd422, 0xd423,
+  0x0000, 0x0000, 0xd424, 0x6540, 0x3c7a, 0x305d, 0x653b, 0x6543,
+  0x6547, 0x394b, 0x4c56, 0xd425, 0x4456, 0x653d, 0xd426, 0xd427,
+  0x6545, 0xd428, 0x653a, 0x433e, 0x0000, 0x653f, 0x303d, 0x4c4a,
+  0x0000, 0x0000, 0xd429, 0xd42a, 0xd42b, 0xd42c, 0xd42d, 0x653e,
+  0x0000, 0x0000, 0x365b, 0x486c, 0xd42e, 0xd42f, 0xd430, 0x416d,
+  0x0000, 0x4e50, 0x3d6f, 0x0000, 0x0000, 0x656e, 0x0000, 0xd431,
+  0x6548, 0xd432, 0x407e, 0x0000, 0x6544, 0x6549, 0x654b, 0x0000,
+  0x4479, 0x654e, 0xd434, 0x0000, 0x654a, 0xd435, 0xd436, 0x0000,
+  0x4a54, 0x344b, 0xd437, 0xd438, 0x4c4b, 0xd439, 0x0000, 0x305e,
+  0x0000, 0xd43a, 0x654d, 0x0000, 0x4e7d, 0xd43b, 0xd43c, 0x0000,
+  0x0000, 0xd43d, 0xd43e, 0x654c, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 114 (U+7E00)
+  0xd433, 0x316f, 0x0000, 0x0000, 0x466c, 0x654f, 0x0000, 0x0000,
+  0xd43f, 0x6556, 0x6550, 0x6557, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xd440, 0xd441, 0x6553, 0x0000, 0x0000, 0xd442, 0x0000, 0xd443,
+  0x0000, 0x0000, 0x0000, 0x477b, 0xd444, 0xd445, 0x3c4a, 0x6555,
+  0xd446, 0x6552, 0x6558, 0x6551, 0x0000, 0x0000, 0x3d44, 0xd447,
+  0xd448, 0x0000, 0x0000, 0x4b25, 0xd449, 0xd44a, 0x3d4c, 0xd44b,
+  0x0000, 0x6554, 0x6560, 0xd44c, 0x0000, 0x655c, 0xd44d, 0x655f,
+  0x0000, 0x655d, 0x6561, 0x655b, 0x0000, 0x6541, 0x4053, 0xd44e,
+  0x0000, 0x484b, 0x0000, 0x655e, 0xd44f, 0xd450, 0x6559, 0xd451,
+  0x0000, 0x0000, 0x4121, 0x3752, 0x0000, 0x3d2b, 0xd452, 0x0000,
+  0xd453, 0x0000, 0xd454, 0x0000, 0x3f25, 0x4136, 0x6564, 0x0000,
+  0xd455, 0x6566, 0x6567, 0x0000, 0x0000, 0x6563, 0x6565, 0xd456,
+  0x0000, 0xd457, 0xd458, 0x0000, 0x0000, 0xd459, 0x655a, 0x6562,
+  0x0000, 0x656a, 0x6569, 0xd45a, 0x0000, 0x4b7a, 0xd45b, 0xd45c,
+  0x372b, 0x0000, 0x0000, 0xd45d, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xd45e, 0x6568, 0x0000, 0x656c, 0x656b, 0x656f, 0xd45f, 0x6571,
+ // page 115 (U+7E80)
+  0x0000, 0xd460, 0x3b3c, 0x656d, 0x0000, 0x0000, 0xd461, 0xd462,
+  0x6572, 0x6573, 0xd463, 0x0000, 0x6574, 0xd464, 0x657a, 0x453b,
+  0x6576, 0xd465, 0x6575, 0x6577, 0x6578, 0xd466, 0x6579, 0x0000,
+  0xd467, 0x0000, 0xd468, 0x657b, 0x657c, 0xd469, 0xd46a, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 116 (U+7F00)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x344c, 0x0000,
+  0x657d, 0x0000, 0x657e, 0xd46c, 0xd46b, 0xd46d, 0xd46e, 0xd46f,
+  0x0000, 0x0000, 0x0000, 0xd470, 0xd471, 0x6621, 0x0000, 0xd472,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x6622, 0x6623, 0x6624, 0xd473,
+  0x6625, 0x6626, 0xd474, 0xd475, 0x6628, 0x6627, 0x0000, 0x0000,
+  0x6629, 0x0000, 0x0000, 0xd476, 0xd477, 0xd478, 0x0000, 0x662a,
+  0x662b, 0xd479, 0x0000, 0xd47a, 0xd47b, 0xd47c, 0xd47d, 0x662e,
+  0x662c, 0x662d, 0x3a61, 0x3753, 0x0000, 0xd47e, 0x4356, 0x0000,
+  0x4833, 0xd521, 0x3d70, 0x0000, 0x0000, 0x474d, 0x0000, 0x486d,
+  0x662f, 0x586d, 0x0000, 0x0000, 0x0000, 0xd522, 0xd523, 0xd524,
+ // page 117 (U+7F80)
+  0xd525, 0x0000, 0x6630, 0x6632, 0x0000, 0x4d65, 0x6631, 0x6634,
+  0x6633, 0x0000, 0x4d53, 0xd526, 0x6635, 0xd527, 0x487e, 0xd528,
+  0xd529, 0xd52a, 0x0000, 0x0000, 0x6636, 0x0000, 0xd52b, 0xd52c,
+  0x0000, 0x0000, 0x6639, 0x0000, 0xd52d, 0x6638, 0x6637, 0x0000,
+  0x0000, 0xd52e, 0xd52f, 0x663a, 0x3732, 0x0000, 0xd530, 0x0000,
+  0x4122, 0x3541, 0xd531, 0x0000, 0x0000, 0xd532, 0x663e, 0x663b,
+  0x0000, 0x0000, 0x663c, 0x0000, 0xd533, 0x0000, 0x663f, 0x0000,
+  0x6640, 0x663d, 0x0000, 0x0000, 0xd534, 0x3129, 0x0000, 0xd535,
+  0xd536, 0x3227, 0x0000, 0xd537, 0x0000, 0x6642, 0x6643, 0x0000,
+  0xd538, 0x0000, 0x6644, 0x0000, 0x4d62, 0x0000, 0xd539, 0xd53a,
+  0x0000, 0x0000, 0x3d2c, 0x0000, 0x6646, 0x6645, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xd53b, 0x0000, 0x0000, 0x0000, 0xd53c,
+  0x3f69, 0x6647, 0x0000, 0xd53d, 0x0000, 0xd53e, 0x6648, 0x0000,
+  0xd53f, 0x6649, 0x0000, 0x3465, 0xd540, 0x0000, 0xd541, 0xd542,
+  0x344d, 0x0000, 0xd543, 0x664a, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x664b, 0xd544, 0x4b5d, 0x4d63, 0xd545, 0xd546, 0xd547,
+ // page 118 (U+8000)
+  0x4d54, 0x4f37, 0x0000, 0x394d, 0x664e, 0x3c54, 0x664d, 0xd548,
+  0xd549, 0x0000, 0xd54a, 0x664f, 0x3c29, 0xd54b, 0xd54c, 0xd54d,
+  0x4251, 0xd54e, 0x6650, 0xd54f, 0xd550, 0x394c, 0xd551, 0x4c57,
+  0x6651, 0x6652, 0x0000, 0x0000, 0x6653, 0xd552, 0xd553, 0xd554,
+  0xd555, 0x6654, 0x0000, 0x0000, 0xd556, 0x0000, 0xd557, 0x0000,
+  0x6655, 0x0000, 0x0000, 0x0000, 0xd558, 0x0000, 0xd559, 0x0000,
+  0xd55a, 0x0000, 0x0000, 0x3c2a, 0xd55b, 0xd55c, 0x4c6d, 0xd55d,
+  0x0000, 0xd55e, 0xd55f, 0x6657, 0xd560, 0x433f, 0xd561, 0x6656,
+  0xd562, 0x0000, 0x0000, 0x0000, 0xd563, 0x0000, 0x6659, 0x0000,
+  0x0000, 0x0000, 0x6658, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x665a, 0x0000, 0x0000, 0x0000, 0x403b, 0x0000,
+  0x665b, 0x0000, 0x665c, 0x0000, 0x0000, 0x0000, 0x4a39, 0x665d,
+  0xd564, 0x416f, 0x665e, 0x0000, 0xd565, 0x0000, 0xd566, 0x0000,
+  0x665f, 0x0000, 0x0000, 0x0000, 0x0000, 0xd567, 0x0000, 0x4e7e,
+  0x6662, 0xd568, 0x6661, 0x6660, 0x4430, 0xd569, 0x6663, 0x3f26,
+  0x0000, 0x6664, 0x0000, 0x0000, 0x0000, 0x6665, 0x4f38, 0x6666,
+ // page 119 (U+8080)
+  0x0000, 0xd56a, 0x0000, 0x0000, 0x6667, 0x6669, 0x6668, 0x4825,
+  0xd56b, 0x4679, 0x0000, 0x4f3e, 0x4829, 0x0000, 0xd56c, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x666b, 0x0000, 0x0000, 0x3e53, 0x0000,
+  0x492a, 0x0000, 0x666c, 0x666a, 0xd56d, 0x344e, 0xd56e, 0x0000,
+  0x0000, 0x3854, 0x3b68, 0x0000, 0x0000, 0x486e, 0xd56f, 0xd570,
+  0x0000, 0x382a, 0x4b43, 0xd571, 0x666f, 0x666d, 0x0000, 0x394e,
+  0x0000, 0x394f, 0x3069, 0x0000, 0x3a68, 0x0000, 0x0000, 0x0000,
+  0xd572, 0xd573, 0x4759, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x305f, 0x6674, 0x0000, 0x4340, 0x0000,
+  0xd574, 0x0000, 0x0000, 0x0000, 0x4758, 0xd575, 0x425b, 0xd576,
+  0x0000, 0x0000, 0xd577, 0x0000, 0xd578, 0xd579, 0x6676, 0xd57a,
+  0xd57b, 0x6672, 0x6675, 0x6670, 0x0000, 0x6673, 0x4b26, 0x0000,
+  0xd57c, 0x3855, 0x0000, 0x0000, 0x307d, 0x6671, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd57d, 0xd57e, 0x6678,
+  0xd621, 0x6679, 0xd622, 0xd623, 0x4639, 0x0000, 0xd624, 0x0000,
+  0x363b, 0xd625, 0xd626, 0x0000, 0x6726, 0x473d, 0xd627, 0x0000,
+ // page 120 (U+8100)
+  0x0000, 0x0000, 0x3b69, 0xd628, 0x0000, 0x363c, 0x4048, 0x4f46,
+  0x4c2e, 0x6677, 0x4054, 0xd629, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd62a, 0xd62b,
+  0xd62c, 0x0000, 0x3553, 0x667a, 0xd62d, 0x0000, 0xd62e, 0x0000,
+  0xd62f, 0x0000, 0x0000, 0x667c, 0xd630, 0x0000, 0x0000, 0xd631,
+  0x0000, 0x667b, 0x0000, 0x0000, 0xd632, 0x0000, 0x0000, 0x667d,
+  0xd633, 0x4326, 0x0000, 0x473e, 0x0000, 0xd634, 0x0000, 0x0000,
+  0x0000, 0x4431, 0xd635, 0x0000, 0xd636, 0x0000, 0x6723, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd637, 0x6722, 0xd638,
+  0x0000, 0x0000, 0xd639, 0x667e, 0xd63a, 0x0000, 0x3f55, 0x0000,
+  0x4965, 0x6725, 0xd63b, 0x6724, 0x3950, 0x4f53, 0x0000, 0xd63c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6735,
+  0xd63d, 0xd63e, 0x0000, 0x0000, 0x0000, 0x6729, 0x672a, 0xd63f,
+  0xd640, 0xd641, 0x0000, 0x3c70, 0x0000, 0xd642, 0x6728, 0xd643,
+  0x3978, 0x6727, 0x0000, 0x0000, 0x672b, 0x0000, 0x0000, 0xd644,
+  0x4432, 0x4a22, 0x4123, 0x0000, 0x0000, 0x0000, 0x0000, 0x425c,
+ // page 121 (U+8180)
+  0x672f, 0xd645, 0x6730, 0x672c, 0xd647, 0xd648, 0xd649, 0x0000,
+  0x672d, 0x0000, 0x672e, 0xd64a, 0x0000, 0x0000, 0xd64b, 0x3951,
+  0xd646, 0x0000, 0x0000, 0x6736, 0x0000, 0x6732, 0xd64c, 0x0000,
+  0xd64d, 0x0000, 0x4966, 0xd64e, 0x4b6c, 0x4928, 0xd64f, 0x0000,
+  0x6731, 0x0000, 0xd650, 0x6734, 0x6733, 0x0000, 0x0000, 0x0000,
+  0x4b44, 0x6737, 0x0000, 0x0000, 0x0000, 0x0000, 0xd651, 0x0000,
+  0x6738, 0x0000, 0xd652, 0x4137, 0xd653, 0x6739, 0x0000, 0x0000,
+  0x673b, 0x0000, 0x673f, 0xd654, 0x0000, 0x673c, 0x673a, 0x473f,
+  0x673d, 0x0000, 0x673e, 0xd656, 0x0000, 0xd657, 0x3232, 0x0000,
+  0x6745, 0x6740, 0xd658, 0xd655, 0x0000, 0x6741, 0xd659, 0xd65a,
+  0x0000, 0x6742, 0x0000, 0x4221, 0x0000, 0xd65b, 0x0000, 0xd65c,
+  0x6744, 0x6743, 0x6746, 0xd65d, 0x0000, 0xd65e, 0xd65f, 0x6747,
+  0x6748, 0xd660, 0x0000, 0x3f43, 0xd661, 0x3269, 0x0000, 0x6749,
+  0x4e57, 0x0000, 0x3c2b, 0xd662, 0xd663, 0x3d2d, 0x0000, 0x0000,
+  0xd664, 0xd665, 0xd666, 0x3b6a, 0x4357, 0xd667, 0xd668, 0x0000,
+  0xd669, 0xd66a, 0x674a, 0x674b, 0x3131, 0xd66b, 0x674c, 0xd66c,
+ // page 122 (U+8200)
+  0xd66d, 0x674d, 0x674e, 0xd66e, 0x0000, 0x674f, 0x0000, 0x6750,
+  0x363d, 0x5a2a, 0x6751, 0x0000, 0x4065, 0x6752, 0x3c4b, 0xd66f,
+  0x6753, 0x0000, 0x5030, 0xd670, 0xd671, 0x0000, 0x6754, 0x4a5e,
+  0x345c, 0xd672, 0xd673, 0x4124, 0x3d58, 0xd674, 0x4971, 0x3d2e,
+  0x0000, 0xd675, 0xd676, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xd677, 0x6755, 0x3952, 0x6756, 0x484c, 0x0000, 0x6764, 0x0000,
+  0x0000, 0x0000, 0xd678, 0x6758, 0xd679, 0x4249, 0x4775, 0x383f,
+  0x6757, 0x4125, 0xd67a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x6759, 0x0000, 0x0000, 0xd67b, 0xd67c, 0xd67d, 0xd67e, 0x447a,
+  0x0000, 0x0000, 0x0000, 0xd721, 0x0000, 0x0000, 0xd722, 0xd723,
+  0x0000, 0xd724, 0x0000, 0x0000, 0x0000, 0x0000, 0xd725, 0x0000,
+  0x675b, 0x675a, 0x675d, 0x0000, 0xd726, 0x675c, 0x0000, 0x675e,
+  0xd727, 0x0000, 0x6760, 0xd728, 0x675f, 0x0000, 0x344f, 0xd729,
+  0x6761, 0x0000, 0x6762, 0x6763, 0x0000, 0xd72a, 0x3a31, 0x4e49,
+  0x0000, 0x6765, 0x3f27, 0x0000, 0xd72b, 0x0000, 0x3170, 0x6766,
+  0x6767, 0x0000, 0x0000, 0xd72c, 0x0000, 0xd72d, 0x6768, 0xd72e,
+ // page 123 (U+8280)
+  0xd72f, 0xd730, 0x0000, 0xd731, 0xd732, 0x0000, 0x0000, 0xd733,
+  0x0000, 0xd734, 0xd735, 0x3072, 0x0000, 0x6769, 0xd736, 0x0000,
+  0x0000, 0xd737, 0x676a, 0x0000, 0xd738, 0x0000, 0xd739, 0x0000,
+  0xd73a, 0x4967, 0xd73b, 0xd73c, 0x0000, 0x3c47, 0x0000, 0x676c,
+  0xd73d, 0xd73e, 0x0000, 0xd73f, 0xd740, 0x3329, 0x3032, 0xd741,
+  0xd742, 0xd743, 0xd744, 0x676b, 0x676e, 0x474e, 0xd745, 0x3f44,
+  0xd746, 0x3256, 0xd747, 0x4b27, 0xd748, 0x0000, 0x0000, 0xd749,
+  0x375d, 0x365c, 0xd74a, 0x676d, 0xd74b, 0x326a, 0xd74c, 0xd74d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3423, 0xd74e, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xd74f, 0x3171, 0x6772, 0x4e6a, 0x425d, 0xd750, 0x0000, 0x4944,
+  0x0000, 0x677e, 0xd751, 0x3257, 0x677c, 0x0000, 0x677a, 0x6771,
+  0xd752, 0x676f, 0xd753, 0x6770, 0xd754, 0x3c63, 0x366c, 0x4377,
+  0xd755, 0x0000, 0xd756, 0x4651, 0x0000, 0xd757, 0x0000, 0xd758,
+  0x0000, 0x3151, 0x0000, 0x6774, 0x6773, 0x0000, 0xd759, 0xd75a,
+  0x0000, 0x6779, 0x6775, 0x6778, 0x0000, 0xd75b, 0xd75c, 0x0000,
+ // page 124 (U+8300)
+  0xd75d, 0xd75e, 0x4c50, 0x6777, 0x3258, 0x337d, 0x677b, 0xd75f,
+  0xd760, 0x677d, 0xd761, 0xd762, 0x0000, 0x0000, 0x3754, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6823, 0x682c,
+  0x682d, 0x0000, 0x0000, 0xd764, 0x302b, 0xd765, 0xd766, 0xd767,
+  0x0000, 0xd768, 0xd769, 0x6834, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3071, 0x0000, 0x0000, 0x682b, 0xd76a, 0xd76b, 0xd76c, 0x682a,
+  0xd76d, 0x6825, 0x6824, 0xd76e, 0x6822, 0x6821, 0x4363, 0xd76f,
+  0x427b, 0x6827, 0xd770, 0x0000, 0xd771, 0xd772, 0x0000, 0x0000,
+  0x6826, 0x0000, 0xd773, 0xd774, 0xd775, 0x6829, 0x0000, 0xd776,
+  0x0000, 0x4170, 0x3755, 0x0000, 0x0000, 0xd777, 0xd778, 0x3141,
+  0x6828, 0xd779, 0x3953, 0xd83e, 0xd763, 0xd77a, 0xd77b, 0xd77c,
+  0x4171, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xd77d, 0x0000, 0x0000, 0x683a, 0x0000, 0x683b, 0x0000, 0x3259,
+  0xd77e, 0x0000, 0x0000, 0x322e, 0x6838, 0xd821, 0x0000, 0xd822,
+ // page 125 (U+8380)
+  0xd823, 0x0000, 0xd824, 0x0000, 0xd825, 0x682e, 0xd826, 0x6836,
+  0x0000, 0x683d, 0x6837, 0x0000, 0x0000, 0xd827, 0x6835, 0x0000,
+  0x0000, 0x0000, 0xd828, 0x6776, 0xd829, 0xd82a, 0x6833, 0x0000,
+  0xd82b, 0xd82c, 0x682f, 0xd82d, 0xd82e, 0xd82f, 0x3450, 0x6831,
+  0x683c, 0x0000, 0x6832, 0x0000, 0x0000, 0x0000, 0xd830, 0xd831,
+  0x683e, 0xd832, 0x6830, 0x477c, 0xd833, 0xd84c, 0x0000, 0x0000,
+  0x0000, 0x4d69, 0x0000, 0x0000, 0x0000, 0x6839, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x684f, 0xd834, 0xd835,
+  0xd836, 0x6847, 0x0000, 0x0000, 0x0000, 0x3f7b, 0x0000, 0xd837,
+  0x0000, 0xd838, 0x3546, 0x0000, 0x365d, 0x0000, 0x6842, 0xd839,
+  0xd83a, 0xd83b, 0x0000, 0x325b, 0xd83c, 0x0000, 0x3e54, 0x0000,
+  0x6845, 0x0000, 0x0000, 0x0000, 0x3a5a, 0xd83d, 0x0000, 0x4551,
+  0x684a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xd83f, 0x4a6e, 0xd840, 0x6841, 0x0000, 0x0000, 0x0000, 0x325a,
+  0x3856, 0x4929, 0x684b, 0x0000, 0x683f, 0x0000, 0xd841, 0x6848,
+  0xd842, 0xd843, 0x0000, 0x6852, 0xd844, 0x6843, 0x0000, 0x0000,
+ // page 126 (U+8400)
+  0x0000, 0xd845, 0x0000, 0x6844, 0x463a, 0x0000, 0xd846, 0x6849,
+  0x0000, 0x0000, 0xd847, 0x6846, 0x4b28, 0x684c, 0x3060, 0xd848,
+  0x0000, 0xd849, 0x0000, 0x6840, 0x0000, 0xd84a, 0x0000, 0x0000,
+  0x0000, 0xd84b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x684e, 0x0000, 0x684d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x476b, 0x6854, 0x0000, 0x685f, 0x0000, 0x0000, 0xd84d,
+  0x0000, 0x337e, 0x0000, 0x0000, 0x0000, 0x6862, 0x0000, 0x0000,
+  0x6850, 0xd84e, 0x0000, 0x0000, 0x6855, 0x4d6e, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd84f, 0x685e, 0xd850,
+  0xd851, 0x4d55, 0xd852, 0x0000, 0x0000, 0xd853, 0x4e2a, 0xd854,
+  0x0000, 0xd855, 0xd856, 0x0000, 0x0000, 0x0000, 0xd857, 0x4378,
+  0xd858, 0xd859, 0xd85a, 0x336b, 0xd85b, 0x0000, 0x0000, 0x0000,
+  0xd85c, 0x4972, 0x6864, 0x4621, 0xd85d, 0xd85e, 0x3031, 0xd85f,
+  0x0000, 0x685d, 0xd860, 0x6859, 0x4172, 0x6853, 0x685b, 0x6860,
+  0xd861, 0x472c, 0x0000, 0xd862, 0xd863, 0x302a, 0xd864, 0x6858,
+  0xd865, 0x6861, 0x4978, 0x0000, 0xd866, 0xd867, 0x0000, 0x0000,
+ // page 127 (U+8480)
+  0x0000, 0xd868, 0x685c, 0x0000, 0x6857, 0xd869, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3e55, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3d2f, 0x0000, 0xd86a, 0xd86b, 0x3c2c, 0xd86c, 0x0000, 0x0000,
+  0x0000, 0x4c58, 0x0000, 0x0000, 0x4947, 0x0000, 0xd86d, 0x6867,
+  0x0000, 0x6870, 0x0000, 0x0000, 0x0000, 0x0000, 0xd86e, 0x0000,
+  0xd86f, 0xd870, 0xd871, 0x0000, 0x0000, 0x685a, 0x0000, 0xd872,
+  0x0000, 0xd873, 0x3377, 0x0000, 0xd874, 0x0000, 0x0000, 0x0000,
+  0x3e78, 0x6865, 0xd875, 0x686a, 0x4173, 0xd876, 0xd877, 0x6866,
+  0xd878, 0x686d, 0xd879, 0x0000, 0x435f, 0x0000, 0x686e, 0xd87a,
+  0xd87b, 0x4d56, 0x6863, 0x3338, 0xd87c, 0x6869, 0x0000, 0xd87d,
+  0x686c, 0x4c2c, 0x0000, 0xd87e, 0x0000, 0x0000, 0x686f, 0x0000,
+  0x0000, 0x6868, 0x686b, 0x0000, 0xd921, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd922,
+  0x0000, 0x0000, 0xd923, 0x0000, 0x4b29, 0x0000, 0x4f21, 0xd924,
+  0xd925, 0xd926, 0xd927, 0x0000, 0x6873, 0x0000, 0x0000, 0xd928,
+  0x0000, 0x0000, 0xd92a, 0xd92b, 0x687a, 0xd92c, 0x0000, 0x6872,
+ // page 128 (U+8500)
+  0x3c43, 0x0000, 0xd92d, 0xd92e, 0x0000, 0x0000, 0x6851, 0xd92f,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xd930, 0x0000, 0xd931, 0x0000,
+  0xd932, 0x4a4e, 0x0000, 0x4c22, 0x6879, 0x6878, 0x0000, 0x6874,
+  0x6875, 0x0000, 0x3136, 0x0000, 0xd933, 0x0000, 0xd934, 0x6877,
+  0x0000, 0x6871, 0xd935, 0xd936, 0xd937, 0xd938, 0x4455, 0xd939,
+  0x0000, 0x0000, 0xd93a, 0xd93b, 0x6876, 0x307e, 0x0000, 0xd93c,
+  0x0000, 0x0000, 0xd929, 0xd93d, 0xd93e, 0x4222, 0xd93f, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a43, 0x0000, 0xd940,
+  0x687b, 0x6921, 0x0000, 0x4859, 0x0000, 0x0000, 0xd941, 0x0000,
+  0x687e, 0x3e56, 0x3c49, 0x6923, 0x0000, 0x0000, 0x363e, 0xd942,
+  0xd943, 0xd944, 0xd945, 0xd946, 0x0000, 0x6924, 0xd947, 0x4979,
+  0x687d, 0xd948, 0x6856, 0x0000, 0xd949, 0xd94a, 0xd94b, 0xd94c,
+  0xd94d, 0xd94e, 0xd94f, 0x687c, 0xd950, 0x0000, 0x0000, 0x0000,
+  0x4f4f, 0x4622, 0x4973, 0xd951, 0x0000, 0x692b, 0x0000, 0xd952,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6931,
+  0x0000, 0xd953, 0xd954, 0xd955, 0x0000, 0xd956, 0x6932, 0xd957,
+ // page 129 (U+8580)
+  0x6925, 0xd958, 0x0000, 0x0000, 0x4776, 0xd959, 0xd95a, 0x692f,
+  0x6927, 0xd95b, 0x6929, 0xd95c, 0xd95d, 0x0000, 0x0000, 0xd95e,
+  0x6933, 0x6928, 0x0000, 0xd95f, 0x692c, 0x0000, 0x0000, 0x3172,
+  0xd960, 0x4665, 0x0000, 0x692d, 0x6930, 0xd961, 0x0000, 0xd962,
+  0xd963, 0x0000, 0xd964, 0x0000, 0x6926, 0xd965, 0x4126, 0xd966,
+  0x692a, 0x3b27, 0x3f45, 0x3730, 0x4c74, 0xd974, 0x4c79, 0x3d72,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xd967, 0x0000, 0xd968, 0xd969,
+  0xd96a, 0x6937, 0x6935, 0x0000, 0xd96b, 0xd96c, 0xd96d, 0xd96e,
+  0x0000, 0x4f4e, 0xd96f, 0x0000, 0x0000, 0x0000, 0x0000, 0xd970,
+  0x0000, 0x6934, 0xd971, 0xd972, 0x0000, 0x4d75, 0xd973, 0x6936,
+  0x6938, 0x0000, 0x0000, 0x0000, 0x0000, 0x6939, 0x0000, 0x0000,
+  0xd975, 0x0000, 0xd976, 0x0000, 0x693c, 0x693a, 0x0000, 0xd977,
+  0xd978, 0x0000, 0x0000, 0x0000, 0x4623, 0x693b, 0xd979, 0x0000,
+  0xd97a, 0x484d, 0x692e, 0x0000, 0x0000, 0xd97b, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xd97c, 0x0000, 0x0000, 0xd97d, 0x3d73,
+  0x0000, 0x693d, 0x6942, 0x4174, 0xd97e, 0x0000, 0x6941, 0xda21,
+ // page 130 (U+8600)
+  0xda22, 0x0000, 0x6922, 0x0000, 0xda23, 0xda24, 0x6943, 0x4149,
+  0x0000, 0x0000, 0x693e, 0x6940, 0x0000, 0xda25, 0xda26, 0x0000,
+  0xda27, 0xda28, 0xda29, 0x693f, 0x0000, 0x0000, 0x5d31, 0x5d22,
+  0xda2a, 0xda2b, 0x6945, 0xda2c, 0x0000, 0x0000, 0xda2d, 0x0000,
+  0x0000, 0xda2e, 0x6944, 0x0000, 0x0000, 0x0000, 0x0000, 0xda2f,
+  0x0000, 0xda30, 0x0000, 0x0000, 0x0000, 0x4d76, 0x0000, 0x623c,
+  0x6946, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xda31, 0x0000,
+  0xda32, 0x0000, 0xda33, 0x0000, 0xda34, 0xda35, 0x0000, 0x6947,
+  0xda36, 0xb866, 0xda37, 0x0000, 0x0000, 0x0000, 0xda38, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6948, 0x3857, 0x0000,
+  0x3554, 0x0000, 0xda39, 0xda3a, 0x694a, 0x515d, 0xda3b, 0xda3c,
+  0xda3d, 0xda3e, 0x3575, 0x0000, 0x4e3a, 0xda3f, 0x3673, 0x694b,
+  0xda40, 0xda41, 0xda42, 0xda43, 0xda44, 0x0000, 0x0000, 0x694c,
+  0x0000, 0xda45, 0x0000, 0x436e, 0xda46, 0x0000, 0x0000, 0xda47,
+  0x0000, 0x694d, 0x0000, 0x0000, 0x0000, 0xda48, 0xda49, 0xda4a,
+  0x0000, 0x467a, 0xda4b, 0x303a, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 131 (U+8680)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xda6d, 0x0000, 0x3263, 0x6952, 0x6953, 0xda4c, 0x0000, 0x0000,
+  0x0000, 0xda4d, 0x0000, 0x694e, 0x0000, 0x3b3d, 0xda4e, 0x0000,
+  0xda4f, 0x0000, 0xda50, 0x0000, 0xda51, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xda52, 0x0000, 0x694f, 0x4742, 0x0000, 0xda53, 0xda54,
+  0xda55, 0x6950, 0x6951, 0x695b, 0x0000, 0xda56, 0x0000, 0x6955,
+  0x6958, 0xda57, 0x0000, 0xda58, 0xda59, 0xda5a, 0x6954, 0xda5b,
+  0xda5c, 0xda5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xda5e,
+  0xda5f, 0xda60, 0x0000, 0xda61, 0x6956, 0xda62, 0x6957, 0x3c58,
+  0x0000, 0x6959, 0x0000, 0x4341, 0x0000, 0x3756, 0x3342, 0x0000,
+  0x0000, 0xda63, 0xda64, 0x0000, 0x695c, 0xda65, 0x0000, 0xda66,
+  0x0000, 0x333f, 0xda67, 0x6961, 0xda68, 0x0000, 0x695d, 0x6960,
+  0xda69, 0x0000, 0x0000, 0xda6a, 0x483a, 0xda6b, 0x0000, 0xda6c,
+  0x0000, 0x695e, 0x0000, 0x0000, 0x695f, 0x4948, 0x485a, 0x6962,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x427d, 0x696c, 0xda6e, 0x6968, 0xda6f, 0xda70, 0x326b, 0x0000,
+ // page 132 (U+8700)
+  0x6966, 0x0000, 0x4b2a, 0x6967, 0xda71, 0xda72, 0x6964, 0xda73,
+  0x6965, 0x696a, 0x696d, 0xda74, 0x0000, 0x696b, 0xda75, 0xda76,
+  0xda77, 0x6969, 0x6963, 0xda78, 0xda79, 0x0000, 0x0000, 0x0000,
+  0x4358, 0xda7a, 0x6974, 0x0000, 0x4c2a, 0x0000, 0xda7b, 0xda7c,
+  0x0000, 0xda7d, 0x0000, 0xda7e, 0x0000, 0x6972, 0x0000, 0x0000,
+  0xdb21, 0x6973, 0x0000, 0x0000, 0x0000, 0x0000, 0xdb22, 0xdb23,
+  0x0000, 0xdb24, 0xdb25, 0x0000, 0x696e, 0x0000, 0x0000, 0x6970,
+  0x0000, 0xdb26, 0xdb27, 0x6971, 0xdb28, 0xdb29, 0xdb2a, 0x696f,
+  0xdb2b, 0x0000, 0x0000, 0xdb2c, 0x0000, 0xdb2d, 0x0000, 0x0000,
+  0x0000, 0x4066, 0x0000, 0x4f39, 0x6978, 0xdb2e, 0x6979, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x6a21, 0x0000, 0x3f2a, 0x0000, 0x697b,
+  0xdb2f, 0x697e, 0x0000, 0x0000, 0x0000, 0xdb30, 0x0000, 0x6976,
+  0x6975, 0xdb31, 0x0000, 0x6a22, 0xdb32, 0xdb33, 0x325c, 0x0000,
+  0x697c, 0x0000, 0x6a23, 0x0000, 0x0000, 0x0000, 0x697d, 0xdb34,
+  0x0000, 0xdb35, 0xdb36, 0x0000, 0x697a, 0x0000, 0x4433, 0x0000,
+  0x6977, 0x0000, 0x0000, 0xdb37, 0x0000, 0x0000, 0x0000, 0x4768,
+ // page 133 (U+8780)
+  0x0000, 0x0000, 0x6a27, 0xdb38, 0xdb39, 0xdb3a, 0xdb3b, 0xdb3c,
+  0xdb3d, 0xdb3e, 0x0000, 0xdb3f, 0xdb40, 0x4d3b, 0x0000, 0x0000,
+  0xdb41, 0x0000, 0x0000, 0xdb42, 0x0000, 0xdb43, 0x0000, 0xdb44,
+  0xdb45, 0xdb46, 0x0000, 0x0000, 0x0000, 0x0000, 0xdb47, 0x6a26,
+  0xdb48, 0x0000, 0x6a25, 0xdb49, 0x0000, 0x0000, 0x0000, 0xdb4a,
+  0x0000, 0x0000, 0x0000, 0x6a2e, 0xdb4b, 0xdb4c, 0xdb4d, 0x6a28,
+  0x0000, 0xdb4e, 0x0000, 0x6a30, 0x0000, 0xdb4f, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x4d66, 0x6a33, 0x0000, 0x6a2a, 0xdb50, 0xdb51,
+  0x6a2b, 0xdb52, 0x0000, 0x0000, 0x6a2f, 0x0000, 0x6a32, 0x6a31,
+  0xdb53, 0xdb54, 0xdb55, 0x6a29, 0x0000, 0x0000, 0xdb56, 0x0000,
+  0x6a2c, 0x0000, 0x6a3d, 0x0000, 0x0000, 0xdb57, 0xdb58, 0x0000,
+  0x0000, 0xdb59, 0xdb5a, 0x0000, 0xdb5b, 0x0000, 0x0000, 0xdb5c,
+  0x6a36, 0x0000, 0xdb5d, 0xdb5e, 0xdb5f, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xdb60, 0xdb61, 0x0000, 0xdb62, 0x0000, 0x6a34,
+  0x0000, 0xdb63, 0x6a35, 0xdb64, 0x0000, 0x0000, 0x6a3a, 0x6a3b,
+  0xdb65, 0x332a, 0xdb66, 0x3542, 0x0000, 0x0000, 0x6a39, 0xdb67,
+ // page 134 (U+8800)
+  0x0000, 0xdb68, 0x0000, 0xdb69, 0x0000, 0x6a24, 0xdb6a, 0x0000,
+  0x0000, 0xdb6b, 0xdb6c, 0xdb6d, 0x0000, 0x6a38, 0x6a3c, 0x6a37,
+  0xdb6e, 0x6a3e, 0xdb70, 0xdb71, 0xdb72, 0x6a40, 0x6a3f, 0x0000,
+  0xdb73, 0xdb6f, 0xdb74, 0xdb75, 0xdb76, 0x0000, 0xdb77, 0xdb78,
+  0x0000, 0x6a42, 0x6a41, 0x695a, 0x0000, 0x0000, 0x0000, 0x6a46,
+  0xdb79, 0x0000, 0x0000, 0x0000, 0x0000, 0xdb7a, 0xdb7b, 0x0000,
+  0xdb7c, 0x6a43, 0xdb7d, 0x0000, 0x0000, 0xdb7e, 0x6a44, 0x0000,
+  0x0000, 0x6a45, 0xdc21, 0x6a47, 0xdc22, 0x0000, 0x0000, 0x0000,
+  0x376c, 0xdc23, 0x6a49, 0xdc24, 0x6a48, 0xdc25, 0x3d30, 0x0000,
+  0xdc26, 0xdc27, 0xdc28, 0xdc29, 0x3954, 0x5e27, 0xdc2a, 0x0000,
+  0x0000, 0xdc2b, 0x6a4a, 0x3d51, 0x0000, 0xdc2c, 0xdc2d, 0x3339,
+  0xdc2e, 0x6a4b, 0xdc2f, 0x3152, 0xdc30, 0x3e57, 0x6a4c, 0xdc31,
+  0xdc32, 0x3955, 0x6a4d, 0x3061, 0xdc33, 0x0000, 0x0000, 0x0000,
+  0x493d, 0xdc34, 0x0000, 0x6a4e, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3f6a, 0xdc35, 0x6a55, 0x0000, 0x0000, 0x6a52, 0x0000, 0x436f,
+  0x0000, 0xdc36, 0x0000, 0xdc37, 0x0000, 0x6a53, 0x6a50, 0x365e,
+ // page 135 (U+8880)
+  0xdc38, 0x6a4f, 0x6a56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3736, 0x0000, 0x0000, 0x425e, 0x0000, 0x6a5c, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x6a58, 0x0000, 0x0000, 0x0000, 0x4235, 0x6a57,
+  0xdc39, 0x6a5a, 0xdc3a, 0xdc3b, 0xdc3c, 0x0000, 0x6a51, 0xdc3d,
+  0xdc3e, 0x0000, 0x6a5b, 0x0000, 0x6a5d, 0x0000, 0x0000, 0x0000,
+  0xdc3f, 0x0000, 0xdc40, 0x486f, 0x0000, 0x0000, 0x6a59, 0x0000,
+  0x6a5e, 0x6a60, 0x0000, 0x0000, 0x3853, 0x6a54, 0x0000, 0x3041,
+  0x0000, 0x0000, 0xdc41, 0x0000, 0x0000, 0xdc42, 0xdc43, 0x6a5f,
+  0xdc44, 0x3a5b, 0x4e76, 0x6a61, 0x6a62, 0x4175, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xdc45, 0xdc46, 0xdc47, 0xdc48, 0xdc49, 0x4e22,
+  0x0000, 0xdc4a, 0xdc4b, 0xdc4c, 0x6a63, 0x4d35, 0x0000, 0x0000,
+  0x6a64, 0x6a65, 0x0000, 0xdc4d, 0x4a64, 0x6a66, 0xdc4e, 0x3a40,
+  0x0000, 0x4e23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdc4f,
+  0x6a6b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdc50,
+  0xdc51, 0xdc52, 0x6a6c, 0x3e58, 0x6a6a, 0xdc53, 0x0000, 0xdc54,
+  0x4d67, 0x6a67, 0x0000, 0x0000, 0x6a69, 0x403d, 0x3f7e, 0x0000,
+ // page 136 (U+8900)
+  0x0000, 0xdc55, 0x6a68, 0x0000, 0x6a6d, 0x0000, 0xdc56, 0x4a23,
+  0x0000, 0x0000, 0x6a6f, 0x0000, 0x6a6e, 0xdc57, 0xdc58, 0xdc59,
+  0x336c, 0x0000, 0x4b2b, 0x6a70, 0x0000, 0xdc5a, 0xdc5b, 0x0000,
+  0xdc5c, 0xdc5d, 0xdc5e, 0x0000, 0xdc5f, 0x6a7c, 0x6a72, 0x0000,
+  0xdc60, 0x0000, 0x0000, 0x0000, 0x0000, 0x6a73, 0xdc61, 0xdc62,
+  0xdc63, 0x0000, 0x6a74, 0x6a75, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xdc64, 0xdc65, 0xdc66, 0x0000, 0x0000, 0xdc67, 0x6a79, 0x0000,
+  0x6a7a, 0xdc68, 0xdc69, 0x6a78, 0x0000, 0x0000, 0xdc6a, 0x0000,
+  0xdc6b, 0x6a76, 0xdc6c, 0x6a71, 0x6a77, 0xdc6d, 0xdc6e, 0x0000,
+  0x0000, 0xdc6f, 0x0000, 0x0000, 0x6a7b, 0x7037, 0x0000, 0xdc70,
+  0x0000, 0x0000, 0xdc71, 0x0000, 0x0000, 0x0000, 0x3228, 0xdc72,
+  0x0000, 0x0000, 0xdc73, 0xdc74, 0xdc75, 0x0000, 0x6a7e, 0x365f,
+  0x6a7d, 0xdc76, 0xdc77, 0xdc78, 0x6b22, 0x0000, 0x6b21, 0x0000,
+  0x0000, 0x0000, 0x6b24, 0xdc79, 0x0000, 0x6b23, 0xdc7a, 0x6b25,
+  0xdc7b, 0x0000, 0x3d31, 0xdc7c, 0x6b26, 0xdc7d, 0x0000, 0x6b27,
+  0x0000, 0x0000, 0xdc7e, 0xdd21, 0xdd22, 0xdd23, 0x6b28, 0x403e,
+ // page 137 (U+8980)
+  0x0000, 0x4d57, 0x0000, 0x6b29, 0x0000, 0x0000, 0x4a24, 0x4746,
+  0x6b2a, 0xdd24, 0x6b2b, 0x382b, 0x0000, 0xdd25, 0x0000, 0x352c,
+  0xdd26, 0x0000, 0x0000, 0x6b2c, 0xdd27, 0xdd28, 0x3b6b, 0x4741,
+  0x6b2d, 0x0000, 0x3350, 0xdd29, 0xdd2a, 0x0000, 0x0000, 0xdd2b,
+  0xdd2c, 0x6b2e, 0x0000, 0x0000, 0x0000, 0xdd2d, 0x6b30, 0x4d77,
+  0x0000, 0x6b2f, 0x3f46, 0x0000, 0x6b31, 0x0000, 0x0000, 0x6b32,
+  0xdd2e, 0x0000, 0x6b33, 0x3451, 0xdd2f, 0xdd30, 0xdd31, 0xdd32,
+  0x0000, 0x0000, 0x6b34, 0x0000, 0xdd33, 0x6b35, 0x0000, 0x6b36,
+  0x6b37, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3351, 0x0000, 0xdd34, 0xdd35, 0xdd36, 0xdd37,
+  0xdd38, 0x0000, 0x6b38, 0x0000, 0x6b39, 0x6b3a, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3272, 0x0000, 0xdd39, 0x3f28, 0x6b3b,
+  0x0000, 0xdd3a, 0x0000, 0xdd3b, 0x0000, 0xdd3c, 0x0000, 0x0000,
+  0x0000, 0xdd3d, 0x0000, 0xdd3e, 0x6b3c, 0x0000, 0xdd3f, 0x0000,
+  0x6b3d, 0xdd40, 0x0000, 0x0000, 0x0000, 0xdd41, 0x0000, 0xdd42,
+ // page 138 (U+8A00)
+  0x3840, 0x0000, 0x447b, 0x6b3e, 0xdd43, 0xdd44, 0x0000, 0xdd45,
+  0x3757, 0x0000, 0x3f56, 0x0000, 0x6b41, 0x0000, 0x4624, 0xdd46,
+  0x6b40, 0xdd47, 0xdd48, 0x3731, 0xdd49, 0xdd4a, 0x6b3f, 0x4277,
+  0x352d, 0x0000, 0x0000, 0x6b42, 0x0000, 0x6b43, 0xdd4b, 0x3e59,
+  0xdd4c, 0x0000, 0xdd4d, 0x376d, 0xdd4e, 0x6b44, 0xdd4f, 0x0000,
+  0x0000, 0x0000, 0x4b2c, 0xdd50, 0xdd51, 0x405f, 0x0000, 0xdd52,
+  0x0000, 0x3576, 0x0000, 0x4c75, 0x414a, 0xdd53, 0x6b45, 0xdd54,
+  0x0000, 0x0000, 0x3f47, 0x4370, 0x3e5a, 0xdd55, 0xdd56, 0x0000,
+  0xdd57, 0x6b46, 0x0000, 0xdd58, 0x0000, 0xdd59, 0x6b49, 0xdd5a,
+  0x6b4a, 0xdd5b, 0x0000, 0x0000, 0x0000, 0xdd5c, 0xdd5d, 0x0000,
+  0x3a3e, 0x4242, 0x6b48, 0xdd5e, 0x3e5b, 0x493e, 0xdd5f, 0xdd60,
+  0xdd61, 0x0000, 0x0000, 0x6b47, 0xdd62, 0xdd63, 0x3b6c, 0x0000,
+  0x3153, 0xdd64, 0x6b4e, 0x3758, 0x0000, 0xdd65, 0x3b6e, 0xdd66,
+  0x0000, 0x3b6d, 0x0000, 0x4f4d, 0x6b4d, 0x6b4c, 0x4127, 0x0000,
+  0x354d, 0x4f43, 0x333a, 0x3e5c, 0x0000, 0xdd67, 0xdd68, 0xdd69,
+  0x0000, 0xdd6a, 0xdd6b, 0xdd6c, 0x6b4b, 0x0000, 0xdd6d, 0xdd6e,
+ // page 139 (U+8A80)
+  0xdd6f, 0x0000, 0x6b50, 0xdd70, 0x6b51, 0x6b4f, 0xdd71, 0x3858,
+  0x0000, 0x4d40, 0x0000, 0xdd72, 0x3b6f, 0x4727, 0x0000, 0xdd73,
+  0xdd74, 0x6b54, 0xdd75, 0x4040, 0x0000, 0x4342, 0xdd76, 0xdd77,
+  0x4d36, 0xdd78, 0x6b57, 0x0000, 0x0000, 0x0000, 0x386c, 0xdd79,
+  0x403f, 0x6b53, 0x0000, 0x6b58, 0x386d, 0x6b55, 0x6b56, 0xdd7a,
+  0x6b52, 0xdd7b, 0x0000, 0x0000, 0x4062, 0x4649, 0xdd7c, 0xdd7d,
+  0x432f, 0x0000, 0x325d, 0xdd7e, 0x0000, 0x0000, 0xde21, 0xde22,
+  0x0000, 0x4870, 0x0000, 0xde23, 0x3543, 0x0000, 0xde24, 0x4434,
+  0x0000, 0x0000, 0x6b5b, 0xde25, 0x6b59, 0x0000, 0xde26, 0x434c,
+  0xde27, 0xde28, 0xde29, 0x4041, 0x3452, 0x6b5a, 0x0000, 0x3f5b,
+  0x0000, 0xde2a, 0x4e4a, 0xde2b, 0xde2c, 0xde2d, 0x4f40, 0xde2e,
+  0x0000, 0x0000, 0x6b5c, 0x6b67, 0x4435, 0xde2f, 0x6b66, 0xde30,
+  0x6b63, 0x6b6b, 0x6b64, 0x0000, 0x6b60, 0x0000, 0x447c, 0x6b5f,
+  0x0000, 0x0000, 0x0000, 0x6b5d, 0xde31, 0x4d21, 0x3b70, 0x0000,
+  0xde32, 0x6b61, 0x0000, 0x6b5e, 0xde33, 0xde34, 0xde35, 0x6b65,
+  0x3d74, 0x0000, 0x3841, 0x0000, 0xde36, 0x0000, 0x427a, 0xde37,
+ // page 140 (U+8B00)
+  0x4b45, 0x315a, 0x3062, 0x0000, 0x4625, 0xde38, 0xde39, 0x6b69,
+  0x0000, 0x0000, 0xde3f, 0xde3a, 0x6b68, 0x0000, 0x4666, 0x0000,
+  0x6b6d, 0xde3b, 0x0000, 0x0000, 0x6b62, 0x0000, 0x6b6c, 0x6b6e,
+  0x0000, 0x382c, 0x6b6a, 0x3956, 0xde3c, 0x3c55, 0xde3d, 0xde3e,
+  0x6b6f, 0x4d58, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b72, 0x0000,
+  0x6b75, 0x0000, 0x0000, 0x6b73, 0x4935, 0xde40, 0x0000, 0x0000,
+  0xde41, 0x0000, 0x0000, 0x6b70, 0x0000, 0x0000, 0x0000, 0xde42,
+  0x0000, 0x3660, 0x0000, 0x0000, 0xde43, 0x0000, 0x6b74, 0x0000,
+  0x0000, 0x6b76, 0xde44, 0xde45, 0xde46, 0xde47, 0xde48, 0x0000,
+  0xde49, 0x6b7a, 0x0000, 0x0000, 0x6b77, 0xde4e, 0x6b79, 0x6b78,
+  0x0000, 0x0000, 0xde4a, 0xde4b, 0xde4c, 0x0000, 0x6b7b, 0x0000,
+  0x3c31, 0xde4d, 0x6b7d, 0x6b7c, 0x4968, 0x0000, 0xde4f, 0x6c21,
+  0x0000, 0x0000, 0x0000, 0xde50, 0x0000, 0x0000, 0x3759, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x6b7e, 0x6c22, 0xde51, 0x0000, 0x6c23,
+  0x3544, 0x6641, 0x3e79, 0x0000, 0x6c24, 0x0000, 0xde52, 0x386e,
+  0xde53, 0xde54, 0x0000, 0x0000, 0xde55, 0x6c25, 0xde56, 0x0000,
+ // page 141 (U+8B80)
+  0x6c26, 0xde57, 0x0000, 0x3b3e, 0xde58, 0xde59, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x5a4e, 0xde5a, 0x6c27, 0xde5b, 0x6c28, 0xde5c,
+  0x3d32, 0x0000, 0x6c29, 0x6c2a, 0xde5d, 0xde5e, 0x6c2b, 0x0000,
+  0x0000, 0x6c2c, 0x6c2d, 0x0000, 0xde5f, 0x0000, 0xde60, 0xde61,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 142 (U+8C00)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x432b,
+  0xde62, 0xde63, 0x6c2e, 0x0000, 0x0000, 0xde64, 0xde65, 0x6c30,
+  0x0000, 0x6c2f, 0x0000, 0x0000, 0x0000, 0xde66, 0x4626, 0xde67,
+  0x6c31, 0xde68, 0x4b2d, 0xde69, 0x6c32, 0x0000, 0x6c33, 0xde6a,
+  0x6c34, 0xde6b, 0x0000, 0xde6c, 0xde6d, 0x6c35, 0x0000, 0xde6e,
+  0xde6f, 0xde72, 0x465a, 0xde70, 0x0000, 0xde71, 0x0000, 0x0000,
+  0x0000, 0x3e5d, 0x6c36, 0xde73, 0xde74, 0x0000, 0xde75, 0x0000,
+  0xde76, 0xde77, 0x396b, 0x502e, 0x6c37, 0xde78, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xde79, 0x0000, 0xde7a, 0xde7b, 0x0000,
+  0x6c38, 0x493f, 0x6c39, 0xde7c, 0x6c41, 0x0000, 0xde7d, 0x0000,
+ // page 143 (U+8C80)
+  0x0000, 0x0000, 0x6c3a, 0x0000, 0x0000, 0x6c3c, 0xde7e, 0xdf21,
+  0x0000, 0x6c3b, 0x6c3d, 0xdf22, 0x4b46, 0x6c3e, 0x6c3f, 0x0000,
+  0xdf23, 0x0000, 0xdf24, 0xdf25, 0x6c40, 0x0000, 0x0000, 0x0000,
+  0x6c42, 0xdf26, 0x0000, 0xdf27, 0xdf28, 0x332d, 0x4467, 0x0000,
+  0x4969, 0x3a62, 0x3957, 0x0000, 0xdf29, 0x0000, 0x0000, 0x494f,
+  0x325f, 0x484e, 0x6c45, 0x3453, 0x4055, 0x6c44, 0x6c49, 0x4379,
+  0x4c63, 0x0000, 0x6c47, 0x6c48, 0x352e, 0x0000, 0x6c4a, 0x4763,
+  0x425f, 0xdf2a, 0xdf2b, 0x4871, 0x453d, 0x6c46, 0x0000, 0x4b47,
+  0x326c, 0x6c4c, 0x4f28, 0x4442, 0x4f45, 0xdf2c, 0xdf2d, 0x3b71,
+  0x6c4b, 0xdf2e, 0x4231, 0xdf2f, 0x0000, 0x6c5c, 0x4128, 0xdf30,
+  0x0000, 0x4678, 0x0000, 0x4950, 0x0000, 0xdf32, 0xdf31, 0x0000,
+  0x0000, 0xdf33, 0x6c4f, 0x3b3f, 0x3b72, 0xdf34, 0x3e5e, 0x0000,
+  0x4765, 0xdf35, 0x382d, 0x6c4e, 0x6c4d, 0x0000, 0x496a, 0x0000,
+  0xdf36, 0x0000, 0x3c41, 0x0000, 0xdf37, 0x4552, 0x0000, 0xdf38,
+  0xdf39, 0x0000, 0xdf3a, 0x0000, 0x0000, 0xdf3b, 0x0000, 0xdf3c,
+  0xdf3d, 0x0000, 0x6c51, 0x6c52, 0x3958, 0x6c50, 0xdf3e, 0xdf3f,
+ // page 144 (U+8D00)
+  0x0000, 0xdf40, 0x0000, 0xdf41, 0x6c53, 0x6c54, 0x0000, 0x6c56,
+  0x4223, 0xdf42, 0x6c55, 0x3466, 0x0000, 0x6c58, 0x0000, 0x6c57,
+  0x6c59, 0x0000, 0xdf43, 0x6c5b, 0x6c5d, 0x0000, 0x6c5e, 0xdf44,
+  0x0000, 0x0000, 0x0000, 0xdf45, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x4056, 0xdf46, 0x3c4f, 0x6c5f,
+  0x0000, 0xdf47, 0x0000, 0x3352, 0xdf48, 0x6c60, 0xdf49, 0x0000,
+  0x4176, 0x6c61, 0x0000, 0x6c62, 0x496b, 0x0000, 0x0000, 0x352f,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdf4a,
+ // page 145 (U+8D80)
+  0x0000, 0x6c63, 0xdf4b, 0x0000, 0xdf4c, 0x4436, 0x0000, 0x0000,
+  0xdf4d, 0x0000, 0x315b, 0x0000, 0x0000, 0xdf4e, 0x0000, 0x0000,
+  0xdf4f, 0xdf50, 0x0000, 0x0000, 0x0000, 0xdf51, 0x0000, 0x0000,
+  0x0000, 0x6c64, 0x0000, 0x0000, 0x0000, 0x0000, 0xdf52, 0xdf53,
+  0xdf54, 0x0000, 0x0000, 0x3c71, 0x0000, 0x0000, 0xdf55, 0x0000,
+  0x3f76, 0x0000, 0x0000, 0xdf56, 0xdf57, 0x0000, 0x0000, 0xdf58,
+  0x0000, 0x0000, 0xdf59, 0x422d, 0x0000, 0xdf5a, 0x0000, 0xdf5b,
+  0x0000, 0xdf5c, 0x6c67, 0xdf5d, 0xdf6f, 0x0000, 0x6c66, 0x0000,
+  0xdf5e, 0x0000, 0x6c65, 0x0000, 0x0000, 0xdf5f, 0xdf60, 0xdf61,
+  0xdf62, 0x0000, 0xdf63, 0x6c6d, 0x6c6b, 0x0000, 0xdf64, 0x6c68,
+  0x0000, 0xdf65, 0x0000, 0x0000, 0xdf66, 0xdf67, 0x6c6a, 0xdf68,
+  0x0000, 0xdf69, 0x6c69, 0x6c6c, 0x0000, 0x3577, 0x0000, 0x6c70,
+  0x0000, 0x4057, 0x0000, 0x6c71, 0xdf6a, 0xdf6b, 0x0000, 0xdf6c,
+  0x3859, 0x0000, 0x6c6e, 0x6c6f, 0xdf6d, 0x0000, 0x0000, 0x4f29,
+  0xdf6e, 0xdf70, 0xdf71, 0x4437, 0xdf72, 0x4129, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x6c72, 0xdf73, 0x0000, 0x6c75,
+ // page 146 (U+8E00)
+  0x0000, 0xdf74, 0x0000, 0x0000, 0xdf75, 0xdf76, 0xdf77, 0x0000,
+  0x6c73, 0x6c74, 0x4d59, 0xdf78, 0x0000, 0x0000, 0x0000, 0x4627,
+  0x6c78, 0xdf79, 0x0000, 0x0000, 0xdf7a, 0x0000, 0xdf7b, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6c76, 0x6c77, 0x6c79,
+  0xdf7c, 0xdf7d, 0xdf7e, 0xe021, 0x0000, 0x0000, 0xe022, 0xe023,
+  0x0000, 0x0000, 0x6d29, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x6c7c, 0xe024, 0x0000, 0xe025, 0x6c7d, 0x6c7b, 0xe026, 0xe027,
+  0xe028, 0xe029, 0x0000, 0x0000, 0x0000, 0xe02a, 0x0000, 0x0000,
+  0xe02b, 0xe02c, 0x6c7a, 0x0000, 0x447d, 0x0000, 0x0000, 0x6d21,
+  0x6d25, 0x6d22, 0x6c7e, 0xe02d, 0x6d23, 0xe02e, 0xe02f, 0xe030,
+  0x6d24, 0x0000, 0x0000, 0x0000, 0xe031, 0x6d2b, 0x0000, 0x0000,
+  0x0000, 0x6d26, 0x0000, 0xe032, 0xe033, 0xe034, 0xe035, 0x4058,
+  0x6d28, 0xe036, 0xe037, 0x6d2a, 0x6d27, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xe038, 0x0000, 0x0000, 0xe039, 0xe03a, 0x0000, 0xe03b,
+  0xe03c, 0xe03d, 0x6d2d, 0x0000, 0x3d33, 0x0000, 0x6d2c, 0x0000,
+  0x0000, 0xe03e, 0xe03f, 0xe040, 0x6d2e, 0x0000, 0x0000, 0x0000,
+ // page 147 (U+8E80)
+  0x0000, 0x6d2f, 0xe041, 0xe042, 0x6d32, 0x6d31, 0x0000, 0x6d30,
+  0x0000, 0xe043, 0x6d34, 0x6d33, 0x0000, 0x4c76, 0x0000, 0x0000,
+  0xe044, 0x6d36, 0xe045, 0x6d35, 0x6d37, 0xe046, 0x0000, 0x0000,
+  0x0000, 0x6d38, 0xe047, 0xe048, 0x0000, 0xe049, 0xe04a, 0x0000,
+  0x0000, 0x6d3a, 0xe04b, 0x0000, 0x0000, 0x0000, 0x0000, 0xe04c,
+  0x0000, 0xe04d, 0x6d39, 0x3f48, 0x6d3b, 0xe04e, 0xe04f, 0x366d,
+  0x6d3c, 0x6d3e, 0x0000, 0xe050, 0x0000, 0xe051, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xe052, 0xe053, 0x0000, 0x0000, 0x6d3f, 0x0000,
+  0xe054, 0xe055, 0x0000, 0xe056, 0xe057, 0x6d40, 0x6d3d, 0xe058,
+  0x6d41, 0x0000, 0x3c56, 0x6d42, 0x3530, 0x3733, 0x0000, 0xe059,
+  0x0000, 0xe05a, 0x382e, 0x0000, 0xe05b, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x6d43, 0xe05c, 0x0000, 0x0000, 0x4670,
+  0x0000, 0x0000, 0x453e, 0x6d44, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xe05d, 0x0000, 0x0000, 0x6d47, 0x0000, 0xe064, 0xe05e, 0x0000,
+  0xe05f, 0xe060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe061,
+  0x3c34, 0xe062, 0xe063, 0x6d46, 0x6d45, 0x375a, 0x6d48, 0x0000,
+ // page 148 (U+8F00)
+  0xe065, 0x0000, 0xe066, 0x3353, 0x0000, 0x6d4a, 0x0000, 0xe067,
+  0xe068, 0x3a5c, 0x6d49, 0x0000, 0x6d52, 0x0000, 0x0000, 0xe069,
+  0xe06a, 0x0000, 0x6d4c, 0x6d4e, 0x4a65, 0x6d4b, 0xe06b, 0xe06c,
+  0xe06d, 0x6d4d, 0x0000, 0x6d51, 0x6d4f, 0x3531, 0xe06e, 0x6d50,
+  0xe06f, 0xe070, 0x0000, 0xe071, 0x0000, 0xe072, 0x6d53, 0xe073,
+  0xe074, 0x475a, 0x4e58, 0x0000, 0xe075, 0xe076, 0xe077, 0x3d34,
+  0x0000, 0x0000, 0x0000, 0x6d54, 0xe078, 0xe079, 0xe07a, 0xe07b,
+  0x4d22, 0x6d56, 0xe07c, 0x6d55, 0x0000, 0x0000, 0x6d59, 0x4d41,
+  0xe07d, 0xe07e, 0x6d58, 0xe121, 0x336d, 0x6d57, 0x6d5c, 0xe122,
+  0x0000, 0x6d5b, 0x0000, 0x0000, 0x6d5a, 0x4532, 0x6d5d, 0xe123,
+  0x0000, 0xe124, 0xe125, 0xe126, 0xe127, 0xe128, 0x0000, 0x6d5e,
+  0xe129, 0x0000, 0x0000, 0x0000, 0x6d5f, 0xe12a, 0xe12b, 0x396c,
+  0x0000, 0x3725, 0x6d60, 0x6d61, 0x6d62, 0xe12c, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 149 (U+8F80)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3f49, 0x6d63, 0xe12d, 0x3c2d, 0x6d64,
+  0xe12e, 0xe12f, 0x0000, 0x6d65, 0xe130, 0xe131, 0xe132, 0x5221,
+  0x517e, 0x0000, 0x0000, 0x0000, 0x0000, 0x6d66, 0x6570, 0x6d67,
+  0x4324, 0x3f2b, 0x4740, 0x0000, 0x0000, 0xe133, 0xe134, 0x6d68,
+  0xe135, 0x0000, 0x4a55, 0x4454, 0x397e, 0x0000, 0xe136, 0x4329,
+  0xe137, 0xe138, 0x312a, 0x0000, 0x4b78, 0x3f57, 0xe139, 0x0000,
+  0x0000, 0x0000, 0xe13a, 0xe13b, 0x0000, 0xe13c, 0x375e, 0x0000,
+  0xe13d, 0x3661, 0xe13e, 0xe13f, 0x4a56, 0xe140, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x6d69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xe141, 0x0000, 0x6d6b, 0xe142, 0xe143, 0x6d6a, 0x3260, 0x0000,
+  0xe144, 0x4676, 0x6d6c, 0x4777, 0x0000, 0x4533, 0xe145, 0x6d6d,
+  0x3d52, 0xe146, 0x0000, 0x0000, 0x6d6f, 0xe147, 0xe148, 0x4c42,
+  0x6d7e, 0x6d71, 0x6d72, 0xe149, 0x0000, 0x4449, 0xe14a, 0x0000,
+ // page 150 (U+9000)
+  0x4260, 0x4177, 0xe14b, 0x4628, 0xe14c, 0x6d70, 0x3555, 0x0000,
+  0xe14d, 0x0000, 0x0000, 0x6d79, 0xe14e, 0x6d76, 0x6e25, 0x4629,
+  0x4360, 0x6d73, 0x0000, 0x447e, 0x4553, 0x6d74, 0x6d78, 0x3f60,
+  0xe14f, 0x4767, 0x444c, 0xe150, 0x0000, 0x4042, 0x6d77, 0x422e,
+  0x4224, 0x6d75, 0x3029, 0x4f22, 0x0000, 0x0000, 0x0000, 0x6d7a,
+  0xe151, 0xe152, 0xe154, 0x0000, 0xe155, 0xe156, 0x4261, 0xe153,
+  0x0000, 0x3d35, 0x3f4a, 0xe157, 0xe158, 0x6d7c, 0x6d7b, 0xe159,
+  0x306f, 0x6d7d, 0x0000, 0x0000, 0x492f, 0x0000, 0x6e27, 0xe15a,
+  0x0000, 0x465b, 0x3f6b, 0xe15b, 0xe15c, 0x4359, 0x0000, 0x3678,
+  0x0000, 0x6e26, 0x4d37, 0x313f, 0xe15d, 0x4a57, 0x3261, 0x6e21,
+  0x6e22, 0x6e23, 0x6e24, 0x463b, 0x4323, 0x3063, 0x6e28, 0x0000,
+  0x6e29, 0x7423, 0x0000, 0xe15e, 0x423d, 0xe15f, 0x6e2a, 0x0000,
+  0x3173, 0x414c, 0xe160, 0x382f, 0x0000, 0x4d5a, 0xe161, 0xe162,
+  0x6e2b, 0x452c, 0x0000, 0x0000, 0xe163, 0x4178, 0x3c57, 0x6e2c,
+  0xe164, 0x0000, 0x6e2f, 0x0000, 0xe165, 0x3d65, 0x6e2d, 0x412b,
+  0x412a, 0xe166, 0x3064, 0x0000, 0x4e4b, 0x6e31, 0x0000, 0x4872,
+ // page 151 (U+9080)
+  0x6e33, 0x6e32, 0x6e30, 0x6364, 0x3454, 0xe167, 0x0000, 0x6d6e,
+  0xe168, 0x6e35, 0x6e34, 0xe169, 0xe16a, 0x0000, 0xe16b, 0x6e36,
+  0xe16c, 0x4d38, 0x0000, 0x0000, 0x0000, 0xe16d, 0x0000, 0xe16e,
+  0xe16f, 0xe170, 0x0000, 0xe171, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xe172, 0xe173, 0xe174, 0x4661, 0x0000, 0xe175, 0x4b2e, 0x0000,
+  0x6e37, 0x0000, 0x3c59, 0x0000, 0x0000, 0x0000, 0x0000, 0x6e38,
+  0xe176, 0x6e39, 0xe177, 0xe178, 0xe179, 0x6e3a, 0xe17a, 0x0000,
+  0x4521, 0x0000, 0x0000, 0x0000, 0x0000, 0xe17b, 0xe17d, 0x0000,
+  0x0000, 0x306a, 0x0000, 0xe17e, 0xe221, 0xe222, 0x0000, 0xe223,
+  0xe224, 0x0000, 0x3959, 0x0000, 0xe17c, 0x0000, 0x4f3a, 0x0000,
+  0x0000, 0x0000, 0xe22d, 0x0000, 0x0000, 0xe225, 0x0000, 0xe226,
+  0xe227, 0xe228, 0x0000, 0x6e3e, 0xe229, 0xe22a, 0x0000, 0xe22b,
+  0x0000, 0x3734, 0x6e3b, 0x0000, 0x6e3c, 0xe22c, 0x0000, 0x0000,
+  0x4974, 0x0000, 0x0000, 0xe22f, 0x0000, 0x3354, 0x0000, 0xe230,
+  0xe231, 0x0000, 0x0000, 0x0000, 0xe232, 0x4d39, 0xe22e, 0x363f,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4554, 0xe233, 0xe234,
+ // page 152 (U+9100)
+  0xe235, 0x0000, 0x6e3f, 0x0000, 0xe236, 0xe237, 0xe238, 0x0000,
+  0xe239, 0x0000, 0x0000, 0x0000, 0x0000, 0xe23a, 0x0000, 0x0000,
+  0xe23b, 0x0000, 0x6e40, 0x0000, 0xe23c, 0x0000, 0xe23d, 0xe23e,
+  0xe23f, 0x6e41, 0xe240, 0x0000, 0xe241, 0x0000, 0xe242, 0x0000,
+  0xe243, 0x0000, 0xe245, 0xe246, 0x0000, 0xe244, 0x0000, 0xe247,
+  0x0000, 0xe248, 0x0000, 0x0000, 0x0000, 0x4522, 0xe249, 0xe24a,
+  0x6e43, 0xe24b, 0x6e42, 0x0000, 0xe24c, 0x0000, 0xe24d, 0xe24e,
+  0x0000, 0xe24f, 0xe250, 0x0000, 0xe251, 0xe252, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xe253, 0x0000, 0x0000, 0x0000, 0xe254,
+  0xe255, 0x4653, 0x6e44, 0x3d36, 0x3c60, 0x475b, 0x4371, 0xe256,
+  0x0000, 0x0000, 0x3c72, 0xe257, 0x3f6c, 0x0000, 0x6e45, 0xe258,
+  0x6e46, 0xe259, 0xe25a, 0xe25b, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xe25c, 0x3f5d, 0x6e47, 0xe25d, 0x6e48, 0x0000, 0xe25e,
+  0x0000, 0x6e49, 0x4d6f, 0x0000, 0x3d37, 0xe25f, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x6e4b, 0x6e4a, 0xe260, 0x395a, 0x0000, 0x3973,
+  0x3b40, 0xe261, 0xe262, 0xe263, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 153 (U+9180)
+  0x0000, 0xe264, 0x6e4e, 0xe265, 0x0000, 0xe266, 0xe267, 0x3d66,
+  0x0000, 0x6e4d, 0xe268, 0x6e4c, 0x0000, 0x4269, 0xe269, 0x0000,
+  0x386f, 0xe26a, 0x4043, 0xe26b, 0xe26c, 0xe26d, 0x0000, 0x4830,
+  0xe26e, 0x0000, 0x0000, 0x0000, 0x3d39, 0x0000, 0xe26f, 0x0000,
+  0x0000, 0xe270, 0x6e4f, 0x0000, 0x3e5f, 0x0000, 0xe271, 0x0000,
+  0xe272, 0x0000, 0x6e52, 0x6e50, 0xe273, 0xe274, 0xe275, 0x6e51,
+  0xe276, 0xe277, 0xe278, 0xe279, 0x6e54, 0x6e53, 0xe27a, 0x0000,
+  0x3e7a, 0x0000, 0x6e55, 0xe27b, 0xe27c, 0xe27d, 0x0000, 0xe27e,
+  0x6e56, 0x6e57, 0xe321, 0xe322, 0x0000, 0xe323, 0x4850, 0x3a53,
+  0x3c61, 0x6e58, 0x0000, 0x6e59, 0x4e24, 0x3d45, 0x4c6e, 0x4e4c,
+  0x6e5a, 0x3662, 0x0000, 0xe324, 0xe325, 0x0000, 0x6e5b, 0xe326,
+  0x4523, 0xe327, 0xe328, 0x6e5e, 0x3378, 0x3f4b, 0xe329, 0x6e5c,
+  0x0000, 0x6e5d, 0x0000, 0x4460, 0xe32a, 0xe32b, 0x4b55, 0x367c,
+  0x0000, 0xe32c, 0xe32d, 0x0000, 0xe32e, 0xe32f, 0xe330, 0xe331,
+  0xe332, 0xe333, 0x0000, 0x0000, 0x0000, 0x6e60, 0x6e61, 0xe334,
+  0x0000, 0xe335, 0x0000, 0xe336, 0x6e5f, 0xe337, 0x0000, 0x6e63,
+ // page 154 (U+9200)
+  0xe338, 0xe339, 0x0000, 0x0000, 0xe33a, 0xe33b, 0xe33c, 0xe33d,
+  0x0000, 0xe33e, 0xe33f, 0x0000, 0xe340, 0x465f, 0x3343, 0x0000,
+  0xe341, 0x6e67, 0xe342, 0xe343, 0x6e64, 0x6e66, 0xe344, 0x0000,
+  0xe345, 0x0000, 0x0000, 0x0000, 0xe346, 0xe347, 0x6e62, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xe348, 0xe349, 0xe34a, 0xe34b, 0x0000,
+  0xe34c, 0x6f4f, 0x0000, 0x0000, 0x6e65, 0x0000, 0xe34d, 0xe34e,
+  0xe34f, 0x0000, 0x0000, 0xe350, 0x4e6b, 0xe351, 0xe352, 0x385a,
+  0xe353, 0xe354, 0xe355, 0x0000, 0xe356, 0x0000, 0xe357, 0x6e6f,
+  0xe358, 0x0000, 0xe359, 0xe35a, 0x4534, 0x6e6a, 0xe35b, 0xe35c,
+  0x6e6d, 0x6e6b, 0xe35d, 0x6e70, 0x0000, 0xe35e, 0xe35f, 0xe360,
+  0x6e71, 0xe361, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6e69,
+  0xe362, 0xe363, 0x6e76, 0x3174, 0xe364, 0xe365, 0x6e68, 0x0000,
+  0xe366, 0xe367, 0x482d, 0x0000, 0x6e6c, 0xe368, 0x3e60, 0xe369,
+  0xe36a, 0xe36b, 0x0000, 0x0000, 0x0000, 0x0000, 0xe36c, 0xe36d,
+  0xe36e, 0x395b, 0x0000, 0x0000, 0x0000, 0xe36f, 0xe370, 0xe371,
+  0xe372, 0xe373, 0x0000, 0xe374, 0xe375, 0xe376, 0x4b48, 0xe377,
+ // page 155 (U+9280)
+  0x3664, 0x0000, 0x0000, 0x3d46, 0x0000, 0x463c, 0x0000, 0x0000,
+  0xe378, 0xe379, 0xe37a, 0x0000, 0x0000, 0xe37b, 0xe37c, 0x0000,
+  0x0000, 0x412d, 0xe37d, 0x6e74, 0x0000, 0x6e6e, 0x6e73, 0xe37e,
+  0x4c43, 0xe421, 0x4438, 0x6e75, 0x6e72, 0x0000, 0x0000, 0xe422,
+  0xe423, 0x0000, 0x0000, 0x0000, 0xe424, 0xe425, 0x0000, 0xe426,
+  0xe427, 0x0000, 0x0000, 0xe428, 0x0000, 0x412c, 0x0000, 0xe429,
+  0x0000, 0x0000, 0xe42a, 0x0000, 0x0000, 0x0000, 0xe42b, 0x6e79,
+  0xe42c, 0x6e78, 0xe42d, 0xe42e, 0xe42f, 0xe430, 0x0000, 0xe431,
+  0xe432, 0xe433, 0xe434, 0xe435, 0x0000, 0xe436, 0xe437, 0xe438,
+  0xe439, 0x0000, 0x0000, 0xe43a, 0xe43b, 0xe43c, 0xe43d, 0x6e77,
+  0xe43e, 0x0000, 0x4b2f, 0xe43f, 0x0000, 0xe440, 0x0000, 0xe441,
+  0xe442, 0xe443, 0x0000, 0x0000, 0xe444, 0xe445, 0x0000, 0xe446,
+  0xe447, 0xe448, 0x0000, 0xe449, 0x3d7b, 0xe44a, 0x0000, 0xe44b,
+  0xe44c, 0x6e7a, 0x4a5f, 0x0000, 0xe44d, 0x3154, 0xe44e, 0x0000,
+  0xe44f, 0x0000, 0x4946, 0x4372, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3578, 0xe450, 0x6e7c, 0xe451, 0x395d, 0x0000, 0x0000, 0xe452,
+ // page 156 (U+9300)
+  0xe453, 0x0000, 0xe454, 0x0000, 0x0000, 0x0000, 0x3b2c, 0x0000,
+  0xe455, 0x0000, 0x0000, 0x0000, 0x0000, 0xe456, 0x0000, 0x6e7b,
+  0x3f6d, 0xe457, 0x0000, 0x0000, 0xe458, 0xe459, 0x0000, 0x0000,
+  0x3f6e, 0x6f21, 0x6f23, 0x0000, 0xe45a, 0xe45b, 0xe45c, 0xe45d,
+  0x3e7b, 0xe45e, 0x6f22, 0x6f24, 0xe45f, 0xe460, 0x3653, 0xe461,
+  0x4945, 0xe462, 0xe463, 0x3c62, 0x4f23, 0x0000, 0x6e7e, 0x3a78,
+  0x0000, 0x0000, 0x4f3f, 0xe464, 0xe465, 0x6f26, 0xe466, 0xe467,
+  0x0000, 0x0000, 0x6f25, 0x6f27, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x6e7d, 0x0000, 0x0000, 0xe468,
+  0xe469, 0xe46a, 0x0000, 0x4669, 0x0000, 0x4555, 0x0000, 0x0000,
+  0xe46b, 0xe46c, 0xe46d, 0x0000, 0x4457, 0xe46e, 0x6f2c, 0xe46f,
+  0xe470, 0x0000, 0xe471, 0x4343, 0x6f28, 0x0000, 0xe472, 0x0000,
+  0x6f29, 0x0000, 0x0000, 0x0000, 0xe473, 0xe474, 0x0000, 0xe475,
+  0x0000, 0xe476, 0xe477, 0x0000, 0x372d, 0xe478, 0x6f2b, 0xe479,
+  0xe47a, 0xe47b, 0x0000, 0xe47c, 0xe47d, 0x3830, 0xe47e, 0x0000,
+  0x0000, 0x0000, 0xe521, 0x0000, 0x6f2a, 0xe522, 0x3e61, 0xe523,
+ // page 157 (U+9380)
+  0xe524, 0xe525, 0xe526, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xe527, 0x0000, 0xe528, 0xe529, 0x3379, 0xe52a, 0x0000, 0xe52b,
+  0x0000, 0x0000, 0xe52c, 0x0000, 0x6f30, 0xe52d, 0x3a3f, 0x4179,
+  0xe52e, 0x0000, 0x444a, 0xe52f, 0x0000, 0x0000, 0xe530, 0x0000,
+  0x0000, 0xe531, 0x0000, 0xe532, 0xe533, 0x0000, 0xe534, 0x333b,
+  0xe535, 0xe53b, 0x0000, 0xe536, 0x6f2e, 0x6f2f, 0x4443, 0x0000,
+  0x6f2d, 0x0000, 0x0000, 0x0000, 0xe537, 0xe538, 0xe539, 0x0000,
+  0x0000, 0x6f31, 0xe53a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xe53c, 0x0000, 0x6f37, 0xe53d, 0xe53e, 0xe53f, 0xe540,
+  0x6f3a, 0xe541, 0xe542, 0xe543, 0xe544, 0xe545, 0x0000, 0x0000,
+  0x6f39, 0x452d, 0x0000, 0xe546, 0x0000, 0x0000, 0x6f32, 0x6f33,
+  0x6f36, 0xe547, 0x0000, 0x0000, 0xe548, 0x6f38, 0xe549, 0xe54a,
+  0x0000, 0x3640, 0xe54b, 0x0000, 0x6f3b, 0x6f35, 0xe54c, 0xe54d,
+  0x6f34, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe54f,
+  0xe550, 0xe54e, 0xe551, 0xe552, 0x0000, 0xe553, 0x0000, 0x0000,
+ // page 158 (U+9400)
+  0x0000, 0xe554, 0xe555, 0x6f3f, 0xe556, 0x0000, 0x0000, 0x6f40,
+  0xe557, 0xe558, 0x0000, 0x0000, 0x0000, 0xe559, 0xe55a, 0xe55b,
+  0x6f41, 0x0000, 0x0000, 0x6f3e, 0x6f3d, 0xe55c, 0xe55d, 0xe55e,
+  0x3e62, 0x462a, 0x6f3c, 0x0000, 0x0000, 0x0000, 0x0000, 0xe55f,
+  0x0000, 0x6f45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x6f43, 0x0000, 0x0000, 0xe560, 0xe561,
+  0x0000, 0xe562, 0xe563, 0xe564, 0xe565, 0x6f44, 0x6f42, 0x0000,
+  0x4278, 0x0000, 0x6f46, 0xe566, 0x0000, 0xe568, 0x0000, 0xe567,
+  0x0000, 0x6f47, 0x0000, 0xe569, 0x6f49, 0xe56a, 0x0000, 0x0000,
+  0xe56b, 0x0000, 0xe56c, 0x0000, 0xe56d, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3455, 0x6f48, 0x4c7a, 0x0000, 0xe56e, 0x0000, 0x0000,
+  0x0000, 0xe56f, 0x6f54, 0x6f4a, 0xe570, 0x0000, 0x6f4d, 0xe571,
+  0x6f4b, 0xe572, 0x6f4c, 0xe573, 0x0000, 0x0000, 0x0000, 0x0000,
+  0xe574, 0x0000, 0x6f4e, 0xe575, 0x0000, 0xe576, 0xe577, 0xe578,
+  0x6f50, 0xe579, 0xe57a, 0x0000, 0x0000, 0x6f51, 0x0000, 0x6f52,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x6f55, 0x6f53, 0x6f56, 0x6f58,
+ // page 159 (U+9480)
+  0x0000, 0x6f57, 0x0000, 0xe57c, 0xe57b, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 160 (U+9500)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4439,
+  0xe57d, 0xe57e, 0x0000, 0x0000, 0x0000, 0x0000, 0xe621, 0x0000,
+ // page 161 (U+9580)
+  0x4c67, 0x0000, 0x6f59, 0x412e, 0xe622, 0x0000, 0x0000, 0x6f5a,
+  0xe623, 0x4a44, 0x6f5b, 0x332b, 0xe624, 0xe625, 0xe626, 0x313c,
+  0x0000, 0x3457, 0x0000, 0x3456, 0x6f5c, 0x0000, 0x6f5d, 0x0000,
+  0x6f5e, 0x6f5f, 0x0000, 0x0000, 0x0000, 0xe627, 0xe628, 0xe629,
+  0x6f60, 0xe62a, 0x3458, 0x3355, 0x395e, 0x4836, 0xe62b, 0x6f62,
+  0x6f61, 0xe62c, 0x0000, 0xe62d, 0xe62e, 0x6f63, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x315c, 0x0000, 0xe62f, 0x0000, 0xe630, 0x0000,
+  0x0000, 0x6f66, 0xe631, 0x6f65, 0x6f64, 0xe632, 0x6f67, 0xe633,
+  0x0000, 0x0000, 0x0000, 0x6f6a, 0x0000, 0x0000, 0xe634, 0x3047,
+  0xe635, 0xe636, 0x6f68, 0xe637, 0x6f6c, 0x6f6b, 0x0000, 0x0000,
+  0xe638, 0xe639, 0xe63a, 0xe63b, 0x6f6e, 0x6f6d, 0x6f6f, 0x0000,
+  0x462e, 0xe63c, 0xe63d, 0x0000, 0x6f70, 0xe63e, 0xe63f, 0xe640,
+  0xe641, 0x6f71, 0x6f73, 0x0000, 0xe642, 0x6f72, 0xe643, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 162 (U+9600)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x496c, 0xe644, 0xe645, 0x0000,
+  0x0000, 0x6f74, 0xe646, 0x0000, 0xe647, 0xe648, 0xe649, 0x0000,
+  0x6f75, 0x0000, 0x3a65, 0x0000, 0xe64a, 0x0000, 0x6f76, 0x6f77,
+  0x0000, 0xe64b, 0x4b49, 0xe64c, 0x0000, 0x0000, 0x0000, 0xe64d,
+  0xe64e, 0xe64f, 0xe650, 0x414b, 0xe651, 0xe652, 0x0000, 0x3024,
+  0x424b, 0xe653, 0x6f78, 0x0000, 0x496d, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x6f7b, 0x6f79, 0x395f, 0x0000, 0x6f7a,
+  0x3842, 0x0000, 0xe654, 0x0000, 0xe655, 0x0000, 0xe656, 0xe657,
+  0xe658, 0x0000, 0x0000, 0x4a45, 0x6f7d, 0x7021, 0x6f7e, 0x7022,
+  0x0000, 0xe659, 0x3121, 0x3f58, 0x3d7c, 0x3459, 0x7023, 0x0000,
+  0x0000, 0x0000, 0x4766, 0x0000, 0x7025, 0x0000, 0xe65a, 0x0000,
+  0x3122, 0x0000, 0x7024, 0x4444, 0xe65b, 0x4e4d, 0x462b, 0x6f7c,
+  0x4e26, 0x0000, 0x3831, 0xe65c, 0xe65d, 0x4d5b, 0xe65e, 0xe65f,
+ // page 163 (U+9680)
+  0x0000, 0xe660, 0xe661, 0xe662, 0xe663, 0x3679, 0x4e34, 0x0000,
+  0x3728, 0xe664, 0x4262, 0x6721, 0x0000, 0x7026, 0x332c, 0x3f6f,
+  0x0000, 0xe665, 0x0000, 0x0000, 0x3356, 0x7028, 0xe666, 0x7029,
+  0x7027, 0x3764, 0xe667, 0x3a5d, 0x3e63, 0xe668, 0x0000, 0xe669,
+  0x3123, 0x0000, 0x0000, 0x4e59, 0xe66a, 0xe66b, 0xe66c, 0x702b,
+  0x6e2e, 0xe66d, 0x702a, 0x0000, 0x0000, 0x0000, 0xe66e, 0xe66f,
+  0x702e, 0x702c, 0x702d, 0xe670, 0x702f, 0x0000, 0x7030, 0x4e6c,
+  0x7031, 0x7032, 0xe671, 0x4049, 0x483b, 0x0000, 0x0000, 0x0000,
+  0x3f7d, 0x3467, 0x0000, 0x0000, 0x4d3a, 0x326d, 0x3d38, 0x385b,
+  0x0000, 0x7035, 0xe672, 0x7034, 0x3b73, 0x7036, 0x7033, 0x0000,
+  0x0000, 0x3b28, 0xe673, 0x0000, 0x0000, 0x703a, 0x6a2d, 0x0000,
+  0xe675, 0x5256, 0xe676, 0x3f77, 0x7038, 0xe677, 0xe678, 0xe679,
+  0x0000, 0x0000, 0x4e25, 0x4671, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x312b, 0xe67a, 0x4063, 0x3c36, 0x0000, 0x0000, 0x0000, 0xe67b,
+  0x4a37, 0xe67c, 0x3140, 0x0000, 0x0000, 0x0000, 0x4e6d, 0x4d6b,
+  0x0000, 0x703b, 0xe67d, 0x4545, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 164 (U+9700)
+  0x3c7b, 0x0000, 0xe67e, 0xe721, 0x703c, 0xe722, 0x703d, 0x3f4c,
+  0x703e, 0xe723, 0x4e6e, 0x0000, 0x0000, 0x7039, 0x7040, 0x7042,
+  0x0000, 0x7041, 0x0000, 0x703f, 0x0000, 0x0000, 0x7043, 0x0000,
+  0x0000, 0x7044, 0xe724, 0xe725, 0x417a, 0xe726, 0x3262, 0x0000,
+  0x0000, 0xe727, 0xe728, 0xe729, 0x7045, 0x0000, 0x0000, 0x4c38,
+  0xe72a, 0x0000, 0x7046, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x7047, 0xe72b, 0x4f2a, 0xe72c, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5b31, 0x7048, 0x0000, 0x0000, 0x0000, 0x7049, 0x704a, 0x0000,
+  0x0000, 0xe72d, 0x704e, 0xe72e, 0x704b, 0x0000, 0x704c, 0x0000,
+  0x704d, 0x704f, 0xe72f, 0x0000, 0x0000, 0x0000, 0xe730, 0xe731,
+  0x0000, 0x0000, 0x4044, 0x0000, 0x0000, 0xe732, 0x4c77, 0xe733,
+  0xe734, 0x4045, 0xe735, 0xe736, 0x7050, 0x0000, 0x4873, 0x0000,
+  0x7051, 0x7353, 0x4c4c, 0xe737, 0x7052, 0x0000, 0x7053, 0xe738,
+  0x7054, 0x3357, 0xe739, 0x7056, 0x0000, 0x3f59, 0xe73a, 0x0000,
+  0x0000, 0x7057, 0x0000, 0xe73b, 0x3724, 0x0000, 0xe73c, 0xe73d,
+  0xe73e, 0x7058, 0x705c, 0xe73f, 0x705a, 0xe740, 0x0000, 0xe741,
+ // page 165 (U+9780)
+  0xe742, 0x705b, 0x0000, 0x0000, 0x3373, 0x7059, 0x705d, 0x0000,
+  0x0000, 0xe743, 0x0000, 0x705e, 0x0000, 0x3048, 0x0000, 0x705f,
+  0x7060, 0x0000, 0x0000, 0x0000, 0x0000, 0xe744, 0xe745, 0xe746,
+  0x3e64, 0xe747, 0xe748, 0x0000, 0x7061, 0x0000, 0xe749, 0xe74a,
+  0x3547, 0x0000, 0xe74b, 0x7064, 0x0000, 0x0000, 0x7063, 0x0000,
+  0x7062, 0x0000, 0x0000, 0x6b71, 0xe74c, 0x4a5c, 0xe74d, 0x0000,
+  0x0000, 0xe74e, 0xe74f, 0x7065, 0x7066, 0xe750, 0xe751, 0x0000,
+  0xe752, 0xe753, 0xe754, 0x0000, 0xe755, 0x0000, 0xe756, 0xe757,
+  0x0000, 0xe758, 0x0000, 0x7067, 0xe759, 0xe75a, 0x7068, 0xe75b,
+  0x7069, 0xe75c, 0xe75d, 0x706a, 0xe75e, 0xe75f, 0xe760, 0x0000,
+  0xe761, 0xe762, 0x0000, 0x345a, 0xe763, 0x0000, 0x0000, 0xe764,
+  0xe765, 0xe766, 0x0000, 0xe76a, 0x706b, 0xe767, 0xe768, 0x0000,
+  0xe769, 0xe76b, 0x0000, 0x0000, 0xe76c, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x706c, 0x4723, 0xe76d,
+  0x0000, 0xe76e, 0x706e, 0x323b, 0xe76f, 0x7071, 0x7070, 0xe770,
+  0xe771, 0x0000, 0xe772, 0x3124, 0x0000, 0x0000, 0x0000, 0x3641,
+ // page 166 (U+9800)
+  0x0000, 0x4a47, 0x443a, 0x3a22, 0x0000, 0x3960, 0x3d67, 0xe773,
+  0x3f5c, 0x0000, 0xe774, 0x0000, 0x7073, 0xe776, 0xe777, 0x7072,
+  0x4d42, 0x3468, 0x4852, 0x465c, 0xe778, 0x0000, 0xe779, 0x3f7c,
+  0x4e4e, 0xe775, 0x375b, 0x0000, 0xe77a, 0x0000, 0xe77b, 0x0000,
+  0xe77c, 0x7076, 0x0000, 0xe77d, 0x7075, 0xe828, 0xe77e, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xe821, 0x4b4b, 0x462c, 0xe822, 0xe823,
+  0xe824, 0x0000, 0xe825, 0xe826, 0x3150, 0xe827, 0x0000, 0x7077,
+  0x7074, 0x0000, 0x0000, 0x4951, 0x4d6a, 0x7078, 0xe829, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xe82a, 0x0000, 0x7079, 0xe82b,
+  0x0000, 0x0000, 0xe82c, 0x707b, 0x426a, 0x335b, 0x335c, 0x707a,
+  0x0000, 0xe82d, 0xe82e, 0xe82f, 0x3469, 0x3832, 0xe830, 0xe831,
+  0x346a, 0xe832, 0xe833, 0x453f, 0x0000, 0x0000, 0x4e60, 0x0000,
+  0x0000, 0x0000, 0xe834, 0xe835, 0x0000, 0xe836, 0xe837, 0x385c,
+  0x0000, 0x0000, 0xe838, 0x707c, 0xe839, 0x0000, 0x0000, 0x707d,
+  0x707e, 0x7121, 0x0000, 0x7123, 0x7122, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 167 (U+9880)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x4977, 0x0000, 0x7124, 0xe83a, 0x0000, 0xe83b, 0xe83c, 0x7125,
+  0xe83d, 0x7126, 0x0000, 0x0000, 0xe83e, 0x0000, 0x7127, 0xe83f,
+  0xe840, 0x0000, 0xe841, 0xe842, 0x0000, 0x0000, 0x0000, 0xe843,
+  0x0000, 0x0000, 0xe844, 0x7129, 0x7128, 0xe845, 0x712a, 0x0000,
+  0xe846, 0x0000, 0x0000, 0x0000, 0xe847, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x4874, 0x664c, 0x0000, 0x0000, 0x3f29,
+  0x0000, 0xe848, 0x3532, 0xe849, 0x0000, 0xe84a, 0xe84b, 0xe84c,
+  0x0000, 0x712b, 0xe84d, 0x712c, 0x0000, 0x522c, 0x5d3b, 0x4853,
+  0x0000, 0x0000, 0x307b, 0xe84e, 0x303b, 0x0000, 0xe84f, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3b74, 0x4b30, 0x3e7e, 0x0000,
+ // page 168 (U+9900)
+  0x0000, 0x0000, 0xe850, 0x712d, 0x0000, 0x4c5f, 0x0000, 0xe851,
+  0xe852, 0x712e, 0x4d5c, 0x0000, 0x3142, 0x0000, 0x0000, 0x0000,
+  0x3b41, 0xe853, 0x712f, 0x326e, 0x7130, 0xe854, 0xe855, 0xe856,
+  0x7131, 0x0000, 0xe857, 0xe858, 0xe859, 0x7133, 0x7134, 0xe85a,
+  0x7136, 0x7132, 0xe85b, 0x0000, 0x7135, 0x0000, 0xe85c, 0xe85d,
+  0x345b, 0x0000, 0x0000, 0xe85e, 0x7137, 0x0000, 0x7138, 0x0000,
+  0x0000, 0xe85f, 0xe860, 0xe861, 0xe862, 0xe863, 0x0000, 0x0000,
+  0x0000, 0xe864, 0xe865, 0xe866, 0xe867, 0x7139, 0x713a, 0x0000,
+  0xe868, 0xe869, 0x713b, 0x0000, 0x0000, 0x713d, 0xe86a, 0xe86b,
+  0xe86c, 0x713c, 0x0000, 0x713f, 0x7142, 0xe86d, 0xe86e, 0x0000,
+  0x713e, 0x7140, 0x7141, 0x0000, 0xe86f, 0x7143, 0x0000, 0x3642,
+  0xe870, 0xe871, 0x0000, 0xe872, 0xe873, 0x0000, 0xe874, 0xe875,
+  0xe876, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 169 (U+9980)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c73, 0x7144,
+  0x7145, 0x3961, 0x0000, 0xe877, 0x0000, 0xe878, 0x0000, 0xe879,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7146, 0xe87a, 0x0000,
+  0x333e, 0x0000, 0x0000, 0x0000, 0x474f, 0x7147, 0x7148, 0x0000,
+  0xe87b, 0xe87c, 0xe87d, 0x435a, 0x466b, 0xe87e, 0x0000, 0x0000,
+  0x0000, 0xe921, 0xe922, 0x0000, 0x7149, 0xe923, 0x0000, 0xe924,
+  0x0000, 0x477d, 0x0000, 0xe925, 0x424c, 0x3158, 0x366e, 0x0000,
+  0x366f, 0xe926, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x4373, 0x714e, 0x3670, 0xe927, 0xe928, 0x326f, 0x0000, 0x0000,
+  0x714d, 0xe929, 0xe92a, 0x714b, 0xe92b, 0x714c, 0xe92c, 0x714a,
+  0x0000, 0x0000, 0x7158, 0x0000, 0x0000, 0x0000, 0x0000, 0xe92d,
+  0x0000, 0x0000, 0xe92e, 0xe92f, 0xe930, 0x714f, 0x7150, 0x0000,
+  0xe931, 0x7151, 0x7152, 0x0000, 0xe932, 0xe933, 0x0000, 0x0000,
+  0x7154, 0xe934, 0x0000, 0x7153, 0x0000, 0xe935, 0xe936, 0x3d59,
+ // page 170 (U+9A00)
+  0x0000, 0x7155, 0xe937, 0xe938, 0xe939, 0x7157, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xe93a, 0xe93b, 0x0000, 0x3533, 0x7156,
+  0xe93c, 0xe93d, 0x417b, 0x3833, 0x0000, 0x0000, 0xe93e, 0x0000,
+  0x0000, 0x7159, 0x0000, 0x0000, 0x0000, 0x0000, 0xe93f, 0x0000,
+  0xe940, 0x0000, 0xe941, 0xe942, 0xe943, 0x0000, 0x0000, 0xe944,
+  0x424d, 0x0000, 0x0000, 0x715a, 0x0000, 0xe945, 0xe946, 0x0000,
+  0x462d, 0x0000, 0x0000, 0xe947, 0x0000, 0xe948, 0xe949, 0x715b,
+  0xe94a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7160, 0x0000,
+  0x715e, 0xe94c, 0x715d, 0x715f, 0xe94d, 0x715c, 0x0000, 0xe94b,
+  0x0000, 0x0000, 0xe94e, 0xe94f, 0xe950, 0x7162, 0xe951, 0x0000,
+  0x0000, 0xe952, 0x0000, 0x0000, 0xe953, 0x7161, 0xe954, 0x7164,
+  0x0000, 0x0000, 0x3643, 0x7163, 0x0000, 0xe955, 0x0000, 0x7165,
+  0x0000, 0x0000, 0x7166, 0x0000, 0x7168, 0x7167, 0x0000, 0x0000,
+  0x0000, 0x7169, 0x716b, 0x716a, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 171 (U+9A80)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x397c, 0x0000, 0xe956, 0x0000, 0xe957, 0x716c, 0xe958, 0xe959,
+  0x716d, 0x0000, 0xe95a, 0x0000, 0xe95b, 0xe95c, 0xe95d, 0x0000,
+  0x333c, 0xe95e, 0x0000, 0xe95f, 0x716e, 0x0000, 0xe960, 0xe961,
+  0x716f, 0xe962, 0x0000, 0xe963, 0x3f71, 0x0000, 0xe964, 0x0000,
+  0xe965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe966, 0x7170,
+  0xe967, 0x7171, 0xe968, 0x7172, 0x7173, 0xe969, 0xe96a, 0xe96b,
+  0x3962, 0x0000, 0x0000, 0xe96c, 0xe96d, 0x0000, 0x7174, 0x7175,
+  0xe96e, 0x0000, 0x7176, 0x7177, 0xe96f, 0xe970, 0x7178, 0xe971,
+  0x0000, 0xe972, 0x4831, 0x717a, 0xe973, 0x4926, 0x717b, 0x7179,
+  0x0000, 0x717d, 0xe974, 0xe975, 0x717c, 0xe976, 0x0000, 0x717e,
+  0x0000, 0xe977, 0xe978, 0x7221, 0x0000, 0xe979, 0x0000, 0xe97a,
+ // page 172 (U+9B00)
+  0xe97b, 0xe97c, 0xe97d, 0xe97e, 0xea21, 0xea22, 0x7222, 0x0000,
+  0xea23, 0xea24, 0x0000, 0xea25, 0xea26, 0xea27, 0xea28, 0x0000,
+  0xea29, 0x0000, 0xea2a, 0x0000, 0x0000, 0x0000, 0xea2b, 0x0000,
+  0x7223, 0xea2c, 0x7224, 0xea2d, 0xea2e, 0x0000, 0x0000, 0x7225,
+  0xea2f, 0x0000, 0x7226, 0x7227, 0x0000, 0x7228, 0xea30, 0x7229,
+  0x722a, 0x722b, 0x722c, 0xea31, 0x0000, 0xea32, 0x722d, 0x722e,
+  0x0000, 0x5d35, 0x722f, 0xea33, 0xea34, 0xea35, 0x0000, 0xea36,
+  0x0000, 0xea37, 0xea38, 0x6478, 0x3534, 0xea39, 0x0000, 0x0000,
+  0x0000, 0x3321, 0x3a32, 0x7231, 0x7230, 0x4c25, 0x0000, 0x0000,
+  0xea3a, 0x0000, 0x0000, 0xea3b, 0xea3c, 0x7233, 0x7234, 0x7232,
+  0x0000, 0x7235, 0x0000, 0x0000, 0x4b62, 0xea3d, 0xea3e, 0xea3f,
+  0x7236, 0x0000, 0x357b, 0xea40, 0x0000, 0x0000, 0xea41, 0x0000,
+  0x0000, 0xea42, 0x0000, 0xea43, 0x0000, 0xea44, 0xea45, 0x0000,
+  0xea46, 0x0000, 0xea47, 0xea48, 0xea49, 0xea4a, 0xea4b, 0x4f25,
+  0x0000, 0x0000, 0x0000, 0xea4c, 0x7237, 0xea4d, 0x0000, 0xea4e,
+  0xea4f, 0xea50, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xea51,
+ // page 173 (U+9B80)
+  0xea52, 0x0000, 0x0000, 0x7239, 0xea53, 0xea54, 0xea55, 0xea56,
+  0x0000, 0xea57, 0xea58, 0xea59, 0x0000, 0xea5a, 0x303e, 0xea5b,
+  0xea5c, 0x723a, 0x4a2b, 0x7238, 0xea5d, 0x0000, 0x723b, 0x723c,
+  0x0000, 0x0000, 0xea5e, 0x0000, 0x0000, 0xea5f, 0xea60, 0x723d,
+  0x723e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xea61, 0xea62,
+  0x723f, 0xea63, 0x4b6e, 0x3b2d, 0xea64, 0x3a7a, 0x412f, 0x0000,
+  0xea65, 0xea66, 0xea67, 0x0000, 0x7240, 0x0000, 0x0000, 0xea68,
+  0xea69, 0x7243, 0x0000, 0xea6a, 0xea6b, 0x0000, 0xea6c, 0xea6d,
+  0x7241, 0xea6e, 0x0000, 0x0000, 0x0000, 0x0000, 0x7244, 0xea6f,
+  0xea70, 0x3871, 0x7242, 0x0000, 0x0000, 0x0000, 0xea71, 0x7245,
+  0xea72, 0x7246, 0x7247, 0x0000, 0x724b, 0x0000, 0x3b2a, 0xea73,
+  0xea74, 0x0000, 0x0000, 0x4264, 0x0000, 0xea75, 0x0000, 0xea76,
+  0x0000, 0x724c, 0x7249, 0x7248, 0x724a, 0xea77, 0x0000, 0xea78,
+  0x375f, 0x0000, 0xea79, 0xea7a, 0x0000, 0x0000, 0x0000, 0xea7b,
+  0x7250, 0x724f, 0x724e, 0xea7c, 0x0000, 0x3033, 0x0000, 0xea7d,
+  0xea7e, 0xeb21, 0xeb22, 0x0000, 0x0000, 0xeb23, 0x0000, 0xeb24,
+ // page 174 (U+9C00)
+  0xeb25, 0x0000, 0xeb26, 0x0000, 0x725a, 0x0000, 0x7256, 0x0000,
+  0x7257, 0x7253, 0x7259, 0xeb27, 0x7255, 0x3362, 0x0000, 0xeb28,
+  0x4f4c, 0xeb29, 0x7258, 0x7254, 0x7252, 0x7251, 0xeb2a, 0x0000,
+  0xeb2b, 0xeb2c, 0xeb2d, 0x725c, 0xeb2e, 0x0000, 0xeb2f, 0x0000,
+  0x0000, 0x725f, 0xeb30, 0xeb31, 0x725e, 0x725d, 0xeb32, 0xeb33,
+  0xeb34, 0xeb35, 0xeb36, 0x0000, 0x0000, 0x4949, 0x725b, 0x3073,
+  0x7260, 0xeb37, 0x7262, 0x0000, 0x0000, 0xeb38, 0xeb39, 0xeb3a,
+  0x0000, 0x336f, 0x724d, 0x3137, 0x0000, 0xeb3b, 0x7264, 0x0000,
+  0x0000, 0xeb3c, 0x0000, 0xeb3d, 0xeb3e, 0xeb3f, 0x7263, 0x7261,
+  0x432d, 0xeb40, 0xeb41, 0x0000, 0x0000, 0x0000, 0xeb42, 0xeb43,
+  0xeb44, 0x0000, 0x4b70, 0xeb45, 0xeb46, 0x0000, 0xeb47, 0x4e5a,
+  0xeb48, 0x0000, 0x7265, 0xeb49, 0xeb50, 0xeb4a, 0xeb4b, 0xeb4c,
+  0x7266, 0x0000, 0x0000, 0xeb4d, 0x0000, 0x0000, 0x0000, 0x7267,
+  0xeb52, 0xeb4e, 0xeb4f, 0xeb51, 0x0000, 0x0000, 0xeb53, 0x0000,
+  0xeb54, 0x0000, 0xeb55, 0x0000, 0x0000, 0xeb56, 0x7268, 0xeb57,
+  0x7269, 0x0000, 0x0000, 0xeb58, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 175 (U+9C80)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x443b, 0xeb59, 0x726a,
+  0x0000, 0x4837, 0x0000, 0x726f, 0x726b, 0x0000, 0x0000, 0x0000,
+  0x726c, 0x0000, 0xeb5a, 0x4b31, 0x4c44, 0x0000, 0x4650, 0xeb5b,
+  0x0000, 0xeb5c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 176 (U+9D00)
+  0x0000, 0x0000, 0xeb5e, 0x7270, 0x0000, 0x0000, 0x7271, 0x463e,
+  0x726e, 0x726d, 0x0000, 0xeb5d, 0x0000, 0x0000, 0x322a, 0x0000,
+  0x0000, 0xeb5f, 0x7279, 0x0000, 0x0000, 0x7278, 0x0000, 0xeb60,
+  0xeb61, 0x0000, 0x0000, 0x3175, 0xeb62, 0xeb63, 0xeb64, 0x7276,
+  0x0000, 0x0000, 0x0000, 0x7275, 0x0000, 0x0000, 0x7273, 0x0000,
+  0x337b, 0x0000, 0x7272, 0x3c32, 0x3229, 0x0000, 0x0000, 0xeb65,
+  0xeb66, 0x0000, 0xeb67, 0xeb68, 0xeb69, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xeb6a, 0x3963, 0xeb6b, 0xeb6d, 0x727c, 0x727b,
+  0x0000, 0x727a, 0xeb6e, 0xeb6f, 0x7277, 0xeb6c, 0x727d, 0xeb70,
+  0x727e, 0x0000, 0xeb71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x7325, 0x7324, 0x0000, 0xeb72, 0xeb73, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x7326, 0x0000, 0x0000, 0x312d, 0x7321, 0x7322, 0xeb74,
+  0x3974, 0x4c39, 0xeb76, 0xeb75, 0x7323, 0xeb77, 0x0000, 0x0000,
+  0x0000, 0xeb78, 0xeb79, 0xeb7a, 0x4b32, 0x0000, 0x0000, 0x732b,
+  0xeb7b, 0x0000, 0x7327, 0x0000, 0x0000, 0x0000, 0xeb7c, 0xeb7d,
+  0x0000, 0x0000, 0x732c, 0xeb7e, 0xec21, 0x0000, 0xec22, 0x0000,
+ // page 177 (U+9D80)
+  0x0000, 0x0000, 0x0000, 0xec23, 0xec24, 0x0000, 0xec25, 0x7329,
+  0x0000, 0x7328, 0xec26, 0x0000, 0x0000, 0xec27, 0xec28, 0x375c,
+  0x0000, 0x0000, 0xec29, 0xec2a, 0x0000, 0xec2b, 0xec2c, 0xec2d,
+  0xec2e, 0x0000, 0x732d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xec2f, 0x0000, 0x0000, 0x732e, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x732f, 0xec30, 0x732a, 0xec31, 0x0000, 0xec32, 0x7274,
+  0x0000, 0xec33, 0x7330, 0x0000, 0x4461, 0xec34, 0x0000, 0x0000,
+  0x7334, 0xec35, 0x7335, 0x7333, 0xec36, 0x0000, 0x0000, 0xec37,
+  0x0000, 0x7332, 0x7338, 0xec38, 0x7331, 0x0000, 0x7336, 0xec39,
+  0x0000, 0xec3a, 0xec3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x7337,
+  0x0000, 0x0000, 0x0000, 0x733a, 0xec3c, 0xec3d, 0xec3e, 0xec3f,
+  0x0000, 0x7339, 0xec40, 0x0000, 0x0000, 0x0000, 0xec41, 0xec42,
+  0xec43, 0x0000, 0x0000, 0x0000, 0x0000, 0xec44, 0x733c, 0xec45,
+  0x0000, 0xec46, 0x0000, 0xec47, 0x0000, 0x733d, 0xec48, 0x733e,
+  0xec49, 0x0000, 0x4f49, 0xec4a, 0xec4b, 0x0000, 0x0000, 0x0000,
+  0x733b, 0x426b, 0x3a6d, 0x0000, 0x0000, 0x733f, 0xec4c, 0x0000,
+ // page 178 (U+9E00)
+  0x0000, 0x0000, 0xec4e, 0x0000, 0x0000, 0x0000, 0x0000, 0xec4f,
+  0x0000, 0x0000, 0xec4d, 0x0000, 0x0000, 0x0000, 0xec50, 0x0000,
+  0xec51, 0xec52, 0xec53, 0x0000, 0x0000, 0xec54, 0xec55, 0x0000,
+  0x0000, 0xec56, 0x7340, 0x7341, 0xec57, 0xec58, 0x7342, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7343, 0x0000, 0x0000,
+  0x3834, 0x7344, 0xec59, 0xec5a, 0xec5b, 0x7345, 0x0000, 0x3c2f,
+ // page 179 (U+9E80)
+  0xec5c, 0x7346, 0xec5d, 0xec5e, 0xec5f, 0xec60, 0x0000, 0xec61,
+  0x7347, 0x0000, 0x0000, 0x7348, 0x7349, 0x0000, 0xec62, 0xec63,
+  0x0000, 0x734c, 0x734a, 0x4f3c, 0x0000, 0x734b, 0xec64, 0x4e6f,
+  0xec65, 0x0000, 0x0000, 0xec66, 0x0000, 0x734d, 0xec67, 0x4e5b,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xec68, 0x734e, 0x477e, 0x0000,
+  0xec69, 0x734f, 0x7351, 0x0000, 0xec6a, 0x7352, 0xec6b, 0xec6c,
+  0xec6d, 0x0000, 0x0000, 0xec6e, 0xec6f, 0xec70, 0x0000, 0x0000,
+  0x7350, 0x396d, 0x4c4d, 0x4b63, 0x5677, 0x0000, 0x5d60, 0x4b7b,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x322b, 0x0000, 0xec71, 0x0000,
+  0xec72, 0x0000, 0x0000, 0xec73, 0x7354, 0x3550, 0x7355, 0x7356,
+  0x7357, 0x0000, 0x3975, 0x0000, 0x7358, 0xec74, 0x0000, 0x0000,
+  0x6054, 0x4c5b, 0x0000, 0x4263, 0x7359, 0x735b, 0x735a, 0xec75,
+  0x735c, 0x0000, 0x0000, 0x0000, 0xec76, 0x735d, 0x0000, 0xec77,
+  0x735e, 0x0000, 0x0000, 0x0000, 0xec78, 0xec79, 0xec7a, 0x735f,
+  0xec7b, 0xec7c, 0xec7d, 0x0000, 0x7360, 0xec7e, 0x7361, 0x7362,
+  0xed21, 0x7363, 0x0000, 0x7364, 0x7365, 0x7366, 0x0000, 0xed22,
+ // page 180 (U+9F00)
+  0x0000, 0x0000, 0xed23, 0xed24, 0x0000, 0x0000, 0x0000, 0x7367,
+  0x7368, 0xed25, 0x0000, 0x0000, 0x0000, 0x0000, 0x4524, 0xed26,
+  0xed27, 0xed28, 0xed29, 0x385d, 0xed2a, 0x736a, 0xed2b, 0xed2c,
+  0x0000, 0xed2d, 0xed2e, 0xed2f, 0x0000, 0x0000, 0x0000, 0xed30,
+  0x414d, 0x736b, 0xed31, 0x0000, 0x0000, 0x0000, 0xed32, 0x0000,
+  0x0000, 0x0000, 0xed33, 0xed34, 0x736c, 0x0000, 0x0000, 0xed35,
+  0x0000, 0xed36, 0xed37, 0x0000, 0xed38, 0x0000, 0x0000, 0xed39,
+  0x0000, 0xed3a, 0xed3b, 0x4921, 0xed3c, 0xed3d, 0x736d, 0xed3e,
+  0x0000, 0xed3f, 0x0000, 0xed40, 0xed41, 0xed42, 0xed43, 0xed44,
+  0x0000, 0x0000, 0x736e, 0x6337, 0x0000, 0x0000, 0x6c5a, 0x706d,
+  0x0000, 0x0000, 0x736f, 0xed45, 0x7370, 0xed46, 0xed47, 0xed48,
+  0xed49, 0x0000, 0xed4a, 0x0000, 0x0000, 0xed4b, 0xed4c, 0x7372,
+  0x7373, 0x7374, 0x4e70, 0x7371, 0x0000, 0x0000, 0x7375, 0x7376,
+  0xed4d, 0xed4e, 0x7378, 0x0000, 0x7377, 0xed4f, 0xed50, 0xed51,
+  0xed52, 0xed53, 0x737a, 0xed54, 0x0000, 0xed55, 0x737b, 0x7379,
+  0x0000, 0x0000, 0xed56, 0x0000, 0x0000, 0xed57, 0x0000, 0x0000,
+ // page 181 (U+9F80)
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4e36, 0x0000, 0xed58,
+  0xed59, 0xed5a, 0xed5b, 0x0000, 0xed5c, 0x737c, 0xed5d, 0xed5e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x737d, 0x6354, 0xed5f, 0x0000,
+  0x737e, 0xed60, 0xed61, 0xed62, 0x0000, 0xed63, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+ // page 182 (U+FF00)
+  0x0000, 0x212a, 0x0000, 0x2174, 0x2170, 0x2173, 0x2175, 0x0000,
+  0x214a, 0x214b, 0x2176, 0x215c, 0x2124, 0x0000, 0x2125, 0x213f,
+  0x2330, 0x2331, 0x2332, 0x2333, 0x2334, 0x2335, 0x2336, 0x2337,
+  0x2338, 0x2339, 0x2127, 0x2128, 0x2163, 0x2161, 0x2164, 0x2129,
+  0x2177, 0x2341, 0x2342, 0x2343, 0x2344, 0x2345, 0x2346, 0x2347,
+  0x2348, 0x2349, 0x234a, 0x234b, 0x234c, 0x234d, 0x234e, 0x234f,
+  0x2350, 0x2351, 0x2352, 0x2353, 0x2354, 0x2355, 0x2356, 0x2357,
+  0x2358, 0x2359, 0x235a, 0x214e, 0x2140, 0x214f, 0x2130, 0x2132,
+  0x212e, 0x2361, 0x2362, 0x2363, 0x2364, 0x2365, 0x2366, 0x2367,
+  0x2368, 0x2369, 0x236a, 0x236b, 0x236c, 0x236d, 0x236e, 0x236f,
+  0x2370, 0x2371, 0x2372, 0x2373, 0x2374, 0x2375, 0x2376, 0x2377,
+  0x2378, 0x2379, 0x237a, 0x2150, 0x2143, 0x2151, 0xa237, 0x0000,
+  0x0000, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+  0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+  0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+  0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+ // page 183 (U+FF80)
+  0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+  0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+  0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+  0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2131, 0x0000, 0x216f, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "header.h"
+#include <array>
+
+// BMP の 128 文字ごとのページ番号。0 は空ページ。
+extern const std::array<uint8,0x200> jis_index;
+// ページごとの EUC-JP の値。詳細は jis_gen.cpp 参照。
+extern const std::array<uint16,0x5c00> jis_table;
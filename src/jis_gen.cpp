@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+//
+// jis_data.cpp を生成する (開発者用)。
+// 実行環境の iconv が持つ UTF-32 → EUC-JP の対応表を引き出して、
+// UString の内蔵エンコーダ用の2段テーブルにする。
+//
+// 値は EUC-JP でのバイト列を以下のように詰めたもの。
+//  0x0000        変換できない
+//  0x0001-0x007f 1バイト (JIS X 0201 ローマ字。YEN SIGN と OVERLINE)
+//  0x0080-0x009f 1バイト (C1 制御文字)
+//  0x00a1-0x00df 0x8e + 1バイト (JIS X 0201 カタカナ)
+//  0x2121-0x7e7e 2バイト (JIS X 0208)
+//  0xa121-0xfefe 0x8f + 2バイト (JIS X 0212、最上位ビットを立てる)
+//
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <err.h>
+#include <iconv.h>
+
+// 1ページの文字数。
+static const int PAGE_BITS = 7;
+static const int PAGE_SIZE = 1 << PAGE_BITS;
+
+// BMP のみ対象。これより上は EUC-JP に変換できる文字がない。
+static const int MAXCHARS = 0x10000;
+
+static iconv_t cd;
+
+// Unicode 文字 c を EUC-JP に変換した値を返す。
+static int
+conv(int c)
+{
+	if (c < 0x80 || (0xd800 <= c && c <= 0xdfff)) {
+		return 0;
+	}
+
+	// 状態をリセットしてから1文字だけ変換する。
+	iconv(cd, NULL, NULL, NULL, NULL);
+	char src[4];
+	src[0] = 0;
+	src[1] = 0;
+	src[2] = c >> 8;
+	src[3] = c & 0xff;
+	unsigned char dst[8];
+	char *s = src;
+	char *d = (char *)dst;
+	size_t slen = sizeof(src);
+	size_t dlen = sizeof(dst);
+	if (iconv(cd, &s, &slen, &d, &dlen) != 0) {
+		return 0;
+	}
+
+	int len = d - (char *)dst;
+	if (len == 1 && dst[0] < 0xa0) {
+		return dst[0];
+	}
+	if (len == 2 && dst[0] == 0x8e && 0xa1 <= dst[1] && dst[1] <= 0xdf) {
+		return dst[1];
+	}
+	if (len == 2 && dst[0] >= 0xa1 && dst[1] >= 0xa1) {
+		return ((dst[0] & 0x7f) << 8) | (dst[1] & 0x7f);
+	}
+	if (len == 3 && dst[0] == 0x8f && dst[1] >= 0xa1 && dst[2] >= 0xa1) {
+		return 0x8000 | ((dst[1] & 0x7f) << 8) | (dst[2] & 0x7f);
+	}
+	errx(1, "U+%04X: unexpected %d bytes", c, len);
+}
+
+int
+main(int ac, char *av[])
+{
+	cd = iconv_open("euc-jp", "utf-32be");
+	if (cd == (iconv_t)-1) {
+		err(1, "iconv_open");
+	}
+
+	std::array<int, MAXCHARS> code;
+	for (int c = 0; c < MAXCHARS; c++) {
+		code[c] = conv(c);
+	}
+
+	// 空でないページだけ取り出す。ページ 0 は全部 0 の空ページ。
+	std::array<int, MAXCHARS / PAGE_SIZE> index {};
+	std::vector<int> pages;
+	pages.push_back(-1);
+	for (int p = 0; p < index.size(); p++) {
+		for (int i = 0; i < PAGE_SIZE; i++) {
+			if (code[p * PAGE_SIZE + i] != 0) {
+				index[p] = pages.size();
+				pages.push_back(p);
+				break;
+			}
+		}
+	}
+	if (pages.size() > 256) {
+		errx(1, "too many pages: %zu", pages.size());
+	}
+
+	printf("// generated by jis_gen.cpp\n");
+	printf("\n");
+	printf("#include \"jis_data.h\"\n");
+	printf("\n");
+	printf("const std::array<uint8,0x%x> jis_index = {\n", (int)index.size());
+	for (int p = 0; p < index.size(); p += 16) {
+		printf(" ");
+		for (int i = 0; i < 16; i++) {
+			printf(" %3d,", index[p + i]);
+		}
+		printf(" // %04x\n", p * PAGE_SIZE);
+	}
+	printf("};\n");
+	printf("\n");
+	printf("const std::array<uint16,0x%x> jis_table = {\n",
+		(int)pages.size() * PAGE_SIZE);
+	for (int n = 0; n < pages.size(); n++) {
+		int p = pages[n];
+		if (p < 0) {
+			printf(" // page 0 (empty)\n");
+		} else {
+			printf(" // page %d (U+%04X)\n", n, p * PAGE_SIZE);
+		}
+		for (int i = 0; i < PAGE_SIZE; i += 8) {
+			printf(" ");
+			for (int j = 0; j < 8; j++) {
+				int v = (p < 0) ? 0 : code[p * PAGE_SIZE + i + j];
+				printf(" 0x%04x,", v);
+			}
+			printf("\n");
+		}
+	}
+	printf("};\n");
+
+	iconv_close(cd);
+	return 0;
+}
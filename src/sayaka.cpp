@@ -26,10 +26,18 @@
 #include "sayaka.h"
 #include "Display.h"
 #include "FileStream.h"
+#include "ImageCache.h"
 #include "JsonInc.h"
+#include "KittyImageCache.h"
+#include "MemoryStream.h"
 #include "Misskey.h"
+#include "NegativeCache.h"
+#include "NoteHistory.h"
+#include "SixelHotCache.h"
+#include "StageStat.h"
 #include "StringUtil.h"
 #include "TLSHandle.h"
+#include "Tracer.h"
 #if defined(USE_TWITTER)
 #include "Twitter.h"
 #endif
@@ -37,8 +45,12 @@
 #include "eaw_code.h"
 #include "subr.h"
 #include "term.h"
+#include <algorithm>
+#include <cinttypes>
 #include <cstdio>
 #include <cstring>
+#include <thread>
+#include <dirent.h>
 #include <err.h>
 #include <getopt.h>
 #include <signal.h>
@@ -50,15 +62,14 @@
 #include <sys/ttycom.h>
 #endif
 
-enum SayakaCmd {
+enum class SayakaCmd {
 	Noop = 0,
 	Stream,
 	Play,
-#if 0
+	Bench,
 	NgwordAdd,
 	NgwordDel,
 	NgwordList,
-#endif
 	Version,
 };
 
@@ -69,11 +80,15 @@ static void init_screen();
 static void invalidate_cache();
 static void signal_handler(int signo);
 static void sigwinch();
-#if 0
+static void set_screen_size(int ws_cols, int ws_width, int ws_height,
+	const char *from);
+static void play(Stream& stream);
+static void dump_metrics(bool json);
+static void write_trace();
+static void cmd_bench();
 static void cmd_ngword_add();
 static void cmd_ngword_del();
 static void cmd_ngword_list();
-#endif
 static void cmd_version();
 [[noreturn]] static void usage();
 
@@ -84,6 +99,11 @@ static const int DEFAULT_FONT_HEIGHT = 14;
 
 int  address_family;			// AF_INET*
 UseSixel use_sixel;				// SIXEL 画像を表示するかどうか
+bool use_syncout;				// 同期出力モードを使うなら true
+bool use_kitty;					// 画像を kitty graphics protocol で表示する
+bool opt_kitty;					// kitty graphics protocol を使ってみる
+bool use_iterm2;				// 画像を iTerm2 の OSC 1337 で表示する
+bool opt_iterm2;				// iTerm2 の OSC 1337 を使ってみる
 int  color_mode;				// 色数もしくはカラーモード
 bool opt_protect;
 Diag diag;						// デバッグ (無分類)
@@ -108,17 +128,15 @@ int  image_next_cols;			// この列で次に表示する画像の位置(桁数)
 int  image_max_rows;			// この列で最大の画像の高さ(行数)
 enum bgtheme opt_bgtheme;		// 背景用の色タイプ
 std::string output_codeset;		// 出力文字コード ("" なら UTF-8)
-#if 0
 bool opt_show_ng;				// NG ツイートを隠さない
 std::string opt_ngword;			// NG ワード (追加削除コマンド用)
 std::string opt_ngword_user;	// NG 対象ユーザ (追加コマンド用)
 NGWordList ngword_list;			// NG ワードリスト
-#endif
 std::string record_file;		// 記録用ファイルパス
 std::string last_id;			// 直前に表示したツイート
 int  last_id_count;				// 連続回数
 int  last_id_max;				// 連続回数の上限
-bool in_sixel;					// SIXEL 出力中なら true
+volatile sig_atomic_t in_sixel;	// SIXEL 出力中なら true
 std::string opt_ciphers;		// 暗号スイート
 bool opt_full_url;				// URL を省略表示しない
 bool opt_progress;				// 起動時の途中経過表示
@@ -128,6 +146,9 @@ int  opt_timeout_image;			// 画像取得の(接続)タイムアウト [msec]
 bool opt_nocolor;				// テキストに(色)属性を一切付けない
 int  opt_record_mode;			// 0:保存しない 1:表示のみ 2:全部保存
 bool opt_mathalpha;				// Mathematical AlphaNumeric を全角英数字に変換
+bool opt_json_sax;				// DOM を作らずにノートを取り出す
+int  opt_play_threads;			// 並列再生のワーカー数 (0 なら並列にしない)
+bool opt_offline;				// 画像を取得せずキャッシュにあるものだけ使う
 bool opt_nocombine;				// Combining Enclosing Keycap を表示しない
 bool opt_show_cw;				// CW を表示する
 bool opt_show_nsfw;				// NSFW 画像を表示する
@@ -136,6 +157,24 @@ StreamMode opt_stream;			// ストリーム種別
 std::string opt_server;			// 接続先サーバ名
 std::string basedir;
 std::string cachedir;
+int  opt_cache_size;			// 画像キャッシュの上限 [MB]
+ImageCache imagecache;			// 画像キャッシュ
+int  opt_source_cache_size;		// 元画像キャッシュの上限 [MB]
+ImageCache srccache("source");	// 元画像キャッシュ
+NegativeCache negcache(imagecache);	// 取得に失敗した URL
+int  opt_hot_cache_size;		// メモリ上の SIXEL キャッシュの上限 [KB]
+SixelHotCache hotcache;			// メモリ上の SIXEL キャッシュ
+int  opt_kitty_cache_size;		// 端末に送った kitty 画像の上限 [MB]
+KittyImageCache kittycache;		// 端末に送った kitty 画像
+int  opt_history;				// 描き直し用に保持するノート数
+NoteHistory history;			// 最近表示したノート
+volatile sig_atomic_t redraw_pending;	// 描き直しが必要なら true
+static uint64 redraw_requested;	// 最後に描き直しを要求された時刻 [nsec]
+std::string opt_metrics;		// 統計の書き出し先 (空か "-" なら stderr)
+int  opt_metrics_interval;		// 統計を JSON で書き出す間隔 [秒] (0 なら無効)
+static uint64 metrics_next;		// 次に JSON で書き出す時刻 [nsec]
+volatile sig_atomic_t metrics_pending;	// 統計の書き出しが必要なら true
+std::string opt_trace;			// トレースの書き出し先 (空なら記録しない)
 
 #if defined(USE_TWITTER)
 std::string myid;				// 自身の user id
@@ -148,7 +187,9 @@ StringDictionary nortlist;		// RT非表示氏リスト
 // enum は getopt() の1文字のオプションと衝突しなければいいので
 // 適当に 0x80 から始めておく。
 enum {
-	OPT_ciphers = 0x80,
+	OPT_bench = 0x80,
+	OPT_cache_size,
+	OPT_ciphers,
 	OPT_color,
 	OPT_dark,
 	OPT_debug,
@@ -165,42 +206,51 @@ enum {
 	OPT_font,
 	OPT_force_sixel,
 	OPT_full_url,
+	OPT_history,
 	OPT_home,
+	OPT_iterm2,
+	OPT_hot_cache_size,
 	OPT_jis,
+	OPT_json_parser,
+	OPT_kitty,
+	OPT_kitty_cache_size,
 	OPT_light,
 	OPT_local,
 	OPT_mathalpha,
 	OPT_max_cont,
 	OPT_max_image_cols,
+	OPT_metrics,
+	OPT_metrics_interval,
 	OPT_misskey,
-#if 0
 	OPT_ngword_add,
 	OPT_ngword_del,
 	OPT_ngword_list,
 	OPT_ngword_user,
-#endif
 	OPT_no_color,
 	OPT_no_combine,
 	OPT_no_image,
 	OPT_ormode,
 	OPT_palette,
 	OPT_play,
+	OPT_play_threads,
 	OPT_progress,
 	OPT_protect,
 	OPT_record,
 	OPT_record_all,
 	OPT_show_cw,
 	OPT_show_nsfw,
-#if 0
+	OPT_source_cache_size,
 	OPT_show_ng,
-#endif
 	OPT_timeout_image,
+	OPT_trace,
 	OPT_twitter,
 	OPT_version,
 	OPT_x68k,
 };
 
 static const struct option longopts[] = {
+	{ "bench",			no_argument,		NULL,	OPT_bench },
+	{ "cache-size",		required_argument,	NULL,	OPT_cache_size },
 	{ "ciphers",		required_argument,	NULL,	OPT_ciphers },
 	{ "color",			required_argument,	NULL,	OPT_color },
 	{ "dark",			no_argument,		NULL,	OPT_dark },
@@ -218,36 +268,43 @@ static const struct option longopts[] = {
 	{ "font",			required_argument,	NULL,	OPT_font },
 	{ "force-sixel",	no_argument,		NULL,	OPT_force_sixel },
 	{ "full-url",		no_argument,		NULL,	OPT_full_url },
+	{ "history",		required_argument,	NULL,	OPT_history },
 //	{ "home",			no_argument,		NULL,	OPT_home },
+	{ "hot-cache-size",	required_argument,	NULL,	OPT_hot_cache_size },
+	{ "iterm2",			no_argument,		NULL,	OPT_iterm2 },
 	{ "jis",			no_argument,		NULL,	OPT_jis },
+	{ "json-parser",	required_argument,	NULL,	OPT_json_parser },
+	{ "kitty",			no_argument,		NULL,	OPT_kitty },
+	{ "kitty-cache-size",	required_argument,	NULL,	OPT_kitty_cache_size },
 	{ "light",			no_argument,		NULL,	OPT_light },
 	{ "local",			required_argument,	NULL,	OPT_local },
 	{ "mathalpha",		no_argument,		NULL,	OPT_mathalpha },
 	{ "max-cont",		required_argument,	NULL,	OPT_max_cont },
 	{ "max-image-cols",	required_argument,	NULL,	OPT_max_image_cols },
+	{ "metrics",		required_argument,	NULL,	OPT_metrics },
+	{ "metrics-interval",	required_argument,	NULL,	OPT_metrics_interval },
 	{ "misskey",		no_argument,		NULL,	OPT_misskey, },
-#if 0
 	{ "ngword-add",		required_argument,	NULL,	OPT_ngword_add },
 	{ "ngword-del",		required_argument,	NULL,	OPT_ngword_del },
 	{ "ngword-list",	no_argument,		NULL,	OPT_ngword_list },
 	{ "ngword-user",	required_argument,	NULL,	OPT_ngword_user },
-#endif
 	{ "no-color",		no_argument,		NULL,	OPT_no_color },
 	{ "no-combine",		no_argument,		NULL,	OPT_no_combine },
 	{ "no-image",		no_argument,		NULL,	OPT_no_image },
 	{ "ormode",			required_argument,	NULL,	OPT_ormode },
 	{ "palette",		required_argument,	NULL,	OPT_palette },
 	{ "play",			no_argument,		NULL,	OPT_play },
+	{ "play-threads",	required_argument,	NULL,	OPT_play_threads },
 	{ "progress",		no_argument,		NULL,	OPT_progress },
 	{ "protect",		no_argument,		NULL,	OPT_protect },
 	{ "record",			required_argument,	NULL,	OPT_record },
 	{ "record-all",		required_argument,	NULL,	OPT_record_all },
 	{ "show-cw",		no_argument,		NULL,	OPT_show_cw },
 	{ "show-nsfw",		no_argument,		NULL,	OPT_show_nsfw },
-#if 0
+	{ "source-cache-size",	required_argument,	NULL,	OPT_source_cache_size },
 	{ "show-ng",		no_argument,		NULL,	OPT_show_ng },
-#endif
 	{ "timeout-image",	required_argument,	NULL,	OPT_timeout_image },
+	{ "trace",			required_argument,	NULL,	OPT_trace },
 	{ "twitter",		no_argument,		NULL,	OPT_twitter },
 	{ "version",		no_argument,		NULL,	OPT_version },
 	{ "x68k",			no_argument,		NULL,	OPT_x68k },
@@ -279,16 +336,12 @@ main(int ac, char *av[])
 	// トークンのデフォルトファイル名は API version によって変わる
 	// ので、デフォルト empty のままにしておく。
 
-#if 0
 	ngword_list.SetFileName(basedir + "ngword.json");
-#endif
 
 	address_family = AF_UNSPEC;
 	opt_bgtheme = BG_NONE;
 	color_mode = 256;
-#if 0
 	opt_show_ng = false;
-#endif
 	last_id = "";
 	last_id_count = 0;
 	last_id_max = 10;
@@ -297,6 +350,13 @@ main(int ac, char *av[])
 	opt_ormode = false;
 	opt_output_palette = true;
 	opt_timeout_image = 3000;
+	opt_cache_size = 32;
+	opt_hot_cache_size = 256;
+	opt_kitty_cache_size = 64;
+	opt_history = 10;
+	opt_json_sax = true;
+	opt_play_threads = 0;
+	opt_source_cache_size = 16;
 	opt_eaw_a = 2;
 	opt_eaw_n = 1;
 	use_sixel = UseSixel::AutoDetect;
@@ -311,6 +371,16 @@ main(int ac, char *av[])
 		 case '6':
 			address_family = AF_INET6;
 			break;
+		 case OPT_bench:
+			cmd = SayakaCmd::Bench;
+			break;
+		 case OPT_cache_size:
+			opt_cache_size = stou32def(optarg, -1);
+			if (opt_cache_size < 0) {
+				errno = EINVAL;
+				err(1, "--cache-size %s", optarg);
+			}
+			break;
 		 case OPT_ciphers:
 			opt_ciphers = optarg;
 			break;
@@ -425,13 +495,50 @@ main(int ac, char *av[])
 			errx(1, "--full-url is only supported with --twitter");
 #endif
 			break;
+		 case OPT_history:
+			opt_history = stou32def(optarg, -1);
+			if (opt_history < 0) {
+				errno = EINVAL;
+				err(1, "--history %s", optarg);
+			}
+			break;
 		 case OPT_home:
 			cmd = SayakaCmd::Stream;
 			opt_stream = StreamMode::Home;
 			break;
+		 case OPT_hot_cache_size:
+			opt_hot_cache_size = stou32def(optarg, -1);
+			if (opt_hot_cache_size < 0) {
+				errno = EINVAL;
+				err(1, "--hot-cache-size %s", optarg);
+			}
+			break;
+		 case OPT_iterm2:
+			opt_iterm2 = true;
+			break;
 		 case OPT_jis:
 			output_codeset = "iso-2022-jp";
 			break;
+		 case OPT_json_parser:
+			if (strcmp(optarg, "sax") == 0) {
+				opt_json_sax = true;
+			} else if (strcmp(optarg, "dom") == 0) {
+				opt_json_sax = false;
+			} else {
+				errx(1, "--json-parser %s: must be either 'sax' or 'dom'",
+					optarg);
+			}
+			break;
+		 case OPT_kitty:
+			opt_kitty = true;
+			break;
+		 case OPT_kitty_cache_size:
+			opt_kitty_cache_size = stou32def(optarg, -1);
+			if (opt_kitty_cache_size < 0) {
+				errno = EINVAL;
+				err(1, "--kitty-cache-size %s", optarg);
+			}
+			break;
 		 case OPT_light:
 			opt_bgtheme = BG_LIGHT;
 			break;
@@ -457,10 +564,19 @@ main(int ac, char *av[])
 				err(1, "--max-image-cols %s", optarg);
 			}
 			break;
+		 case OPT_metrics:
+			opt_metrics = optarg;
+			break;
+		 case OPT_metrics_interval:
+			opt_metrics_interval = stou32def(optarg, -1);
+			if (opt_metrics_interval < 0) {
+				errno = EINVAL;
+				err(1, "--metrics-interval %s", optarg);
+			}
+			break;
 		 case OPT_misskey:
 			opt_proto = Proto::Misskey;
 			break;
-#if 0
 		 case OPT_ngword_add:
 			cmd = SayakaCmd::NgwordAdd;
 			opt_ngword = optarg;
@@ -475,7 +591,6 @@ main(int ac, char *av[])
 		 case OPT_ngword_user:
 			opt_ngword_user = optarg;
 			break;
-#endif
 		 case OPT_no_color:
 			opt_nocolor = true;
 			break;
@@ -506,6 +621,13 @@ main(int ac, char *av[])
 		 case OPT_play:
 			cmd = SayakaCmd::Play;
 			break;
+		 case OPT_play_threads:
+			opt_play_threads = stou32def(optarg, -1);
+			if (opt_play_threads < 0) {
+				errno = EINVAL;
+				err(1, "--play-threads %s", optarg);
+			}
+			break;
 		 case OPT_progress:
 			opt_progress = true;
 			break;
@@ -530,11 +652,16 @@ main(int ac, char *av[])
 		 case OPT_show_nsfw:
 			opt_show_nsfw = true;
 			break;
-#if 0
 		 case OPT_show_ng:
 			opt_show_ng = true;
 			break;
-#endif
+		 case OPT_source_cache_size:
+			opt_source_cache_size = stou32def(optarg, -1);
+			if (opt_source_cache_size < 0) {
+				errno = EINVAL;
+				err(1, "--source-cache-size %s", optarg);
+			}
+			break;
 		 case OPT_timeout_image:
 			opt_timeout_image = stou32def(optarg, -1);
 			if (opt_timeout_image < 0) {
@@ -542,6 +669,9 @@ main(int ac, char *av[])
 				err(1, "--timeout-image %s", optarg);
 			}
 			break;
+		 case OPT_trace:
+			opt_trace = optarg;
+			break;
 		 case OPT_twitter:
 #if defined(USE_TWITTER)
 			opt_proto = Proto::Twitter;
@@ -605,6 +735,18 @@ main(int ac, char *av[])
 
 	init();
 
+	// 統計は常に集めておき、SIGUSR1 か一定間隔で書き出す。
+	StageStat::Enable(true);
+	if (opt_metrics_interval > 0) {
+		metrics_next = StageStat::Now() +
+			(uint64)opt_metrics_interval * 1000 * 1000 * 1000;
+	}
+	// トレースは指定された時だけ記録し、SIGUSR1 と終了時に書き出す。
+	if (opt_trace.empty() == false) {
+		Tracer::Enable(true);
+		atexit(write_trace);
+	}
+
 	// コマンド別処理
 	switch (cmd) {
 	 case SayakaCmd::Stream:
@@ -628,7 +770,12 @@ main(int ac, char *av[])
 		init_screen();
 		cmd_play();
 		break;
-#if 0
+	 case SayakaCmd::Bench:
+		if (opt_proto == Proto::None) {
+			errx(1, "--bench must be used with --twitter or --misskey");
+		}
+		cmd_bench();
+		break;
 	 case SayakaCmd::NgwordAdd:
 		cmd_ngword_add();
 		break;
@@ -638,7 +785,6 @@ main(int ac, char *av[])
 	 case SayakaCmd::NgwordList:
 		cmd_ngword_list();
 		break;
-#endif
 	 case SayakaCmd::Version:
 		cmd_version();
 		break;
@@ -678,6 +824,22 @@ init()
 		warnx("init: %s is created.", c_cachedir);
 	}
 
+	// 画像キャッシュを開く。開けなくても画像を毎回取得するだけ。
+	imagecache.SetDiag(diagImage);
+	if (imagecache.Open(cachedir, (uint64)opt_cache_size * 1024 * 1024)
+	    == false) {
+		warnx("init: image cache in %s cannot be opened.", c_cachedir);
+	}
+	srccache.SetDiag(diagImage);
+	if (srccache.Open(cachedir, (uint64)opt_source_cache_size * 1024 * 1024)
+	    == false) {
+		warnx("init: source image cache in %s cannot be opened.", c_cachedir);
+	}
+	hotcache.SetBudget((size_t)opt_hot_cache_size * 1024);
+	kittycache.SetBudget((size_t)opt_kitty_cache_size * 1024 * 1024);
+	history.SetCapacity((size_t)opt_history);
+	negcache.SetDiag(diagImage);
+
 	// シグナルハンドラを設定
 	signal(SIGINT,    signal_handler);
 	signal(SIGHUP,    signal_handler);
@@ -731,6 +893,28 @@ init_screen()
 		}
 	}
 
+	// --kitty なら、端末が kitty graphics protocol をサポートしているか。
+	// サポートしていればそちらで画像を表示するので SIXEL は調べない。
+	// サポートしていなければ SIXEL を調べる。
+	if (opt_kitty && use_sixel != UseSixel::No) {
+		progress("Checking whether the terminal supports kitty graphics...");
+		use_kitty = terminal_support_kitty();
+		progress(use_kitty ? "yes\n" : "no\n");
+		if (use_kitty) {
+			use_sixel = UseSixel::Yes;
+		}
+	}
+
+	// --iterm2 なら、同様に iTerm2 の画像表示をサポートしているか。
+	if (opt_iterm2 && use_kitty == false && use_sixel != UseSixel::No) {
+		progress("Checking whether the terminal supports iTerm2 images...");
+		use_iterm2 = terminal_support_iterm2();
+		progress(use_iterm2 ? "yes\n" : "no\n");
+		if (use_iterm2) {
+			use_sixel = UseSixel::Yes;
+		}
+	}
+
 	// 端末が SIXEL をサポートしているか。
 	//
 	//             termianl_support_sixel() ?
@@ -751,42 +935,55 @@ init_screen()
 		}
 	}
 
+	// 端末が同期出力モードをサポートしているか。
+	progress("Checking whether the terminal supports synchronized output...");
+	use_syncout = terminal_support_syncout();
+	progress(use_syncout ? "yes\n" : "no\n");
+
 	// 文字コードの初期化
 	UString::Init(output_codeset);
 
+	// 文字幅テーブルの初期化
+	init_eaw_width();
+
 	// 色の初期化
 	init_color();
 
 	// 一度手動で呼び出して桁数を取得
 	sigwinch();
 
-#if 0
 	// NG ワード取得
-	ngword_list.ReadFile();
-#endif
+	if (ngword_list.ReadFile() == false) {
+		warnx("%s: failed to read NG word list; ignored",
+			ngword_list.Filename.c_str());
+	}
 }
 
 // 古いキャッシュを破棄する
 static void
 invalidate_cache()
 {
-	char cmd[1024];
-
 	// アイコンは1か月分くらいか
-	snprintf(cmd, sizeof(cmd),
-		"find %s -name icon-\\* -type f -atime +30 -exec rm {} +",
-		cachedir.c_str());
-	if (system(cmd) < 0) {
-		warn("system(find icon)");
-	}
+	imagecache.Expire("icon-", 30 * 24 * 60 * 60);
 
 	// 写真は2日分くらいか
-	snprintf(cmd, sizeof(cmd),
-		"find %s -name http\\* -type f -atime +2 -exec rm {} +",
-		cachedir.c_str());
-	if (system(cmd) < 0) {
-		warn("system(find photo)");
-	}
+	imagecache.Expire("http", 2 * 24 * 60 * 60);
+
+	// 検証子は表示するたびに参照されるので、アイコンと同じでいい
+	imagecache.Expire("val-", 30 * 24 * 60 * 60);
+
+	// 取得失敗の記録は期限の上限 (1週間) を過ぎても参照されなければ不要
+	imagecache.Expire(NegativeCache::KeyPrefix, 7 * 24 * 60 * 60);
+
+	imagecache.Sync();
+
+	// 元画像 (と検証子) はアイコンも写真も2か月分。
+	// SIXEL と元画像はそれぞれの上限の中で独立に古いものから追い出すが、
+	// SIXEL は元画像があれば通信なしで作り直せるので、期限切れでは
+	// SIXEL のほうが先に消えるようにしておく。
+	// 逆に元画像が先に消えても SIXEL はそのまま使える。
+	srccache.Expire("", 60 * 24 * 60 * 60);
+	srccache.Sync();
 }
 
 static void
@@ -795,16 +992,41 @@ signal_handler(int signo)
 	switch (signo) {
 	 case SIGINT:
 		// SIXEL 出力中なら中断する (CAN + ST)
+		// SIXEL は stdio を通さずに書いているので、こちらも直接書く。
+		// in_sixel を下ろすと書き出し側が残りを捨てる。
 		if (in_sixel) {
-			printf(CAN ESC "\\");
-			fflush(stdout);
+			static const char abortseq[] = CAN ESC "\\";
+			if (write(STDOUT_FILENO, abortseq, sizeof(abortseq) - 1) < 0) {
+				// 書けなくてもここではどうしようもない。
+			}
+			in_sixel = false;
 		} else {
 			exit(0);
 		}
 		break;
 
 	 case SIGWINCH:
+	 {
+		int old_cols = screen_cols;
+		int old_iconsize = iconsize;
 		sigwinch();
+		// 画面に出ているものの桁数やアイコンサイズが変わったら描き直す。
+		// 実際に描き直すのはメインループに戻ってから。
+		if (screen_cols != old_cols || iconsize != old_iconsize) {
+			redraw_pending = true;
+		}
+		break;
+	 }
+
+	 case SIGUSR1:
+		// 統計を書き出す。
+		// 実際に書き出すのはメインループに戻ってから。
+		metrics_pending = true;
+		break;
+
+	 case SIGUSR2:
+		// 手動で描き直す。
+		redraw_pending = true;
 		break;
 
 	 default:
@@ -836,6 +1058,14 @@ sigwinch()
 		}
 	}
 
+	set_screen_size(ws_cols, ws_width, ws_height, " (from ioctl)");
+}
+
+// 画面の桁数とフォントの大きさ (0 なら不明) から表示に使う大きさを決める。
+// from はデバッグ表示用の取得元。
+static void
+set_screen_size(int ws_cols, int ws_width, int ws_height, const char *from)
+{
 	const char *msg_cols = "";
 	const char *msg_width = "";
 	const char *msg_height = "";
@@ -843,7 +1073,7 @@ sigwinch()
 	// 画面幅は常に更新
 	if (ws_cols > 0) {
 		screen_cols = ws_cols;
-		msg_cols = " (from ioctl)";
+		msg_cols = from;
 	} else {
 		screen_cols = 0;
 		msg_cols = " (not detected)";
@@ -856,7 +1086,7 @@ sigwinch()
 	} else {
 		if (ws_width > 0) {
 			fontwidth = ws_width;
-			msg_width = " (from ioctl)";
+			msg_width = from;
 		} else {
 			fontwidth = DEFAULT_FONT_WIDTH;
 			msg_width = " (DEFAULT)";
@@ -868,7 +1098,7 @@ sigwinch()
 	} else {
 		if (ws_height > 0) {
 			fontheight = ws_height;
-			msg_height = " (from ioctl)";
+			msg_height = from;
 		} else {
 			fontheight = DEFAULT_FONT_HEIGHT;
 			msg_height = " (DEFAULT)";
@@ -904,7 +1134,6 @@ sigwinch()
 	Debug(diag, "imagesize=%d", imagesize);
 }
 
-#if 0
 // NG ワードを追加するコマンド
 static void
 cmd_ngword_add()
@@ -925,7 +1154,6 @@ cmd_ngword_list()
 {
 	ngword_list.CmdList();
 }
-#endif
 
 static void
 cmd_version()
@@ -941,19 +1169,27 @@ R"(usage: sayaka [<options>...]
    command option:
 	--local <server> : show <server>'s local timeline.
 	--play : read JSON from stdin.
+	--bench : replay JSON from stdin offline and report the throughput.
    other options:
+	--cache-size <MB> : image cache size limit. default 32.
 	--color <n> : color mode { 2 .. 256 or x68k }. default 256.
 	--font <width>x<height> : font size. default 7x14
 	--full-url : display full URL even if the URL is abbreviated. (twitter)
+	--history <n> : number of notes to redraw on resize/SIGUSR2. default 10.
+	--hot-cache-size <KB> : in-memory SIXEL cache size. default 256.
 	--light / --dark : Use light/dark theme. (default: auto detect)
 	--no-color : disable all text color sequences
 	--no-image : force disable (SIXEL) images.
 	--force-sixel : force enable SIXEL images.
+	--iterm2 : pass original images through iTerm2's OSC 1337 if available.
 	--jis / --eucjp : Set output encoding.
+	--kitty : use kitty graphics protocol instead of SIXEL if available.
+	--kitty-cache-size <MB> : terminal side image budget. default 64.
 	--progress: show startup progress (for very slow machines).
 	--protect : don't display protected user's tweet. (twitter)
 	--record <file> : record JSON to file.
 	--record-all <file> : record all received JSON to file.
+	--source-cache-size <MB> : original image cache size limit. default 16.
 	--timeout-image <msec>
 	--version
 	--x68k : preset options for x68k (with SIXEL kernel).
@@ -963,15 +1199,17 @@ R"(usage: sayaka [<options>...]
 	--debug-http  <0-2>             --debug-image <0-1>
 	--debug-mbedtls <0-4>
 	--debug-sixel <0-2>             --debug-show  <0-2>
+	--json-parser <sax|dom> (default sax)
 	--mathalpha                     --no-combine
 	--max-cont <n>                  --max-image-cols <n>
-)"
-#if 0
-	--ngword-add                    --ngword-del
-	--ngword-list                   --ngword-user
+	--metrics <file> : where to dump statistics on SIGUSR1 (default stderr)
+	--metrics-interval <sec> : also dump them as JSON every <sec> seconds
+	--trace <file> : write a Chrome trace to <file> on exit and SIGUSR1
+	--ngword-add <word>             --ngword-del <id>
+	--ngword-list                   --ngword-user <@user[@host]>
+	--ormode <on|off> (default off) --palette <on|off> (default on)
+	--play-threads <n> (default 0)
 	--show-ng
-#endif
-R"(	--ormode <on|off> (default off) --palette <on|off> (default on)
 )"
 	);
 	exit(0);
@@ -983,9 +1221,27 @@ cmd_play()
 {
 	FileStream stdinstream(stdin, false);
 
+	play(stdinstream);
+}
+
+// stream から1行ずつ JSON を読み込んで表示する。
+static void
+play(Stream& stream)
+{
+	// 解析と整形をワーカーに任せて並列に行う。
+	if (opt_play_threads > 0 && opt_proto == Proto::Misskey) {
+		misskey_play_parallel(stream, opt_play_threads);
+		misskey_print_stat();
+		return;
+	}
+
 	for (;;) {
+		// 端末の大きさが変わっていれば (落ち着いてから) 描き直す。
+		check_redraw();
+		check_metrics();
+
 		std::string line;
-		auto r = stdinstream.ReadLine(&line);
+		auto r = stream.ReadLine(&line);
 		if (__predict_false(r <= 0)) {
 			break;
 		}
@@ -1008,6 +1264,280 @@ cmd_play()
 			break;
 		}
 	}
+
+	if (opt_proto == Proto::Misskey) {
+		misskey_print_stat();
+	}
+}
+
+// 端末の大きさが変わってから描き直すまでの時間 [msec]。
+// 変更が落ち着くまで (しばらくシグナルが来なくなるまで) 待つ。
+static const int REDRAW_DELAY = 200;
+
+// 描き直す必要があれば描き直す。メインループから呼ぶこと。
+// シグナルを受け取ってから REDRAW_DELAY 経つまでに次のシグナルが来れば
+// そこから数え直す。入力が続いていても、経った時点で描き直す。
+void
+check_redraw()
+{
+	uint64 now = StageStat::Now();
+	if (__predict_false(redraw_pending)) {
+		// ハンドラでは時刻を取らず、ここで気付いた時刻を使う。
+		redraw_pending = false;
+		redraw_requested = now;
+	}
+	if (__predict_false(redraw_requested != 0) &&
+	    now >= redraw_requested + (uint64)REDRAW_DELAY * 1000 * 1000)
+	{
+		redraw_requested = 0;
+		RedrawHistory();
+	}
+}
+
+// 次に描き直すまでの時間 [msec] を返す。
+// 描き直しの予定がなければ -1 を返す。poll(2) のタイムアウト用。
+int
+redraw_timeout()
+{
+	if (redraw_pending) {
+		return 0;
+	}
+	if (redraw_requested == 0) {
+		return -1;
+	}
+	uint64 now = StageStat::Now();
+	uint64 when = redraw_requested + (uint64)REDRAW_DELAY * 1000 * 1000;
+	if (now >= when) {
+		return 0;
+	}
+	return (int)((when - now + 999999) / 1000000);
+}
+
+// 統計を書き出す必要があれば書き出す。メインループから呼ぶこと。
+// SIGUSR1 を受け取っていれば表形式で、--metrics-interval の間隔が
+// 過ぎていれば JSON で書き出す。
+void
+check_metrics()
+{
+	if (__predict_false(metrics_pending)) {
+		metrics_pending = false;
+		dump_metrics(false);
+		if (Tracer::IsEnabled()) {
+			write_trace();
+		}
+	}
+	if (opt_metrics_interval > 0) {
+		uint64 now = StageStat::Now();
+		if (now >= metrics_next) {
+			dump_metrics(true);
+			metrics_next = now +
+				(uint64)opt_metrics_interval * 1000 * 1000 * 1000;
+		}
+	}
+}
+
+// 次に JSON で書き出すまでの時間 [msec] を返す。
+// 定期的に書き出さないなら -1 を返す。poll(2) のタイムアウト用。
+int
+metrics_timeout()
+{
+	if (opt_metrics_interval <= 0) {
+		return -1;
+	}
+	uint64 now = StageStat::Now();
+	if (now >= metrics_next) {
+		return 0;
+	}
+	return (int)((metrics_next - now + 999999) / 1000000);
+}
+
+// 統計を --metrics のファイル (指定がなければ stderr) に書き出す。
+// ファイルには追記するので、JSON なら1行1レコードになる。
+static void
+dump_metrics(bool json)
+{
+	FILE *fp;
+
+	if (opt_metrics.empty() || opt_metrics == "-") {
+		fp = stderr;
+	} else {
+		fp = fopen(opt_metrics.c_str(), "a");
+		if (fp == NULL) {
+			warn("%s", opt_metrics.c_str());
+			return;
+		}
+	}
+
+	if (json) {
+		StageStat::PrintJSON(fp);
+	} else {
+		StageStat::Print(fp);
+	}
+
+	if (fp != stderr) {
+		fclose(fp);
+	}
+}
+
+// トレースを --trace のファイルに書き出す。
+// 書き出すのはその時点でリングバッファに残っている分なので、
+// 毎回ファイルを作り直す。
+static void
+write_trace()
+{
+	FILE *fp = fopen(opt_trace.c_str(), "w");
+	if (fp == NULL) {
+		warn("%s", opt_trace.c_str());
+		return;
+	}
+	Tracer::Write(fp);
+	fclose(fp);
+}
+
+// ベンチマークモード
+//
+// 標準入力から録画した JSON を読み込んで再生し、所要時間と段階ごとの
+// 内訳を表示する。入力は先に全部読み込んでおき、1行を1ノートと数える。
+// 端末には問い合わせず、出力は端末の代わりにパイプでつないだスレッドが
+// バイト数とチェックサムを数えながら読み捨てる。
+// 画像は通信せず元画像キャッシュにあるものだけを使い、SIXEL は毎回
+// 一時ディレクトリの空のキャッシュから作り直す。そのため同じ入力と
+// 同じ元画像キャッシュからは毎回同じ出力になる。
+static void
+cmd_bench()
+{
+	std::vector<uint8> input;
+	for (;;) {
+		uint8 buf[65536];
+		ssize_t n = read(STDIN_FILENO, buf, sizeof(buf));
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			err(1, "%s: read", __func__);
+		}
+		if (n == 0) {
+			break;
+		}
+		input.insert(input.end(), buf, buf + n);
+	}
+	uint64 notes = std::count(input.begin(), input.end(), '\n');
+
+	// 端末への問い合わせの代わりに決め打ちの値を使う。
+	if (opt_bgtheme == BG_NONE) {
+		opt_bgtheme = BG_DARK;
+	}
+	if (use_sixel == UseSixel::AutoDetect) {
+		use_sixel = UseSixel::Yes;
+	}
+	use_kitty = opt_kitty;
+	use_iterm2 = opt_iterm2 && !use_kitty;
+	use_syncout = false;
+	UString::Init(output_codeset);
+	init_eaw_width();
+	init_color();
+	set_screen_size(80, DEFAULT_FONT_WIDTH, DEFAULT_FONT_HEIGHT, " (bench)");
+	// 出力先は端末ではないので、端末の大きさには追従しない。
+	signal(SIGWINCH, SIG_IGN);
+
+	if (ngword_list.ReadFile() == false) {
+		warnx("%s: failed to read NG word list; ignored",
+			ngword_list.Filename.c_str());
+	}
+
+	// SIXEL (と取得失敗の記録) は空のキャッシュから始める。
+	const char *tmp = getenv("TMPDIR");
+	std::string tmpdir = std::string(tmp ? tmp : "/tmp") + "/sayaka-bench.XXXXXX";
+	if (mkdtemp(&tmpdir[0]) == NULL) {
+		err(1, "%s: mkdtemp %s", __func__, tmpdir.c_str());
+	}
+	if (imagecache.Open(tmpdir, (uint64)opt_cache_size * 1024 * 1024)
+	    == false) {
+		warnx("%s: image cache in %s cannot be opened.",
+			__func__, tmpdir.c_str());
+	}
+	opt_offline = true;
+
+	// 標準出力を読み捨てスレッドにつなぐ。
+	int fds[2];
+	if (pipe(fds) < 0) {
+		err(1, "%s: pipe", __func__);
+	}
+	fflush(stdout);
+	int saved_stdout = dup(STDOUT_FILENO);
+	if (saved_stdout < 0 || dup2(fds[1], STDOUT_FILENO) < 0) {
+		err(1, "%s: dup", __func__);
+	}
+	close(fds[1]);
+
+	uint64 bytes = 0;
+	uint64 hash = 0xcbf29ce484222325;	// FNV-1a
+	std::thread sink([&] {
+		uint8 buf[65536];
+		for (;;) {
+			ssize_t n = read(fds[0], buf, sizeof(buf));
+			if (n < 0 && errno == EINTR) {
+				continue;
+			}
+			if (n <= 0) {
+				break;
+			}
+			bytes += n;
+			for (ssize_t i = 0; i < n; i++) {
+				hash = (hash ^ buf[i]) * 0x100000001b3;
+			}
+		}
+	});
+
+	MemoryStream stream(input);
+	StageStat::Clear();
+	StageStat::Enable(true);
+	uint64 start = StageStat::Now();
+	play(stream);
+	fflush(stdout);
+	uint64 elapsed = StageStat::Now() - start;
+	StageStat::Enable(false);
+
+	// 書き込み側を閉じればスレッドは EOF で終わる。
+	dup2(saved_stdout, STDOUT_FILENO);
+	close(saved_stdout);
+	sink.join();
+	close(fds[0]);
+
+	imagecache.Close();
+	DIR *dir = opendir(tmpdir.c_str());
+	if (dir) {
+		struct dirent *d;
+		while ((d = readdir(dir)) != NULL) {
+			if (d->d_name[0] != '.') {
+				unlink((tmpdir + "/" + d->d_name).c_str());
+			}
+		}
+		closedir(dir);
+	}
+	rmdir(tmpdir.c_str());
+
+	double sec = (double)elapsed / 1e9;
+	double n = (notes != 0) ? notes : 1;
+	printf("notes %" PRIu64 "\n", notes);
+	printf("elapsed %.3f sec\n", sec);
+	printf("rate %.1f notes/sec\n", (sec > 0) ? notes / sec : 0);
+	printf("bytes %" PRIu64 " (%.1f bytes/note)\n", bytes, bytes / n);
+	printf("checksum %016" PRIx64 "\n", hash);
+	// 並列再生ではワーカーの時間はスレッドの合計になる。
+	printf("%-10s %8s %12s %12s\n", "stage", "calls", "total[ms]", "usec/note");
+	for (int i = 0; i < (int)Stage::Max; i++) {
+		auto stage = (Stage)i;
+		uint64 nsec = StageStat::GetNsec(stage);
+		printf("%-10s %8" PRIu64 " %12.3f %12.2f\n",
+			StageStat::GetName(stage), StageStat::GetCount(stage),
+			(double)nsec / 1e6, (double)nsec / 1e3 / n);
+	}
+	for (int i = 0; i < (int)Counter::Max; i++) {
+		auto counter = (Counter)i;
+		printf("%-12s %" PRIu64 "\n",
+			StageStat::GetName(counter), StageStat::GetCounter(counter));
+	}
 }
 
 // ツイートを保存する
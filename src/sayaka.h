@@ -29,9 +29,8 @@
 #include "Diag.h"
 #include "Dictionary.h"
 #include "JsonFwd.h"
-#if 0
 #include "NGWord.h"
-#endif
+#include <csignal>
 #include <string>
 
 #define DEBUG_FORMAT 1
@@ -49,6 +48,10 @@ enum Color {
 	Verified,
 	Protected,
 	NG,
+	Bold,
+	Italic,
+	Strike,
+	Small,
 	Max,
 };
 
@@ -59,6 +62,8 @@ enum bgtheme {
 };
 
 // use_sixel
+// 画像を kitty graphics protocol や iTerm2 の OSC 1337 で表示する場合
+// (use_kitty, use_iterm2) も Yes になる。
 enum class UseSixel {
 	AutoDetect = -1,
 	No = 0,
@@ -77,17 +82,29 @@ enum class StreamMode {
 	Global,
 };
 
+class ImageCache;
+class KittyImageCache;
+class NegativeCache;
+class NoteHistory;
+class SixelHotCache;
 class UString;
 
 static const int ColorFixedX68k = -1;
 
 extern void cmd_play();
+extern void check_redraw();
+extern int  redraw_timeout();
+extern void check_metrics();
+extern int  metrics_timeout();
 
 extern void record(const char *str);
 extern void record(const Json& obj);
 
 extern int  address_family;
 extern UseSixel use_sixel;
+extern bool use_syncout;
+extern bool use_kitty;
+extern bool use_iterm2;
 extern int  color_mode;
 extern bool opt_protect;
 extern Diag diag;
@@ -112,17 +129,15 @@ extern int  image_next_cols;
 extern int  image_max_rows;
 extern enum bgtheme opt_bgtheme;
 extern std::string output_codeset;
-#if 0
 extern bool opt_show_ng;
 extern std::string opt_ngword;
 extern std::string opt_ngword_user;
 extern NGWordList ngword_list;
-#endif
 extern std::string record_file;
 extern std::string last_id;
 extern int  last_id_count;
 extern int  last_id_max;
-extern bool in_sixel;
+extern volatile sig_atomic_t in_sixel;
 extern std::string opt_ciphers;
 extern bool opt_full_url;
 extern bool opt_progress;
@@ -132,11 +147,26 @@ extern int  opt_timeout_image;
 extern bool opt_nocolor;
 extern int  opt_record_mode;
 extern bool opt_mathalpha;
+extern bool opt_json_sax;
+extern int  opt_play_threads;
+extern bool opt_offline;
 extern bool opt_nocombine;
 extern bool opt_show_cw;
 extern bool opt_show_nsfw;
 extern std::string basedir;
 extern std::string cachedir;
+extern int  opt_cache_size;
+extern ImageCache imagecache;
+extern int  opt_source_cache_size;
+extern ImageCache srccache;
+extern NegativeCache negcache;
+extern int  opt_hot_cache_size;
+extern SixelHotCache hotcache;
+extern int  opt_kitty_cache_size;
+extern KittyImageCache kittycache;
+extern int  opt_history;
+extern NoteHistory history;
+extern volatile sig_atomic_t metrics_pending;
 extern Proto opt_proto;
 extern StreamMode opt_stream;
 extern std::string opt_server;
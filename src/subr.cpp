@@ -71,6 +71,16 @@ GetUnixTime()
 	return time(NULL);
 }
 
+// 経過時間の計測用に単調増加する時刻を usec で返す
+uint64
+GetMonotonicUsec()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
 // UNIX 時刻から表示用の文字列を返す。
 //
 // Display.cpp に移動したいところだがテストに Display.o を含めると
@@ -34,6 +34,7 @@ extern std::string unescape(const std::string& text);
 extern std::string strip_tags(const std::string& text);
 
 extern time_t GetUnixTime() __attribute__((__weak__));
+extern uint64 GetMonotonicUsec();
 extern std::string format_time(time_t);
 extern time_t twitter_get_time(const Json& status);
 extern time_t DecodeTwitterTime(const std::string& src);
@@ -30,6 +30,7 @@
 #include "subr.h"
 #include <cstdio>
 #include <string>
+#include <ctype.h>
 #include <errno.h>
 #include <string.h>
 #include <termios.h>
@@ -120,6 +121,144 @@ terminal_support_sixel()
 	return false;
 }
 
+// 端末が同期出力モード (DEC private mode 2026) をサポートしていれば
+// true を返す。
+bool
+terminal_support_syncout()
+{
+	std::string query;
+	char result[128];
+	int n;
+
+	// 出力先が端末でない(パイプとか)なら帰る。
+	if (isatty(STDOUT_FILENO) == 0) {
+		return false;
+	}
+
+	// DECRQM で問い合わせる。
+	// 知らない端末は応答しないことがあるので、タイムアウトを待たなくて
+	// いいように DA1 を続けて送っておく (こちらは必ず応答がある)。
+	query = CSI "?2026$p" CSI "c";
+	n = query_terminal(query, result, sizeof(result));
+	if (n < 0) {
+		Debug(diag, "%s query_terminal failed: %s", __func__, strerrno());
+		return false;
+	}
+	if (n == 0) {
+		Debug(diag, "%s: timeout", __func__);
+		return false;
+	}
+	Trace(diag, "result |%s|", termdump(result).c_str());
+
+	// 1 (set) か 2 (reset) なら切り替えられる。
+	// 3, 4 (permanently set/reset) は切り替えても意味がない。
+	int val = parse_decrpm(result, 2026);
+	return (val == 1 || val == 2);
+}
+
+// 端末が kitty graphics protocol をサポートしていれば true を返す。
+bool
+terminal_support_kitty()
+{
+	std::string query;
+	char result[128];
+	int n;
+
+	// 出力先が端末でない(パイプとか)なら帰る。
+	if (isatty(STDOUT_FILENO) == 0) {
+		return false;
+	}
+
+	// 1x1 の画像を a=q (問い合わせ) で送ってみる。
+	// 知らない端末は応答しないので、syncout と同様に DA1 を続けて送る。
+	// APC の応答と DA1 の応答が別々に届いても、query_terminal() が
+	// DA1 の応答まで読むので、DA1 の方が端末に漏れることはない。
+	query = ESC "_Gi=31,s=1,v=1,a=q,t=d,f=24;AAAA" ESC "\\" CSI "c";
+	n = query_terminal(query, result, sizeof(result));
+	if (n < 0) {
+		Debug(diag, "%s query_terminal failed: %s", __func__, strerrno());
+		return false;
+	}
+	if (n == 0) {
+		Debug(diag, "%s: timeout", __func__);
+		return false;
+	}
+	Trace(diag, "result |%s|", termdump(result).c_str());
+
+	return parse_kitty_response(result);
+}
+
+// kitty graphics protocol の問い合わせに対する応答が成功なら true を返す。
+// 応答は ESC "_Gi=31;OK" ESC "\\" の形式で、失敗ならエラーメッセージが入る。
+bool
+parse_kitty_response(const char *result)
+{
+	return (strstr(result, ESC "_Gi=31;OK") != NULL);
+}
+
+// 端末が iTerm2 の画像表示 (OSC 1337 File=) をサポートしていれば
+// true を返す。
+bool
+terminal_support_iterm2()
+{
+	std::string query;
+	char result[128];
+	int n;
+
+	// 出力先が端末でない(パイプとか)なら帰る。
+	if (isatty(STDOUT_FILENO) == 0) {
+		return false;
+	}
+
+	// File= 自体は問い合わせられないので、同じ OSC 1337 の
+	// ReportCellSize に応答するかどうかで判断する。
+	// 知らない端末は応答しないので、DA1 を続けて送る。
+	// OSC の応答と DA1 の応答が別々に届いても、query_terminal() が
+	// DA1 の応答まで読む。
+	query = ESC "]1337;ReportCellSize" ESC "\\" CSI "c";
+	n = query_terminal(query, result, sizeof(result));
+	if (n < 0) {
+		Debug(diag, "%s query_terminal failed: %s", __func__, strerrno());
+		return false;
+	}
+	if (n == 0) {
+		Debug(diag, "%s: timeout", __func__);
+		return false;
+	}
+	Trace(diag, "result |%s|", termdump(result).c_str());
+
+	return parse_iterm2_response(result);
+}
+
+// ReportCellSize の問い合わせに応答があれば true を返す。
+// 応答は ESC "]1337;ReportCellSize=<height>;<width>[;<scale>]" ST の形式。
+bool
+parse_iterm2_response(const char *result)
+{
+	return (strstr(result, ESC "]1337;ReportCellSize=") != NULL);
+}
+
+// DECRQM に対する応答 (DECRPM) からモード mode の値を取り出す。
+// 応答は CSI "?<mode>;<value>$y" の形式。
+// 見付からなければ -1 を返す。
+int
+parse_decrpm(const char *result, int mode)
+{
+	auto head = string_format(CSI "?%d;", mode);
+	const char *p = strstr(result, head.c_str());
+	if (p == NULL) {
+		return -1;
+	}
+	p += head.size();
+
+	char *e;
+	int val = stou32def(p, -1, &e);
+	if (val < 0 || e[0] != '$' || e[1] != 'y') {
+		return -1;
+	}
+	return val;
+}
+
 // 端末の背景色を調べる。
 // 黒に近ければ BG_DARK、白に近ければ BG_LIGHT、取得できなければ BG_NONE を
 // 返す。
@@ -211,10 +350,48 @@ parse_bgcolor(char *result)
 	return (bgtheme)(int)(I + 0.5);
 }
 
-// ファイルディスクリプタ fd から dstbuf に読み込む。
+// query に対する端末からの応答 result (len バイト) が揃っていれば
+// true を返す。
+// 問い合わせの最後に DA1 を送っていれば、その応答 (CSI "?" 数字と ';' "c")
+// で終わるまで揃っていない。応答は複数回に分かれて届くことがある。
+// DA1 を送っていなければ、OSC などの終端 (BEL か ST) で終わっていれば揃った
+// ことにする。
+bool
+terminal_reply_complete(const std::string& query, const char *result,
+	size_t len)
+{
+	if (len == 0) {
+		return false;
+	}
+
+	bool with_da1 = (query.size() >= 3 &&
+		query.compare(query.size() - 3, 3, CSI "c") == 0);
+	if (with_da1) {
+		if (result[len - 1] != 'c') {
+			return false;
+		}
+		size_t i = len - 1;
+		while (i > 0 &&
+		       (isdigit((unsigned char)result[i - 1]) || result[i - 1] == ';'))
+		{
+			i--;
+		}
+		return (i >= 3 && result[i - 3] == ESCchar && result[i - 2] == '[' &&
+			result[i - 1] == '?');
+	}
+
+	if (result[len - 1] == '\a') {
+		return true;
+	}
+	return (len >= 2 && result[len - 2] == ESCchar && result[len - 1] == '\\');
+}
+
+// 端末に query を送って、応答を dst に読み込む。
+// 応答が揃うまで (terminal_reply_complete() 参照) 何回かに分けて読む。
 // 成功すれば、読み出した内容を dst に '\0' 終端で書き戻し、読み出した
-// バイト数を返す。
-// タイムアウトすれば 0 を返す。
+// バイト数を返す。dst には最大 dstsize - 1 バイトまで読み込む。
+// 途中でタイムアウトすればそれまでに読み出したバイト数を返す
+// (1バイトも読めていなければ 0)。
 // エラーなら -1 を返す (今の所 select か read かの区別はつかない)。
 static int
 query_terminal(const std::string& query, char *dst, size_t dstsize)
@@ -223,18 +400,9 @@ query_terminal(const std::string& query, char *dst, size_t dstsize)
 	struct termios tc;
 	struct termios old;
 	fd_set rfds;
+	size_t len;
 	int r;
 
-	// select(2) の用意
-	FD_ZERO(&rfds);
-	FD_SET(STDOUT_FILENO, &rfds);
-	memset(&timeout, 0, sizeof(timeout));
-#if defined(SLOW_MACHINES)
-	timeout.tv_sec = 10;
-#else
-	timeout.tv_usec = 500 * 1000;
-#endif
-
 	// 応答受け取るため非カノニカルモードにするのと
 	// その応答を画面に表示してしまわないようにエコーオフにする。
 	tcgetattr(STDOUT_FILENO, &tc);
@@ -246,17 +414,40 @@ query_terminal(const std::string& query, char *dst, size_t dstsize)
 	Trace(diag, "\nquery  |%s|", termdump(query.c_str()).c_str());
 	r = write(STDOUT_FILENO, query.c_str(), query.size());
 
-	// 念のため応答がなければタイムアウトするようにしておく
-	r = select(STDOUT_FILENO + 1, &rfds, NULL, NULL, &timeout);
-	if (__predict_false(r <= 0)) {
-		goto done;
-	}
+	len = 0;
+	dst[0] = '\0';
+	while (len < dstsize - 1) {
+		// 念のため応答がなければタイムアウトするようにしておく
+		FD_ZERO(&rfds);
+		FD_SET(STDOUT_FILENO, &rfds);
+		memset(&timeout, 0, sizeof(timeout));
+#if defined(SLOW_MACHINES)
+		timeout.tv_sec = 10;
+#else
+		timeout.tv_usec = 500 * 1000;
+#endif
+		r = select(STDOUT_FILENO + 1, &rfds, NULL, NULL, &timeout);
+		if (__predict_false(r < 0)) {
+			goto done;
+		}
+		if (__predict_false(r == 0)) {
+			break;
+		}
 
-	r = read(STDOUT_FILENO, dst, dstsize);
-	if (__predict_false(r < 0)) {
-		goto done;
+		r = read(STDOUT_FILENO, dst + len, dstsize - 1 - len);
+		if (__predict_false(r < 0)) {
+			goto done;
+		}
+		if (r == 0) {
+			break;
+		}
+		len += r;
+		dst[len] = '\0';
+		if (terminal_reply_complete(query, dst, len)) {
+			break;
+		}
 	}
-	dst[r] = '\0';
+	r = len;
 
 	// 端末を元に戻して r を持って帰る
  done:
@@ -268,6 +459,9 @@ query_terminal(const std::string& query, char *dst, size_t dstsize)
 #include <err.h>
 
 int test_sixel();
+int test_syncout();
+int test_kitty();
+int test_iterm2();
 int test_bg();
 
 Diag diag;
@@ -284,6 +478,42 @@ test_sixel()
 	return 0;
 }
 
+int
+test_syncout()
+{
+	bool r = terminal_support_syncout();
+	if (r) {
+		printf("terminal supports synchronized output\n");
+	} else {
+		printf("terminal does not support synchronized output\n");
+	}
+	return 0;
+}
+
+int
+test_kitty()
+{
+	bool r = terminal_support_kitty();
+	if (r) {
+		printf("terminal supports kitty graphics protocol\n");
+	} else {
+		printf("terminal does not support kitty graphics protocol\n");
+	}
+	return 0;
+}
+
+int
+test_iterm2()
+{
+	bool r = terminal_support_iterm2();
+	if (r) {
+		printf("terminal supports iTerm2 inline images\n");
+	} else {
+		printf("terminal does not support iTerm2 inline images\n");
+	}
+	return 0;
+}
+
 int
 test_bg()
 {
@@ -306,11 +536,20 @@ main(int ac, char *av[])
 		if (av1 == "sixel") {
 			return test_sixel();
 		}
+		if (av1 == "syncout") {
+			return test_syncout();
+		}
+		if (av1 == "kitty") {
+			return test_kitty();
+		}
+		if (av1 == "iterm2") {
+			return test_iterm2();
+		}
 		if (av1 == "bg") {
 			return test_bg();
 		}
 	}
-	errx(1, "usage: <sixel | bg>");
+	errx(1, "usage: <sixel | syncout | kitty | iterm2 | bg>");
 }
 
 #endif // TEST
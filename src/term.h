@@ -35,5 +35,13 @@
 
 extern std::string termdump(const char *src);
 extern bool terminal_support_sixel();
+extern bool terminal_support_syncout();
+extern bool terminal_support_kitty();
+extern bool parse_kitty_response(const char *result);
+extern bool terminal_support_iterm2();
+extern bool parse_iterm2_response(const char *result);
+extern int parse_decrpm(const char *result, int mode);
+extern bool terminal_reply_complete(const std::string& query,
+	const char *result, size_t len);
 extern bgtheme terminal_bgtheme();
 extern bgtheme parse_bgcolor(char *result);
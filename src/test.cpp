@@ -25,6 +25,8 @@
 
 #include "test.h"
 #include <inttypes.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
 
 int test_count;
 int test_fail;
@@ -90,6 +92,65 @@ xp_fail_(const char *file, int line, const char *func,
 	printf("%s:%d: %s(%s) failed\n", file, line, func, msg.c_str());
 }
 
+pid_t
+start_test_server(int *portp, int count,
+	const std::function<std::string(const std::string&)>& handler)
+{
+	int ls = socket(AF_INET, SOCK_STREAM, 0);
+	if (ls < 0) {
+		return -1;
+	}
+	struct sockaddr_in sin {};
+	sin.sin_family = AF_INET;
+	sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	socklen_t slen = sizeof(sin);
+	if (bind(ls, (struct sockaddr *)&sin, sizeof(sin)) < 0 ||
+	    listen(ls, 16) < 0 ||
+	    getsockname(ls, (struct sockaddr *)&sin, &slen) < 0)
+	{
+		close(ls);
+		return -1;
+	}
+	*portp = ntohs(sin.sin_port);
+
+	pid_t pid = fork();
+	if (pid != 0) {
+		close(ls);
+		return pid;
+	}
+
+	// 子プロセス
+	int served = 0;
+	while (count <= 0 || served < count) {
+		int fd = accept(ls, NULL, NULL);
+		if (fd < 0) {
+			_exit(255);
+		}
+		std::string req;
+		char buf[1024];
+		while (req.find("\r\n\r\n") == std::string::npos) {
+			auto n = read(fd, buf, sizeof(buf));
+			if (n <= 0) {
+				break;
+			}
+			req.append(buf, n);
+		}
+
+		auto res = handler(req);
+		if (res.empty()) {
+			close(fd);
+			break;
+		}
+		// 書けなければ終了コードで親に知らせる。
+		if (write(fd, res.data(), res.size()) != (ssize_t)res.size()) {
+			_exit(255);
+		}
+		close(fd);
+		served++;
+	}
+	_exit(served);
+}
+
 int
 main(int ac, char *av[])
 {
@@ -97,24 +158,40 @@ main(int ac, char *av[])
 	test_fail = 0;
 
 	test_Base64();
+	test_CacheValidator();
 	test_ChunkedInputStream();
 	test_Diag();
 	test_Dictionary();
+	test_FileUtil();
+	test_Image();
+	test_ImageCache();
 	test_ImageReductor();
+	test_ImageSource();
+	test_JsonArena();
+	test_KittyImageCache();
+	test_LineWrapper();
+	test_MFM();
 	test_MemoryStream();
-#if 0
+	test_NegativeCache();
+	test_Note();
+	test_NoteHistory();
+	test_NGMatcher();
 	test_NGWord();
-#endif
+	test_OrderedPipeline();
 	test_ParsedUri();
+	test_RenderBuffer();
+	test_SeenNotes();
 	test_SixelConverter();
+	test_SixelHotCache();
+	test_StageStat();
 	test_StringUtil();
+	test_Tracer();
 	test_UString();
 	test_eaw_code();
 	test_subr();
 	test_term();
 
 #if defined(USE_TWITTER)
-	test_FileUtil();
 	test_OAuth();
 	test_RichString();
 #endif
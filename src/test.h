@@ -30,8 +30,10 @@
 #include <array>
 #include <cstdio>
 #include <cstring>
+#include <functional>
 #include <string>
 #include <vector>
+#include <sys/types.h>
 
 // テスト用に、自動的に後始末するテンポラリファイル
 // tempnam(3) や mktemp(3) 使うと unsecure だと怒られるので
@@ -86,20 +88,48 @@ extern void xp_eq_(const char *file, int line, const char *func,
 extern void xp_fail_(const char *file, int line, const char *func,
 	const std::string& msg);
 
+// テスト用の HTTP サーバ (の代わり)。
+// 子プロセスで接続を受け付け、リクエスト (ヘッダまで) を handler に渡して
+// 返ってきた応答を返す。handler が空文字列を返すと応答せずに終了する。
+// count が正なら count 回応答したところでも終了する。
+// 終了コードは応答した回数 (エラーなら 255)。
+// 待ち受けたポート番号を *portp に書き戻し、子プロセスの pid を返す。
+// 失敗すれば -1 を返す。
+extern pid_t start_test_server(int *portp, int count,
+	const std::function<std::string(const std::string&)>& handler);
+
 
 extern void test_Base64();
+extern void test_CacheValidator();
 extern void test_ChunkedInputStream();
 extern void test_Diag();
 extern void test_Dictionary();
 extern void test_FileUtil();
+extern void test_Image();
+extern void test_ImageCache();
 extern void test_ImageReductor();
+extern void test_ImageSource();
+extern void test_JsonArena();
+extern void test_KittyImageCache();
+extern void test_LineWrapper();
+extern void test_MFM();
 extern void test_MemoryStream();
+extern void test_NegativeCache();
+extern void test_Note();
+extern void test_NoteHistory();
+extern void test_NGMatcher();
 extern void test_NGWord();
 extern void test_OAuth();
+extern void test_OrderedPipeline();
 extern void test_ParsedUri();
+extern void test_RenderBuffer();
 extern void test_RichString();
+extern void test_SeenNotes();
 extern void test_SixelConverter();
+extern void test_SixelHotCache();
+extern void test_StageStat();
 extern void test_StringUtil();
+extern void test_Tracer();
 extern void test_UString();
 extern void test_acl();
 extern void test_eaw_code();
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "CacheValidator.h"
+#include "HttpClient.h"
+#include "StringUtil.h"
+#include <signal.h>
+#include <sys/wait.h>
+
+static void
+test_CacheValidator_FromHeaders()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::pair<std::vector<std::string>, std::string>> table = {
+		// 応答ヘッダ						期待値
+		{ { },								"1000 86400||" },
+		{ { "ETag: \"abc\"" },				"1000 86400|\"abc\"|" },
+		{ { "etag: W/\"x\"",
+		    "Last-Modified: Wed, 21 Oct 2015 07:28:00 GMT" },
+			"1000 86400|W/\"x\"|Wed, 21 Oct 2015 07:28:00 GMT" },
+		{ { "Cache-Control: public, max-age=3600" },	"1000 3600||" },
+		{ { "Cache-Control: max-age=60, no-cache" },	"1000 0||" },
+		{ { "Cache-Control: no-store" },	"1000 0||" },
+		{ { "Cache-Control: max-age=60," },	"1000 60||" },
+	};
+	for (const auto& a : table) {
+		const auto& headers = a.first;
+		const auto& exp = a.second;
+
+		CacheValidator val;
+		val.FromHeaders(headers, 1000);
+		auto act = string_format("%u %u|%s|%s", val.fetched, val.max_age,
+			val.etag.c_str(), val.last_modified.c_str());
+		xp_eq(exp, act, exp);
+	}
+}
+
+static void
+test_CacheValidator_IsFresh()
+{
+	printf("%s\n", __func__);
+
+	CacheValidator val;
+	val.fetched = 1000;
+	val.max_age = 60;
+	xp_eq(true, val.IsFresh(1000));
+	xp_eq(true, val.IsFresh(1059));
+	xp_eq(false, val.IsFresh(1060));
+
+	// no-cache なら常に問い合わせる
+	val.max_age = 0;
+	xp_eq(false, val.IsFresh(1000));
+
+	xp_eq(false, val.CanRevalidate());
+	val.last_modified = "x";
+	xp_eq(true, val.CanRevalidate());
+}
+
+static void
+test_CacheValidator_Serialize()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::array<std::string, 2>> table = {
+		{ "\"abc\"",	"" },
+		{ "",			"Wed, 21 Oct 2015 07:28:00 GMT" },
+		{ "W/\"x y\"",	"Thu, 01 Jan 1970 00:00:00 GMT" },
+	};
+	for (const auto& a : table) {
+		CacheValidator src;
+		src.etag = a[0];
+		src.last_modified = a[1];
+		src.fetched = 1258538052;
+		src.max_age = 3600;
+		auto str = src.Serialize();
+
+		CacheValidator dst;
+		xp_eq(true, dst.Deserialize((const uint8 *)str.data(), str.size()),
+			str);
+		xp_eq(src.etag, dst.etag, str);
+		xp_eq(src.last_modified, dst.last_modified, str);
+		xp_eq(src.fetched, dst.fetched, str);
+		xp_eq(src.max_age, dst.max_age, str);
+	}
+
+	// 壊れている
+	CacheValidator dst;
+	std::string bad = "abc\n";
+	xp_eq(false, dst.Deserialize((const uint8 *)bad.data(), bad.size()));
+}
+
+// テスト用の HTTP サーバの応答。
+// If-None-Match が "v1" なら 304 を、そうでなければ 200 を返す。
+static std::string
+revalidate_handler(const std::string& req)
+{
+	if (req.find("\r\nIf-None-Match: \"v1\"\r\n") != std::string::npos) {
+		return "HTTP/1.1 304 Not Modified\r\n"
+			"ETag: \"v1\"\r\n"
+			"Cache-Control: max-age=60\r\n"
+			"\r\n";
+	} else {
+		return "HTTP/1.1 200 OK\r\n"
+			"Content-Type: image/png\r\n"
+			"Content-Length: 5\r\n"
+			"ETag: \"v1\"\r\n"
+			"Last-Modified: Wed, 21 Oct 2015 07:28:00 GMT\r\n"
+			"Cache-Control: max-age=3600\r\n"
+			"\r\n"
+			"hello";
+	}
+}
+
+// 条件付きリクエストを実際に送受信する
+static void
+test_CacheValidator_Revalidate()
+{
+	printf("%s\n", __func__);
+
+	int port;
+	pid_t pid = start_test_server(&port, 3, revalidate_handler);
+	if (pid < 0) {
+		xp_fail("start_test_server failed");
+		return;
+	}
+	auto url = string_format("http://127.0.0.1:%d/icon.png", port);
+
+	// 1回目は普通に取得
+	CacheValidator val;
+	{
+		HttpClient http;
+		xp_eq(true, http.Open(url));
+		val.AddConditionalHeaders(http);
+		Stream *stream = http.GET();
+		xp_eq(true, stream != NULL);
+		xp_eq(200, http.ResultCode);
+		xp_eq(false, val.Update(http, 1000));
+		xp_eq("\"v1\"", val.etag);
+		xp_eq("Wed, 21 Oct 2015 07:28:00 GMT", val.last_modified);
+		xp_eq(3600, val.max_age);
+		xp_eq(1000, val.fetched);
+		if (stream) {
+			char buf[16];
+			auto n = stream->Read(buf, sizeof(buf));
+			xp_eq("hello", std::string(buf, std::max(n, (ssize_t)0)));
+		}
+	}
+
+	// 鮮度期間を過ぎたら問い合わせて、304 なら取得時刻だけ更新
+	xp_eq(false, val.IsFresh(4600));
+	{
+		HttpClient http;
+		xp_eq(true, http.Open(url));
+		val.AddConditionalHeaders(http);
+		Stream *stream = http.GET();
+		xp_eq(true, stream != NULL);
+		xp_eq(304, http.ResultCode);
+		xp_eq(true, val.Update(http, 4600));
+		xp_eq("\"v1\"", val.etag);
+		xp_eq("Wed, 21 Oct 2015 07:28:00 GMT", val.last_modified);
+		xp_eq(60, val.max_age);
+		xp_eq(4600, val.fetched);
+		xp_eq(true, val.IsFresh(4600));
+	}
+
+	// 検証子が違えば 200 で新しい内容が返ってくる
+	val.etag = "\"v0\"";
+	{
+		HttpClient http;
+		xp_eq(true, http.Open(url));
+		val.AddConditionalHeaders(http);
+		http.GET();
+		xp_eq(200, http.ResultCode);
+		xp_eq(false, val.Update(http, 5000));
+		xp_eq("\"v1\"", val.etag);
+	}
+
+	int status;
+	waitpid(pid, &status, 0);
+	xp_eq(true, WIFEXITED(status) && WEXITSTATUS(status) == 3);
+}
+
+void
+test_CacheValidator()
+{
+	test_CacheValidator_FromHeaders();
+	test_CacheValidator_IsFresh();
+	test_CacheValidator_Serialize();
+	test_CacheValidator_Revalidate();
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "Image.h"
+
+static void
+test_ProbeImageSize()
+{
+	printf("%s\n", __func__);
+
+	struct testentry {
+		std::string name;
+		std::vector<uint8> src;
+		int w;
+		int h;
+	};
+	std::vector<testentry> table = {
+		{ "PNG", {
+			0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n',
+			0, 0, 0, 13, 'I', 'H', 'D', 'R',
+			0, 0, 0x01, 0x2c, 0, 0, 0, 0xc8,
+		  }, 300, 200 },
+		{ "GIF", {
+			'G', 'I', 'F', '8', '9', 'a', 0x2c, 0x01, 0xc8, 0x00,
+		  }, 300, 200 },
+		// APP0 を読み飛ばして SOF0
+		{ "JPEG", {
+			0xff, 0xd8,
+			0xff, 0xe0, 0x00, 0x04, 0x00, 0x00,
+			0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0xc8, 0x01, 0x2c, 0x03,
+		  }, 300, 200 },
+		// SOF より前に SOS が来たら分からない
+		{ "JPEG(SOS)", {
+			0xff, 0xd8,
+			0xff, 0xda, 0x00, 0x04, 0x00, 0x00,
+			0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0xc8, 0x01, 0x2c, 0x03,
+		  }, -1, -1 },
+		{ "WebP(VP8)", {
+			'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'E', 'B', 'P',
+			'V', 'P', '8', ' ', 0, 0, 0, 0,
+			0, 0, 0, 0x9d, 0x01, 0x2a, 0x2c, 0x01, 0xc8, 0x00,
+		  }, 300, 200 },
+		// 299 | (199 << 14)
+		{ "WebP(VP8L)", {
+			'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'E', 'B', 'P',
+			'V', 'P', '8', 'L', 0, 0, 0, 0,
+			0x2f, 0x2b, 0xc1, 0x31, 0x00, 0, 0, 0, 0, 0,
+		  }, 300, 200 },
+		{ "WebP(VP8X)", {
+			'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'E', 'B', 'P',
+			'V', 'P', '8', 'X', 0, 0, 0, 0,
+			0, 0, 0, 0, 0x2b, 0x01, 0x00, 0xc7, 0x00, 0x00,
+		  }, 300, 200 },
+		// 短すぎる
+		{ "short", {
+			0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n',
+		  }, -1, -1 },
+		{ "unknown", {
+			'B', 'M', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		  }, -1, -1 },
+	};
+	for (const auto& a : table) {
+		Size size { -1, -1 };
+		bool expected = (a.w >= 0);
+		bool actual = ProbeImageSize(a.src.data(), a.src.size(), &size);
+		xp_eq(expected, actual, a.name);
+		xp_eq(a.w, size.w, a.name);
+		xp_eq(a.h, size.h, a.name);
+	}
+}
+
+void
+test_Image()
+{
+	test_ProbeImageSize();
+}
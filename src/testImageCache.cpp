@@ -0,0 +1,453 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "HttpClient.h"
+#include "ImageCache.h"
+#include "StringUtil.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+// テスト用のキャッシュディレクトリ。終了時に中身ごと消す。
+class autotempdir
+{
+ public:
+	autotempdir() {
+		strcpy(tempname, "/tmp/sayakatest.XXXXXX");
+		dirname = mkdtemp(tempname);
+	}
+	~autotempdir() {
+		for (const char *name :
+		    { "sixel.dat", "sixel.idx", "sixel.lock",
+		      "source.dat", "source.idx", "source.lock" })
+		{
+			unlink((dirname + "/" + name).c_str());
+		}
+		rmdir(dirname.c_str());
+	}
+	std::string dirname {};
+ private:
+	char tempname[32];
+};
+
+// キャッシュから key を引いて文字列で返す。なければ "(none)"。
+static std::string
+lookup(ImageCache& cache, const std::string& key)
+{
+	const uint8 *data;
+	size_t len;
+
+	if (cache.Lookup(key, &data, &len) == false) {
+		return "(none)";
+	}
+	return std::string((const char *)data, len);
+}
+
+static void
+store(ImageCache& cache, const std::string& key, const std::string& val)
+{
+	cache.Store(key, val.data(), val.size());
+}
+
+static off_t
+filesize(const std::string& path)
+{
+	struct stat st;
+	if (stat(path.c_str(), &st) < 0) {
+		return -1;
+	}
+	return st.st_size;
+}
+
+static void
+test_ImageCache_basic()
+{
+	printf("%s\n", __func__);
+
+	autotempdir dir;
+	{
+		ImageCache cache;
+		xp_eq(true, cache.Open(dir.dirname, 0));
+		xp_eq(0, cache.GetCount());
+
+		store(cache, "a", "apple");
+		store(cache, "b", "banana");
+		xp_eq(2, cache.GetCount());
+		xp_eq("apple", lookup(cache, "a"));
+		xp_eq("banana", lookup(cache, "b"));
+		xp_eq("(none)", lookup(cache, "c"));
+
+		// 置き換え
+		store(cache, "a", "apricot");
+		xp_eq(2, cache.GetCount());
+		xp_eq("apricot", lookup(cache, "a"));
+
+		// 削除
+		cache.Remove("b");
+		xp_eq(1, cache.GetCount());
+		xp_eq("(none)", lookup(cache, "b"));
+	}
+	// 開き直してもインデックスから復元できる
+	{
+		ImageCache cache;
+		xp_eq(true, cache.Open(dir.dirname, 0));
+		xp_eq(1, cache.GetCount());
+		xp_eq("apricot", lookup(cache, "a"));
+		xp_eq("(none)", lookup(cache, "b"));
+	}
+	// インデックスがなくてもデータファイルから再構築できる
+	unlink((dir.dirname + "/sixel.idx").c_str());
+	{
+		ImageCache cache;
+		xp_eq(true, cache.Open(dir.dirname, 0));
+		xp_eq(1, cache.GetCount());
+		xp_eq("apricot", lookup(cache, "a"));
+		xp_eq("(none)", lookup(cache, "b"));
+	}
+}
+
+// 追記途中でクラッシュした場合
+static void
+test_ImageCache_torn()
+{
+	printf("%s\n", __func__);
+
+	autotempdir dir;
+	std::string datapath = dir.dirname + "/sixel.dat";
+	off_t goodsize;
+	{
+		ImageCache cache;
+		cache.Open(dir.dirname, 0);
+		store(cache, "a", "apple");
+		goodsize = filesize(datapath);
+	}
+
+	// 書きかけのレコードを末尾に足す
+	int fd = open(datapath.c_str(), O_WRONLY | O_APPEND);
+	xp_eq(true, fd >= 0);
+	if (fd >= 0) {
+		static const uint8 garbage[] = { 'S', 'Y', 'K', 'R', 1, 0, 0 };
+		xp_eq((int)sizeof(garbage), (int)write(fd, garbage, sizeof(garbage)));
+		close(fd);
+	}
+	{
+		ImageCache cache;
+		xp_eq(true, cache.Open(dir.dirname, 0));
+		xp_eq(1, cache.GetCount());
+		xp_eq("apple", lookup(cache, "a"));
+		// 壊れた部分は切り捨てられている
+		xp_eq(goodsize, filesize(datapath));
+
+		// その後にも追記できる
+		store(cache, "b", "banana");
+	}
+	{
+		ImageCache cache;
+		cache.Open(dir.dirname, 0);
+		xp_eq(2, cache.GetCount());
+		xp_eq("banana", lookup(cache, "b"));
+	}
+}
+
+// 上限を超えたら古いものから追い出し、詰め直す
+static void
+test_ImageCache_evict()
+{
+	printf("%s\n", __func__);
+
+	autotempdir dir;
+	std::string datapath = dir.dirname + "/sixel.dat";
+	std::string blob(16 * 1024, 'x');
+	ImageCache cache;
+	cache.Open(dir.dirname, 100 * 1024);
+
+	for (int i = 0; i < 5; i++) {
+		store(cache, string_format("k%d", i), blob);
+	}
+	xp_eq(5, cache.GetCount());
+	// k0 を参照すると k1 が一番古くなる
+	lookup(cache, "k0");
+
+	for (int i = 5; i < 20; i++) {
+		store(cache, string_format("k%d", i), blob);
+		xp_eq(true, cache.GetLiveBytes() <= cache.GetBudget(),
+			string_format("live at k%d", i));
+	}
+	xp_eq("(none)", lookup(cache, "k1"));
+	xp_eq(blob, lookup(cache, "k19"));
+
+	// 詰め直しが起きているので、ファイルは上限の倍までには収まっている
+	xp_eq(true, filesize(datapath) < 2 * cache.GetBudget());
+
+	// 明示的に詰め直すと死んだ領域はなくなる
+	xp_eq(true, cache.Compact());
+	xp_eq(0, cache.GetDeadBytes());
+	xp_eq(blob, lookup(cache, "k19"));
+}
+
+// 追い出しと期限切れも墓標を残すので、インデックスを失っても、
+// 他のプロセスと共有していても生き返らない
+static void
+test_ImageCache_tombstone()
+{
+	printf("%s\n", __func__);
+
+	autotempdir dir;
+	std::string idxpath = dir.dirname + "/sixel.idx";
+	std::string blob(16 * 1024, 'x');
+	{
+		ImageCache a;
+		ImageCache b;
+		xp_eq(true, a.Open(dir.dirname, 100 * 1024));
+		xp_eq(true, b.Open(dir.dirname, 0));
+
+		// 7つ目で k0 と k1 が追い出される
+		for (int i = 0; i < 7; i++) {
+			store(a, string_format("k%d", i), blob);
+		}
+		xp_eq(5, a.GetCount());
+		xp_eq("(none)", lookup(a, "k0"));
+
+		// 追い出しは墓標として相手にも伝わり、相手のインデックスにも残らない。
+		// (テスト中は時刻が固定なので Expire() は試せないが、
+		// Expire() も同じ Remove() を通る)
+		xp_eq(true, b.Refresh());
+		xp_eq(5, b.GetCount());
+		xp_eq("(none)", lookup(b, "k0"));
+		xp_eq("(none)", lookup(b, "k1"));
+		xp_eq(true, b.Sync());
+	}
+
+	// インデックスがなくなっても (データファイルから作り直しても) 同じ
+	unlink(idxpath.c_str());
+	ImageCache c;
+	xp_eq(true, c.Open(dir.dirname, 0));
+	xp_eq(5, c.GetCount());
+	xp_eq("(none)", lookup(c, "k0"));
+	xp_eq("(none)", lookup(c, "k1"));
+	xp_eq(blob, lookup(c, "k6"));
+}
+
+// 同じディレクトリに名前の違うキャッシュを置ける
+static void
+test_ImageCache_name()
+{
+	printf("%s\n", __func__);
+
+	autotempdir dir;
+	{
+		ImageCache sixel;
+		ImageCache source("source");
+		xp_eq(true, sixel.Open(dir.dirname, 0));
+		xp_eq(true, source.Open(dir.dirname, 0));
+
+		store(sixel, "a", "apple");
+		store(source, "a", "avocado");
+		xp_eq("apple", lookup(sixel, "a"));
+		xp_eq("avocado", lookup(source, "a"));
+	}
+	xp_eq(true, filesize(dir.dirname + "/source.dat") > 0);
+	{
+		ImageCache source("source");
+		source.Open(dir.dirname, 0);
+		xp_eq(1, source.GetCount());
+		xp_eq("avocado", lookup(source, "a"));
+	}
+}
+
+// 同じディレクトリを複数のインスタンス (プロセス) で共有する
+static void
+test_ImageCache_shared()
+{
+	printf("%s\n", __func__);
+
+	autotempdir dir;
+	ImageCache a;
+	ImageCache b;
+	xp_eq(true, a.Open(dir.dirname, 0));
+	xp_eq(true, b.Open(dir.dirname, 0));
+
+	// 相手の追記を取り込める
+	store(a, "a", "apple");
+	xp_eq(true, b.Refresh());
+	xp_eq("apple", lookup(b, "a"));
+	store(b, "b", "banana");
+	xp_eq(true, a.Refresh());
+	xp_eq("banana", lookup(a, "b"));
+
+	// 相手が詰め直した後に追記しても失われない
+	a.Remove("a");
+	xp_eq(true, a.Compact());
+	store(b, "c", "cherry");
+	xp_eq(true, a.Refresh());
+	xp_eq(2, a.GetCount());
+	xp_eq("(none)", lookup(a, "a"));
+	xp_eq("banana", lookup(a, "b"));
+	xp_eq("cherry", lookup(a, "c"));
+	xp_eq(2, b.GetCount());
+	xp_eq("(none)", lookup(b, "a"));
+
+	a.Close();
+	b.Close();
+	{
+		ImageCache c;
+		xp_eq(true, c.Open(dir.dirname, 0));
+		xp_eq(2, c.GetCount());
+		xp_eq("banana", lookup(c, "b"));
+		xp_eq("cherry", lookup(c, "c"));
+	}
+}
+
+// テスト用の HTTP サーバの応答。
+// パス名を本文として返す。"/quit" が来たら終了する。
+// 応答は少し遅らせて、取得中に他のプロセスが来るようにする。
+static std::string
+path_handler(const std::string& req)
+{
+	// "GET <path> HTTP/1.1"
+	std::string path;
+	auto p = req.find(' ');
+	if (p != std::string::npos) {
+		auto e = req.find(' ', p + 1);
+		if (e != std::string::npos) {
+			path = req.substr(p + 1, e - p - 1);
+		}
+	}
+	if (path == "/quit") {
+		return "";
+	}
+	usleep(100 * 1000);
+
+	return string_format("HTTP/1.1 200 OK\r\n"
+		"Content-Length: %zu\r\n"
+		"\r\n", path.size()) + path;
+}
+
+// url を取得して本文を返す。失敗すれば空文字列。
+static std::string
+http_get(const std::string& url)
+{
+	HttpClient http;
+	if (http.Open(url) == false) {
+		return "";
+	}
+	Stream *stream = http.GET();
+	if (stream == NULL || http.ResultCode != 200) {
+		return "";
+	}
+	std::string body;
+	char buf[256];
+	ssize_t n;
+	while ((n = stream->Read(buf, sizeof(buf))) > 0) {
+		body.append(buf, n);
+	}
+	return body;
+}
+
+// 複数のプロセスが同時に同じ画像を要求しても、取得は1回だけ。
+// ShowImage() と同じ SingleFlight() を使い、本物の HTTP 取得で確かめる。
+static void
+test_ImageCache_singleflight()
+{
+	printf("%s\n", __func__);
+
+	const int nproc = 8;
+	const int nkeys = 4;
+
+	autotempdir dir;
+	int port;
+	pid_t server = start_test_server(&port, 0, path_handler);
+	if (server < 0) {
+		xp_fail("start_test_server failed");
+		return;
+	}
+	auto base = string_format("http://127.0.0.1:%d", port);
+
+	std::vector<pid_t> workers;
+	for (int i = 0; i < nproc; i++) {
+		pid_t pid = fork();
+		if (pid == 0) {
+			// 子プロセス。全部正しく取得できれば 0 で終わる。
+			ImageCache cache;
+			if (cache.Open(dir.dirname, 0) == false) {
+				_exit(1);
+			}
+			for (int k = 0; k < nkeys; k++) {
+				auto key = string_format("/img%d.png", k);
+				bool ok = cache.SingleFlight(key, 10 * 1000,
+					[&]() {
+						return lookup(cache, key) != "(none)";
+					},
+					[&]() {
+						auto body = http_get(base + key);
+						return cache.Store(key, body.data(), body.size());
+					});
+				if (ok == false) {
+					_exit(2);
+				}
+				if (lookup(cache, key) != key) {
+					_exit(3);
+				}
+			}
+			cache.Close();
+			_exit(0);
+		}
+		workers.push_back(pid);
+	}
+
+	int status;
+	for (auto pid : workers) {
+		if (pid < 0) {
+			xp_fail("fork failed");
+			continue;
+		}
+		waitpid(pid, &status, 0);
+		xp_eq(true, WIFEXITED(status), string_format("pid %d", pid));
+		xp_eq(0, WEXITSTATUS(status), string_format("pid %d", pid));
+	}
+
+	// サーバを止めて、受け付けた回数を調べる
+	http_get(base + "/quit");
+	waitpid(server, &status, 0);
+	xp_eq(true, WIFEXITED(status));
+	xp_eq(nkeys, WEXITSTATUS(status));
+
+	ImageCache cache;
+	xp_eq(true, cache.Open(dir.dirname, 0));
+	xp_eq(nkeys, cache.GetCount());
+}
+
+void
+test_ImageCache()
+{
+	test_ImageCache_basic();
+	test_ImageCache_torn();
+	test_ImageCache_evict();
+	test_ImageCache_tombstone();
+	test_ImageCache_name();
+	test_ImageCache_shared();
+	test_ImageCache_singleflight();
+}
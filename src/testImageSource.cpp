@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "ImageCache.h"
+#include "ImageSource.h"
+#include "MemoryStream.h"
+
+using Reason = NegativeCache::Reason;
+
+// src の中身を文字列で返す。
+static std::string
+readall(MemoryStream& src)
+{
+	std::string str(src.GetSize(), '\0');
+	src.Read(str.data(), str.size());
+	return str;
+}
+
+static void
+test_ImageSource_Get()
+{
+	printf("%s\n", __func__);
+
+	char tempname[32];
+	strcpy(tempname, "/tmp/sayakatest.XXXXXX");
+	std::string dir = mkdtemp(tempname);
+
+	const std::string url = "https://example.com/a.png";
+	const time_t now = 1700000000;
+	{
+		ImageCache srccache("source");
+		ImageCache imagecache;
+		srccache.Open(dir, 0);
+		imagecache.Open(dir, 0);
+		NegativeCache negcache(imagecache);
+
+		// 取得の代わり。次に返すものは以下の変数で決める。
+		int calls = 0;
+		auto result = FetchResult::Fetched;
+		auto reason = Reason::None;
+		std::string cond;
+		time_t fetched = now;
+		ImageSource source(srccache, negcache,
+			[&](std::vector<uint8>& body, Reason *reasonp,
+			    CacheValidator *valp, const std::string&) {
+				calls++;
+				cond = valp->etag;
+				if (result == FetchResult::Failed) {
+					*reasonp = reason;
+				} else {
+					if (result == FetchResult::Fetched) {
+						const std::string data = "image1";
+						body.assign(data.begin(), data.end());
+						valp->etag = "\"1\"";
+					}
+					valp->fetched = fetched;
+					valp->max_age = 600;
+				}
+				return result;
+			});
+
+		// なければ取得して、元画像キャッシュに入れる
+		{
+			MemoryStream src;
+			CacheValidator val;
+			xp_eq((int)FetchResult::Fetched,
+				(int)source.Get(src, &val, url, now));
+			xp_eq(1, calls);
+			xp_eq("image1", readall(src));
+			xp_eq("\"1\"", val.etag);
+		}
+		// 鮮度期間内なら取得せずに元画像キャッシュのものを使う
+		{
+			MemoryStream src;
+			CacheValidator val;
+			xp_eq((int)FetchResult::Fetched,
+				(int)source.Get(src, &val, url, now + 1));
+			xp_eq(1, calls);
+			xp_eq("image1", readall(src));
+		}
+		// GetData() はコピーせずに元画像キャッシュの領域をそのまま返す
+		{
+			const uint8 *data;
+			size_t len;
+			std::vector<uint8> body;
+			CacheValidator val;
+			xp_eq((int)FetchResult::Fetched,
+				(int)source.GetData(&data, &len, body, &val, url, now + 1));
+			xp_eq(1, calls);
+			xp_eq("image1", std::string((const char *)data, len));
+			xp_eq(0, body.size());
+		}
+		// SIXEL の元になったものと同じなら中身は要らない
+		{
+			MemoryStream src;
+			CacheValidator val;
+			val.etag = "\"1\"";
+			xp_eq((int)FetchResult::NotModified,
+				(int)source.Get(src, &val, url, now + 1));
+			xp_eq(1, calls);
+			xp_eq(0, src.GetSize());
+		}
+		// 期限切れなら条件付きで問い合わせ、304 なら手元のものを使う
+		{
+			MemoryStream src;
+			CacheValidator val;
+			result = FetchResult::NotModified;
+			fetched = now + 600;
+			xp_eq((int)FetchResult::Fetched,
+				(int)source.Get(src, &val, url, now + 600));
+			xp_eq(2, calls);
+			xp_eq("\"1\"", cond);
+			xp_eq("image1", readall(src));
+			xp_eq(now + 600, val.fetched);
+		}
+		// 確認した時刻から鮮度期間をもう一巡する
+		{
+			MemoryStream src;
+			CacheValidator val;
+			xp_eq((int)FetchResult::Fetched,
+				(int)source.Get(src, &val, url, now + 1199));
+			xp_eq(2, calls);
+		}
+		// 問い合わせに失敗しても、手元の元画像を使う。
+		// 条件付きの問い合わせの失敗は記録しない。
+		{
+			MemoryStream src;
+			CacheValidator val;
+			result = FetchResult::Failed;
+			reason = Reason::Connect;
+			xp_eq((int)FetchResult::Fetched,
+				(int)source.Get(src, &val, url, now + 1200));
+			xp_eq(3, calls);
+			xp_eq("image1", readall(src));
+			xp_eq(false, negcache.Check(url, now + 1200));
+		}
+		// 手元になければ失敗し、失敗を記録して次からは問い合わせない
+		{
+			const std::string url2 = "https://example.com/b.png";
+			MemoryStream src;
+			CacheValidator val;
+			reason = Reason::NotImage;
+			xp_eq((int)FetchResult::Failed,
+				(int)source.Get(src, &val, url2, now));
+			xp_eq(4, calls);
+			xp_eq((int)FetchResult::Failed,
+				(int)source.Get(src, &val, url2, now + 1));
+			xp_eq(4, calls);
+		}
+	}
+
+	for (const char *name :
+	    { "sixel.dat", "sixel.idx", "sixel.lock",
+	      "source.dat", "source.idx", "source.lock" })
+	{
+		unlink((dir + "/" + name).c_str());
+	}
+	rmdir(dir.c_str());
+}
+
+void
+test_ImageSource()
+{
+	test_ImageSource_Get();
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "JsonInc.h"
+
+static void
+test_JsonArena_Allocate()
+{
+	printf("%s\n", __func__);
+
+	JsonArena arena;
+	xp_eq(0, arena.GetCapacity());
+
+	// 切り出したものは境界が揃っていて重ならない
+	auto p1 = (char *)arena.Allocate(1);
+	auto p2 = (char *)arena.Allocate(24);
+	xp_eq(0, (uintptr_t)p1 % alignof(std::max_align_t));
+	xp_eq(0, (uintptr_t)p2 % alignof(std::max_align_t));
+	xp_eq(true, p2 >= p1 + 1);
+	xp_eq(true, arena.Owns(p1));
+	xp_eq(true, arena.Owns(p2 + 23));
+	int local;
+	xp_eq(false, arena.Owns(&local));
+
+	// チャンクより大きいものも確保できる
+	auto p3 = (char *)arena.Allocate(200 * 1024);
+	xp_eq(true, arena.Owns(p3 + 200 * 1024 - 1));
+	size_t used = arena.GetUsed();
+	xp_eq(true, used >= 200 * 1024 + 24 + 1);
+
+	// リセットすると1つのチャンクにまとまる
+	arena.Reset();
+	xp_eq(0, arena.GetUsed());
+	xp_eq(used, arena.GetPeak());
+	size_t cap = arena.GetCapacity();
+	xp_eq(true, cap >= used);
+	// 同じだけ使ってもチャンクは増えない
+	arena.Allocate(1);
+	arena.Allocate(24);
+	arena.Allocate(200 * 1024);
+	xp_eq(cap, arena.GetCapacity());
+
+	// 巨大なものはリセット後まで抱えていない
+	arena.Allocate(4 * 1024 * 1024);
+	arena.Reset();
+	xp_eq(true, arena.GetCapacity() <= 1024 * 1024);
+}
+
+static void
+test_JsonArena_Scope()
+{
+	printf("%s\n", __func__);
+
+	JsonArena arena;
+	xp_eq(true, JsonArena::Current() == NULL);
+
+	// スコープ外で作った Json はアリーナを使わない
+	Json outer = Json::parse(R"({"a":[1,2,3],"b":{"c":"d"}})");
+	xp_eq(0, arena.GetUsed());
+
+	{
+		JsonArena::Scope scope(arena);
+		xp_eq(true, JsonArena::Current() == &arena);
+
+		Json obj = Json::parse(R"({"text":"hello","user":{"name":"a"},)"
+			R"("files":[{"type":"image/png"},{"type":"image/jpeg"}]})");
+		xp_eq(true, arena.GetUsed() > 0);
+		xp_eq("hello", JsonAsString(obj["text"]));
+		xp_eq(2, obj["files"].size());
+
+		// 入れ子のスコープを抜けてもリセットしない
+		{
+			JsonArena::Scope inner(arena);
+			Json tmp = obj;
+			xp_eq("a", JsonAsString(tmp["user"]["name"]));
+		}
+		xp_eq(true, arena.GetUsed() > 0);
+		xp_eq("image/jpeg", JsonAsString(obj["files"][1]["type"]));
+
+		// スコープ外で作った Json をスコープ内で破棄してもよい
+		Json tmp = std::move(outer);
+		tmp = nullptr;
+	}
+	xp_eq(true, JsonArena::Current() == NULL);
+	xp_eq(0, arena.GetUsed());
+	xp_eq(true, arena.GetPeak() > 0);
+}
+
+void
+test_JsonArena()
+{
+	test_JsonArena_Allocate();
+	test_JsonArena_Scope();
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "KittyImageCache.h"
+#include "term.h"
+
+static void
+test_KittyImageCache_store()
+{
+	printf("%s\n", __func__);
+
+	KittyImageCache cache;
+	cache.SetBudget(1000);
+	std::vector<uint32> evicted;
+
+	xp_eq(true, cache.Lookup("a") == NULL);
+	uint32 ida = cache.Store("a", 400, 10, 20, &evicted);
+	uint32 idb = cache.Store("b", 400, 30, 40, &evicted);
+	xp_eq(KittyImageCache::MakeId("a"), ida);
+	xp_eq(KittyImageCache::MakeId("b"), idb);
+	xp_eq(2, cache.GetCount());
+	xp_eq(800, cache.GetBytes());
+	xp_eq(0, evicted.size());
+
+	const auto *e = cache.Lookup("a");
+	xp_eq(true, e != NULL);
+	if (e) {
+		xp_eq(ida, e->id);
+		xp_eq(10, e->width);
+		xp_eq(20, e->height);
+	}
+
+	// a を参照したので追い出されるのは b
+	cache.Store("c", 400, 1, 1, &evicted);
+	xp_eq(2, cache.GetCount());
+	xp_eq(800, cache.GetBytes());
+	xp_eq(1, cache.GetEvict());
+	xp_eq(1, evicted.size());
+	if (evicted.size() == 1) {
+		xp_eq(idb, evicted[0]);
+	}
+	xp_eq(true, cache.Lookup("b") == NULL);
+
+	// 置き換えは追い出しにならない
+	evicted.clear();
+	cache.Store("a", 500, 1, 1, &evicted);
+	xp_eq(2, cache.GetCount());
+	xp_eq(900, cache.GetBytes());
+	xp_eq(0, evicted.size());
+}
+
+static void
+test_KittyImageCache_MakeId()
+{
+	printf("%s\n", __func__);
+
+	// FNV-1a
+	xp_eq(0x811c9dc5U, KittyImageCache::MakeId(""));
+	xp_eq(0xe40c292cU, KittyImageCache::MakeId("a"));
+	xp_eq(KittyImageCache::MakeId("icon-x"), KittyImageCache::MakeId("icon-x"));
+}
+
+static void
+test_KittyImageCache_sequence()
+{
+	printf("%s\n", __func__);
+
+	// 1チャンクで収まる
+	std::vector<uint8> rgb(3);
+	std::string exp = ESC "_Ga=t,f=24,s=1,v=1,i=5,q=2,m=0;AAAA" ESC "\\";
+	xp_eq(exp, KittyImageCache::UploadSequence(5, rgb.data(), 1, 1));
+
+	// 3072 バイトずつ分割される
+	rgb.resize(2000 * 3);
+	auto seq = KittyImageCache::UploadSequence(5, rgb.data(), 2000, 1);
+	auto first = std::string(ESC "_Ga=t,f=24,s=2000,v=1,i=5,q=2,m=1;")
+		+ std::string(4096, 'A') + ESC "\\";
+	auto second = std::string(ESC "_Gm=0;")
+		+ std::string((6000 - 3072) / 3 * 4, 'A') + ESC "\\";
+	xp_eq(first + second, seq);
+
+	exp = ESC "D" ESC "D" CSI "2A" ESC "_Ga=p,i=7,C=1,q=2" ESC "\\"
+		ESC "D" ESC "D";
+	xp_eq(exp, KittyImageCache::PlaceSequence(7, 2));
+
+	exp = ESC "_Ga=d,d=I,i=7,q=2" ESC "\\";
+	xp_eq(exp, KittyImageCache::DeleteSequence(7));
+}
+
+void
+test_KittyImageCache()
+{
+	test_KittyImageCache_store();
+	test_KittyImageCache_MakeId();
+	test_KittyImageCache_sequence();
+}
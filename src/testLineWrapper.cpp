@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "LineWrapper.h"
+#include "StringUtil.h"
+
+// 表示用に ESC と改行を置き換える
+static std::string
+quote(const std::string& s)
+{
+	std::string q;
+
+	for (const auto c : s) {
+		if (c == 0x1b) {
+			q += "<ESC>";
+		} else if (c == '\n') {
+			q += "\\n";
+		} else {
+			q += c;
+		}
+	}
+	return q;
+}
+
+#define ZWJ		"\xe2\x80\x8d"
+#define FAMILY	"\xf0\x9f\x91\xa8" ZWJ "\xf0\x9f\x91\xa9" ZWJ "\xf0\x9f\x91\xa7"
+
+static void
+test_LineWrapper_wrap()
+{
+	printf("%s\n", __func__);
+
+	// 桁数 10、インデントなしで折り返す。
+	std::vector<std::pair<std::string, std::string>> table = {
+		// input				expected
+
+		// ASCII
+		{ "abcdefghijKL",		"abcdefghij\nKL" },
+		// 行末でちょうど終わったら改行する
+		{ "abcdefghij",			"abcdefghij\n" },
+		// 全角文字が入らなければ手前で改行する
+		{ "abcdefghi亜",			"abcdefghi\n亜" },
+		// 行末の結合文字はその行に置く
+		{ "abcdefghij" "\xcc\x81" "K",	"abcdefghij" "\xcc\x81" "\nK" },
+		// 結合文字は桁を進めない
+		{ "e" "\xcc\x81" "bcdefghijK",	"e" "\xcc\x81" "bcdefghij\nK" },
+		// ZWJ で繋いだ絵文字 (家族) は全体で 2桁
+		{ FAMILY "abcdefghZ",	FAMILY "abcdefgh\nZ" },
+		// 異体字セレクタも同じ桁 (HEAVY BLACK HEART + VS16)
+		{ "\xe2\x9d\xa4" "\xef\xb8\x8f" "abcdefghiZ",
+								"\xe2\x9d\xa4" "\xef\xb8\x8f" "abcdefghi\nZ" },
+		// 国旗は 2桁
+		{ "🇯🇵abcdefghZ",		"🇯🇵abcdefgh\nZ" },
+		// エスケープシーケンスは桁を進めない
+		{ "\x1b[1mabcdefghij\x1b[0mK",
+								"\x1b[1mabcdefghij\n\x1b[0mK" },
+		// 改行でリセット
+		{ "abc\ndefghijklmnop",	"abc\ndefghijklm\nnop" },
+	};
+
+	std::string indent = "\x1b[0C";
+	for (const auto& a : table) {
+		const auto& input = a.first;
+		auto expected = indent;
+		for (const auto c : a.second) {
+			expected += c;
+			if (c == '\n') {
+				expected += indent;
+			}
+		}
+
+		std::string dst;
+		UString ubuf;
+		LineWrapper out(dst, ubuf, 0, 10, false);
+		for (const auto c : UString::FromUTF8(input)) {
+			out.Put(c);
+		}
+		out.Finish();
+		xp_eq(quote(expected), quote(dst), quote(input));
+	}
+}
+
+static void
+test_LineWrapper_misc()
+{
+	printf("%s\n", __func__);
+
+	// インデント付き。
+	{
+		std::string dst;
+		UString ubuf;
+		LineWrapper out(dst, ubuf, 4, 10, false);
+		out.PutASCII("abcdefgh");
+		out.Finish();
+		xp_eq(quote("\x1b[4Cabcdef\n\x1b[4Cgh"), quote(dst), "indent");
+	}
+
+	// 桁数が分からなければ折り返さない。
+	{
+		std::string dst;
+		UString ubuf;
+		LineWrapper out(dst, ubuf, 0, 0, false);
+		out.PutASCII("abcdefghijklmn");
+		out.Finish();
+		xp_eq(quote("\x1b[0Cabcdefghijklmn"), quote(dst), "cols=0");
+	}
+
+	// UTF-8 以外なら最後にまとめて変換する。
+	{
+		UString::Init("euc-jp");
+		std::string dst;
+		UString ubuf;
+		LineWrapper out(dst, ubuf, 0, 10, true);
+		out.Put(0x4e9c);
+		out.Put('A');
+		out.Finish();
+		xp_eq(quote("\x1b[0C\xb0\xa1" "A"), quote(dst), "euc-jp");
+		UString::Init("");
+	}
+}
+
+void
+test_LineWrapper()
+{
+	opt_eaw_a = 2;
+	opt_eaw_n = 1;
+	init_eaw_width();
+
+	test_LineWrapper_wrap();
+	test_LineWrapper_misc();
+}
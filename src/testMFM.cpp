@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "MFM.h"
+
+// 字句列を "種類[文字列]" を並べた文字列にする。
+// 種類は T:文字列 K:記号 M:メンション H:タグ U:URL E:絵文字 C:コード
+// X:数式 P:plain Q:引用、装飾は '<' か '>' に続けて b:太字 i:斜体
+// s:取り消し線 m:小さい c:中央 f:関数。改行は "\n" と表示する。
+static std::string
+dump(const UString& src, const std::vector<MFM::Token>& tokens)
+{
+	static const char types[] = "TKMHUECXPQ<>";
+	static const char styles[] = "-bismcf";
+	std::string s;
+
+	for (const auto& t : tokens) {
+		s += types[t.type];
+		if (t.type == MFM::Begin || t.type == MFM::End) {
+			s += styles[t.style];
+		}
+		s += '[';
+		for (uint32 i = t.pos; i < t.pos + t.len; i++) {
+			if (src[i] == '\n') {
+				s += "\\n";
+			} else {
+				char buf[4];
+				int n = UString::UCharToUTF8(buf, src[i]);
+				s.append(buf, n);
+			}
+		}
+		s += ']';
+	}
+	return s;
+}
+
+// 字句が元の文字列を隙間なく覆っているか。
+static bool
+is_tiled(const UString& src, const std::vector<MFM::Token>& tokens)
+{
+	uint32 pos = 0;
+	for (const auto& t : tokens) {
+		if (t.pos != pos || t.len == 0) {
+			return false;
+		}
+		pos += t.len;
+	}
+	return pos == src.size();
+}
+
+static void
+test_MFM_Parse()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::pair<std::string, std::string>> table = {
+		// input						expected
+		{ "",							"" },
+		{ "こんにちは",					"T[こんにちは]" },
+
+		// メンション
+		{ "@user hello",				"M[@user]T[ hello]" },
+		{ "cc @user@misskey.io.",		"T[cc ]M[@user@misskey.io.]" },
+		{ "foo@example.com",			"T[foo@example.com]" },
+		{ "@ only",						"T[@ only]" },
+
+		// タグ (ノートの tags にあるものだけ、長いほうを優先)
+		{ "#misskeyio #MISSKEY #other",
+		  "H[#misskeyio]T[ ]H[#MISSKEY]T[ #other]" },
+		{ "#みすきー!",					"H[#みすきー]T[!]" },
+
+		// URL
+		{ "see https://example.com/a(b)c) end",
+		  "T[see ]U[https://example.com/a(b)c]T[) end]" },
+		{ "(http://foo/a)b",			"T[(]U[http://foo/a]T[)b]" },
+		{ "<https://x.y/>",				"K[<]U[https://x.y/]K[>]" },
+		{ "[link](https://x.y/)",		"T[[link](]U[https://x.y/]T[)]" },
+		{ "hello http",					"T[hello http]" },
+
+		// 太字
+		{ "**bold** text",				"<b[**]T[bold]>b[**]T[ text]" },
+		{ "**@a**",						"<b[**]M[@a]>b[**]" },
+		{ "**a <i>b</i> c**",
+		  "<b[**]T[a ]<i[<i>]T[b]>i[</i>]T[ c]>b[**]" },
+		{ "**a",						"T[**a]" },
+		{ "<b>a<i>b</b>c</i>",			"<b[<b>]T[a<i>b]>b[</b>]T[c</i>]" },
+		{ "__init__",					"<b[__]T[init]>b[__]" },
+		{ "__a-b__",					"T[__a-b__]" },
+
+		// 斜体
+		{ "_it_ *it*",					"<i[_]T[it]>i[_]T[ ]<i[*]T[it]>i[*]" },
+		{ "foo_bar_baz",				"T[foo_bar_baz]" },
+		{ "2*3*4",						"T[2*3*4]" },
+
+		// 取り消し線、小さい、中央
+		{ "~~no~~",						"<s[~~]T[no]>s[~~]" },
+		{ "<s>x</s>",					"<s[<s>]T[x]>s[</s>]" },
+		{ "<small>s</small>",			"<m[<small>]T[s]>m[</small>]" },
+		{ "<center>c</center>",			"<c[<center>]T[c]>c[</center>]" },
+		{ "</b>",						"T[</b>]" },
+
+		// 関数
+		{ "$[x2 big] $[fg.color=f00 red]",
+		  "<f[$[x2 ]T[big]>f[]]T[ ]<f[$[fg.color=f00 ]T[red]>f[]]" },
+		{ "[a] $[x2 [b]]",				"T[[a] ]<f[$[x2 ]T[[b]>f[]]T[]]" },
+		{ "$[0-9]",						"T[$[0-9]]" },
+		{ "$[x2 open",					"T[$[x2 open]" },
+
+		// コード
+		{ "`@user #misskey`",			"C[`@user #misskey`]" },
+		{ "a`b",						"T[a`b]" },
+		{ "```\n@a\n```\nx",			"C[```\\n@a\\n```]T[\\nx]" },
+		{ "x```\n@a",					"T[x```\\n]M[@a]" },
+
+		// 絵文字
+		{ ":smile: 12:34:56",			"E[:smile:]T[ 12:34:56]" },
+		{ "a:b:",						"T[a:b:]" },
+
+		// 数式
+		{ "\\(x^2\\)",					"X[\\(x^2\\)]" },
+		{ "\\[\na\n\\]",				"X[\\[\\na\\n\\]]" },
+		{ "\\(x\n\\)",					"T[\\(x\\n\\)]" },
+
+		// plain
+		{ "<plain>**x** @a</plain>@b",
+		  "K[<plain>]P[**x** @a]K[</plain>]M[@b]" },
+		{ "<plain>@a",					"K[<plain>]P[@a]" },
+		{ "<plain></plain>",			"K[<plain>]K[</plain>]" },
+
+		// 引用
+		{ "> quoted\n>x a>b",			"Q[> ]T[quoted\\n]Q[>]T[x a>b]" },
+	};
+
+	MFM mfm;
+	mfm.AddTag("misskey");
+	mfm.AddTag("MisskeyIO");
+	mfm.AddTag("みすきー");
+	for (const auto& a : table) {
+		const auto& input = a.first;
+		const auto& expected = a.second;
+
+		UString src = UString::FromUTF8(input);
+		const auto& tokens = mfm.Parse(src);
+		xp_eq(expected, dump(src, tokens), input);
+		xp_eq(true, is_tiled(src, tokens), input);
+	}
+}
+
+// 実際のノートに近いもの。
+static void
+test_MFM_notes()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::pair<std::string, std::string>> table = {
+		{
+			"$[tada 🎉] リリースしました! **sayaka 3.8** "
+			"https://github.com/isaki68k/sayaka #sayaka\n"
+			"<small>詳細は :arrow_right: @isaki@misskey.io まで</small>",
+
+			"<f[$[tada ]T[🎉]>f[]]T[ リリースしました! ]"
+			"<b[**]T[sayaka 3.8]>b[**]T[ ]"
+			"U[https://github.com/isaki68k/sayaka]T[ ]H[#sayaka]T[\\n]"
+			"<m[<small>]T[詳細は ]E[:arrow_right:]T[ ]"
+			"M[@isaki@misskey.io]T[ まで]>m[</small>]",
+		},
+		{
+			"> 引用元の文\n"
+			"それな ~~ほんとに~~ `make -j4` で <center>$[x3 :ok:]</center>",
+
+			"Q[> ]T[引用元の文\\nそれな ]<s[~~]T[ほんとに]>s[~~]T[ ]"
+			"C[`make -j4`]T[ で ]<c[<center>]<f[$[x3 ]E[:ok:]>f[]]"
+			">c[</center>]",
+		},
+	};
+
+	MFM mfm;
+	mfm.AddTag("sayaka");
+	for (const auto& a : table) {
+		const auto& input = a.first;
+		const auto& expected = a.second;
+
+		UString src = UString::FromUTF8(input);
+		const auto& tokens = mfm.Parse(src);
+		xp_eq(expected, dump(src, tokens), input);
+		xp_eq(true, is_tiled(src, tokens), input);
+	}
+}
+
+// 閉じ記号のない開き記号が大量にあっても線形時間で終わること。
+static void
+test_MFM_pathological()
+{
+	printf("%s\n", __func__);
+
+	std::string input;
+	for (int i = 0; i < 20000; i++) {
+		input += "<b><i>$[x <plain \\[";
+	}
+	UString src = UString::FromUTF8(input);
+
+	MFM mfm;
+	const auto& tokens = mfm.Parse(src);
+	xp_eq(1, tokens.size());
+	xp_eq(true, is_tiled(src, tokens));
+
+	// 閉じない "\(" が1行に大量にある
+	input.clear();
+	for (int i = 0; i < 20000; i++) {
+		input += "\\(";
+	}
+	input += "\n\\(x\\)";
+	src = UString::FromUTF8(input);
+	const auto& tokens2 = mfm.Parse(src);
+	xp_eq(2, tokens2.size());
+	xp_eq(true, is_tiled(src, tokens2));
+	if (tokens2.size() == 2) {
+		xp_eq(MFM::Math, tokens2[1].type);
+	}
+}
+
+void
+test_MFM()
+{
+	test_MFM_Parse();
+	test_MFM_notes();
+	test_MFM_pathological();
+}
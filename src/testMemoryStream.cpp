@@ -78,6 +78,21 @@ test_MemoryStream()
 		xp_eq('a', buf[2]);
 		xp_eq('b', buf[3]);
 	}
+	// 書き込みは末尾に追加
+	{
+		MemoryStream ms;
+		xp_eq(2, ms.Write("ab", 2));
+		xp_eq(1, ms.Write("c", 1));
+		xp_eq(3, ms.GetSize());
+
+		char buf[4];
+		memset(buf, 0, sizeof(buf));
+		auto actual = ms.Read(buf, sizeof(buf));
+		xp_eq(3, actual);
+		xp_eq('a', buf[0]);
+		xp_eq('b', buf[1]);
+		xp_eq('c', buf[2]);
+	}
 
 	// Peek1
 	{
@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "NGMatcher.h"
+#include "StringUtil.h"
+#include <set>
+#include <tuple>
+
+// matcher で text を検索して一致した id を全部集める。
+template <class T> static std::string
+collect(const T& matcher, const std::string& text)
+{
+	std::set<int> ids;
+	matcher.Search(text, [&](int id) {
+		ids.insert(id);
+		return false;
+	});
+	std::string rv;
+	for (auto id : ids) {
+		if (rv.empty() == false) {
+			rv += ',';
+		}
+		rv += string_format("%d", id);
+	}
+	return rv;
+}
+
+static void
+test_AhoCorasick()
+{
+	printf("%s\n", __func__);
+
+	AhoCorasick ac;
+	xp_eq(true, ac.empty());
+	ac.Add("he", 1);
+	ac.Add("she", 2);
+	ac.Add("his", 3);
+	ac.Add("Hers", 4);
+	ac.Add("", 5);			// 無視される
+	ac.Add("\xe3\x81\x82", 6);	// "あ"
+	ac.Add("she", 7);		// 同じ文字列でも両方通知される
+	ac.Build();
+	xp_eq(false, ac.empty());
+
+	std::vector<std::pair<std::string, std::string>> table = {
+		// text			expected
+		{ "",			"" },
+		{ "ushers",		"1,2,4,7" },
+		{ "USHERS",		"1,2,4,7" },
+		{ "ahishe",		"1,2,3,7" },
+		{ "hi",			"" },
+		{ "h\xe3\x81\x82",	"6" },
+		{ "\xe3\x81\x81",	"" },
+	};
+	for (const auto& a : table) {
+		const auto& text = a.first;
+		const auto& exp = a.second;
+		xp_eq(exp, collect(ac, text), text);
+	}
+
+	// callback が true を返したら打ち切る
+	int count = 0;
+	bool r = ac.Search("he he he", [&](int id) {
+		count++;
+		return count == 2;
+	});
+	xp_eq(true, r);
+	xp_eq(2, count);
+}
+
+static void
+test_RegexDFA()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::tuple<std::string, std::string, bool>> table = {
+		// re			text			expected
+		{ "a(b|d)c",	"xadcx",		true },
+		{ "a(b|d)c",	"xaecx",		false },
+		{ "ad?c",		"abc",			false },
+		{ "ad?c",		"ac",			true },
+		{ "colou?r",	"COLOR",		true },
+		{ "^abc",		"abcd",			true },
+		{ "^abc",		"xabc",			false },
+		{ "abc$",		"xabc",			true },
+		{ "abc$",		"abcx",			false },
+		{ "^$",			"",				true },
+		{ "^$",			"a",			false },
+		{ "foo|^bar",	"xbar",			false },
+		{ "foo|^bar",	"barx",			true },
+		{ "(?:ab)+$",	"xabab",		true },
+		{ "[a-c]+x",	"BCx",			true },
+		{ "[a-c]+x",	"dx",			false },
+		{ "[^0-9]",		"123",			false },
+		{ "[^0-9]",		"12a",			true },
+		{ "[^a]",		"A",			false },	// icase
+		{ "[]a]",		"a",			false },	// [] は空集合
+		{ "\\d{3}-\\d{4}",	"tel 123-4567",	true },
+		{ "\\d{3}-\\d{4}",	"tel 12-34567",	false },
+		{ "x{2,3}y",	"xy",			false },
+		{ "x{2,3}y",	"xxy",			true },
+		{ "^x{2,3}y",	"xxxxy",		false },
+		{ "^x{2,}y",	"xxxxy",		true },
+		{ "a.c",		"abc",			true },
+		{ "a.c",		"a\nc",			false },
+		{ "\\w+\\s\\W",	"ab !",			true },
+		{ "a*?b",		"aab",			true },
+		{ "\\.\\.\\.",	"a...",			true },
+		{ "\\.\\.\\.",	"a..b",			false },
+		{ "\\x41\\u0042",	"ab",		true },
+		{ "\\bfoo",		"",				false },	// 扱えない
+		{ "(a)\\1",		"",				false },	// 扱えない
+		{ "(?=a)",		"",				false },	// 扱えない
+		{ "a**",		"",				false },	// エラー
+		{ "(a",			"",				false },	// エラー
+		{ "a)",			"",				false },	// エラー
+		{ "[a",			"",				false },	// エラー
+		{ "^*",			"",				false },	// エラー
+	};
+	for (int i = 0, end = table.size(); i < end; i++) {
+		const auto& re = std::get<0>(table[i]);
+		const auto& text = std::get<1>(table[i]);
+		bool expected = std::get<2>(table[i]);
+
+		RegexDFA dfa;
+		bool added = dfa.Add(re, i);
+		dfa.Build();
+		bool actual = added && collect(dfa, text) == string_format("%d", i);
+		xp_eq(expected, actual, re + "," + text);
+	}
+
+	// 全部まとめた DFA でも、それぞれ単独の場合と同じ結果になること。
+	RegexDFA all;
+	for (int i = 0, end = table.size(); i < end; i++) {
+		all.Add(std::get<0>(table[i]), i);
+	}
+	all.Build();
+	for (int i = 0, end = table.size(); i < end; i++) {
+		const auto& text = std::get<1>(table[i]);
+		std::string exp;
+		for (int j = 0; j < end; j++) {
+			RegexDFA one;
+			if (one.Add(std::get<0>(table[j]), j) == false) {
+				continue;
+			}
+			one.Build();
+			if (collect(one, text).empty() == false) {
+				if (exp.empty() == false) {
+					exp += ',';
+				}
+				exp += string_format("%d", j);
+			}
+		}
+		xp_eq(exp, collect(all, text), text);
+	}
+}
+
+// DFA の状態が上限を超えて作り直しても結果が変わらないこと。
+static void
+test_RegexDFA_flush()
+{
+	printf("%s\n", __func__);
+
+	// 末尾から 17 文字目が a という DFA は 2^17 状態になる。
+	RegexDFA dfa;
+	dfa.Add("a[ab]{16}", 0);
+	dfa.Build();
+
+	std::string text;
+	uint32 x = 1;
+	for (int i = 0; i < 200000; i++) {
+		x = x * 1103515245 + 12345;
+		text += ((x >> 16) & 1) ? 'a' : 'b';
+	}
+	int exp = 0;
+	for (int i = 16; i < text.size(); i++) {
+		if (text[i - 16] == 'a') {
+			exp++;
+		}
+	}
+
+	int act = 0;
+	dfa.Search(text, [&](int id) {
+		act++;
+		return false;
+	});
+	xp_eq(exp, act);
+	// 作り直しているので上限 (要素数 256K) を大きく超えてはいない
+	xp_eq(true, dfa.GetStateCount() < 256 * 1024);
+}
+
+static void
+test_RegexDFA_IsLiteral()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::tuple<std::string, bool, std::string>> table = {
+		// re				expected	literal
+		{ "abc",			true,		"abc" },
+		{ "ABC",			true,		"abc" },
+		{ "\xe3\x81\x82",	true,		"\xe3\x81\x82" },
+		{ "\\.\\.\\.",		true,		"..." },
+		{ "a\\(b\\)",		true,		"a(b)" },
+		{ "[a]",			true,		"a" },
+		{ "",				false,		"" },
+		{ "a.c",			false,		"" },
+		{ "a|b",			false,		"" },
+		{ "ab?",			false,		"" },
+		{ "\\d",			false,		"" },
+		{ "^a",				false,		"" },
+		{ "(a",				false,		"" },
+	};
+	for (const auto& a : table) {
+		const auto& re = std::get<0>(a);
+		bool expected = std::get<1>(a);
+		const auto& exp_literal = std::get<2>(a);
+
+		std::string literal;
+		bool actual = RegexDFA::IsLiteral(re, &literal);
+		xp_eq(expected, actual, re);
+		if (expected && actual) {
+			xp_eq(exp_literal, literal, re);
+		}
+	}
+}
+
+void
+test_NGMatcher()
+{
+	test_AhoCorasick();
+	test_RegexDFA();
+	test_RegexDFA_flush();
+	test_RegexDFA_IsLiteral();
+}
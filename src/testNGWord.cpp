@@ -58,6 +58,13 @@ test_NGWordList_ReadFile()
 		r = list.ReadFile();
 		xp_eq(false, r);
 	}
+	{
+		// JSON として壊れている場合
+		NGWordList list(filename);
+		FileWriteAllText(filename, "{ \"ngword_list\": [");
+		r = list.ReadFile();
+		xp_eq(false, r);
+	}
 	{
 		// ["ngword_list"] があって空の場合
 		NGWordList list(filename);
@@ -69,46 +76,62 @@ test_NGWordList_ReadFile()
 }
 
 static void
-test_NGWordList_Parse()
+test_NGWordList_WriteFile()
 {
 	printf("%s\n", __func__);
 
-	std::vector<std::pair<std::string, std::string>> table = {
-		// src	ダンプのうち可変部分
-		{ "a",	" type=Regular" },
-
-		{ "%LIVE,Mon,00:01,23:59,a,a",
-		  " type=Live wday=1 start=1 end1=1439 end2=-1" },
+	autotemp filename("a.json");
 
-		{ "%LIVE,Tue,00:00,24:01,a,a",
-		  " type=Live wday=2 start=0 end1=1440 end2=1" },
+	{
+		NGWordList list(filename);
+		list.Add("abc", "");
+		list.Add("", "@u@example.com");
+		xp_eq(true, list.WriteFile());
+	}
+	{
+		NGWordList list(filename);
+		xp_eq(true, list.ReadFile());
+		xp_eq(2, list.size());
+		if (list.size() == 2) {
+			xp_eq("id=1 word=|abc| user=|| type=Regular", list[0].Dump());
+			xp_eq("id=2 word=|| user=|@u@example.com| type=User",
+				list[1].Dump());
+		}
+	}
+}
 
-		{ "%DELAY,1,a,a",	" type=Delay delay_sec=3600 ngtext=|a,a|" },
-		{ "%DELAY,2d,a,a",	" type=Delay delay_sec=172800 ngtext=|a,a|" },
-		{ "%RT,1",			" type=LessRT threshold=1" },
-		{ "%SOURCE,a,a",	" type=Source ngsource=|a,a|" },
+static void
+test_NGWordList_Parse()
+{
+	printf("%s\n", __func__);
 
-		// XXX 異常系をもうちょっとやったほうがいい
+	std::vector<std::tuple<std::string, std::string, std::string>> table = {
+		// src					user	type
+		{ "a",					"@u",	"Regular" },
+		{ "",					"@u",	"User" },
+		{ "%INSTANCE,example.com",	"",	"Instance" },
 	};
 	for (const auto& a : table) {
-		const auto& src = a.first;
-		const auto& expstr = a.second;
+		const auto& src = std::get<0>(a);
+		const auto& user = std::get<1>(a);
+		const auto& type = std::get<2>(a);
 
 		// 期待する文字列
-		auto exp = string_format("id=123 word=|%s| user=|@u|", src.c_str());
-		exp += expstr;
+		auto exp = string_format("id=123 word=|%s| user=|%s| type=%s",
+			src.c_str(), user.c_str(), type.c_str());
 
 		// 入力 (ファイルを模しているので "nguser" ではなく "user")
 		Json ngword_json;
 		ngword_json["id"] = 123;
-		ngword_json["user"] = "@u";
+		ngword_json["user"] = user;
 		ngword_json["ngword"] = src;
-		// 検査 (仕方ないので一つずつやる)
-		NGWord *ng = NGWordList::Parse(ngword_json);
-		auto act = ng->Dump();
-		xp_eq(exp, act, src);
-		delete ng;
+		NGWord ng = NGWordList::Parse(ngword_json);
+		xp_eq(exp, ng.Dump(), src);
 	}
+
+	// インスタンス名は小文字で比較する
+	NGWord ng(1, "%INSTANCE,Example.COM", "");
+	xp_eq("example.com", ng.GetPattern());
 }
 
 static void
@@ -116,292 +139,151 @@ test_NGWord_MatchUser()
 {
 	printf("%s\n", __func__);
 
-	// さすがに status に user がないケースはテストせんでいいだろ…
 	std::vector<std::tuple<std::string, std::string, bool>> table = {
-		// nguser	status->user								expected
-		{ "id:1",	R"( "id_str":"12","screen_name":"ab" )",	false },
-		{ "id:12",	R"( "id_str":"12","screen_name":"ab" )",	true },
-		{ "id:123",	R"( "id_str":"12","screen_name":"ab" )",	false },
-		{ "@a",		R"( "id_str":"12","screen_name":"ab" )",	false },
-		{ "@ab",	R"( "id_str":"12","screen_name":"ab" )",	true },
-		{ "@AB",	R"( "id_str":"12","screen_name":"ab" )",	true },
-		{ "@abc",	R"( "id_str":"12","screen_name":"ab" )",	false },
+		// nguser			user
+		{ "id:9a",			R"( "id":"9a","username":"ab","host":null )", true },
+		{ "id:9",			R"( "id":"9a","username":"ab","host":null )", false },
+		{ "@ab",			R"( "id":"9a","username":"ab","host":null )", true },
+		{ "@AB",			R"( "id":"9a","username":"ab","host":null )", true },
+		{ "ab",				R"( "id":"9a","username":"ab","host":null )", true },
+		{ "@a",				R"( "id":"9a","username":"ab","host":null )", false },
+		{ "@abc",			R"( "id":"9a","username":"ab","host":null )", false },
+		{ "@ab@x.com",		R"( "id":"9a","username":"ab","host":null )", false },
+		{ "@ab",			R"( "id":"9a","username":"Ab","host":"x.com" )", false },
+		{ "@ab@x.com",		R"( "id":"9a","username":"Ab","host":"x.com" )", true },
+		{ "@ab@X.COM",		R"( "id":"9a","username":"Ab","host":"x.com" )", true },
+		{ "@ab@y.com",		R"( "id":"9a","username":"Ab","host":"x.com" )", false },
 	};
 	for (const auto& a : table) {
 		const std::string& nguser = std::get<0>(a);
 		const std::string& expr = std::get<1>(a);
 		const bool expected = std::get<2>(a);
 
-		Json ngword_json;
-		ngword_json["id"] = 123;
-		ngword_json["user"] = nguser;
-		ngword_json["ngword"] = "a";
-		NGWord *ng = NGWordList::Parse(ngword_json);
-
-		Json user = Json::parse("{" + expr + "}");
-		Json status { { "user", user } };
-		auto actual = ng->MatchUser(status);
+		NGWord ng(1, "a", nguser);
+		Json json = Json::parse("{\"user\":{" + expr + "}}");
+		NoteParser parser;
+		const Note& note = parser.FromJson(json);
+		auto actual = ng.MatchUser(note.user);
 		xp_eq(expected, actual, nguser + "," + expr);
 	}
 }
 
-static void
-test_NGWord_MatchText()
-{
-	printf("%s\n", __func__);
-
-	std::vector<std::tuple<std::string, std::string, bool>> table = {
-		// testname 	ngword		expected
-		{ "text_only",	"hell",		true },
-		{ "full_only",	"hell",		true },
-		{ "full_text",	"hell",		true },
-		{ "text_only",	"hellox",	false },
-		{ "full_only",	"hellox",	false },
-		{ "full_text",	"hellox",	false },
-		{ "text_only",	"HELL",		true },
-		{ "full_only",	"HELL",		true },
-		{ "full_text",	"HELL",		true },
-		{ "text_only",	"HELLOX",	false },
-		{ "full_only",	"HELLOX",	false },
-		{ "full_text",	"HELLOX",	false },
-
-		{ "text_only",	"\\.\\.\\.",	false },
-		{ "full_only",	"\\.\\.\\.",	false },
-		{ "full_text",	"\\.\\.\\.",	false },
-	};
-	Json statuses {
-		{ "text_only", {	// text のみ、今時あるのかは知らん
-			{ "text", "hello" },
-		} },
-		{ "full_only", {	// full_text のみ、あるのかは知らん
-			{ "extended_tweet", {
-				{ "full_text", "hello" },
-			} },
-		} },
-		{ "full_text", {	// full_text と text 両方。通常はこれ
-			{ "text", "hel..." },
-			{ "extended_tweet", {
-				{ "full_text", "hello" },
-			} },
-		} },
-	};
-	for (const auto& a : table) {
-		const auto& testname = std::get<0>(a);
-		const auto& ngword = std::get<1>(a);
-		bool expected = std::get<2>(a);
-
-		// テストを選択
-		if (statuses.contains(testname) == false) {
-			xp_fail("invalid testname: " + testname);
-			continue;
-		}
-
-		// ng を作成
-		NGWordList nglist;
-		NGWord *ng = nglist.Add(ngword, "");
-
-		auto actual = ng->MatchText(statuses[testname]);
-		xp_eq(expected, actual, testname + "," + ngword);
-	}
-}
-
 static void
 test_NGWordList_Match()
 {
 	printf("%s\n", __func__);
 
-	// RT元とRT先が関係するテスト
 	std::vector<std::tuple<std::string, std::string, std::string, bool>> table =
 	{	// testname	ngword			@user		expected
 
-		// --- Live
-		// NGワードはローカル時刻、status は UTC。
-		// XXX JST 前提なので、他タイムゾーンではテストがこける…
-		{ "std",	"%LIVE,Sun,21:00,22:00",	"",	true },
-		{ "std",	"%LIVE,Sun,12:00,21:00",	"",	false },
-		// 日またぎ、Sun 21:20 は Sat 45:20…
-		{ "std",	"%LIVE,Sat,23:00,45:00",	"",	false },
-		{ "std",	"%LIVE,Sat,23:00,45:30",	"",	true },
-
-		// --- Delay は今の所省略
-
-		// --- LessRT
-		{ "rt0",	"%RT,2",		"",			false },
-		{ "rt0",	"%RT,3",		"",			false },
-		{ "rt0",	"%RT,2",		"@other",	false },
-		{ "rt0",	"%RT,3",		"@other",	false },
-		{ "rt0",	"%RT,2",		"@ange",	false },
-		{ "rt0",	"%RT,3",		"@ange",	false },
-		{ "rt1",	"%RT,2",		"",			false },
-		{ "rt1",	"%RT,3",		"",			false },
-		{ "rt1",	"%RT,2",		"@other",	false },
-		{ "rt1",	"%RT,3",		"@other",	false },
-		{ "rt1",	"%RT,2",		"@ange",	false },
-		{ "rt1",	"%RT,3",		"@ange",	false },
-		{ "rt2",	"%RT,2",		"",			false },
-		{ "rt2",	"%RT,3",		"",			true },
-		{ "rt2",	"%RT,2",		"@other",	false },
-		{ "rt2",	"%RT,3",		"@other",	false },
-		{ "rt2",	"%RT,2",		"@ange",	false },
-		{ "rt2",	"%RT,3",		"@ange",	true },
-		// RT先ユーザがマッチしても RT 数ルールは適用しない
-		{ "rt2",	"%RT,2",		"@seven",	false },
-		{ "rt2",	"%RT,3",		"@seven",	false },
-
-		// --- Source
-		{ "std",	"%SOURCE,client",	"",		true },
-		{ "std",	"%SOURCE,CLIENT",	"",		true },		// CaseIgnore
-		{ "std",	"%SOURCE,clientx",	"",		false },
-		{ "std",	"%SOURCE, v\\d",	"",		true },		// 正規表現
-
-		// --- Regular
-		// 通常ワード
-		{ "std",	"abc",				"",		true },
-		{ "std",	"ABC",				"",		true },		// CaseIgnore
+		// 固定文字列
+		{ "std",	"hello",		"",			true },
+		{ "std",	"HELLO",		"",			true },		// CaseIgnore
+		{ "std",	"hellox",		"",			false },
+		{ "std",	"\\.\\.\\.",	"",			false },
+		{ "std",	"ange",			"",			false },	// ユーザ名は見ない
 		// 正規表現
-		{ "std",	"a(b|d)c",			"",		true },
-		{ "std",	"ad?c",				"",		false },
-
-		// 本文のみ検索
-		{ "rt0",	"nomatch",		"",			false },
-		{ "rt0",	"hello",		"",			true },
-		{ "rt0",	"ange",			"",			false },
-		{ "rt0",	"nomatch",		"@other",	false },
-		{ "rt0",	"hello",		"@other",	false },
-		{ "rt0",	"ange",			"@other",	false },
-		{ "rt0",	"nomatch",		"@ange",	false },
-		{ "rt0",	"hello",		"@ange",	true },
-		{ "rt0",	"ange",			"@ange",	false },
-		// 通常キーワードは本文のほかにRT先のユーザ名も比較する
-		{ "rt2",	"nomatch",		"",			false },
-		{ "rt2",	"hello",		"",			true },
-		{ "rt2",	"ange",			"",			false },
-		{ "rt2",	"seven",		"",			true },
-		{ "rt2",	"nomatch",		"@other",	false },
-		{ "rt2",	"hello",		"@other",	false },
-		{ "rt2",	"ange",			"@other",	false },
-		{ "rt2",	"seven",		"@other",	false },
-		{ "rt2",	"nomatch",		"@ange",	false },
-		{ "rt2",	"hello",		"@ange",	true },
-		{ "rt2",	"ange",			"@ange",	false },
-		{ "rt2",	"seven",		"@ange",	true },
-		{ "rt2",	"nomatch",		"@seven",	false },
-		{ "rt2",	"hello",		"@seven",	true },
-		{ "rt2",	"ange",			"@seven",	false },
-		// XXX これはどうするか?
-		{ "rt2",	"seven",		"@seven",	true },
-
-		// QT 本文のみ
-		{ "qt1",	"nomatch",		"",			false },
-		{ "qt1",	"hello",		"",			true },
-		{ "qt1",	"foo",			"",			true },
-		{ "qt1",	"seven",		"",			true },
-		{ "qt1",	"nomatch",		"@ange",	false },
-		{ "qt1",	"hello",		"@ange",	true },
-		{ "qt1",	"foo",			"@ange",	true },
-		{ "qt1",	"seven",		"@ange",	true },
-		{ "qt1",	"nomatch",		"@other",	false },
-		{ "qt1",	"hello",		"@other",	false },
-		{ "qt1",	"foo",			"@other",	false },
-		{ "qt1",	"seven",		"@other",	false },
-		{ "qt1",	"nomatch",		"@seven",	false },
-		{ "qt1",	"hello",		"@seven",	false },
-		{ "qt1",	"foo",			"@seven",	true },
-		// XXX これはどうする?
-		{ "qt1",	"seven",		"@seven",	true },
-
-		// QT 先が RT
-		{ "qt2",	"nomatch",		"",			false },
-		{ "qt2",	"hello",		"",			true },
-		{ "qt2",	"foo",			"",			true },
-		{ "qt2",	"seven",		"",			true },
-		{ "qt2",	"nomatch",		"@ange",	false },
-		{ "qt2",	"hello",		"@ange",	true },
-		{ "qt2",	"foo",			"@ange",	true },
-		{ "qt2",	"seven",		"@ange",	true },
-		{ "qt2",	"nomatch",		"@other",	false },
-		{ "qt2",	"hello",		"@other",	false },
-		{ "qt2",	"foo",			"@other",	false },
-		{ "qt2",	"seven",		"@other",	false },
-		{ "qt2",	"nomatch",		"@seven",	false },
-		{ "qt2",	"hello",		"@seven",	false },
-		{ "qt2",	"foo",			"@seven",	true },
-		// XXX これはどうする?
-		{ "qt2",	"seven",		"@seven",	true },
+		{ "std",	"h(e|a)llo",	"",			true },
+		{ "std",	"^hello",		"",			false },
+		{ "std",	"world$",		"",			true },
+		{ "std",	"he(?=l)",		"",			true },		// std::regex
+		// ユーザ指定付き
+		{ "std",	"hello",		"@ange",	true },
+		{ "std",	"hello",		"@other",	false },
+		{ "std",	"hello",		"id:100",	true },
+		// ユーザ
+		{ "std",	"",				"@ange",	true },
+		{ "std",	"",				"@other",	false },
+		{ "std",	"",				"",			false },
+		{ "remote",	"",				"@seven",	false },
+		{ "remote",	"",				"@seven@example.com",	true },
+		// インスタンス
+		{ "std",	"%INSTANCE,example.com",	"",	false },
+		{ "remote",	"%INSTANCE,example.com",	"",	true },
+		{ "remote",	"%INSTANCE,EXAMPLE.COM",	"",	true },
+		{ "remote",	"%INSTANCE,example.org",	"",	false },
+
+		// CW と投票
+		{ "cw",		"spoiler",		"",			true },
+		{ "cw",		"secret",		"",			true },
+		{ "poll",	"choice2",		"",			true },
+		{ "poll",	"choice3",		"",			false },
+
+		// RN は RN した人と RN 先の両方
+		{ "rn",		"foo",			"",			true },
+		{ "rn",		"foo",			"@ange",	true },
+		{ "rn",		"foo",			"@seven@example.com",	true },
+		{ "rn",		"foo",			"@other",	false },
+		{ "rn",		"",				"@ange",	true },
+		{ "rn",		"",				"@seven@example.com",	true },
+		{ "rn",		"%INSTANCE,example.com",	"",	true },
+		// 引用 RN は両方の本文
+		{ "qt",		"hello",		"",			true },
+		{ "qt",		"foo",			"",			true },
 	};
-	Json statuses {
-		{ "std", {		// 基本形式
-			{ "text", "abc hello..." },
-			{ "extended_tweet", { { "full_text", "abc hello world" } } },
-			{ "created_at", "Sun Jan 10 12:20:00 +0000 2021" },
-			{ "source", "test client v0" },
-			{ "user", { { "id_str", "100" }, { "screen_name", "ange" } } },
+	Json notes {
+		{ "std", {
+			{ "text", "abc hello world" },
+			{ "cw", nullptr },
+			{ "createdAt", "2024-01-10T12:20:00.000Z" },
+			{ "user", {
+				{ "id", "100" }, { "username", "ange" }, { "host", nullptr },
+			} },
 		} },
-		{ "rt0", {		// RTされていない通常ツイート
-			{ "text", "abc hello..." },
-			{ "extended_tweet", { { "full_text", "abc hello world" } } },
-			{ "created_at", "Sun Jan 10 12:20:00 +0000 2021" },
-			{ "source", "test client v0" },
-			{ "user", { { "id_str", "100" }, { "screen_name", "ange" } } },
+		{ "remote", {
+			{ "text", "hello" },
+			{ "createdAt", "2024-01-10T12:20:00.000Z" },
+			{ "user", {
+				{ "id", "101" }, { "username", "seven" },
+				{ "host", "example.com" },
+			} },
 		} },
-		{ "rt1", {		// これ自身がRTされているだけの通常ツイート
-			{ "text", "abc hello..." },
-			{ "extended_tweet", { { "full_text", "abc hello world" } } },
-			{ "created_at", "Sun Jan 10 12:20:00 +0000 2021" },
-			{ "source", "test client v0" },
-			{ "user", { { "id_str", "100" }, { "screen_name", "ange" } } },
-			{ "retweet_count", 3 },
+		{ "cw", {
+			{ "text", "secret" },
+			{ "cw", "spoiler" },
+			{ "createdAt", "2024-01-10T12:20:00.000Z" },
+			{ "user", {
+				{ "id", "100" }, { "username", "ange" }, { "host", nullptr },
+			} },
 		} },
-		{ "rt2", {		// RTしたツイート(3リツイートされている)
-			{ "text", "RT: abc hello..." },
-			{ "extended_tweet", { { "full_text", "abc hello world" } } },
-			{ "created_at", "Sun Jan 10 12:20:00 +0000 2021" },
-			{ "source", "test client v0" },
-			{ "user", { { "id_str", "100" }, { "screen_name", "ange" } } },
-			{ "retweet_count", 3 },
-			{ "retweeted_status", {
-				{ "text", "abc hello..." },
-				{ "extended_tweet", { { "full_text", "abc hello world" } } },
-				{ "created_at", "Sun Jan 10 12:20:00 +0000 2021" },
-				{ "source", "other client v0" },
-				{ "user", { { "id_str", "101" }, { "screen_name", "seven" } } },
-				{ "retweet_count", 3 },
+		{ "poll", {
+			{ "text", "which?" },
+			{ "createdAt", "2024-01-10T12:20:00.000Z" },
+			{ "poll", { { "choices", {
+				{ { "text", "choice1" }, { "votes", 0 } },
+				{ { "text", "choice2" }, { "votes", 1 } },
+			} } } },
+			{ "user", {
+				{ "id", "100" }, { "username", "ange" }, { "host", nullptr },
 			} },
 		} },
-		{ "qt1", {		// QT (RTなし)
-			{ "text", "abc hello..." },
-			{ "extended_tweet", { { "full_text", "abc hello world" } } },
-			{ "created_at", "Sun Jan 10 12:20:00 +0000 2021" },
-			{ "source", "test client v0" },
-			{ "user", { { "id_str", "100" }, { "screen_name", "ange" } } },
-			{ "quoted_status", {
+		{ "rn", {
+			{ "text", nullptr },
+			{ "createdAt", "2024-01-10T12:20:00.000Z" },
+			{ "user", {
+				{ "id", "100" }, { "username", "ange" }, { "host", nullptr },
+			} },
+			{ "renote", {
 				{ "text", "foo bar" },
-				{ "created_at", "Sun Jan 10 12:20:00 +0000 2021" },
-				{ "source", "other client v0" },
-				{ "user", { { "id_str", "101" }, { "screen_name", "seven" } } },
+				{ "createdAt", "2024-01-10T12:00:00.000Z" },
+				{ "user", {
+					{ "id", "101" }, { "username", "seven" },
+					{ "host", "example.com" },
+				} },
 			} },
 		} },
-		{ "qt2", {		// QT (RTあり)
-			{ "text", "abc hello..." },
-			{ "extended_tweet", { { "full_text", "abc hello world" } } },
-			{ "created_at", "Sun Jan 10 12:20:00 +0000 2021" },
-			{ "source", "test client v0" },
-			{ "user", { { "id_str", "100" }, { "screen_name", "ange" } } },
-			{ "quoted_status", {
-				{ "text", "RT: foo bar" },
-				{ "created_at", "Sun Jan 10 12:20:00 +0000 2021" },
-				{ "source", "test client v0" },
-				{ "user", { { "id_str", "100" }, { "screen_name", "ange" } } },
-				{ "retweet_count", 3 },
-				{ "retweeted_status", {
-					{ "text", "foo bar" },
-					{ "created_at", "Sun Jan 10 12:20:00 +0000 2021" },
-					{ "user", {
-						{ "id_str", "101" },
-						{ "screen_name", "seven" }
-					} },
-					{ "retweet_count", 3 },
-					{ "source", "other client v0" },
+		{ "qt", {
+			{ "text", "hello" },
+			{ "createdAt", "2024-01-10T12:20:00.000Z" },
+			{ "user", {
+				{ "id", "100" }, { "username", "ange" }, { "host", nullptr },
+			} },
+			{ "renote", {
+				{ "text", "foo bar" },
+				{ "createdAt", "2024-01-10T12:00:00.000Z" },
+				{ "user", {
+					{ "id", "101" }, { "username", "seven" },
+					{ "host", "example.com" },
 				} },
 			} },
 		} },
@@ -412,31 +294,47 @@ test_NGWordList_Match()
 		const auto& word = std::get<1>(a);
 		const auto& user = std::get<2>(a);
 		bool expected = std::get<3>(a);
+		auto where = testname + ",|" + word + "|," + user;
 
 		// テストを選択
-		if (statuses.contains(testname) == false) {
+		if (notes.contains(testname) == false) {
 			xp_fail("invalid testname: " + testname);
+			continue;
 		}
-		const Json& status = statuses[testname];
+		NoteParser parser;
+		const Note& note = parser.FromJson(notes[testname]);
 
-		// ng を作成
+		// ng を作成 (一致しないルールも混ぜておく)
 		NGWordList nglist;
+		nglist.Add("nomatch", "");
+		nglist.Add("no(m|n)atch", "");
 		nglist.Add(word, user);
+		nglist.Compile();
 
 		NGStatus ngstat;
-		bool actual = nglist.Match(&ngstat, status);
-		xp_eq(expected, actual,
-			std::string(testname) + "," + word + "," + user + "," +
-				(expected ? "true" : "false"));
+		bool actual = nglist.Match(&ngstat, note);
+		xp_eq(expected, actual, where);
+		if (expected && actual) {
+			xp_eq(true, ngstat.user != NULL, where);
+			xp_eq(true, ngstat.note != NULL, where);
+			xp_eq(word.empty() ? user : word, ngstat.ngword, where);
+		}
 	}
+
+	// 空のリストは何にも一致しない
+	NGWordList empty;
+	empty.Compile();
+	NGStatus ngstat;
+	NoteParser parser;
+	xp_eq(false, empty.Match(&ngstat, parser.FromJson(notes["std"])));
 }
 
 void
 test_NGWord()
 {
 	test_NGWordList_ReadFile();
+	test_NGWordList_WriteFile();
 	test_NGWordList_Parse();
 	test_NGWord_MatchUser();
-	test_NGWord_MatchText();
 	test_NGWordList_Match();
 }
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "ImageCache.h"
+#include "NegativeCache.h"
+#include "subr.h"
+
+using Reason = NegativeCache::Reason;
+
+static void
+test_NegativeCache_GetTTL()
+{
+	printf("%s\n", __func__);
+
+	// 失敗するたびに倍になる
+	xp_eq(600, NegativeCache::GetTTL(Reason::Connect, 1));
+	xp_eq(1200, NegativeCache::GetTTL(Reason::Connect, 2));
+	xp_eq(2400, NegativeCache::GetTTL(Reason::Connect, 3));
+	// 種類によって初期値が違う
+	xp_eq(6 * 3600, NegativeCache::GetTTL(Reason::ClientError, 1));
+	xp_eq(86400, NegativeCache::GetTTL(Reason::NotImage, 1));
+	// 上限は1週間
+	xp_eq(7 * 86400, NegativeCache::GetTTL(Reason::NotImage, 10));
+	xp_eq(7 * 86400, NegativeCache::GetTTL(Reason::Connect, 255));
+	// 失敗していない
+	xp_eq(0, NegativeCache::GetTTL(Reason::None, 1));
+	xp_eq(0, NegativeCache::GetTTL(Reason::Connect, 0));
+}
+
+static void
+test_NegativeCache_FromResultCode()
+{
+	printf("%s\n", __func__);
+
+	xp_eq((int)Reason::Connect,
+		(int)NegativeCache::FromResultCode(0));
+	xp_eq((int)Reason::ClientError,
+		(int)NegativeCache::FromResultCode(404));
+	xp_eq((int)Reason::ServerError,
+		(int)NegativeCache::FromResultCode(503));
+}
+
+static void
+test_NegativeCache_Check()
+{
+	printf("%s\n", __func__);
+
+	char tempname[32];
+	strcpy(tempname, "/tmp/sayakatest.XXXXXX");
+	std::string dir = mkdtemp(tempname);
+
+	const std::string url = "https://example.com/a.png";
+	const time_t now = 1700000000;
+	{
+		ImageCache cache;
+		cache.Open(dir, 0);
+		NegativeCache neg(cache);
+
+		xp_eq(false, neg.Check(url, now));
+
+		// 失敗したら期限まで見送る
+		neg.Fail(url, Reason::Connect, now);
+		xp_eq(true, neg.Check(url, now));
+		xp_eq(true, neg.Check(url, now + 599));
+		xp_eq(false, neg.Check(url, now + 600));
+		xp_eq(2, neg.GetSkip());
+
+		// 期限切れ後にまた失敗すると期限は倍
+		neg.Fail(url, Reason::Connect, now + 600);
+		xp_eq(true, neg.Check(url, now + 600 + 1199));
+		xp_eq(false, neg.Check(url, now + 600 + 1200));
+		xp_eq(2, neg.GetFail());
+
+		// 別の URL には影響しない
+		xp_eq(false, neg.Check(url + "x", now + 600));
+
+		// 32ビットの FNV1 が衝突する URL でも影響しない
+		xp_eq(FNV1("https://example.com/444789.png"),
+			FNV1("https://example.com/1124330.png"));
+		neg.Fail("https://example.com/444789.png", Reason::NotImage, now);
+		xp_eq(true, neg.Check("https://example.com/444789.png", now));
+		xp_eq(false, neg.Check("https://example.com/1124330.png", now));
+		neg.Success("https://example.com/444789.png");
+	}
+	// 次回起動時にも引き継がれる
+	{
+		ImageCache cache;
+		cache.Open(dir, 0);
+		NegativeCache neg(cache);
+
+		xp_eq(true, neg.Check(url, now + 600));
+
+		// 成功したら消える
+		neg.Success(url);
+		xp_eq(false, neg.Check(url, now + 600));
+		xp_eq(0, cache.GetCount());
+
+		// 回数もリセットされている
+		neg.Fail(url, Reason::Connect, now);
+		xp_eq(false, neg.Check(url, now + 600));
+	}
+
+	unlink((dir + "/sixel.dat").c_str());
+	unlink((dir + "/sixel.idx").c_str());
+	rmdir(dir.c_str());
+}
+
+void
+test_NegativeCache()
+{
+	test_NegativeCache_GetTTL();
+	test_NegativeCache_FromResultCode();
+	test_NegativeCache_Check();
+}
@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "JsonInc.h"
+#include "Note.h"
+#include "StringUtil.h"
+
+// Note を比較しやすいよう1つの文字列にする。
+static std::string
+dump(const Note& note)
+{
+	std::string s;
+
+	auto add = [&](const char *name, std::string_view v) {
+		s += name;
+		s += "=|";
+		s += v;
+		s += "| ";
+	};
+	add("id", note.id);
+	add("createdAt", note.createdAt);
+	add("text", note.text);
+	add("cw", note.cw);
+	if (note.has_user) {
+		const NoteUser& u = note.user;
+		s += "user{";
+		add("id", u.id);
+		add("name", u.name);
+		add("username", u.username);
+		add("host", u.host);
+		add("avatarUrl", u.avatarUrl);
+		if (u.has_instance) {
+			add("instance", u.instance_name);
+		}
+		s += "} ";
+	}
+	for (const auto& tag : note.tags) {
+		add("tag", tag);
+	}
+	for (const auto& f : note.files) {
+		s += "file{";
+		add("type", f.type);
+		add("blurhash", f.blurhash);
+		add("thumbnailUrl", f.thumbnailUrl);
+		s += string_format("nsfw=%d %dx%d} ", f.isSensitive, f.width, f.height);
+	}
+	if (note.has_poll) {
+		s += "poll{";
+		for (const auto& c : note.choices) {
+			add("text", c.text);
+			s += string_format("votes=%d voted=%d ", c.votes, c.isVoted);
+		}
+		s += "} ";
+	}
+	s += string_format("rn=%d react=%d", note.renoteCount, note.reactionCount);
+	if (note.renote) {
+		s += " renote{" + dump(*note.renote) + "}";
+	}
+	return s;
+}
+
+static void
+test_NoteParser_Result()
+{
+	printf("%s\n", __func__);
+
+	using R = NoteParser::Result;
+	std::vector<std::pair<std::string, R>> table = {
+		// ノート
+		{ R"({"id":"9a","text":"a"})",							R::Note },
+		{ R"( { "id" : "9a" , "text" : null } )",				R::Note },
+		{ R"({})",												R::Note },
+		{ R"({"type":"channel","body":{"id":"s","type":"note",)"
+		  R"("body":{"id":"9a"}}})",							R::Note },
+		{ R"({"type":"note","body":{"id":"9a"}})",				R::Note },
+		// "body" がオブジェクトでなければノート
+		{ R"({"type":"channel","body":"x"})",					R::Note },
+
+		// 無視していいもの
+		{ R"({"type":"emojiAdded","body":{"emoji":{}}})",		R::Ignore },
+		{ R"({"type":"channel","body":{"type":"emojiDeleted",)"
+		  R"("body":{}}})",										R::Ignore },
+
+		// DOM に任せるもの
+		{ R"({"type":"announcementCreated","body":{)"
+		  R"("announcement":{}}})",								R::Fallback },
+		{ R"({"type":"unknown","body":{}})",					R::Fallback },
+		{ R"({"body":{"id":"9a"},"type":"note"})",				R::Fallback },
+		{ R"({"type":1,"body":{}})",							R::Fallback },
+		{ R"({"id":"9a","announcement":{"text":"a"}})",			R::Fallback },
+
+		// 構文エラーも DOM に任せる
+		{ "",													R::Fallback },
+		{ "[]",													R::Fallback },
+		{ "\"a\"",												R::Fallback },
+		{ R"({"id":"9a",})",									R::Fallback },
+		{ R"({"id":"9a"} x)",									R::Fallback },
+		{ R"({"id":"9a")",										R::Fallback },
+		{ R"({"id":"9a})",										R::Fallback },
+		{ R"({"id":9a})",										R::Fallback },
+		{ R"({"id":01})",										R::Fallback },
+		{ R"({"id":1.})",										R::Fallback },
+		{ R"({"id":-})",										R::Fallback },
+		{ R"({"id":tru})",										R::Fallback },
+		{ R"({"id" "9a"})",										R::Fallback },
+		{ R"({"a":[1,]})",										R::Fallback },
+		{ R"({"a":[1 2]})",										R::Fallback },
+		{ R"({"text":"\x"})",									R::Fallback },
+		{ R"({"text":"\u12"})",									R::Fallback },
+		{ R"({"text":"\ud83c"})",								R::Fallback },
+		{ R"({"text":"\udf63"})",								R::Fallback },
+		{ "{\"text\":\"a\tb\"}",								R::Fallback },
+		{ "{\"text\":\"\xe3\x81\"}",							R::Fallback },
+		{ "{\"text\":\"\xc0\xaf\"}",							R::Fallback },
+		{ "{\"text\":\"\xed\xa0\x80\"}",						R::Fallback },
+	};
+	for (const auto& a : table) {
+		const auto& input = a.first;
+		auto expected = a.second;
+
+		NoteParser parser;
+		auto actual = parser.Parse(input);
+		xp_eq((int)expected, (int)actual, input);
+
+		// DOM で読めるかどうかと一致しているか
+		if (expected == R::Fallback) {
+			continue;
+		}
+		xp_eq(true, Json::accept(input), input);
+	}
+
+	// 深すぎる入れ子は DOM に任せる
+	std::string deep = "{\"a\":" + std::string(1000, '[') +
+		std::string(1000, ']') + "}";
+	NoteParser parser;
+	xp_eq((int)R::Fallback, (int)parser.Parse(deep));
+}
+
+static void
+test_NoteParser_Parse()
+{
+	printf("%s\n", __func__);
+
+	std::string input = R"({"type":"channel","body":{"id":"sayaka-1",)"
+		R"("type":"note","body":{)"
+		R"("id":"9b","createdAt":"2024-01-10T12:20:00.000Z",)"
+		R"("text":"a\"b\\c\/d\nあ🍣 #tag",)"
+		R"("cw":null,"visibility":"public",)"
+		R"("user":{"id":"u1","name":null,"username":"ange",)"
+		R"("host":"example.com","avatarUrl":"https://a/b.png",)"
+		R"("emojis":{"x":"y"},"instance":{"name":"Ex","iconUrl":null}},)"
+		R"("tags":["tag",1,"tag2"],)"
+		R"("files":[{"type":"image/png","isSensitive":true,)"
+		R"("blurhash":"LEHV6n","thumbnailUrl":null,)"
+		R"("properties":{"width":640,"height":480.5}},3],)"
+		R"("poll":{"multiple":false,"choices":[)"
+		R"({"text":"c1","votes":2,"isVoted":true},)"
+		R"({"text":"c2","votes":"x"}]},)"
+		R"("renoteCount":3.0,"repliesCount":0,)"
+		R"("reactions":{"❤":2,":a:":1e1,":b:":null},)"
+		R"("renote":{"id":"9a","text":"orig","renote":{"id":"9"},)"
+		R"("user":{"username":"seven"},"renoteCount":1}}}})";
+
+	NoteParser parser;
+	auto r = parser.Parse(input);
+	xp_eq((int)NoteParser::Result::Note, (int)r);
+	const Note& note = parser.GetNote();
+
+	xp_eq("9b", std::string(note.id));
+	xp_eq("2024-01-10T12:20:00.000Z", std::string(note.createdAt));
+	xp_eq("a\"b\\c/d\n\xe3\x81\x82\xf0\x9f\x8d\xa3 #tag",
+		std::string(note.text));
+	xp_eq("", std::string(note.cw));
+
+	xp_eq(true, note.has_user);
+	xp_eq("u1", std::string(note.user.id));
+	xp_eq("", std::string(note.user.name));
+	xp_eq("ange", std::string(note.user.username));
+	xp_eq("example.com", std::string(note.user.host));
+	xp_eq("https://a/b.png", std::string(note.user.avatarUrl));
+	xp_eq(true, note.user.has_instance);
+	xp_eq("Ex", std::string(note.user.instance_name));
+
+	xp_eq(2, note.tags.size());
+	xp_eq("tag2", std::string(note.tags[1]));
+
+	xp_eq(1, note.files.size());
+	xp_eq("image/png", std::string(note.files[0].type));
+	xp_eq(true, note.files[0].isSensitive);
+	xp_eq("LEHV6n", std::string(note.files[0].blurhash));
+	xp_eq("", std::string(note.files[0].thumbnailUrl));
+	xp_eq(640, note.files[0].width);
+	xp_eq(480, note.files[0].height);
+
+	xp_eq(true, note.has_poll);
+	xp_eq(2, note.choices.size());
+	xp_eq("c1", std::string(note.choices[0].text));
+	xp_eq(2, note.choices[0].votes);
+	xp_eq(true, note.choices[0].isVoted);
+	xp_eq(0, note.choices[1].votes);
+	xp_eq(false, note.choices[1].isVoted);
+
+	xp_eq(3, note.renoteCount);
+	xp_eq(12, note.reactionCount);
+
+	// RN 先の RN 先は見ない
+	xp_eq(true, note.renote != NULL);
+	if (note.renote) {
+		xp_eq("9a", std::string(note.renote->id));
+		xp_eq("orig", std::string(note.renote->text));
+		xp_eq("seven", std::string(note.renote->user.username));
+		xp_eq(1, note.renote->renoteCount);
+		xp_eq(true, note.renote->renote == NULL);
+	}
+
+	// 使い回しても前回の値が残らないこと
+	r = parser.Parse(R"({"id":"9c"})");
+	xp_eq((int)NoteParser::Result::Note, (int)r);
+	xp_eq("id=|9c| createdAt=|| text=|| cw=|| rn=0 react=0",
+		dump(parser.GetNote()));
+}
+
+// Parse() と FromJson() が同じ Note を作ること
+static void
+test_NoteParser_FromJson()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::string> table = {
+		R"({"id":"1","text":"hello","cw":"spoiler","tags":["a","b"]})",
+		R"({"id":"2","user":{"id":"u","name":"名","username":"n",)"
+		R"("host":null,"instance":{"name":null}},"user":{"username":"m"}})",
+		R"({"id":"3","files":[{"type":"image/jpeg","thumbnailUrl":"u",)"
+		R"("properties":{"width":1}},null,{"isSensitive":false}]})",
+		R"({"id":"4","poll":{"choices":[{"text":"a","votes":1},"b"]}})",
+		R"({"id":"5","poll":{"choices":null},"renoteCount":null,)"
+		R"("reactions":{"a":1,"b":2.9,"c":"3"}})",
+		R"({"id":"6","text":null,"renote":{"id":"5","text":"x",)"
+		R"("files":[{"type":"a"}],"user":{"username":"r"}}})",
+		R"({"id":"7","renote":null,"tags":"x","files":{},"user":[]})",
+		R"({"id":"8","text":"🍣\t\u0001","createdAt":1})",
+	};
+	for (const auto& input : table) {
+		NoteParser sax;
+		auto r = sax.Parse(input);
+		xp_eq((int)NoteParser::Result::Note, (int)r, input);
+
+		NoteParser dom;
+		Json json = Json::parse(input);
+		xp_eq(dump(dom.FromJson(json)), dump(sax.GetNote()), input);
+	}
+}
+
+void
+test_Note()
+{
+	test_NoteParser_Result();
+	test_NoteParser_Parse();
+	test_NoteParser_FromJson();
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "NoteHistory.h"
+#include "StringUtil.h"
+
+static void
+test_NoteHistory_record()
+{
+	printf("%s\n", __func__);
+
+	NoteHistory h;
+	h.SetCapacity(2);
+
+	// 記録中でなければ何も追加されない
+	xp_eq(false, h.IsRecording());
+	h.AddRaw("a");
+	h.AddText(0, UString("b"));
+	xp_eq(0, h.GetCount());
+
+	int called = 0;
+	h.Begin();
+	xp_eq(true, h.IsRecording());
+	h.AddText(1, UString("abc"));
+	h.AddRaw("\n");
+	h.AddRaw("\r");			// 連結される
+	h.AddDraw(0, [&called]() { called++; });
+	h.SetPaused(true);
+	h.AddRaw("x");			// 一時停止中は無視
+	xp_eq(false, h.IsRecording());
+	h.SetPaused(false);
+	h.AddRaw("");			// 空文字列は無視
+	h.End();
+	xp_eq(false, h.IsRecording());
+	xp_eq(1, h.GetCount());
+
+	const auto& note = h.GetNotes().front();
+	xp_eq(3, note.size());
+	if (note.size() == 3) {
+		xp_eq(NoteHistory::Item::Text, note[0].type);
+		xp_eq(1, note[0].depth);
+		xp_eq("abc", note[0].text.ToString());
+		xp_eq(NoteHistory::Item::Raw, note[1].type);
+		xp_eq("\n\r", note[1].raw);
+		xp_eq(NoteHistory::Item::Draw, note[2].type);
+		note[2].draw();
+		xp_eq(1, called);
+	}
+
+	// 空のノートは残らない
+	h.Begin();
+	h.End();
+	xp_eq(1, h.GetCount());
+}
+
+static void
+test_NoteHistory_capacity()
+{
+	printf("%s\n", __func__);
+
+	NoteHistory h;
+	h.SetCapacity(2);
+
+	for (int i = 0; i < 3; i++) {
+		h.Begin();
+		h.AddRaw(string_format("%d", i));
+		h.End();
+	}
+	// 古いものから消える
+	xp_eq(2, h.GetCount());
+	xp_eq("1", h.GetNotes()[0][0].raw);
+	xp_eq("2", h.GetNotes()[1][0].raw);
+
+	h.SetCapacity(1);
+	xp_eq(1, h.GetCount());
+	xp_eq("2", h.GetNotes()[0][0].raw);
+
+	// 0 なら記録しない
+	h.SetCapacity(0);
+	xp_eq(0, h.GetCount());
+	h.Begin();
+	xp_eq(false, h.IsRecording());
+	h.AddRaw("a");
+	h.End();
+	xp_eq(0, h.GetCount());
+}
+
+void
+test_NoteHistory()
+{
+	test_NoteHistory_record();
+	test_NoteHistory_capacity();
+}
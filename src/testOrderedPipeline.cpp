@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "OrderedPipeline.h"
+#include "StringUtil.h"
+#include <unistd.h>
+
+struct PipelineItem
+{
+	int seq;
+	int value;
+};
+
+// 処理時間がばらばらでも読み込んだ順に出力されること。
+static void
+test_OrderedPipeline_order()
+{
+	printf("%s\n", __func__);
+
+	for (int nworkers : { 1, 2, 4 }) {
+		OrderedPipeline<PipelineItem> pipe(nworkers, 8);
+		const int N = 200;
+		int nread = 0;
+		std::vector<int> out;
+		int maxinflight = 0;
+		auto msg = string_format("nworkers=%d", nworkers);
+
+		auto reader = [&](PipelineItem& item) {
+			if (nread >= N) {
+				return false;
+			}
+			item.seq = nread++;
+			item.value = 0;
+			return true;
+		};
+		auto worker = [&](PipelineItem& item) {
+			// 後のほうが先に終わることがあるように揺らす。
+			if (item.seq % 7 == 0) {
+				usleep(200);
+			}
+			item.value = item.seq * 2;
+		};
+		auto emitter = [&](PipelineItem& item) {
+			out.push_back(item.value);
+			maxinflight = std::max(maxinflight, nread - (int)out.size() + 1);
+			return true;
+		};
+		bool r = pipe.Run(reader, worker, emitter);
+
+		xp_eq(true, r, msg);
+		xp_eq(N, (int)pipe.GetCount(), msg);
+		xp_eq(N, (int)out.size(), msg);
+		bool inorder = true;
+		for (int i = 0; i < (int)out.size(); i++) {
+			if (out[i] != i * 2) {
+				inorder = false;
+			}
+		}
+		xp_eq(true, inorder, msg);
+		// 読み込んでから出力し終わるまでは window 個まで。
+		xp_eq(true, maxinflight <= pipe.GetWindow(), msg);
+	}
+}
+
+// 入力が空でも戻ってくること。
+static void
+test_OrderedPipeline_empty()
+{
+	printf("%s\n", __func__);
+
+	OrderedPipeline<PipelineItem> pipe(3, 4);
+	int nwork = 0;
+	int nemit = 0;
+	bool r = pipe.Run(
+		[](PipelineItem&) { return false; },
+		[&](PipelineItem&) { nwork++; },
+		[&](PipelineItem&) { nemit++; return true; });
+	xp_eq(true, r);
+	xp_eq(0, nwork);
+	xp_eq(0, nemit);
+	xp_eq(0, (int)pipe.GetCount());
+}
+
+// 出力側が false を返したらそこで打ち切ること。
+static void
+test_OrderedPipeline_abort()
+{
+	printf("%s\n", __func__);
+
+	OrderedPipeline<PipelineItem> pipe(2, 4);
+	int nread = 0;
+	int nemit = 0;
+	bool r = pipe.Run(
+		[&](PipelineItem& item) {
+			// 打ち切られなければずっと続く。
+			item.seq = nread++;
+			return true;
+		},
+		[](PipelineItem& item) { item.value = item.seq; },
+		[&](PipelineItem& item) {
+			nemit++;
+			return (item.value < 9);
+		});
+	xp_eq(false, r);
+	xp_eq(10, nemit);
+	xp_eq(10, (int)pipe.GetCount());
+	// 読み込みは出力より window 個までしか先行しない。
+	xp_eq(true, nread <= 10 + pipe.GetWindow());
+}
+
+void
+test_OrderedPipeline()
+{
+	test_OrderedPipeline_order();
+	test_OrderedPipeline_empty();
+	test_OrderedPipeline_abort();
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "RenderBuffer.h"
+
+// rb を End() して書き出された内容を返す。
+static std::string
+flush(RenderBuffer& rb, volatile sig_atomic_t *sixelflag = NULL)
+{
+	int fds[2];
+	if (pipe(fds) < 0) {
+		return "(pipe failed)";
+	}
+	// テストの内容はパイプのバッファに収まる大きさにしておくこと。
+	rb.End(fds[1], sixelflag);
+	close(fds[1]);
+
+	std::string res;
+	char buf[1024];
+	ssize_t n;
+	while ((n = read(fds[0], buf, sizeof(buf))) > 0) {
+		res.append(buf, n);
+	}
+	close(fds[0]);
+	return res;
+}
+
+static void
+test_RenderBuffer_basic()
+{
+	printf("%s\n", __func__);
+
+	RenderBuffer rb;
+	xp_eq(false, rb.IsActive());
+
+	rb.Begin(false);
+	xp_eq(true, rb.IsActive());
+	rb.Append("abc");
+	rb.Printf("[%d]", 12);
+	rb.AppendSixel("\x1bPq#0!10~\x1b\\", 11);
+	rb.Append(std::string("\n"));
+	xp_eq("abc[12]\x1bPq#0!10~\x1b\\\n", flush(rb));
+	xp_eq(false, rb.IsActive());
+	xp_eq(19, rb.GetBytes());
+	xp_eq(1, rb.GetWrites());
+
+	// 長い書式
+	std::string longstr(1000, 'x');
+	rb.Begin(false);
+	rb.Printf("<%s>", longstr.c_str());
+	xp_eq("<" + longstr + ">", flush(rb));
+
+	// 何も溜めてなければ何も書かない
+	rb.Begin(false);
+	xp_eq("", flush(rb));
+	xp_eq(0, rb.GetWrites());
+}
+
+// 同期出力モードで囲む
+static void
+test_RenderBuffer_sync()
+{
+	printf("%s\n", __func__);
+
+	RenderBuffer rb;
+	rb.Begin(true);
+	rb.Append("abc");
+	auto exp = std::string(RenderBuffer::SyncBegin) + "abc" +
+		RenderBuffer::SyncEnd;
+	xp_eq(exp, flush(rb));
+	xp_eq(exp.size(), rb.GetBytes());
+	xp_eq(1, rb.GetWrites());
+
+	// 次は囲まない
+	rb.Begin(false);
+	rb.Append("def");
+	xp_eq("def", flush(rb));
+}
+
+// 書き出し中のフラグ
+static void
+test_RenderBuffer_sixelflag()
+{
+	printf("%s\n", __func__);
+
+	RenderBuffer rb;
+	volatile sig_atomic_t flag = true;
+
+	// SIXEL がなければ触らない
+	rb.Begin(false);
+	rb.Append("abc");
+	flush(rb, &flag);
+	xp_eq(true, (bool)flag);
+
+	// SIXEL があれば書き出し後に下ろす
+	rb.Begin(false);
+	rb.AppendSixel("abc", 3);
+	flush(rb, &flag);
+	xp_eq(false, (bool)flag);
+
+	// 文字の部分ではフラグを下ろしておくため、境界で書き出しを分ける
+	rb.Begin(false);
+	rb.Append("abc");
+	rb.AppendSixel("def", 3);
+	rb.AppendSixel("ghi", 3);
+	rb.Append("jkl");
+	xp_eq("abcdefghijkl", flush(rb, &flag));
+	xp_eq(3, rb.GetWrites());
+	xp_eq(false, (bool)flag);
+
+	// 書けなければ false を返す
+	rb.Begin(false);
+	rb.AppendSixel("abc", 3);
+	xp_eq(false, rb.End(-1, &flag));
+	xp_eq(false, (bool)flag);
+}
+
+// 途中で書き出しても溜め続ける
+static void
+test_RenderBuffer_flush()
+{
+	printf("%s\n", __func__);
+
+	int fds[2];
+	if (pipe(fds) < 0) {
+		xp_fail("pipe failed");
+		return;
+	}
+
+	RenderBuffer rb;
+	rb.Begin(true);
+	rb.Append("abc");
+	xp_eq(true, rb.Flush(fds[1]));
+	xp_eq(true, rb.IsActive());
+	rb.Append("def");
+	xp_eq(true, rb.End(fds[1]));
+	close(fds[1]);
+
+	std::string res;
+	char buf[1024];
+	ssize_t n;
+	while ((n = read(fds[0], buf, sizeof(buf))) > 0) {
+		res.append(buf, n);
+	}
+	close(fds[0]);
+
+	// 同期出力モードの開始と終了はそれぞれ1回だけ
+	auto exp = std::string(RenderBuffer::SyncBegin) + "abcdef" +
+		RenderBuffer::SyncEnd;
+	xp_eq(exp, res);
+	xp_eq(exp.size(), rb.GetBytes());
+	xp_eq(2, rb.GetWrites());
+}
+
+void
+test_RenderBuffer()
+{
+	test_RenderBuffer_basic();
+	test_RenderBuffer_sync();
+	test_RenderBuffer_sixelflag();
+	test_RenderBuffer_flush();
+}
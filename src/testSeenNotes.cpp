@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "SeenNotes.h"
+#include "StringUtil.h"
+
+static void
+test_SeenNotes_basic()
+{
+	printf("%s\n", __func__);
+
+	SeenNotes seen(4);
+	xp_eq(4, seen.GetCapacity());
+	xp_eq(0, seen.GetCount());
+	xp_eq(false, seen.Contains("9a"));
+
+	xp_eq(false, seen.CheckAndAdd("9a"));
+	xp_eq(true, seen.CheckAndAdd("9a"));
+	xp_eq(true, seen.Contains("9a"));
+	xp_eq(false, seen.Contains("9b"));
+	xp_eq(1, seen.GetCount());
+
+	// 一杯になったら古いほうから忘れる
+	seen.Add("9b");
+	seen.Add("9c");
+	seen.Add("9d");
+	xp_eq(4, seen.GetCount());
+	xp_eq(true, seen.Contains("9a"));
+	seen.Add("9e");
+	xp_eq(4, seen.GetCount());
+	xp_eq(false, seen.Contains("9a"));
+	xp_eq(true, seen.Contains("9b"));
+	xp_eq(true, seen.Contains("9e"));
+
+	seen.Clear();
+	xp_eq(0, seen.GetCount());
+	xp_eq(false, seen.Contains("9e"));
+}
+
+// 覚えている範囲は必ず見つかり、忘れたものは見つからないこと。
+// (ブルームフィルタの偽陽性はリングバッファで弾かれる)
+static void
+test_SeenNotes_window()
+{
+	printf("%s\n", __func__);
+
+	const int CAP = 100;
+	SeenNotes seen(CAP);
+	int n = 10000;
+	for (int i = 0; i < n; i++) {
+		seen.Add(string_format("note%d", i));
+	}
+	int found = 0;
+	for (int i = 0; i < n; i++) {
+		bool exp = (i >= n - CAP);
+		bool act = seen.Contains(string_format("note%d", i));
+		if (exp != act) {
+			xp_eq(exp, act, string_format("note%d", i));
+		}
+		found += act;
+	}
+	xp_eq(CAP, found);
+}
+
+void
+test_SeenNotes()
+{
+	test_SeenNotes_basic();
+	test_SeenNotes_window();
+}
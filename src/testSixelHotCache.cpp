@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "SixelHotCache.h"
+
+static void
+store(SixelHotCache& cache, const std::string& key, size_t len)
+{
+	std::vector<uint8> data(len, (uint8)key[0]);
+	cache.Store(key, data.data(), data.size(), (int)len, 1);
+}
+
+static void
+test_SixelHotCache_basic()
+{
+	printf("%s\n", __func__);
+
+	SixelHotCache cache;
+	cache.SetBudget(1000);
+
+	xp_eq(true, cache.Lookup("a") == NULL);
+	store(cache, "a", 100);
+	store(cache, "b", 200);
+	xp_eq(2, cache.GetCount());
+	xp_eq(300, cache.GetBytes());
+
+	const auto *e = cache.Lookup("b");
+	xp_eq(true, e != NULL);
+	if (e) {
+		xp_eq(200, e->data.size());
+		xp_eq('b', e->data[0]);
+		xp_eq(200, e->width);
+		xp_eq(1, e->height);
+	}
+	xp_eq(1, cache.GetHit());
+	xp_eq(1, cache.GetMiss());
+
+	// 置き換え
+	store(cache, "a", 50);
+	xp_eq(2, cache.GetCount());
+	xp_eq(250, cache.GetBytes());
+
+	// budget の 1/4 を超えるものは保持しない (古いのは消える)
+	store(cache, "a", 251);
+	xp_eq(1, cache.GetCount());
+	xp_eq(true, cache.Lookup("a") == NULL);
+}
+
+static void
+test_SixelHotCache_evict()
+{
+	printf("%s\n", __func__);
+
+	SixelHotCache cache;
+	cache.SetBudget(1000);
+
+	store(cache, "a", 250);
+	store(cache, "b", 250);
+	store(cache, "c", 250);
+	store(cache, "d", 250);
+	xp_eq(1000, cache.GetBytes());
+
+	// a を参照したので次に追い出されるのは b
+	cache.Lookup("a");
+	store(cache, "e", 10);
+	xp_eq(4, cache.GetCount());
+	xp_eq(1, cache.GetEvict());
+	xp_eq(true, cache.Lookup("b") == NULL);
+	xp_eq(true, cache.Lookup("a") != NULL);
+
+	// 上限を下げると古いほうから追い出す
+	cache.SetBudget(300);
+	xp_eq(true, cache.GetBytes() <= 300);
+	xp_eq(true, cache.Lookup("a") != NULL);
+	xp_eq(true, cache.Lookup("c") == NULL);
+
+	// 0 なら何も保持しない
+	cache.SetBudget(0);
+	xp_eq(0, cache.GetCount());
+	store(cache, "f", 1);
+	xp_eq(0, cache.GetCount());
+}
+
+void
+test_SixelHotCache()
+{
+	test_SixelHotCache_basic();
+	test_SixelHotCache_evict();
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "StageStat.h"
+
+static void
+test_StageStat_add()
+{
+	printf("%s\n", __func__);
+
+	StageStat::Clear();
+	StageStat::Add(Stage::Parse, 100);
+	StageStat::Add(Stage::Parse, 20);
+	StageStat::Add(Stage::Output, 5);
+	xp_eq(120, StageStat::GetNsec(Stage::Parse));
+	xp_eq(2, StageStat::GetCount(Stage::Parse));
+	xp_eq(5, StageStat::GetNsec(Stage::Output));
+	xp_eq(1, StageStat::GetCount(Stage::Output));
+	xp_eq(0, StageStat::GetCount(Stage::Format));
+
+	StageStat::Clear();
+	xp_eq(0, StageStat::GetNsec(Stage::Parse));
+	xp_eq(0, StageStat::GetCount(Stage::Output));
+}
+
+static void
+test_StageStat_timer()
+{
+	printf("%s\n", __func__);
+
+	// 無効なら数えない。
+	StageStat::Clear();
+	StageStat::Enable(false);
+	{
+		StageTimer timer(Stage::Decode);
+	}
+	xp_eq(0, StageStat::GetCount(Stage::Decode));
+
+	// 有効なら1回数える。
+	StageStat::Enable(true);
+	{
+		StageTimer timer(Stage::Decode);
+	}
+	StageStat::Enable(false);
+	xp_eq(1, StageStat::GetCount(Stage::Decode));
+	xp_eq(0, StageStat::GetCount(Stage::Encode));
+
+	StageStat::Clear();
+}
+
+static void
+test_StageStat_BucketOf()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::pair<uint64, int>> table = {
+		{ 0,			0 },
+		{ 1,			1 },
+		{ 2,			2 },
+		{ 3,			2 },
+		{ 4,			3 },
+		{ 1023,			10 },
+		{ 1024,			11 },
+		{ 0xffffffffULL,	31 },	// 以降は最後のバケット
+		{ 0x100000000ULL,	31 },
+	};
+	for (const auto& a : table) {
+		uint64 usec = a.first;
+		int exp = a.second;
+		xp_eq(exp, StageStat::BucketOf(usec), std::to_string(usec));
+	}
+}
+
+static void
+test_StageStat_histogram()
+{
+	printf("%s\n", __func__);
+
+	// 100usec を 90回、5msec を 9回、40msec を 1回。
+	StageStat::Clear();
+	for (int i = 0; i < 90; i++) {
+		StageStat::Add(Stage::Decode, 100 * 1000);
+	}
+	for (int i = 0; i < 9; i++) {
+		StageStat::Add(Stage::Decode, 5000 * 1000);
+	}
+	StageStat::Add(Stage::Decode, 40000 * 1000);
+
+	xp_eq(100, StageStat::GetCount(Stage::Decode));
+	xp_eq(40000 * 1000, StageStat::GetMax(Stage::Decode));
+	xp_eq(90, StageStat::GetBucket(Stage::Decode, 7));		// [64, 128)
+	xp_eq(9, StageStat::GetBucket(Stage::Decode, 13));	// [4096, 8192)
+	xp_eq(1, StageStat::GetBucket(Stage::Decode, 16));	// [32768, 65536)
+
+	xp_eq(128, StageStat::GetPercentile(Stage::Decode, 0.50));
+	xp_eq(128, StageStat::GetPercentile(Stage::Decode, 0.90));
+	xp_eq(8192, StageStat::GetPercentile(Stage::Decode, 0.99));
+	xp_eq(65536, StageStat::GetPercentile(Stage::Decode, 1.0));
+	xp_eq(0, StageStat::GetPercentile(Stage::Encode, 0.50));
+
+	StageStat::Clear();
+	xp_eq(0, StageStat::GetMax(Stage::Decode));
+	xp_eq(0, StageStat::GetBucket(Stage::Decode, 7));
+}
+
+static void
+test_StageStat_counter()
+{
+	printf("%s\n", __func__);
+
+	StageStat::Clear();
+	StageStat::Count(Counter::HotHit);
+	StageStat::Count(Counter::HotHit);
+	StageStat::Count(Counter::BytesIn, 1000);
+	xp_eq(2, StageStat::GetCounter(Counter::HotHit));
+	xp_eq(0, StageStat::GetCounter(Counter::HotMiss));
+	xp_eq(1000, StageStat::GetCounter(Counter::BytesIn));
+
+	StageStat::SetQueueDepth(3);
+	StageStat::SetQueueDepth(5);
+	StageStat::SetQueueDepth(2);
+	xp_eq(2, StageStat::GetQueueDepth());
+	xp_eq(5, StageStat::GetQueueDepthMax());
+
+	StageStat::Clear();
+	xp_eq(0, StageStat::GetCounter(Counter::HotHit));
+	xp_eq(0, StageStat::GetQueueDepthMax());
+}
+
+static void
+test_StageStat_GetName()
+{
+	printf("%s\n", __func__);
+
+	xp_eq("parse", StageStat::GetName(Stage::Parse));
+	xp_eq("output", StageStat::GetName(Stage::Output));
+	xp_eq("note", StageStat::GetName(Stage::Note));
+	xp_eq("?", StageStat::GetName(Stage::Max));
+
+	xp_eq("hot_hit", StageStat::GetName(Counter::HotHit));
+	xp_eq("kitty_miss", StageStat::GetName(Counter::KittyMiss));
+	xp_eq("reconnect", StageStat::GetName(Counter::Reconnect));
+	xp_eq("?", StageStat::GetName(Counter::Max));
+}
+
+void
+test_StageStat()
+{
+	test_StageStat_add();
+	test_StageStat_timer();
+	test_StageStat_BucketOf();
+	test_StageStat_histogram();
+	test_StageStat_counter();
+	test_StageStat_GetName();
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2024 Tetsuya Isaki
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "test.h"
+#include "Tracer.h"
+#include <thread>
+
+// Tracer::Write() の出力を文字列で返す。*countp には書き出したイベント数。
+static std::string
+write_trace(size_t *countp)
+{
+	std::string str;
+
+	FILE *fp = tmpfile();
+	if (fp == NULL) {
+		xp_fail("tmpfile failed");
+		return str;
+	}
+	*countp = Tracer::Write(fp);
+	rewind(fp);
+	char buf[1024];
+	size_t n;
+	while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+		str.append(buf, n);
+	}
+	fclose(fp);
+	return str;
+}
+
+static void
+test_Tracer_scope()
+{
+	printf("%s\n", __func__);
+	size_t count;
+	std::string out;
+
+	// 無効なら記録しない。
+	Tracer::Enable(false);
+	Tracer::Clear();
+	{
+		TraceScope trace("a");
+	}
+	out = write_trace(&count);
+	xp_eq(0, count);
+	xp_eq(true, out.find("\"traceEvents\":[") != std::string::npos);
+
+	// 有効なら記録する。
+	Tracer::Enable(true);
+	{
+		TraceScope trace("a");
+	}
+	uint64 now = Tracer::Now();
+	Tracer::Complete("b", now, now + 1500);
+	out = write_trace(&count);
+	xp_eq(2, count);
+	xp_eq(true, out.find("{\"name\":\"a\",\"ph\":\"X\",") != std::string::npos);
+	xp_eq(true, out.find("\"dur\":1.500,") != std::string::npos);
+
+	// 別スレッドは別の tid になる。
+	std::thread th([]() {
+		TraceScope trace("c");
+	});
+	th.join();
+	out = write_trace(&count);
+	xp_eq(3, count);
+	auto pos_a = out.find("{\"name\":\"a\"");
+	auto pos_c = out.find("{\"name\":\"c\"");
+	auto tid_a = out.substr(out.find("\"tid\":", pos_a), 8);
+	auto tid_c = out.substr(out.find("\"tid\":", pos_c), 8);
+	xp_eq(true, tid_a != tid_c, tid_a + " vs " + tid_c);
+
+	Tracer::Enable(false);
+	Tracer::Clear();
+}
+
+static void
+test_Tracer_wrap()
+{
+	printf("%s\n", __func__);
+	size_t count;
+
+	// いっぱいになったら古いものから上書きする。
+	Tracer::Enable(true);
+	Tracer::Clear();
+	uint64 now = Tracer::Now();
+	for (size_t i = 0; i < Tracer::Capacity + 10; i++) {
+		Tracer::Complete((i < 10 ? "old" : "new"), now, now);
+	}
+	auto out = write_trace(&count);
+	xp_eq(Tracer::Capacity, count);
+	xp_eq(true, out.find("\"old\"") == std::string::npos);
+
+	Tracer::Enable(false);
+	Tracer::Clear();
+}
+
+void
+test_Tracer()
+{
+	test_Tracer_scope();
+	test_Tracer_wrap();
+}
@@ -31,6 +31,7 @@
 class TestUString : public UString
 {
  public:
+	static void ResetJIS() { jis_state = 0; }
 #if defined(HAVE_ICONV)
 	static iconv_t *GetHandle() { return &cd; }
 #endif
@@ -72,14 +73,13 @@ quote(const std::string& s)
 // test_Init() 以外にも後でポカ避けにも使う
 static std::map<std::string, bool> table_Init = {
 	// encoding		expected
+	{ "",				true },		// UTF-8 へは変換可能
+	{ "euc-jp",			true },		// 内蔵テーブル
+	{ "iso-2022-jp",	true },		// 内蔵テーブル
 #if defined(HAVE_ICONV)
-	{ "",				true },
-	{ "euc-jp",			true },
-	{ "iso-2022-jp",	true },
+	{ "shift_jis",		true },		// iconv
 #else
-	{ "",				true },		// UTF-8 へは変換可能
-	{ "euc-jp",			false },
-	{ "iso-2022-jp",	false },
+	{ "shift_jis",		false },	// iconv がなければ変換できない
 #endif
 };
 
@@ -148,7 +148,6 @@ test_ToString()
 		// UTF-32 -> UTF-8 の不正シーケンスいる?
 
 		// --- euc-jp への変換 ---
-#if defined(HAVE_ICONV)
 		// 亜
 		{ { 0x4e9c },					"euc-jp,\xb0\xa1" },
 
@@ -163,15 +162,12 @@ test_ToString()
 
 		// 'LOUDLY CRYING FACE' のみ
 		{ { 0x1f62d },					"euc-jp,\xa2\xae" },
-#else
-		// iconv サポートがない時にこの変換は起きないはずなのでこれでいい
-		// (e4 ba 9c は U+4e9c の UTF-8 表現)
-		{ { 0x4e9c },					"euc-jp,\xe4\xba\x9c" },
-#endif
+
+		// 丂 (JIS X 0212)、半角ｱ (JIS X 0201)、¥ (YEN SIGN)
+		{ { 0x4e02, 0xff71, 0xa5 },		"euc-jp,\x8f\xb0\xa1\x8e\xb1\x5c" },
 
 		// --- jis への変換 ---
 		// 日本語で終わる文字列ではASCIIに戻すエスケープは出力されないっぽい。
-#if defined(HAVE_ICONV)
 		// 亜
 		{ { 0x4e9c },					"iso-2022-jp,\x1b$B0!" },
 
@@ -189,10 +185,22 @@ test_ToString()
 
 		// 'LOUDLY CRYING FACE' のみ
 		{ { 0x1f62d },					"iso-2022-jp,\x1b$B\"." },
+
+		// ¥ (YEN SIGN) 亜 ‾ (OVERLINE)
+		{ { 0xa5, 0x4e9c, 0x203e },
+			"iso-2022-jp,\x1b(J\\\x1b$B0!\x1b(J~" },
+
+		// 丂 (JIS X 0212) は変換できない
+		{ { 0x4e02 },					"iso-2022-jp,\x1b$B\"." },
+
+		// --- iconv での変換 ---
+#if defined(HAVE_ICONV)
+		// 亜A
+		{ { 0x4e9c, 0x41 },				"shift_jis,\x88\x9f" "A" },
 #else
 		// iconv サポートがない時にこの変換は起きないはずなのでこれでいい
 		// (e4 ba 9c は U+4e9c の UTF-8 表現)
-		{ { 0x4e9c },					"iso-2022-jp,\xe4\xba\x9c" },
+		{ { 0x4e9c, 0x41 },				"shift_jis,\xe4\xba\x9c" "A" },
 #endif
 	};
 
@@ -210,6 +218,13 @@ test_ToString()
 
 		test_iconv_close();
 	}
+
+	// 途中に '\0' があっても切れないこと。
+	UString::Init("");
+	UString nul { 0x41, 0x00, 0x4e9c };
+	auto actual = nul.ToString();
+	xp_eq(std::string("A\0\xe4\xba\x9c", 5), actual);
+	test_iconv_close();
 }
 
 static void
@@ -224,11 +239,7 @@ test_IsUCharConvertible()
 
 	for (const auto& a : table) {
 		const auto uni = a.first;
-#if defined(HAVE_ICONV)
 		const auto exp = a.second;
-#else
-		const auto exp = false;
-#endif
 		auto where = string_format("U+%04x", uni);
 
 		// 変換先が euc-jp の場合
@@ -251,10 +262,115 @@ test_IsUCharConvertible()
 	}
 }
 
+#if defined(HAVE_ICONV)
+// UTF-8 文字列 src を iconv で変換する。cd の状態はそのまま引き継ぐ。
+// 変換できない文字は UString と同じくゲタにする。
+static std::string
+iconv_str(iconv_t cd, const std::string& src)
+{
+	std::string dst;
+	const char *s = src.data();
+	size_t slen = src.size();
+
+	while (slen > 0) {
+		char buf[64];
+		char *d = buf;
+		size_t dlen = sizeof(buf);
+		size_t r = ICONV(cd, &s, &slen, &d, &dlen);
+		dst.append(buf, d - buf);
+		if (r == (size_t)-1) {
+			if (errno == EILSEQ) {
+				auto uclen = UString::UCharFromUTF8(s).second;
+				s += uclen;
+				slen -= uclen;
+				dst += iconv_str(cd, "〓");
+			} else if (errno != E2BIG) {
+				break;
+			}
+		}
+	}
+	return dst;
+}
+
+// 内蔵テーブルでの変換が iconv と一致すること。
+static void
+test_EncodeJIS_iconv()
+{
+	printf("%s\n", __func__);
+
+	for (const std::string enc : { "euc-jp", "iso-2022-jp" }) {
+		iconv_t cd = iconv_open(enc.c_str(), "utf-8");
+		if (cd == (iconv_t)-1) {
+			xp_fail("iconv_open " + enc);
+			continue;
+		}
+		UString::Init(enc);
+		iconv(cd, NULL, NULL, NULL, NULL);
+		auto geta = iconv_str(cd, "〓");
+
+		// 全文字を1文字ずつ、それぞれ初期状態から変換する。
+		int fail = 0;
+		for (unichar uni = 0; uni < 0x110000; uni++) {
+			if (0xd800 <= uni && uni <= 0xdfff) {
+				continue;
+			}
+			auto where = enc + string_format(" U+%04X", uni);
+
+			char src[4];
+			int srclen = UString::UCharToUTF8(src, uni);
+			iconv(cd, NULL, NULL, NULL, NULL);
+			auto exp = iconv_str(cd, std::string(src, srclen));
+			TestUString::ResetJIS();
+			auto act = UString { uni }.ToString();
+			if (exp != act) {
+				if (fail++ < 10) {
+					xp_eq(quote(exp), quote(act), where);
+				}
+			}
+
+			// 変換できるかどうかも一致すること。
+			bool expconv = (uni == 0x3013 || exp != geta);
+			if (expconv != UString::IsUCharConvertible(uni)) {
+				if (fail++ < 10) {
+					xp_eq(expconv, UString::IsUCharConvertible(uni), where);
+				}
+			}
+		}
+		xp_eq(0, fail, enc);
+
+		// 文字集合が切り替わる文字列を続けて変換しても一致すること。
+		// (状態は ToString() をまたいで引き継がれる)
+		std::vector<std::string> table = {
+			"A",
+			"亜",
+			"\x1b[0m",
+			"¥\\",
+			"‾亜\n",
+			"😭B",
+			"ｱ丂",
+			"亜",
+		};
+		iconv(cd, NULL, NULL, NULL, NULL);
+		TestUString::ResetJIS();
+		for (const auto& str : table) {
+			auto exp = iconv_str(cd, str);
+			auto act = UString::FromUTF8(str).ToString();
+			xp_eq(quote(exp), quote(act), enc + " " + str);
+		}
+
+		iconv_close(cd);
+	}
+	UString::Init("");
+}
+#endif
+
 static std::vector<std::pair<unichar, std::vector<uint8>>> table_UCharToUTF8 = {
 	// code		expected_bytes
 	{ 0x0041,	{ 0x41 } },						// 'A'
+	{ 0x0080,	{ 0xc2, 0x80 } },				// 2バイトの最初
 	{ 0x07b0,	{ 0xde, 0xb0 } },				// THAANA SUKUN
+	{ 0x07ff,	{ 0xdf, 0xbf } },				// 2バイトの最後
+	{ 0x0800,	{ 0xe0, 0xa0, 0x80 } },			// 3バイトの最初
 	{ 0xffe5,	{ 0xef, 0xbf, 0xa5 } },			// FULLWIDTH YEN SIGN
 	{ 0x10280,	{ 0xf0, 0x90, 0x8a, 0x80 } },	// LYCIAN LETTER A
 };
@@ -304,6 +420,87 @@ test_UCharToUTF8()
 	}
 }
 
+static void
+test_AppendUTF8()
+{
+	printf("%s\n", __func__);
+
+	UString u { 0x41 };
+	u.AppendUTF8("亜\xf0\x9f\x98\xad");
+	u.AppendUTF8("");
+	u.AppendUTF8("B");
+	xp_eq(4, u.size());
+	if (u.size() == 4) {
+		xp_eq(0x41, u[0]);
+		xp_eq(0x4e9c, u[1]);
+		xp_eq(0x1f62d, u[2]);
+		xp_eq(0x42, u[3]);
+	}
+
+	// ASCII がまとめて処理される長さと、その境界に非 ASCII があるケース。
+	for (int len = 0; len < 70; len++) {
+		std::string src(len, 'a');
+		src += "亜";
+		src += std::string(len % 17, 'b');
+		UString v;
+		v.AppendUTF8(src);
+		auto where = string_format("len=%d", len);
+		int explen = len + 1 + (len % 17);
+		xp_eq(explen, v.size(), where);
+		if (v.size() == explen) {
+			xp_eq(0x4e9c, v[len], where);
+			xp_eq(quote(src), quote(v.ToString()), where);
+		}
+	}
+
+	// 正しくない UTF-8 は UCharFromUTF8() と同じように扱うこと。
+	std::vector<std::string> table = {
+		"\x80" "A",			// 先頭が継続バイト
+		"\xe4\xba" "A",		// 継続バイトが足りない
+		"A\xe4\xba",			// 途中で終わる
+		"\xc0\xaf" "A",		// 冗長な表現
+		"\xed\xa0\x80" "A",	// サロゲート
+		"\xf4\x90\x80\x80" "A",	// 範囲外
+		"\xff" "A",			// 使われないバイト
+	};
+	for (const auto& src : table) {
+		UString exp;
+		for (int i = 0; i < src.size(); ) {
+			auto [ code, len ] = UString::UCharFromUTF8(src.c_str() + i);
+			exp.Append(code);
+			i += len;
+		}
+		UString act;
+		act.AppendUTF8(src);
+		auto where = quote(src);
+		xp_eq(exp.dump(), act.dump(), where);
+	}
+}
+
+// ムーブは中身をコピーせずに移すこと
+static void
+test_Move()
+{
+	printf("%s\n", __func__);
+
+	UString a { 0x41, 0x42, 0x43 };
+	const unichar *p = a.data();
+
+	UString b(std::move(a));
+	xp_eq(true, b.data() == p, "ctor");
+	xp_eq(3, b.size(), "ctor");
+
+	UString c;
+	c = std::move(b);
+	xp_eq(true, c.data() == p, "assign");
+	xp_eq(3, c.size(), "assign");
+
+	// 右辺値の + は左辺に追加したものを返す
+	UString d = std::move(c) + 'D';
+	xp_eq(4, d.size(), "operator+");
+	xp_eq(0x44, d[3], "operator+");
+}
+
 void
 test_UString()
 {
@@ -311,6 +508,11 @@ test_UString()
 	test_FromUTF8();
 	test_ToString();
 	test_IsUCharConvertible();
+#if defined(HAVE_ICONV)
+	test_EncodeJIS_iconv();
+#endif
 	test_UCharFromUTF8();
 	test_UCharToUTF8();
+	test_AppendUTF8();
+	test_Move();
 }
@@ -24,13 +24,18 @@
  */
 
 #include "test.h"
+#include "StringUtil.h"
 #include "eaw_code.h"
 
-void
-test_eaw_code()
+static void
+test_get_eaw_width()
 {
 	printf("%s\n", __func__);
 
+	opt_eaw_a = 2;
+	opt_eaw_n = 1;
+	init_eaw_width();
+
 	// 1バイト内に Full と Half が同居してるところでチェック。
 	// U+FF60 (FULLWIDTH RIGHT WHITE PARENTHESIS) は FullWidth、
 	// U+FF61 (HALFWIDTH IDEOGRAPHIC FULL STOP) は HalfWidth。
@@ -40,20 +45,100 @@ test_eaw_code()
 	// Neutral が変数と連動するかチェック。
 	// U+00A9 (COPYRIGHT SIGN) は Neutral。
 	opt_eaw_n = 1;
+	init_eaw_width();
 	xp_eq(opt_eaw_n, get_eaw_width(0x00a9));
 	opt_eaw_n = 2;
+	init_eaw_width();
 	xp_eq(opt_eaw_n, get_eaw_width(0x00a9));
 
 	// Ambiguous が変数と連動するかチェック。
 	// U+0411 (CYRILLIC CAPITAL LETTER BE) は Ambiguous。
 	opt_eaw_a = 1;
+	init_eaw_width();
 	xp_eq(opt_eaw_a, get_eaw_width(0x0411));
 	opt_eaw_a = 2;
+	init_eaw_width();
 	xp_eq(opt_eaw_a, get_eaw_width(0x0411));
 
 	// U+1F43F (リスの絵文字) は仕様上は何故か Neutral (幅=1) なのだが
 	// それではたぶん困るので回避したい。
 	opt_eaw_n = -1;
+	init_eaw_width();
 	xp_eq(2, get_eaw_width(0x1f43e));	// Paw Prints (猫の足跡) は Wide
 	xp_eq(2, get_eaw_width(0x1f43f));	// Chipmunk (リス)       は Neutral…
+
+	// ASCII と範囲外。
+	xp_eq(1, get_eaw_width('A'));
+	xp_eq(2, get_eaw_width(0x20000));
+	xp_eq(2, get_eaw_width(0x110000));
+
+	opt_eaw_a = 2;
+	opt_eaw_n = 1;
+	init_eaw_width();
+}
+
+static void
+test_GraphemeBreak()
+{
+	printf("%s\n", __func__);
+
+	// 入力と、各文字の前で区切れるかどうか。
+	std::vector<std::pair<std::vector<unichar>, std::string>> table = {
+		// "a" "b"
+		{ { 'a', 'b' },								"11" },
+		// CR LF
+		{ { '\r', '\n', 'a' },						"101" },
+		// e + COMBINING ACUTE ACCENT
+		{ { 'e', 0x0301, 'a' },						"101" },
+		// あ + VS16 (U+FE0F)
+		{ { 0x3042, 0xfe0f, 0x3042 },				"101" },
+		// 👨 ZWJ 👩 ZWJ 👧 (家族)
+		{ { 0x1f468, 0x200d, 0x1f469, 0x200d, 0x1f467, 'a' },
+													"100001" },
+		// 👍 + 肌の色 (EMOJI MODIFIER FITZPATRICK TYPE-4)
+		{ { 0x1f44d, 0x1f3fd },						"10" },
+		// ZWJ の後でも絵文字でなければ区切る
+		{ { 'a', 0x200d, 'b' },						"101" },
+		// 🇯🇵🇺🇸 は2文字ずつ
+		{ { 0x1f1ef, 0x1f1f5, 0x1f1fa, 0x1f1f8, 0x1f1ef },
+													"10101" },
+		// ハングル字母 ᄀ ᅡ ᆨ (L V T) と 가 (LV) + ᆨ (T)
+		{ { 0x1100, 0x1161, 0x11a8, 0xac00, 0x11a8 },	"10010" },
+		// 制御文字の後ろは区切る
+		{ { 0x1b, 0x0301 },							"11" },
+	};
+
+	opt_eaw_a = 2;
+	opt_eaw_n = 1;
+	init_eaw_width();
+
+	for (const auto& a : table) {
+		const auto& input = a.first;
+		const auto& expected = a.second;
+
+		GraphemeBreak gcb;
+		std::string actual;
+		for (const auto c : input) {
+			actual += gcb.Next(get_eaw_props(c)) ? '1' : '0';
+		}
+		std::string where;
+		for (const auto c : input) {
+			where += string_format(" %04x", c);
+		}
+		xp_eq(expected, actual, where);
+	}
+
+	// 国旗の2文字目だけ IsRIPair() が立つこと。
+	GraphemeBreak gcb;
+	gcb.Next(get_eaw_props(0x1f1ef));
+	xp_eq(false, gcb.IsRIPair());
+	gcb.Next(get_eaw_props(0x1f1f5));
+	xp_eq(true, gcb.IsRIPair());
+}
+
+void
+test_eaw_code()
+{
+	test_get_eaw_width();
+	test_GraphemeBreak();
 }
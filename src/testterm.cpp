@@ -25,6 +25,7 @@
 
 #include "test.h"
 #include "term.h"
+#include <tuple>
 
 Diag diag;
 
@@ -55,8 +56,124 @@ test_parse_bgcolor()
 	}
 }
 
+static void
+test_parse_decrpm()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::pair<std::string, int>> table = {
+		{ CSI "?2026;2$y",					2 },
+		{ CSI "?2026;1$y" CSI "?62;4c",		1 },
+		{ CSI "?2026;0$y" CSI "?62;4c",		0 },
+		// 応答がない (DA1 だけ返ってきた)
+		{ CSI "?62;4c",						-1 },
+		// 違うモード
+		{ CSI "?2027;2$y",					-1 },
+		// 壊れている
+		{ CSI "?2026;$y",					-1 },
+		{ CSI "?2026;2",					-1 },
+	};
+	for (const auto& a : table) {
+		const auto& src = a.first;
+		auto expected = a.second;
+
+		auto actual = parse_decrpm(src.c_str(), 2026);
+		xp_eq(expected, actual, termdump(src.c_str()));
+	}
+}
+
+static void
+test_terminal_reply_complete()
+{
+	printf("%s\n", __func__);
+
+	const std::string da1 = ESC "[c";
+	const std::string syncout = CSI "?2026$p" CSI "c";
+	const std::string osc11 = ESC "]11;?" ESC "\\";
+	const std::string kitty =
+		ESC "_Gi=31,s=1,v=1,a=q,t=d,f=24;AAAA" ESC "\\" CSI "c";
+	const std::string iterm2 = ESC "]1337;ReportCellSize" ESC "\\" CSI "c";
+
+	std::vector<std::tuple<std::string, std::string, bool>> table = {
+		// 問い合わせ	応答									期待値
+		{ da1,		CSI "?62;4c",							true },
+		{ da1,		CSI "?62;4",							false },
+		{ da1,		"",										false },
+		{ syncout,	CSI "?2026;2$y" CSI "?62;4c",			true },
+		// DECRPM だけ先に届いた
+		{ syncout,	CSI "?2026;2$y",						false },
+		{ syncout,	CSI "?2026;2$y" CSI "?6",				false },
+		// DECRPM に応答しない端末
+		{ syncout,	CSI "?62;4c",							true },
+		{ kitty,	ESC "_Gi=31;OK" ESC "\\" CSI "?62;4c",		true },
+		// APC だけ先に届いた
+		{ kitty,	ESC "_Gi=31;OK" ESC "\\",				false },
+		{ kitty,	ESC "_Gi=31;EINVAL:Zero width" ESC "\\",	false },
+		{ iterm2,	ESC "]1337;ReportCellSize=17.0;8.0" ESC "\\" CSI "?62;4c", true },
+		// OSC だけ先に届いた
+		{ iterm2,	ESC "]1337;ReportCellSize=17.0;8.0" ESC "\\",	false },
+		{ iterm2,	ESC "]1337;ReportCellSize=17;8",			false },
+		{ osc11,	ESC "]11;rgb:0000/0000/0000" ESC "\\",	true },
+		{ osc11,	ESC "]11;rgb:0000/0000/0000" "\a",		true },
+		{ osc11,	ESC "]11;rgb:0000/00",					false },
+	};
+	for (const auto& a : table) {
+		const auto& query = std::get<0>(a);
+		const auto& src = std::get<1>(a);
+		auto expected = std::get<2>(a);
+
+		auto actual = terminal_reply_complete(query, src.c_str(), src.size());
+		xp_eq(expected, actual, termdump(src.c_str()));
+	}
+}
+
+static void
+test_parse_kitty_response()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::pair<std::string, bool>> table = {
+		{ ESC "_Gi=31;OK" ESC "\\" CSI "?62;4c",				true },
+		// 応答がない (DA1 だけ返ってきた)
+		{ CSI "?62;4c",									false },
+		// エラー
+		{ ESC "_Gi=31;EINVAL:Zero width" ESC "\\" CSI "?62;4c",	false },
+	};
+	for (const auto& a : table) {
+		const auto& src = a.first;
+		auto expected = a.second;
+
+		auto actual = parse_kitty_response(src.c_str());
+		xp_eq(expected, actual, termdump(src.c_str()));
+	}
+}
+
+static void
+test_parse_iterm2_response()
+{
+	printf("%s\n", __func__);
+
+	std::vector<std::pair<std::string, bool>> table = {
+		{ ESC "]1337;ReportCellSize=17.0;8.0;2.0" ESC "\\" CSI "?62;4c",	true },
+		{ ESC "]1337;ReportCellSize=17;8" "\a" CSI "?62;4c",			true },
+		// 応答がない (DA1 だけ返ってきた)
+		{ CSI "?62;4c",											false },
+	};
+	for (const auto& a : table) {
+		const auto& src = a.first;
+		auto expected = a.second;
+
+		auto actual = parse_iterm2_response(src.c_str());
+		xp_eq(expected, actual, termdump(src.c_str()));
+	}
+}
+
 void
 test_term()
 {
 	test_parse_bgcolor();
+	test_parse_decrpm();
+	test_terminal_reply_complete();
+	test_parse_kitty_response();
+	test_parse_iterm2_response();
 }